@@ -0,0 +1,66 @@
+/**
+ * Host benchmark: Reading and writing every signal of every GS, MS and ESP_SBC frame
+ *
+ * Old: The payload reassembled into a big endian uint64_t a byte at a time before reading the signals, and turned
+ * back into bytes a byte at a time (to_bytes()) after writing them, as the firmware used to do.
+ * New: The generated accessors, working on the payload in wire order, copied in and out with memcpy.
+ * (See accessor_cases.h, generated by gen_accessor_cases.py)
+ *
+ * Usage: bench_accessors [iterations]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "accessor_cases.h"
+
+static double time_decode(bool use_new, const uint8_t* payloads, uint32_t iterations, uint64_t* sum) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t n = 0; n < iterations; n++) {
+        for (uint32_t i = 0; i < NUM_FRAME_CODECS; i++) {
+            const FrameCodec* c = &FRAME_CODECS[i];
+            *sum += use_new ? c->new_decode(&payloads[i * 8]) : c->old_decode(&payloads[i * 8]);
+        }
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / ((double)iterations * NUM_FRAME_CODECS);
+}
+
+static double time_encode(bool use_new, uint8_t* payloads, uint32_t iterations) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t n = 0; n < iterations; n++) {
+        for (uint32_t i = 0; i < NUM_FRAME_CODECS; i++) {
+            const FrameCodec* c = &FRAME_CODECS[i];
+            if (use_new) {
+                c->new_encode(n, &payloads[i * 8]);
+            } else {
+                c->old_encode(n, &payloads[i * 8]);
+            }
+        }
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / ((double)iterations * NUM_FRAME_CODECS);
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = argc > 1 ? atoi(argv[1]) : 200000;
+    uint8_t payloads[NUM_FRAME_CODECS * 8];
+    uint8_t check[NUM_FRAME_CODECS * 8];
+    for (uint32_t i = 0; i < sizeof(payloads); i++) {
+        payloads[i] = rand();
+    }
+    uint64_t old_sum = 0;
+    uint64_t new_sum = 0;
+    time_decode(false, payloads, iterations / 10 + 1, &old_sum);
+    time_decode(true, payloads, iterations / 10 + 1, &new_sum);
+    old_sum = 0;
+    new_sum = 0;
+    double old_decode = time_decode(false, payloads, iterations, &old_sum);
+    double new_decode = time_decode(true, payloads, iterations, &new_sum);
+    double old_encode = time_encode(false, check, iterations);
+    double new_encode = time_encode(true, payloads, iterations);
+    printf("%u frames, %u signals, x%u\n", NUM_FRAME_CODECS, NUM_ACCESSOR_CASES, iterations);
+    printf("Read every signal:  old %.2f ns/frame, new %.2f ns/frame (%.2fx)%s\n",
+        old_decode, new_decode, old_decode / new_decode, old_sum == new_sum ? "" : " RESULTS DIFFER");
+    printf("Write every signal: old %.2f ns/frame, new %.2f ns/frame (%.2fx)%s\n",
+        old_encode, new_encode, old_encode / new_encode, memcmp(payloads, check, sizeof(payloads)) == 0 ? "" : " RESULTS DIFFER");
+    return 0;
+}
@@ -0,0 +1,175 @@
+/**
+ * Host benchmark: CAN ID to ECU storage lookup of the Rx task
+ *
+ * Compares the generated dispatch table (ecu_dispatch_lookup(), EGS52_DISPATCH.h) against the chain of
+ * per ECU switch statements it replaced (import_frames() of ECU_MS, ECU_ESP_SBC, ECU_EWM then ECU_ANY_ECU,
+ * with the CAN IDs each of them used to store).
+ *
+ * Both store the frame the same way, so only the lookup differs. The IDs come from a second of EGS52 traffic
+ * at the frames' cycle times, so most of them are frames the TCM does not read (Which the old chain had to
+ * test against every switch before giving up).
+ *
+ * Usage: bench_dispatch [iterations]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+#include "../src/canbus/egs_can_hal.h"
+
+typedef struct {
+    uint32_t can_id;
+    uint16_t cycle_ms;
+} SimFrame;
+
+// Traffic on the bus in the car
+static const SimFrame BUS_FRAMES[] = {
+    { 0x200, 20 }, { 0x208, 10 }, { 0x210, 20 }, { 0x212, 10 }, { 0x230, 20 }, { 0x232, 20 }, { 0x236, 10 },
+    { 0x238, 20 }, { 0x240, 10 }, { 0x248, 20 }, { 0x268, 10 }, { 0x270, 10 }, { 0x2F3, 20 }, { 0x300, 20 },
+    { 0x308, 20 }, { 0x312, 20 }, { 0x328, 20 }, { 0x3B4, 50 }, { 0x408, 20 }, { 0x410, 20 }, { 0x412, 20 },
+    { 0x530, 100 }, { 0x580, 100 }, { 0x608, 100 },
+};
+
+typedef struct {
+    uint64_t data[16];
+    uint64_t times[16];
+} Storage;
+
+static Storage ms;
+static Storage esp;
+static Storage ewm;
+static Storage misc;
+
+// The old import_frames() of each ECU: One switch per ECU, over every frame in its DB (Not just the consumed ones)
+__attribute__((noinline))
+static bool old_ms_import(uint64_t value, uint32_t can_id, uint64_t now) {
+    uint8_t slot;
+    switch (can_id) {
+        case 0x210: slot = 0; break;
+        case 0x212: slot = 1; break;
+        case 0x268: slot = 2; break;
+        case 0x2F3: slot = 3; break;
+        case 0x308: slot = 4; break;
+        case 0x312: slot = 5; break;
+        case 0x580: slot = 6; break;
+        case 0x608: slot = 7; break;
+        default: return false;
+    }
+    ms.times[slot] = now;
+    ms.data[slot] = value;
+    return true;
+}
+
+__attribute__((noinline))
+static bool old_esp_import(uint64_t value, uint32_t can_id, uint64_t now) {
+    uint8_t slot;
+    switch (can_id) {
+        case 0x200: slot = 0; break;
+        case 0x208: slot = 1; break;
+        case 0x270: slot = 2; break;
+        case 0x300: slot = 3; break;
+        case 0x328: slot = 4; break;
+        default: return false;
+    }
+    esp.times[slot] = now;
+    esp.data[slot] = value;
+    return true;
+}
+
+__attribute__((noinline))
+static bool old_ewm_import(uint64_t value, uint32_t can_id, uint64_t now) {
+    if (can_id != 0x230) {
+        return false;
+    }
+    ewm.times[0] = now;
+    ewm.data[0] = value;
+    return true;
+}
+
+__attribute__((noinline))
+static bool old_misc_import(uint64_t value, uint32_t can_id, uint64_t now) {
+    uint8_t slot;
+    switch (can_id) {
+        case 0x035: slot = 0; break;
+        case 0x33D: slot = 1; break;
+        case 0x232: slot = 2; break;
+        case 0x250: slot = 3; break;
+        case 0x258: slot = 4; break;
+        case 0x3B4: slot = 5; break;
+        case 0x3B8: slot = 6; break;
+        case 0x428: slot = 7; break;
+        case 0x530: slot = 8; break;
+        case 0x6FF: slot = 9; break;
+        default: return false;
+    }
+    misc.times[slot] = now;
+    misc.data[slot] = value;
+    return true;
+}
+
+__attribute__((noinline))
+static bool old_dispatch(uint64_t value, uint32_t can_id, uint64_t now) {
+    return old_ms_import(value, can_id, now) ||
+        old_esp_import(value, can_id, now) ||
+        old_ewm_import(value, can_id, now) ||
+        old_misc_import(value, can_id, now);
+}
+
+static inline void store(Storage* s, uint8_t slot, uint64_t value, uint64_t now) {
+    s->times[slot] = now;
+    s->data[slot] = value;
+}
+
+__attribute__((noinline))
+static bool table_dispatch(uint64_t value, uint32_t can_id, uint64_t now) {
+    const EcuDispatchEntry* e = ecu_dispatch_lookup(can_id);
+    if (e == nullptr) {
+        return false;
+    }
+    switch (e->ecu) {
+        case EcuId::MS: store(&ms, e->slot, value, now); return true;
+        case EcuId::ESP_SBC: store(&esp, e->slot, value, now); return true;
+        case EcuId::EWM: store(&ewm, e->slot, value, now); return true;
+        default: store(&misc, e->slot, value, now); return true;
+    }
+}
+
+typedef bool (*DispatchFn)(uint64_t value, uint32_t can_id, uint64_t now);
+
+static double run(DispatchFn fn, const std::vector<uint32_t>& ids, uint32_t iterations, uint32_t* hits) {
+    *hits = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t n = 0; n < iterations; n++) {
+        for (uint32_t i = 0; i < ids.size(); i++) {
+            *hits += fn(i, ids[i], n);
+        }
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return ns / ((double)iterations * ids.size());
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = argc > 1 ? atoi(argv[1]) : 20000;
+    // One second of traffic, in the order it would arrive
+    std::vector<uint32_t> ids;
+    for (uint32_t ms_tick = 0; ms_tick < 1000; ms_tick++) {
+        for (const SimFrame& f : BUS_FRAMES) {
+            if (ms_tick % f.cycle_ms == 0) {
+                ids.push_back(f.can_id);
+            }
+        }
+    }
+    uint32_t old_hits;
+    uint32_t table_hits;
+    // Warm up, then measure
+    run(old_dispatch, ids, iterations / 10 + 1, &old_hits);
+    run(table_dispatch, ids, iterations / 10 + 1, &table_hits);
+    double old_ns = run(old_dispatch, ids, iterations, &old_hits);
+    double table_ns = run(table_dispatch, ids, iterations, &table_hits);
+    printf("%u frames per second of traffic, x%u\n", (uint32_t)ids.size(), iterations);
+    printf("Switch chain (MS, ESP_SBC, EWM, ANY_ECU): %.2f ns/frame, %u stored\n", old_ns, old_hits);
+    printf("Dispatch table: %.2f ns/frame, %u stored (Consumed frames only)\n", table_ns, table_hits);
+    printf("Speedup: %.2fx\n", old_ns / table_ns);
+    return 0;
+}
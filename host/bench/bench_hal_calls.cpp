@@ -0,0 +1,68 @@
+/**
+ * Host benchmark: The CAN HAL setters the gearbox controller calls every tick, through AbstractCan (Virtual
+ * calls, as before the HAL was selected at compile time) and through EgsCanHal (Direct calls, inlined).
+ *
+ * Each way is a noinline function, so its size can be compared too:
+ *   nm -C --size-sort bench_hal_calls | grep tick_
+ *
+ * Usage: bench_hal_calls [iterations]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "../src/canbus/egs_can_hal.h"
+
+static const GearboxGear GEARS[] = { GearboxGear::First, GearboxGear::Second, GearboxGear::Third, GearboxGear::Fourth, GearboxGear::Fifth };
+
+// Same calls the controller makes every tick. Gears only change every few thousand ticks, as in the car
+// (A change queues the frame to go out straight away, which costs far more than the call itself)
+template <typename Hal>
+static inline void tick(Hal* hal, uint32_t n) {
+    hal->set_actual_gear(GEARS[(n >> 12) % 5]);
+    hal->set_target_gear(GEARS[((n >> 12) + 1) % 5]);
+    hal->set_input_shaft_speed(n & 0x1FFF);
+    hal->set_gearbox_temperature(80 + (n & 7));
+    hal->set_safe_start((n & 1) != 0);
+    hal->set_gearbox_ok(true);
+    hal->set_torque_request(TorqueRequest::None);
+    hal->set_requested_torque(0);
+    hal->set_display_gear('D');
+}
+
+__attribute__((noinline))
+static void tick_virtual(AbstractCan* hal, uint32_t n) {
+    tick(hal, n);
+}
+
+__attribute__((noinline))
+static void tick_direct(EgsCanHal* hal, uint32_t n) {
+    tick(hal, n);
+}
+
+int main(int argc, char** argv) {
+    uint32_t iterations = argc > 1 ? atoi(argv[1]) : 10000000;
+    EgsCanHal* hal = new EgsCanHal("EGS52", 20);
+    // Hide the concrete type, as a pointer to AbstractCan set up at runtime would
+    AbstractCan* volatile abstract_hal = hal;
+    AbstractCan* virtual_hal = abstract_hal;
+    for (uint32_t n = 0; n < iterations / 10; n++) {
+        tick_virtual(virtual_hal, n);
+        tick_direct(hal, n);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t n = 0; n < iterations; n++) {
+        tick_virtual(virtual_hal, n);
+    }
+    auto mid = std::chrono::steady_clock::now();
+    for (uint32_t n = 0; n < iterations; n++) {
+        tick_direct(hal, n);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double virtual_ns = std::chrono::duration<double, std::nano>(mid - start).count() / iterations;
+    double direct_ns = std::chrono::duration<double, std::nano>(end - mid).count() / iterations;
+    printf("9 setters per tick, x%u\n", iterations);
+    printf("Through AbstractCan (virtual): %.2f ns/tick\n", virtual_ns);
+    printf("Through EgsCanHal (direct):    %.2f ns/tick (%.2fx)\n", direct_ns, virtual_ns / direct_ns);
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include "can_log.h"
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+CanLogReader::~CanLogReader() {
+    if (this->file != nullptr) {
+        fclose(this->file);
+    }
+}
+
+bool CanLogReader::open(const char* path) {
+    this->file = fopen(path, "r");
+    if (this->file == nullptr) {
+        return false;
+    }
+    size_t len = strlen(path);
+    this->format = (len > 4 && strcasecmp(&path[len-4], ".asc") == 0) ? CanLogFormat::Asc : CanLogFormat::Candump;
+    return true;
+}
+
+static int hex_value(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+// (1612345678.123456) can0 123#11223344
+bool CanLogReader::parse_candump(const char* line, CanLogFrame* dest) {
+    unsigned long long sec;
+    unsigned long usec;
+    char frame[64];
+    if (sscanf(line, " (%llu.%lu) %*s %63s", &sec, &usec, frame) != 3) {
+        return false;
+    }
+    char* hash = strchr(frame, '#');
+    if (hash == nullptr || hash[1] == '#' || hash[1] == 'R') {
+        return false; // CAN FD or remote frame, neither are used by the car
+    }
+    dest->time = sec * 1000000 + usec;
+    dest->extended = (hash - frame) > 3;
+    dest->can_id = strtoul(frame, nullptr, 16);
+    dest->dlc = 0;
+    memset(dest->data, 0x00, 8);
+    for (const char* p = hash+1; hex_value(p[0]) >= 0 && hex_value(p[1]) >= 0 && dest->dlc < 8; p += 2) {
+        dest->data[dest->dlc++] = hex_value(p[0]) << 4 | hex_value(p[1]);
+    }
+    return true;
+}
+
+//    1.234567 1  123             Rx   d 8 11 22 33 44 55 66 77 88
+bool CanLogReader::parse_asc(const char* line, CanLogFrame* dest) {
+    double time;
+    int channel;
+    char id[16];
+    char dir[4];
+    char type;
+    unsigned int dlc;
+    int n;
+    if (sscanf(line, " %lf %d %15s %3s %c %u%n", &time, &channel, id, dir, &type, &dlc, &n) != 6 || type != 'd') {
+        return false;
+    }
+    if (dlc > 8) {
+        dlc = 8;
+    }
+    size_t id_len = strlen(id);
+    dest->extended = id_len > 0 && (id[id_len-1] == 'x' || id[id_len-1] == 'X');
+    dest->can_id = strtoul(id, nullptr, this->asc_hex ? 16 : 10);
+    dest->time = (uint64_t)(time * 1000000.0 + 0.5);
+    dest->dlc = dlc;
+    memset(dest->data, 0x00, 8);
+    const char* p = &line[n];
+    char* end;
+    for (uint8_t i = 0; i < dlc; i++) {
+        dest->data[i] = strtoul(p, &end, this->asc_hex ? 16 : 10);
+        if (end == p) {
+            return false;
+        }
+        p = end;
+    }
+    return true;
+}
+
+bool CanLogReader::next(CanLogFrame* dest) {
+    char line[256];
+    bool ok;
+    while (this->file != nullptr && fgets(line, sizeof(line), this->file) != nullptr) {
+        if (this->format == CanLogFormat::Asc) {
+            if (strncmp(line, "base ", 5) == 0) {
+                this->asc_hex = strncmp(&line[5], "hex", 3) == 0;
+                continue;
+            }
+            if (line[strspn(line, " \t")] < '0' || line[strspn(line, " \t")] > '9') {
+                continue; // Header, or a comment
+            }
+            ok = this->parse_asc(line, dest);
+        } else {
+            if (line[strspn(line, " \t")] != '(') {
+                continue;
+            }
+            ok = this->parse_candump(line, dest);
+        }
+        if (ok) {
+            return true;
+        }
+        // Error frames, ASC events and the like end up here too
+        this->bad_lines++;
+    }
+    return false;
+}
@@ -0,0 +1,47 @@
+/**
+ * Host build: Reads CAN logs (candump -l, or Vector ASC) one frame at a time
+ */
+
+#ifndef __CAN_LOG_H_
+#define __CAN_LOG_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+typedef struct {
+    // Time the frame was logged (us, in the log's own time base)
+    uint64_t time;
+    uint32_t can_id;
+    bool extended;
+    uint8_t dlc;
+    uint8_t data[8];
+} CanLogFrame;
+
+enum class CanLogFormat {
+    Candump,
+    Asc
+};
+
+class CanLogReader {
+    public:
+        ~CanLogReader();
+        // Opens a log. Files ending in .asc are read as Vector ASC, anything else as candump -l
+        bool open(const char* path);
+        // Reads the next CAN frame in the log. Returns false at the end of the file
+        bool next(CanLogFrame* dest);
+        // Lines that looked like frames but could not be read
+        uint32_t get_bad_lines() const {
+            return this->bad_lines;
+        }
+    private:
+        bool parse_candump(const char* line, CanLogFrame* dest);
+        bool parse_asc(const char* line, CanLogFrame* dest);
+
+        FILE* file = nullptr;
+        CanLogFormat format = CanLogFormat::Candump;
+        // ASC files can log IDs in decimal
+        bool asc_hex = true;
+        uint32_t bad_lines = 0;
+};
+
+#endif // __CAN_LOG_H_
@@ -0,0 +1,224 @@
+/**
+ * Host build: CAN log replay
+ *
+ * Feeds a CAN log from a car through the real EGS52 CAN layer and gearbox controller, with
+ * the FreeRTOS tasks running in lockstep with a simulated clock (See shim/host_sim.h), and
+ * writes out every frame the firmware sends (GS_218, GS_338, GS_418...) as a candump log.
+ *
+ * Frames the original TCM sent are not replayed (Our own frames take their place), but
+ * they are used to fill in the sensors we don't have on the bench (See update_sim_inputs()).
+ *
+ * Usage: replay <input .log/.asc> [-o <output.log>] [-v <log level 0-5>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "shim/host_sim.h"
+#include "shim/host_can_bus.h"
+#include "can_log.h"
+#include "sim_io.h"
+#include "../src/canbus/egs_can_hal.h"
+#include "../src/gearbox.h"
+#include "../src/profiles.h"
+
+static CanLogReader reader;
+// Log time that maps to simulated time 0
+static uint64_t log_start = 0;
+static bool log_started = false;
+// Gear the original TCM was in (From GS_418), as N2 reads slow in 1st and 5th
+static GS_418h_GIC log_gear = GS_418h_GIC::G_N;
+
+static FILE* out_file = nullptr;
+static uint64_t rx_frames = 0;
+static uint64_t tx_frames = 0;
+
+// Frames our TCM sends, which will not be on the bus when it is fitted
+static bool is_own_frame(uint32_t can_id) {
+    switch (can_id) {
+        case GS_218_CAN_ID:
+        case GS_338_CAN_ID:
+        case GS_418_CAN_ID:
+        case GS_CUSTOM_558_CAN_ID:
+        case 0x7E9: // Diagnostic responses
+            return true;
+        default:
+            return false;
+    }
+}
+
+static void update_sim_inputs(const CanLogFrame* f) {
+    if (f->extended) {
+        return;
+    }
+    if (f->can_id == GS_338_CAN_ID) {
+        GS_338 gs338 = {};
+        memcpy(gs338.bytes, f->data, f->dlc);
+        uint32_t turbine = gs338.get_NTURBINE() == 0xFFFF ? 0 : gs338.get_NTURBINE();
+        sim_inputs.n3_rpm = turbine;
+        sim_inputs.n2_rpm = (log_gear == GS_418h_GIC::G_D1 || log_gear == GS_418h_GIC::G_D5) ? turbine / 1.64 : turbine;
+    } else if (f->can_id == GS_418_CAN_ID) {
+        GS_418 gs418 = {};
+        memcpy(gs418.bytes, f->data, f->dlc);
+        log_gear = gs418.get_GIC();
+        sim_inputs.atf_temp_valid = gs418.get_T_GET() != 0xFF;
+        sim_inputs.atf_temp = ((int)gs418.get_T_GET() - 50) * 10;
+    } else if (f->can_id == EWM_230_CAN_ID) {
+        EWM_230 ewm230 = {};
+        memcpy(ewm230.bytes, f->data, f->dlc);
+        sim_inputs.parking_lock = ewm230.get_WHC() == EWM_230h_WHC::P || ewm230.get_WHC() == EWM_230h_WHC::N;
+    }
+}
+
+static bool next_rx_frame(twai_message_t* msg, uint64_t* time) {
+    CanLogFrame f;
+    while (reader.next(&f)) {
+        if (!log_started) {
+            log_start = f.time;
+            log_started = true;
+        }
+        update_sim_inputs(&f);
+        if (!f.extended && is_own_frame(f.can_id)) {
+            continue;
+        }
+        *msg = {};
+        msg->extd = f.extended;
+        msg->identifier = f.can_id;
+        msg->data_length_code = f.dlc;
+        memcpy(msg->data, f.data, 8);
+        *time = f.time >= log_start ? f.time - log_start : 0;
+        rx_frames++;
+        return true;
+    }
+    return false;
+}
+
+static void on_tx_frame(const twai_message_t* msg, uint64_t time) {
+    tx_frames++;
+    if (out_file == nullptr) {
+        return;
+    }
+    uint64_t t = log_start + time;
+    fprintf(out_file, "(%llu.%06llu) can0 %03X#", (unsigned long long)(t / 1000000), (unsigned long long)(t % 1000000), msg->identifier);
+    for (uint8_t i = 0; i < msg->data_length_code && i < 8; i++) {
+        fprintf(out_file, "%02X", msg->data[i]);
+    }
+    fputc('\n', out_file);
+}
+
+/**
+ * The log as a bus. Frames arrive at their log time, and every frame sent goes straight to the output.
+ * Nothing is filtered, as the acceptance filter is already tested on the Rx path
+ */
+class ReplayBus : public HostCanBus {
+    public:
+        bool receive(twai_message_t* msg, uint64_t now) override {
+            this->read_ahead();
+            if (!this->pending || this->pending_time > now) {
+                return false;
+            }
+            *msg = this->pending_msg;
+            this->pending = false;
+            return true;
+        }
+
+        uint64_t get_next_rx_time() override {
+            this->read_ahead();
+            return this->pending ? this->pending_time : UINT64_MAX;
+        }
+
+        bool transmit(const twai_message_t* msg, uint64_t now) override {
+            on_tx_frame(msg, now);
+            return true;
+        }
+
+        uint32_t get_tx_queue_len() override {
+            return 0;
+        }
+
+        bool rx_finished(uint64_t* last_frame_time) override {
+            *last_frame_time = this->pending_time;
+            return this->done;
+        }
+    private:
+        // Reads the next frame, so we know when it arrives
+        void read_ahead() {
+            if (!this->pending && !this->done) {
+                this->pending = next_rx_frame(&this->pending_msg, &this->pending_time);
+                this->done = !this->pending;
+            }
+        }
+
+        bool pending = false;
+        bool done = false;
+        twai_message_t pending_msg;
+        uint64_t pending_time = 0;
+};
+
+int main(int argc, char** argv) {
+    const char* in_path = nullptr;
+    const char* out_path = nullptr;
+    int log_level = ESP_LOG_WARN;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i+1 < argc) {
+            out_path = argv[++i];
+        } else if (strcmp(argv[i], "-v") == 0 && i+1 < argc) {
+            log_level = atoi(argv[++i]);
+        } else if (in_path == nullptr) {
+            in_path = argv[i];
+        } else {
+            in_path = nullptr;
+            break;
+        }
+    }
+    if (in_path == nullptr) {
+        fprintf(stderr, "Usage: %s <input .log/.asc> [-o <output.log>] [-v <log level 0-5>]\n", argv[0]);
+        return 1;
+    }
+    if (!reader.open(in_path)) {
+        fprintf(stderr, "Could not open %s\n", in_path);
+        return 1;
+    }
+    if (out_path != nullptr) {
+        out_file = fopen(out_path, "w");
+        if (out_file == nullptr) {
+            fprintf(stderr, "Could not create %s\n", out_path);
+            return 1;
+        }
+    }
+    esp_log_level_set("*", (esp_log_level_t)log_level);
+    ReplayBus bus;
+    HostSim::set_can_bus(&bus);
+
+    // Same start up as setup_tcm() in main.cpp
+    egs_can_hal = new EgsCanHal("EGS52", 20);
+    if (!egs_can_hal->begin_tasks()) {
+        fprintf(stderr, "CAN init failed\n");
+        return 1;
+    }
+    Sensors::init_sensors();
+    init_all_solenoids();
+    StandardProfile* standard = new StandardProfile();
+    Gearbox* gearbox = new Gearbox();
+    gearbox->set_profile(standard);
+    gearbox->start_controller();
+
+    auto start = std::chrono::steady_clock::now();
+    HostSim::run();
+    double wall_secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double sim_secs = HostSim::now() / 1000000.0;
+    HostSim::shutdown();
+    if (out_file != nullptr) {
+        fclose(out_file);
+    }
+
+    printf("Replayed %.1f s of CAN log in %.3f s (%.0fx real time)\n", sim_secs, wall_secs, wall_secs > 0 ? sim_secs / wall_secs : 0.0);
+    printf("Rx frames: %llu (%.0f frames/s)\n", (unsigned long long)rx_frames, wall_secs > 0 ? rx_frames / wall_secs : 0.0);
+    printf("Tx frames: %llu\n", (unsigned long long)tx_frames);
+    printf("Task switches: %llu\n", (unsigned long long)HostSim::get_task_switches());
+    if (reader.get_bad_lines() != 0) {
+        printf("Skipped %u log lines that were not CAN frames\n", reader.get_bad_lines());
+    }
+    return 0;
+}
@@ -0,0 +1,36 @@
+// Host build: ADC2, as used by the sensors. Conversions return what HostSim::set_adc2_raw() last set
+
+#ifndef __HOST_ADC_H_
+#define __HOST_ADC_H_
+
+#include "esp_err.h"
+
+typedef enum {
+    ADC_UNIT_1 = 1,
+    ADC_UNIT_2 = 2
+} adc_unit_t;
+
+typedef enum {
+    ADC2_CHANNEL_0 = 0, ADC2_CHANNEL_1, ADC2_CHANNEL_2, ADC2_CHANNEL_3, ADC2_CHANNEL_4,
+    ADC2_CHANNEL_5, ADC2_CHANNEL_6, ADC2_CHANNEL_7, ADC2_CHANNEL_8, ADC2_CHANNEL_9,
+    ADC2_CHANNEL_MAX
+} adc2_channel_t;
+
+typedef enum {
+    ADC_ATTEN_0db = 0,
+    ADC_ATTEN_2_5db,
+    ADC_ATTEN_6db,
+    ADC_ATTEN_11db
+} adc_atten_t;
+
+typedef enum {
+    ADC_WIDTH_9Bit = 0,
+    ADC_WIDTH_10Bit,
+    ADC_WIDTH_11Bit,
+    ADC_WIDTH_12Bit
+} adc_bits_width_t;
+
+esp_err_t adc2_config_channel_atten(adc2_channel_t channel, adc_atten_t atten);
+esp_err_t adc2_get_raw(adc2_channel_t channel, adc_bits_width_t width_bit, int* raw_out);
+
+#endif // __HOST_ADC_H_
@@ -0,0 +1 @@
+// Host build: Nothing from i2s is used
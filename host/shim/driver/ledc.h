@@ -0,0 +1,19 @@
+// Host build: LEDC types used by the solenoid driver (See sim_io.h)
+
+#ifndef __HOST_LEDC_H_
+#define __HOST_LEDC_H_
+
+#include "driver/gpio.h"
+
+typedef enum {
+    LEDC_CHANNEL_0 = 0, LEDC_CHANNEL_1, LEDC_CHANNEL_2, LEDC_CHANNEL_3,
+    LEDC_CHANNEL_4, LEDC_CHANNEL_5, LEDC_CHANNEL_6, LEDC_CHANNEL_7,
+    LEDC_CHANNEL_MAX
+} ledc_channel_t;
+
+typedef enum {
+    LEDC_TIMER_0 = 0, LEDC_TIMER_1, LEDC_TIMER_2, LEDC_TIMER_3,
+    LEDC_TIMER_MAX
+} ledc_timer_t;
+
+#endif // __HOST_LEDC_H_
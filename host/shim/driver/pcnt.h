@@ -0,0 +1,58 @@
+// Host build: Pulse counter, as used by the speed sensors. Counts the edges injected with HostSim::gpio_edge()
+
+#ifndef __HOST_PCNT_H_
+#define __HOST_PCNT_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+#include "driver/gpio.h"
+
+#define PCNT_PIN_NOT_USED (-1)
+
+typedef enum {
+    PCNT_UNIT_0 = 0, PCNT_UNIT_1, PCNT_UNIT_2, PCNT_UNIT_3,
+    PCNT_UNIT_MAX
+} pcnt_unit_t;
+
+typedef enum {
+    PCNT_CHANNEL_0 = 0,
+    PCNT_CHANNEL_1
+} pcnt_channel_t;
+
+typedef enum {
+    PCNT_MODE_KEEP = 0
+} pcnt_ctrl_mode_t;
+
+typedef enum {
+    PCNT_COUNT_DIS = 0,
+    PCNT_COUNT_INC
+} pcnt_count_mode_t;
+
+typedef enum {
+    PCNT_EVT_H_LIM = 0
+} pcnt_evt_type_t;
+
+typedef struct {
+    int pulse_gpio_num;
+    int ctrl_gpio_num;
+    pcnt_ctrl_mode_t lctrl_mode;
+    pcnt_ctrl_mode_t hctrl_mode;
+    pcnt_count_mode_t pos_mode;
+    pcnt_count_mode_t neg_mode;
+    int16_t counter_h_lim;
+    int16_t counter_l_lim;
+    pcnt_unit_t unit;
+    pcnt_channel_t channel;
+} pcnt_config_t;
+
+esp_err_t pcnt_unit_config(const pcnt_config_t* pcnt_config);
+esp_err_t pcnt_counter_pause(pcnt_unit_t pcnt_unit);
+esp_err_t pcnt_counter_resume(pcnt_unit_t pcnt_unit);
+esp_err_t pcnt_counter_clear(pcnt_unit_t pcnt_unit);
+esp_err_t pcnt_set_filter_value(pcnt_unit_t unit, uint16_t filter_val);
+esp_err_t pcnt_filter_enable(pcnt_unit_t unit);
+esp_err_t pcnt_isr_service_install(int intr_alloc_flags);
+esp_err_t pcnt_isr_handler_add(pcnt_unit_t unit, void (*isr_handler)(void*), void* args);
+esp_err_t pcnt_event_enable(pcnt_unit_t unit, pcnt_evt_type_t evt_type);
+
+#endif // __HOST_PCNT_H_
@@ -0,0 +1 @@
+// Host build: Nothing from esp_event is used
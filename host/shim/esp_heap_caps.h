@@ -0,0 +1,18 @@
+// Host build: There is only one heap
+
+#ifndef __HOST_ESP_HEAP_CAPS_H_
+#define __HOST_ESP_HEAP_CAPS_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1<<2)
+#define MALLOC_CAP_DMA (1<<3)
+#define MALLOC_CAP_INTERNAL (1<<11)
+#define MALLOC_CAP_SPIRAM (1<<10)
+
+static inline void* heap_caps_malloc(size_t size, uint32_t caps) {
+    return malloc(size);
+}
+
+#endif // __HOST_ESP_HEAP_CAPS_H_
@@ -0,0 +1,45 @@
+// Host build: FreeRTOS types. Tasks run one at a time in lockstep with the simulated clock
+// (See host_sim.h), so critical sections have nothing to do
+
+#ifndef __HOST_FREERTOS_H_
+#define __HOST_FREERTOS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+// void* as in the FreeRTOS release the firmware is built against
+typedef void* TaskHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef void (*TaskFunction_t)(void* arg);
+
+typedef struct {
+    uint32_t owner;
+    uint32_t count;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {0, 0}
+#define portENTER_CRITICAL(mux) (void)(mux)
+#define portEXIT_CRITICAL(mux) (void)(mux)
+#define portENTER_CRITICAL_ISR(mux) (void)(mux)
+#define portEXIT_CRITICAL_ISR(mux) (void)(mux)
+#define portYIELD_FROM_ISR()
+
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY (TickType_t)0xFFFFFFFF
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms) / portTICK_PERIOD_MS)
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL 0
+#define pdPASS 1
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define EXT_RAM_ATTR
+
+#define configMAX_PRIORITIES 25
+
+#endif // __HOST_FREERTOS_H_
@@ -0,0 +1,3 @@
+// Host build: Nothing from semphr is used
+
+#include "freertos/FreeRTOS.h"
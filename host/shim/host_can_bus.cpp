@@ -0,0 +1,77 @@
+#include "host_can_bus.h"
+#include "host_sim.h"
+#include "freertos/task.h"
+
+// ID bits of each acceptance filter (Standard frames)
+#define SINGLE_FILTER_ID_BITS 0xFFE00000
+#define DUAL_FILTER_1_ID_BITS 0xFFE00000
+#define DUAL_FILTER_2_ID_BITS 0x0000FFE0
+
+void HostCanBus::configure(const twai_general_config_t* g_config, const twai_filter_config_t* f_config) {
+    if (g_config != nullptr) {
+        this->rx_queue_len = g_config->rx_queue_len;
+        this->tx_queue_len = g_config->tx_queue_len;
+    }
+    if (f_config != nullptr) {
+        this->filter = *f_config;
+    }
+}
+
+bool HostCanBus::filter_accepts(const twai_message_t* msg) {
+    if (msg->extd) {
+        return true;
+    }
+    uint32_t care = ~this->filter.acceptance_mask;
+    bool ok;
+    if (this->filter.single_filter) {
+        ok = (((msg->identifier << 21) ^ this->filter.acceptance_code) & care & SINGLE_FILTER_ID_BITS) == 0;
+    } else {
+        ok = (((msg->identifier << 21) ^ this->filter.acceptance_code) & care & DUAL_FILTER_1_ID_BITS) == 0 ||
+             (((msg->identifier << 5) ^ this->filter.acceptance_code) & care & DUAL_FILTER_2_ID_BITS) == 0;
+    }
+    if (!ok) {
+        this->filtered_count++;
+    }
+    return ok;
+}
+
+void HostCanBus::notify_rx(uint64_t time) {
+    if (this->rx_waiter != nullptr) {
+        HostSim::wake_task_at(this->rx_waiter, time);
+    }
+}
+
+void HostCanBus::notify_tx(uint64_t time) {
+    if (this->tx_waiter != nullptr) {
+        HostSim::wake_task_at(this->tx_waiter, time);
+    }
+}
+
+bool HostCanBus::wait_receive(twai_message_t* msg, uint64_t timeout) {
+    while (true) {
+        if (this->receive(msg, HostSim::now())) {
+            return true;
+        }
+        if (HostSim::now() >= timeout) {
+            return false;
+        }
+        uint64_t next = this->get_next_rx_time();
+        this->rx_waiter = xTaskGetCurrentTaskHandle();
+        HostSim::block_current_task(next < timeout ? next : timeout);
+        this->rx_waiter = nullptr;
+    }
+}
+
+bool HostCanBus::wait_transmit(const twai_message_t* msg, uint64_t timeout) {
+    while (true) {
+        if (this->transmit(msg, HostSim::now())) {
+            return true;
+        }
+        if (HostSim::now() >= timeout) {
+            return false;
+        }
+        this->tx_waiter = xTaskGetCurrentTaskHandle();
+        HostSim::block_current_task(timeout);
+        this->tx_waiter = nullptr;
+    }
+}
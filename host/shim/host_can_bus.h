@@ -0,0 +1,97 @@
+/**
+ * Host build: A connection to a CAN bus
+ *
+ * The TWAI shim talks to one of these (See HostSim::set_can_bus()), so the firmware's CAN HAL
+ * runs unchanged on top of a CAN log (replay.cpp), the in-process virtual bus (virtual_bus.h)
+ * or a Linux SocketCAN interface (socketcan_bus.h). Simulated ECUs use the same interface,
+ * so they can sit on any of them too.
+ *
+ * Only the thread holding the scheduler baton (See host_sim.h) ever calls into a bus.
+ */
+
+#ifndef __HOST_CAN_BUS_H_
+#define __HOST_CAN_BUS_H_
+
+#include <stdint.h>
+#include "driver/twai.h"
+#include "freertos/FreeRTOS.h"
+
+class HostCanBus {
+    public:
+        virtual ~HostCanBus() {}
+
+        /**
+         * Takes the next received frame that has arrived by 'now' (And got through the acceptance filter).
+         * Returns false if there is none
+         */
+        virtual bool receive(twai_message_t* msg, uint64_t now) = 0;
+
+        /**
+         * Returns the time the next received frame arrives, UINT64_MAX if that is not known yet.
+         * A bus that later finds out about an earlier frame calls notify_rx()
+         */
+        virtual uint64_t get_next_rx_time() = 0;
+
+        // Queues a frame to send. Returns false if the Tx queue is full
+        virtual bool transmit(const twai_message_t* msg, uint64_t now) = 0;
+
+        // Frames queued by transmit() that have not gone out yet
+        virtual uint32_t get_tx_queue_len() = 0;
+
+        // Drops the frames queued by transmit() that have not started going out yet (Controller went bus off)
+        virtual void clear_tx_queue() {}
+
+        /**
+         * Returns true (And the time of the last frame) once no more frames will ever be received.
+         * The simulation stops once everything due up to then has run (Log replay)
+         */
+        virtual bool rx_finished(uint64_t* last_frame_time) {
+            return false;
+        }
+
+        // Applies the driver config the firmware installed (Queue lengths and acceptance filter)
+        virtual void configure(const twai_general_config_t* g_config, const twai_filter_config_t* f_config);
+
+        /**
+         * Calling task: Waits until 'timeout' (Simulated time, UINT64_MAX for forever) for a frame.
+         * Returns false if none arrived in time
+         */
+        bool wait_receive(twai_message_t* msg, uint64_t timeout);
+
+        // Calling task: Waits until 'timeout' for room in the Tx queue. Returns false if there was none
+        bool wait_transmit(const twai_message_t* msg, uint64_t timeout);
+
+        // Frames the acceptance filter threw away
+        uint32_t get_filtered_count() const {
+            return this->filtered_count;
+        }
+
+        // Frames lost as the Rx queue was full
+        uint32_t get_rx_overflow_count() const {
+            return this->rx_overflow_count;
+        }
+    protected:
+        /**
+         * Returns true if the acceptance filter lets 'msg' through (Counting it if not).
+         * Only the ID bits of the filter are compared, the RTR and data byte bits are treated as
+         * don't care (Which is all the firmware programs, see can_filter.h). Extended frames always get through
+         */
+        bool filter_accepts(const twai_message_t* msg);
+
+        // A received frame will now be available at 'time'. Wakes whoever is waiting for one
+        void notify_rx(uint64_t time);
+
+        // Room has been made in the Tx queue at 'time'. Wakes whoever is waiting for it
+        void notify_tx(uint64_t time);
+
+        twai_filter_config_t filter = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+        uint32_t rx_queue_len = UINT32_MAX;
+        uint32_t tx_queue_len = UINT32_MAX;
+        uint32_t filtered_count = 0;
+        uint32_t rx_overflow_count = 0;
+    private:
+        TaskHandle_t rx_waiter = nullptr;
+        TaskHandle_t tx_waiter = nullptr;
+};
+
+#endif // __HOST_CAN_BUS_H_
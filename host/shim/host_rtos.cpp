@@ -0,0 +1,428 @@
+#include "host_sim.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct HostTask {
+    const char* name;
+    TaskFunction_t fn;
+    void* arg;
+    UBaseType_t priority;
+    std::thread thread;
+    // Signalled when this task is handed the baton
+    std::condition_variable cv;
+    bool ready;
+    // Will never run again
+    bool done;
+    // Thread has finished, so the task can be freed
+    bool exited;
+    // Order tasks became ready in, so equal priority tasks take turns
+    uint64_t ready_seq;
+    // When a blocked task wakes up (UINT64_MAX if only a notification wakes it)
+    uint64_t wake_time;
+    bool waiting_notify;
+    uint32_t notify_count;
+};
+
+struct HostTimer {
+    esp_timer_cb_t callback;
+    void* arg;
+    // 0 for a one shot timer
+    uint64_t period;
+    uint64_t next_time;
+    bool active;
+};
+
+// Longest the scheduler sleeps in real time mode before checking for stop()
+#define MAX_IO_WAIT_US 100000
+
+// Thrown into a task's thread to end it (vTaskDelete, or shutdown)
+struct HostTaskExit {};
+
+static std::mutex sched_lock;
+// Stands in for the thread that called HostSim::run()
+static HostTask main_thread;
+// Holder of the baton. Only that thread touches anything here
+static HostTask* running = &main_thread;
+static bool stopping = false;
+
+static std::vector<HostTask*> tasks;
+static std::vector<HostTimer*> timers;
+static uint64_t now_us = 0;
+static uint64_t ready_counter = 0;
+static uint64_t task_switches = 0;
+static uint64_t end_time_us = UINT64_MAX;
+static std::atomic<bool> stop_requested{false};
+
+// Real time mode
+static HostSim::IoWait io_wait = nullptr;
+static HostSim::IoHandler io_handler = nullptr;
+static std::chrono::steady_clock::time_point wall_start;
+
+// nullptr on the main thread
+static thread_local HostTask* current_task = nullptr;
+
+static void make_ready(HostTask* t) {
+    t->ready = true;
+    t->waiting_notify = false;
+    t->ready_seq = ready_counter++;
+}
+
+static uint64_t wall_clock_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - wall_start).count();
+}
+
+// Brings the clock up to the wall clock (Real time mode)
+static void update_clock() {
+    uint64_t wall = wall_clock_us();
+    if (wall > now_us) {
+        now_us = wall;
+    }
+}
+
+// Time of the next thing that happens (now if a task is ready)
+static uint64_t next_event_time() {
+    uint64_t next = UINT64_MAX;
+    for (HostTask* t : tasks) {
+        if (t->done) {
+            continue;
+        }
+        if (t->ready) {
+            return now_us;
+        }
+        if (t->wake_time < next) {
+            next = t->wake_time;
+        }
+    }
+    for (HostTimer* tmr : timers) {
+        if (tmr->active && tmr->next_time < next) {
+            next = tmr->next_time;
+        }
+    }
+    return next;
+}
+
+/**
+ * Moves the clock on until a task is ready to run, and returns it (Highest priority first),
+ * or &main_thread once the replay is over. Run by whichever thread holds the baton
+ */
+static HostTask* pick_next() {
+    uint64_t last_frame_time;
+    HostTask* next;
+    while (true) {
+        next = nullptr;
+        for (size_t i = 0; i < tasks.size(); i++) {
+            HostTask* t = tasks[i];
+            if (t->exited) {
+                t->thread.join();
+                tasks.erase(tasks.begin() + i--);
+                delete t;
+            } else if (t->ready && !t->done && (next == nullptr || t->priority > next->priority || (t->priority == next->priority && t->ready_seq < next->ready_seq))) {
+                next = t;
+            }
+        }
+        if (next != nullptr) {
+            return next;
+        }
+        if (stop_requested) {
+            return &main_thread;
+        }
+        uint64_t t_next = next_event_time();
+        if (t_next == UINT64_MAX && io_wait == nullptr) {
+            return &main_thread; // Nothing will ever happen again
+        }
+        if (t_next > end_time_us || now_us >= end_time_us) {
+            return &main_thread;
+        }
+        if (io_wait != nullptr) {
+            // Sleep until the next thing is due, unless I/O turns up first
+            uint64_t wall = wall_clock_us();
+            if (t_next > wall) {
+                uint64_t wait = t_next - wall;
+                if (io_wait(wait < MAX_IO_WAIT_US ? wait : MAX_IO_WAIT_US)) {
+                    update_clock();
+                    io_handler();
+                }
+            }
+            update_clock();
+        } else {
+            if (HostSim::rx_finished(&last_frame_time) && t_next > last_frame_time) {
+                return &main_thread;
+            }
+            now_us = t_next;
+        }
+        // Timers go before tasks waking up at the same time
+        HostTimer* due = nullptr;
+        for (HostTimer* tmr : timers) {
+            if (tmr->active && tmr->next_time <= now_us && (due == nullptr || tmr->next_time < due->next_time)) {
+                due = tmr;
+            }
+        }
+        if (due != nullptr) {
+            if (due->period == 0) {
+                due->active = false;
+            } else {
+                due->next_time += due->period;
+            }
+            due->callback(due->arg);
+        } else {
+            for (HostTask* t : tasks) {
+                if (!t->ready && !t->done && t->wake_time <= now_us) {
+                    make_ready(t);
+                }
+            }
+        }
+    }
+}
+
+// Gives the baton to 'to'. Call with sched_lock held
+static void hand_over(HostTask* to) {
+    running = to;
+    task_switches++;
+    to->cv.notify_one();
+}
+
+// Gives the baton to 'to', and waits until 'self' gets it back
+static void switch_to(HostTask* self, HostTask* to) {
+    if (to == self) {
+        return;
+    }
+    std::unique_lock<std::mutex> lk(sched_lock);
+    hand_over(to);
+    self->cv.wait(lk, [self]{ return running == self || stopping; });
+    if (stopping && self != &main_thread) {
+        throw HostTaskExit();
+    }
+}
+
+static void task_entry(HostTask* t) {
+    current_task = t;
+    try {
+        {
+            std::unique_lock<std::mutex> lk(sched_lock);
+            t->cv.wait(lk, [t]{ return running == t || stopping; });
+            if (stopping) {
+                throw HostTaskExit();
+            }
+        }
+        t->fn(t->arg);
+    } catch (const HostTaskExit&) {
+        // Deleted
+    }
+    if (stopping) {
+        return; // HostSim::shutdown() cleans up
+    }
+    t->done = true;
+    t->ready = false;
+    HostTask* next = pick_next();
+    std::unique_lock<std::mutex> lk(sched_lock);
+    // Freed by the next pick_next()
+    t->exited = true;
+    hand_over(next);
+}
+
+uint64_t HostSim::now() {
+    if (io_wait != nullptr) {
+        update_clock();
+    }
+    return now_us;
+}
+
+void HostSim::set_real_time(IoWait wait, IoHandler handle) {
+    io_wait = wait;
+    io_handler = handle;
+    wall_start = std::chrono::steady_clock::now();
+    now_us = 0;
+}
+
+void HostSim::stop() {
+    stop_requested = true;
+}
+
+void HostSim::wake_task_at(TaskHandle_t task, uint64_t time) {
+    HostTask* t = (HostTask*)task;
+    if (t->ready || t->done) {
+        return;
+    }
+    if (time <= now_us) {
+        make_ready(t);
+    } else if (time < t->wake_time) {
+        t->wake_time = time;
+    }
+}
+
+uint64_t HostSim::get_task_switches() {
+    return task_switches;
+}
+
+void HostSim::block_current_task(uint64_t wake_time) {
+    HostTask* t = current_task;
+    if (t == nullptr) {
+        return; // Not a task (Setup code), so there is nothing to block
+    }
+    t->ready = false;
+    t->wake_time = wake_time;
+    // If nothing else happens before we wake up, we get picked again and carry straight on
+    switch_to(t, pick_next());
+}
+
+void HostSim::run(uint64_t end_time) {
+    end_time_us = end_time;
+    switch_to(&main_thread, pick_next());
+}
+
+void HostSim::shutdown() {
+    {
+        std::unique_lock<std::mutex> lk(sched_lock);
+        stopping = true;
+        for (HostTask* t : tasks) {
+            t->cv.notify_one();
+        }
+    }
+    for (HostTask* t : tasks) {
+        t->thread.join();
+        delete t;
+    }
+    tasks.clear();
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack_depth, void* arg, UBaseType_t priority, TaskHandle_t* created_task, BaseType_t core_id) {
+    HostTask* t = new HostTask();
+    t->name = name;
+    t->fn = fn;
+    t->arg = arg;
+    t->priority = priority;
+    t->done = false;
+    t->exited = false;
+    t->wake_time = UINT64_MAX;
+    t->notify_count = 0;
+    make_ready(t);
+    tasks.push_back(t);
+    if (created_task != nullptr) {
+        *created_task = (TaskHandle_t)t;
+    }
+    t->thread = std::thread(task_entry, t);
+    return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack_depth, void* arg, UBaseType_t priority, TaskHandle_t* created_task) {
+    return xTaskCreatePinnedToCore(fn, name, stack_depth, arg, priority, created_task, 0);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    HostTask* t = (HostTask*)task;
+    if (t == nullptr || t == current_task) {
+        throw HostTaskExit();
+    }
+    // Another task. It is blocked, so it just never runs again
+    t->done = true;
+    t->ready = false;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    HostSim::block_current_task(HostSim::now() + (uint64_t)ticks * portTICK_PERIOD_MS * 1000);
+}
+
+void vTaskDelayUntil(TickType_t* previous_wake_time, TickType_t ticks) {
+    *previous_wake_time += ticks;
+    uint64_t wake = (uint64_t)*previous_wake_time * portTICK_PERIOD_MS * 1000;
+    if (wake > HostSim::now()) {
+        HostSim::block_current_task(wake);
+    }
+}
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)(HostSim::now() / (portTICK_PERIOD_MS * 1000));
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return (TaskHandle_t)current_task;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait) {
+    HostTask* t = current_task;
+    if (t->notify_count == 0 && ticks_to_wait != 0) {
+        t->waiting_notify = true;
+        HostSim::block_current_task(ticks_to_wait == portMAX_DELAY ? UINT64_MAX : HostSim::now() + (uint64_t)ticks_to_wait * portTICK_PERIOD_MS * 1000);
+    }
+    uint32_t count = t->notify_count;
+    if (count != 0) {
+        t->notify_count = clear_on_exit ? 0 : count - 1;
+    }
+    return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    HostTask* t = (HostTask*)task;
+    t->notify_count++;
+    if (t->waiting_notify && !t->ready && !t->done) {
+        make_ready(t);
+    }
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higher_priority_task_woken) {
+    xTaskNotifyGive(task);
+    if (higher_priority_task_woken != nullptr) {
+        *higher_priority_task_woken = pdFALSE;
+    }
+}
+
+int64_t esp_timer_get_time() {
+    return (int64_t)HostSim::now();
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args, esp_timer_handle_t* out_handle) {
+    HostTimer* tmr = new HostTimer();
+    tmr->callback = create_args->callback;
+    tmr->arg = create_args->arg;
+    tmr->period = 0;
+    tmr->next_time = 0;
+    tmr->active = false;
+    timers.push_back(tmr);
+    *out_handle = tmr;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+    timer->period = 0;
+    timer->next_time = HostSim::now() + timeout_us;
+    timer->active = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period) {
+    if (period == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    timer->period = period;
+    timer->next_time = HostSim::now() + period;
+    timer->active = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if (!timer->active) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->active = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+    for (size_t i = 0; i < timers.size(); i++) {
+        if (timers[i] == timer) {
+            timers.erase(timers.begin() + i);
+            break;
+        }
+    }
+    delete timer;
+    return ESP_OK;
+}
@@ -0,0 +1,224 @@
+#include <chrono>
+#include "host_sim.h"
+#include "driver/gpio.h"
+#include "driver/pcnt.h"
+#include "driver/adc.h"
+#include "esp_adc_cal.h"
+#include "xtensa/core-macros.h"
+
+// Clock XTHAL_GET_CCOUNT() counts
+#define HOST_CPU_MHZ 240
+// Calibration curve of every simulated chip: A straight line through these (Roughly an ESP32 at 11dB)
+#define HOST_ADC_CAL_MV_MIN 142
+#define HOST_ADC_CAL_MV_MAX 3142
+#define HOST_ADC_MAX_RAW 4095
+
+typedef struct {
+    gpio_int_type_t intr_type;
+    gpio_isr_t handler;
+    void* arg;
+} HostGpio;
+
+typedef struct {
+    bool configured;
+    pcnt_config_t config;
+    bool running;
+    bool h_lim_event;
+    int16_t count;
+    void (*handler)(void*);
+    void* arg;
+} HostPcnt;
+
+static HostGpio gpios[GPIO_NUM_MAX] = {};
+static bool gpio_isr_service = false;
+static HostPcnt pcnts[PCNT_UNIT_MAX] = {};
+static bool pcnt_isr_service = false;
+// Raw value each ADC2 channel converts to (Negative if conversions fail)
+static int adc2_raw[ADC2_CHANNEL_MAX] = {};
+
+static bool valid_gpio(gpio_num_t gpio_num) {
+    return gpio_num >= 0 && gpio_num < GPIO_NUM_MAX;
+}
+
+static HostPcnt* get_pcnt(pcnt_unit_t unit) {
+    return unit >= 0 && unit < PCNT_UNIT_MAX && pcnts[unit].configured ? &pcnts[unit] : nullptr;
+}
+
+void HostSim::gpio_edge(gpio_num_t pin) {
+    if (!valid_gpio(pin)) {
+        return;
+    }
+    // Only falling edges are simulated
+    HostGpio* g = &gpios[pin];
+    if (g->intr_type == GPIO_INTR_NEGEDGE && g->handler != nullptr) {
+        g->handler(g->arg);
+    }
+    for (HostPcnt& p : pcnts) {
+        if (!p.configured || !p.running || p.config.pulse_gpio_num != pin || p.config.neg_mode != PCNT_COUNT_INC) {
+            continue;
+        }
+        if (++p.count >= p.config.counter_h_lim) {
+            p.count = 0;
+            if (p.h_lim_event && p.handler != nullptr) {
+                p.handler(p.arg);
+            }
+        }
+    }
+}
+
+void HostSim::set_adc2_raw(adc2_channel_t channel, int raw) {
+    if (channel >= 0 && channel < ADC2_CHANNEL_MAX) {
+        adc2_raw[channel] = raw;
+    }
+}
+
+uint32_t host_get_ccount() {
+    uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    return (uint32_t)(ns * HOST_CPU_MHZ / 1000);
+}
+
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode) {
+    return valid_gpio(gpio_num) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t gpio_set_pull_mode(gpio_num_t gpio_num, gpio_pull_mode_t pull) {
+    return valid_gpio(gpio_num) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t gpio_set_intr_type(gpio_num_t gpio_num, gpio_int_type_t intr_type) {
+    if (!valid_gpio(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    gpios[gpio_num].intr_type = intr_type;
+    return ESP_OK;
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags) {
+    if (gpio_isr_service) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    gpio_isr_service = true;
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void* args) {
+    if (!gpio_isr_service) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!valid_gpio(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    gpios[gpio_num].handler = isr_handler;
+    gpios[gpio_num].arg = args;
+    return ESP_OK;
+}
+
+esp_err_t pcnt_unit_config(const pcnt_config_t* pcnt_config) {
+    if (pcnt_config == nullptr || pcnt_config->unit < 0 || pcnt_config->unit >= PCNT_UNIT_MAX || pcnt_config->counter_h_lim <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    HostPcnt* p = &pcnts[pcnt_config->unit];
+    p->configured = true;
+    p->config = *pcnt_config;
+    p->running = true;
+    p->count = 0;
+    return ESP_OK;
+}
+
+esp_err_t pcnt_counter_pause(pcnt_unit_t pcnt_unit) {
+    HostPcnt* p = get_pcnt(pcnt_unit);
+    if (p == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->running = false;
+    return ESP_OK;
+}
+
+esp_err_t pcnt_counter_resume(pcnt_unit_t pcnt_unit) {
+    HostPcnt* p = get_pcnt(pcnt_unit);
+    if (p == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->running = true;
+    return ESP_OK;
+}
+
+esp_err_t pcnt_counter_clear(pcnt_unit_t pcnt_unit) {
+    HostPcnt* p = get_pcnt(pcnt_unit);
+    if (p == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->count = 0;
+    return ESP_OK;
+}
+
+// Only noise is filtered, and there is none
+esp_err_t pcnt_set_filter_value(pcnt_unit_t unit, uint16_t filter_val) {
+    return get_pcnt(unit) == nullptr || filter_val > 1023 ? ESP_ERR_INVALID_ARG : ESP_OK;
+}
+
+esp_err_t pcnt_filter_enable(pcnt_unit_t unit) {
+    return get_pcnt(unit) == nullptr ? ESP_ERR_INVALID_ARG : ESP_OK;
+}
+
+esp_err_t pcnt_isr_service_install(int intr_alloc_flags) {
+    if (pcnt_isr_service) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    pcnt_isr_service = true;
+    return ESP_OK;
+}
+
+esp_err_t pcnt_isr_handler_add(pcnt_unit_t unit, void (*isr_handler)(void*), void* args) {
+    if (!pcnt_isr_service) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    HostPcnt* p = get_pcnt(unit);
+    if (p == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->handler = isr_handler;
+    p->arg = args;
+    return ESP_OK;
+}
+
+esp_err_t pcnt_event_enable(pcnt_unit_t unit, pcnt_evt_type_t evt_type) {
+    HostPcnt* p = get_pcnt(unit);
+    if (p == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->h_lim_event = true;
+    return ESP_OK;
+}
+
+esp_err_t adc2_config_channel_atten(adc2_channel_t channel, adc_atten_t atten) {
+    return channel >= 0 && channel < ADC2_CHANNEL_MAX ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t adc2_get_raw(adc2_channel_t channel, adc_bits_width_t width_bit, int* raw_out) {
+    if (channel < 0 || channel >= ADC2_CHANNEL_MAX || raw_out == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    // As when WiFi holds ADC2
+    if (adc2_raw[channel] < 0) {
+        return ESP_ERR_TIMEOUT;
+    }
+    *raw_out = adc2_raw[channel];
+    return ESP_OK;
+}
+
+esp_adc_cal_value_t esp_adc_cal_characterize(adc_unit_t adc_num, adc_atten_t atten, adc_bits_width_t bit_width,
+    uint32_t default_vref, esp_adc_cal_characteristics_t* chars) {
+    *chars = {};
+    chars->adc_num = adc_num;
+    chars->atten = atten;
+    chars->bit_width = bit_width;
+    chars->coeff_a = HOST_ADC_CAL_MV_MAX - HOST_ADC_CAL_MV_MIN;
+    chars->coeff_b = HOST_ADC_CAL_MV_MIN;
+    chars->vref = 1100;
+    return ESP_ADC_CAL_VAL_DEFAULT_VREF;
+}
+
+uint32_t esp_adc_cal_raw_to_voltage(uint32_t adc_reading, const esp_adc_cal_characteristics_t* chars) {
+    return adc_reading * chars->coeff_a / HOST_ADC_MAX_RAW + chars->coeff_b;
+}
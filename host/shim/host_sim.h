@@ -0,0 +1,81 @@
+/**
+ * Host build: Lockstep simulation of the FreeRTOS tasks, esp_timer and the TWAI bus
+ *
+ * Every task runs on its own thread, but only one thread (A task, or the scheduler in run()) is ever
+ * running at a time, so the firmware sees the same single core, non preemptive ordering every time it runs.
+ *
+ * Time only moves when every task is blocked (vTaskDelay, ulTaskNotifyTake, twai_receive...). The
+ * scheduler then jumps the clock straight to the next thing that happens (A task waking up, a timer
+ * firing or a frame arriving on the bus), so a simulation runs as fast as the firmware code allows.
+ * A task whose wait ends before anything else happens just carries on without a thread switch.
+ *
+ * In real time mode (For talking to a real bus, see set_real_time()) the clock follows the wall clock
+ * instead, and the scheduler sleeps in the bus' I/O wait until the next thing is due.
+ */
+
+#ifndef __HOST_SIM_H_
+#define __HOST_SIM_H_
+
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "driver/gpio.h"
+#include "driver/adc.h"
+
+class HostCanBus;
+
+namespace HostSim {
+    // Waits up to 'max_wait_us' (Wall clock) for I/O. Returns true if there is something to handle
+    typedef bool (*IoWait)(uint64_t max_wait_us);
+    // Handles the I/O (With the clock brought up to date), waking whichever tasks it concerns
+    typedef void (*IoHandler)();
+
+    // Bus the TWAI driver shim sends and receives on
+    void set_can_bus(HostCanBus* bus);
+
+    /**
+     * Runs in real time rather than in lockstep, starting the clock now. When nothing is due,
+     * the scheduler sleeps in 'wait', and calls 'handle' if it returns true. Call before creating any tasks
+     */
+    void set_real_time(IoWait wait, IoHandler handle);
+
+    /**
+     * Runs the tasks and timers until the bus has run out of frames to receive (And everything
+     * due up to the time of the last frame has been done), until 'end_time', or until stop() is called
+     */
+    void run(uint64_t end_time = UINT64_MAX);
+
+    // Makes run() return as soon as possible. Can be called from any thread (Or a signal handler)
+    void stop();
+
+    // Stops every task. Nothing can run after this
+    void shutdown();
+
+    // Times the scheduler handed over to a task
+    uint64_t get_task_switches();
+
+    /**
+     * Fault injection: Puts the simulated CAN controller bus off, as a burst of Tx errors would.
+     * It stays off the bus until the firmware initiates recovery (And then for the 128 x 11 recessive
+     * bits recovery takes), and the driver has to be started again after that. Call from a task
+     */
+    void inject_can_bus_off();
+
+    /**
+     * Sensors: A falling edge on 'pin', running its GPIO interrupt handler and counting it on every
+     * pulse counter on the pin (Running its handler when it reaches its high limit). Call from a task
+     */
+    void gpio_edge(gpio_num_t pin);
+    // Sets the raw value conversions of ADC2 'channel' return from now on (Negative to make them fail)
+    void set_adc2_raw(adc2_channel_t channel, int raw);
+
+    // Used by the shims
+    uint64_t now();
+    // Blocks the calling task until 'wake_time' (UINT64_MAX to block until woken by a notification)
+    void block_current_task(uint64_t wake_time);
+    // Wakes 'task' at 'time' if it is blocked until later than that
+    void wake_task_at(TaskHandle_t task, uint64_t time);
+    // Returns true (And the time of the last frame) once the bus has run out of frames
+    bool rx_finished(uint64_t* last_frame_time);
+}
+
+#endif // __HOST_SIM_H_
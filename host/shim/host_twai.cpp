@@ -0,0 +1,187 @@
+#include "host_sim.h"
+#include "host_can_bus.h"
+#include "driver/twai.h"
+#include "freertos/task.h"
+
+// Clock of the TWAI controller
+#define TWAI_CLOCK_MHZ 80
+// Bus off recovery waits for this many occurrences of 11 recessive bits
+#define TWAI_RECOVERY_SEQUENCES 128
+
+static HostCanBus* can_bus = nullptr;
+
+// Simulated controller (See HostSim::inject_can_bus_off())
+static twai_state_t state = TWAI_STATE_STOPPED;
+static uint32_t bit_time_us = 2;
+// Time recovery completes, whilst TWAI_STATE_RECOVERING
+static uint64_t recovery_done_time = 0;
+static uint32_t tx_error_counter = 0;
+static uint32_t bus_error_count = 0;
+static uint32_t alerts_enabled = 0;
+static uint32_t pending_alerts = 0;
+static TaskHandle_t alert_waiter = nullptr;
+
+static uint64_t ticks_to_timeout(TickType_t ticks_to_wait) {
+    return ticks_to_wait == portMAX_DELAY ? UINT64_MAX : HostSim::now() + (uint64_t)ticks_to_wait * portTICK_PERIOD_MS * 1000;
+}
+
+static void raise_alerts(uint32_t alerts) {
+    pending_alerts |= alerts & alerts_enabled;
+    if (pending_alerts != 0 && alert_waiter != nullptr) {
+        HostSim::wake_task_at(alert_waiter, HostSim::now());
+    }
+}
+
+// Finishes recovery once the recessive bits it waits for have gone by
+static void update_state() {
+    if (state == TWAI_STATE_RECOVERING && HostSim::now() >= recovery_done_time) {
+        state = TWAI_STATE_STOPPED;
+        tx_error_counter = 0;
+        raise_alerts(TWAI_ALERT_BUS_RECOVERED);
+    }
+}
+
+void HostSim::set_can_bus(HostCanBus* bus) {
+    can_bus = bus;
+}
+
+void HostSim::inject_can_bus_off() {
+    if (state != TWAI_STATE_RUNNING) {
+        return;
+    }
+    state = TWAI_STATE_BUS_OFF;
+    // The driver throws away whatever was waiting to be sent
+    if (can_bus != nullptr) {
+        can_bus->clear_tx_queue();
+    }
+    tx_error_counter = 256;
+    bus_error_count += 32; // Each failed Tx adds 8 to the TEC
+    raise_alerts(TWAI_ALERT_ABOVE_ERR_WARN | TWAI_ALERT_ERR_PASS | TWAI_ALERT_BUS_ERROR | TWAI_ALERT_BUS_OFF);
+}
+
+bool HostSim::rx_finished(uint64_t* last_frame_time) {
+    return can_bus == nullptr || can_bus->rx_finished(last_frame_time);
+}
+
+esp_err_t twai_driver_install(const twai_general_config_t* g_config, const twai_timing_config_t* t_config, const twai_filter_config_t* f_config) {
+    if (can_bus != nullptr) {
+        can_bus->configure(g_config, f_config);
+    }
+    bit_time_us = t_config->brp * (1 + t_config->tseg_1 + t_config->tseg_2) / TWAI_CLOCK_MHZ;
+    if (bit_time_us == 0) {
+        bit_time_us = 1;
+    }
+    alerts_enabled = g_config->alerts_enabled;
+    state = TWAI_STATE_STOPPED;
+    return ESP_OK;
+}
+
+esp_err_t twai_driver_uninstall() {
+    return ESP_OK;
+}
+
+esp_err_t twai_start() {
+    update_state();
+    if (state != TWAI_STATE_STOPPED) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    state = TWAI_STATE_RUNNING;
+    return ESP_OK;
+}
+
+esp_err_t twai_stop() {
+    update_state();
+    if (state != TWAI_STATE_RUNNING) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    state = TWAI_STATE_STOPPED;
+    return ESP_OK;
+}
+
+esp_err_t twai_transmit(const twai_message_t* message, TickType_t ticks_to_wait) {
+    update_state();
+    if (state != TWAI_STATE_RUNNING) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (can_bus == nullptr) {
+        return ESP_OK; // Nobody listening
+    }
+    return can_bus->wait_transmit(message, ticks_to_timeout(ticks_to_wait)) ? ESP_OK : ESP_ERR_TIMEOUT;
+}
+
+esp_err_t twai_receive(twai_message_t* message, TickType_t ticks_to_wait) {
+    if (can_bus == nullptr) {
+        return ESP_ERR_TIMEOUT;
+    }
+    uint64_t timeout = ticks_to_timeout(ticks_to_wait);
+    while (can_bus->wait_receive(message, timeout)) {
+        update_state();
+        if (state == TWAI_STATE_RUNNING) {
+            return ESP_OK;
+        }
+        // A controller that is off the bus never sees the frame
+    }
+    return ESP_ERR_TIMEOUT;
+}
+
+esp_err_t twai_read_alerts(uint32_t* alerts, TickType_t ticks_to_wait) {
+    // The simulated bus itself never has errors, they only come from fault injection
+    uint64_t timeout = ticks_to_timeout(ticks_to_wait);
+    while (true) {
+        update_state();
+        if (pending_alerts != 0) {
+            *alerts = pending_alerts;
+            pending_alerts = 0;
+            return ESP_OK;
+        }
+        if (HostSim::now() >= timeout) {
+            *alerts = 0;
+            return ESP_ERR_TIMEOUT;
+        }
+        alert_waiter = xTaskGetCurrentTaskHandle();
+        HostSim::block_current_task(state == TWAI_STATE_RECOVERING && recovery_done_time < timeout ? recovery_done_time : timeout);
+        alert_waiter = nullptr;
+    }
+}
+
+esp_err_t twai_reconfigure_alerts(uint32_t alerts, uint32_t* current_alerts) {
+    alerts_enabled = alerts;
+    pending_alerts &= alerts;
+    if (current_alerts != nullptr) {
+        *current_alerts = pending_alerts;
+    }
+    return ESP_OK;
+}
+
+esp_err_t twai_initiate_recovery() {
+    if (state != TWAI_STATE_BUS_OFF) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    state = TWAI_STATE_RECOVERING;
+    recovery_done_time = HostSim::now() + (uint64_t)TWAI_RECOVERY_SEQUENCES * 11 * bit_time_us;
+    return ESP_OK;
+}
+
+esp_err_t twai_get_status_info(twai_status_info_t* status_info) {
+    update_state();
+    *status_info = {};
+    status_info->state = state;
+    status_info->tx_error_counter = tx_error_counter;
+    status_info->bus_error_count = bus_error_count;
+    if (can_bus != nullptr) {
+        status_info->msgs_to_tx = can_bus->get_tx_queue_len();
+        status_info->rx_missed_count = can_bus->get_rx_overflow_count();
+    }
+    return ESP_OK;
+}
+
+esp_err_t twai_clear_transmit_queue() {
+    if (can_bus != nullptr) {
+        can_bus->clear_tx_queue();
+    }
+    return ESP_OK;
+}
+
+esp_err_t twai_clear_receive_queue() {
+    return ESP_OK;
+}
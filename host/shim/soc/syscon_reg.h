@@ -0,0 +1 @@
+// Host build: No registers to poke
@@ -0,0 +1,13 @@
+// Host build: CPU cycle counter, as cycles of a 240MHz core counted from the host's monotonic clock.
+// Durations measured with it are host time, not what the code takes on an ESP32
+
+#ifndef __HOST_CORE_MACROS_H_
+#define __HOST_CORE_MACROS_H_
+
+#include <stdint.h>
+
+uint32_t host_get_ccount();
+
+#define XTHAL_GET_CCOUNT() host_get_ccount()
+
+#endif // __HOST_CORE_MACROS_H_
@@ -0,0 +1,235 @@
+#include "sim_car.h"
+#include <string.h>
+#include "shim/host_sim.h"
+#include "virtual_bus.h"
+#include "../src/canbus/egs_can_hal.h"
+#include "../src/profiles.h"
+#include "../src/input_manager.h"
+#include "../src/diag/kwp2000.h"
+
+#define NUM_PROFILES 5
+// Rx queue of the simulated nodes, enough to never lose a frame whilst the observer is busy
+#define SIM_NODE_RX_QUEUE_LEN 64
+
+typedef struct {
+    uint32_t can_id;
+    uint16_t cycle_ms;
+} EcuFrame;
+
+// Frames the TCM reads, and how often the car sends them
+static const EcuFrame ECU_FRAMES[] = {
+    { BS_200_CAN_ID, 20 },
+    { MS_210_CAN_ID, 20 },
+    { EWM_230_CAN_ID, 20 },
+    { MS_308_CAN_ID, 20 },
+    { MS_608_CAN_ID, 100 },
+};
+
+// Selector lever sequence, and what GS_418 should report for each position
+static const EWM_230h_WHC LEVER_SEQUENCE[] = {
+    EWM_230h_WHC::P, EWM_230h_WHC::R, EWM_230h_WHC::N, EWM_230h_WHC::D, EWM_230h_WHC::N, EWM_230h_WHC::R
+};
+static const GS_418h_WHST LEVER_REPORTED[] = {
+    GS_418h_WHST::P, GS_418h_WHST::R, GS_418h_WHST::N, GS_418h_WHST::D, GS_418h_WHST::N, GS_418h_WHST::R
+};
+#define LEVER_SEQUENCE_LEN (sizeof(LEVER_SEQUENCE)/sizeof(LEVER_SEQUENCE[0]))
+
+typedef struct {
+    HostCanBus* bus;
+    uint32_t percent;
+    uint32_t can_id;
+} LoadConfig;
+
+// Settings
+static uint32_t shifter_interval_ms = 2000;
+static uint32_t bus_off_interval_ms = 0;
+
+static SimCarResults results;
+
+// Shifter latency measurement
+static uint8_t lever_idx = 0;
+// Lever has moved, but no EWM_230 has reported it yet
+static bool lever_moved = false;
+// Lever movement has been sent, but no GS_418 has reported it yet
+static bool lever_pending = false;
+static uint64_t lever_sent_time = 0;
+
+// Bus off to next GS_418 measurement
+static bool bus_off_pending = false;
+static uint64_t bus_off_time = 0;
+
+static uint64_t ms_to_us(uint32_t ms) {
+    return (uint64_t)ms * 1000;
+}
+
+// Message counter of BS_200 (The TCM throws away frames that repeat it)
+static uint8_t bs200_counter = 0;
+
+static void build_ecu_frame(uint32_t can_id, twai_message_t* msg) {
+    *msg = {};
+    msg->identifier = can_id;
+    msg->data_length_code = 8;
+    if (can_id == BS_200_CAN_ID) {
+        BS_200 bs200 = {};
+        bs200.set_BZ200h(bs200_counter);
+        bs200_counter = (bs200_counter + 1) & 0x0F;
+        memcpy(msg->data, bs200.bytes, 8);
+    } else if (can_id == EWM_230_CAN_ID) {
+        EWM_230 ewm230 = {};
+        ewm230.set_WHC(LEVER_SEQUENCE[lever_idx]);
+        memcpy(msg->data, ewm230.bytes, 8);
+    } else if (can_id == MS_308_CAN_ID) {
+        MS_308 ms308 = {};
+        ms308.set_NMOT(800); // Idling
+        memcpy(msg->data, ms308.bytes, 8);
+    }
+}
+
+// Simulated ECUs: Sends their frames, and moves the selector lever
+static void ecu_task(void* params) {
+    HostCanBus* bus = (HostCanBus*)params;
+    twai_message_t msg;
+    uint32_t tick = 0;
+    uint64_t next_lever_move = ms_to_us(shifter_interval_ms);
+    TickType_t last_wake = xTaskGetTickCount();
+    while (true) {
+        uint64_t now = HostSim::now();
+        if (now >= next_lever_move) {
+            lever_idx = (lever_idx + 1) % LEVER_SEQUENCE_LEN;
+            lever_moved = true;
+            lever_pending = false;
+            next_lever_move += ms_to_us(shifter_interval_ms);
+        }
+        for (uint8_t i = 0; i < sizeof(ECU_FRAMES)/sizeof(ECU_FRAMES[0]); i++) {
+            if (tick % (ECU_FRAMES[i].cycle_ms / SIM_CAR_ECU_TICK_MS) != 0) {
+                continue;
+            }
+            build_ecu_frame(ECU_FRAMES[i].can_id, &msg);
+            if (!bus->wait_transmit(&msg, HostSim::now() + ms_to_us(SIM_CAR_ECU_TICK_MS))) {
+                continue;
+            }
+            if (ECU_FRAMES[i].can_id == EWM_230_CAN_ID && lever_moved) {
+                // Timed from the first EWM_230 that carries it
+                lever_moved = false;
+                lever_pending = true;
+                lever_sent_time = HostSim::now();
+            }
+        }
+        tick++;
+        vTaskDelayUntil(&last_wake, SIM_CAR_ECU_TICK_MS);
+    }
+}
+
+// Watches what the TCM sends, timing how long each lever movement takes to show up in GS_418
+static void observer_task(void* params) {
+    HostCanBus* bus = (HostCanBus*)params;
+    twai_message_t msg;
+    while (true) {
+        if (!bus->wait_receive(&msg, UINT64_MAX) || msg.extd || msg.identifier != GS_418_CAN_ID) {
+            continue;
+        }
+        results.gs418_frames++;
+        // The frame that was on the bus when the fault hit still finishes, so only count ones started after it
+        if (bus_off_pending && HostSim::now() > bus_off_time + CAN_FRAME_TIME_US) {
+            results.bus_off_gaps.push_back((uint32_t)(HostSim::now() - bus_off_time));
+            bus_off_pending = false;
+        }
+        GS_418 gs418 = {};
+        memcpy(gs418.bytes, msg.data, 8);
+        if (lever_pending && gs418.get_WHST() == LEVER_REPORTED[lever_idx]) {
+            results.shifter_latencies.push_back((uint32_t)(HostSim::now() - lever_sent_time));
+            lever_pending = false;
+        }
+    }
+}
+
+// Adds the configured bus load with frames of its own
+static void load_task(void* params) {
+    const LoadConfig* config = (const LoadConfig*)params;
+    HostCanBus* bus = config->bus;
+    uint32_t load_percent = config->percent;
+    twai_message_t msg = {};
+    msg.identifier = config->can_id;
+    msg.data_length_code = 8;
+    uint32_t counter = 0;
+    uint64_t next_time = HostSim::now();
+    while (true) {
+        memcpy(msg.data, &counter, sizeof(counter));
+        counter++;
+        // At 100% just keep the Tx queue full, and let arbitration sort it out
+        if (!bus->wait_transmit(&msg, load_percent >= 100 ? UINT64_MAX : HostSim::now() + ms_to_us(SIM_CAR_ECU_TICK_MS))) {
+            continue;
+        }
+        if (load_percent < 100) {
+            next_time += (uint64_t)VirtualBus::frame_bits(&msg) * 1000000 * 100 / SIM_CAR_BUS_BITRATE / load_percent;
+            if (next_time > HostSim::now()) {
+                HostSim::block_current_task(next_time);
+            }
+        }
+    }
+}
+
+// Puts the TCM's CAN controller bus off every bus_off_interval_ms
+static void fault_task(void* params) {
+    TickType_t last_wake = xTaskGetTickCount();
+    while (true) {
+        vTaskDelayUntil(&last_wake, bus_off_interval_ms);
+        HostSim::inject_can_bus_off();
+        bus_off_pending = true;
+        bus_off_time = HostSim::now();
+    }
+}
+
+void SimCar::configure_node(HostCanBus* bus, const twai_filter_config_t* filter) {
+    twai_general_config_t config = TWAI_GENERAL_CONFIG_DEFAULT(GPIO_NUM_NC, GPIO_NUM_NC, TWAI_MODE_NORMAL);
+    config.rx_queue_len = SIM_NODE_RX_QUEUE_LEN;
+    bus->configure(&config, filter);
+}
+
+Gearbox* SimCar::start_tcm() {
+    egs_can_hal = new EgsCanHal("EGS52", 20);
+    if (!egs_can_hal->begin_tasks()) {
+        return nullptr;
+    }
+    Sensors::init_sensors();
+    init_all_solenoids();
+    static AbstractProfile* profiles[NUM_PROFILES] = {
+        new StandardProfile(),
+        new ComfortProfile(),
+        new AgilityProfile(),
+        new ManualProfile(),
+        new WinterProfile()
+    };
+    Gearbox* gearbox = new Gearbox();
+    gearbox->start_controller();
+    gearbox->set_profile(profiles[0]);
+    Kwp2000Server* diag_server = new Kwp2000Server(gearbox, nullptr, 0);
+    egs_can_hal->set_diag_server(diag_server);
+    static InputManagerConfig input_config = {
+        .gearbox = gearbox,
+        .profiles = profiles,
+        .num_profiles = NUM_PROFILES
+    };
+    xTaskCreate(input_manager, "INPUT_MANAGER", 8192, &input_config, 5, nullptr);
+    return gearbox;
+}
+
+void SimCar::start_ecus(HostCanBus* bus, uint32_t shifter_interval) {
+    shifter_interval_ms = shifter_interval;
+    xTaskCreate(ecu_task, "SIM_ECUS", 8192, bus, 5, nullptr);
+    xTaskCreate(observer_task, "SIM_OBSERVER", 8192, bus, 5, nullptr);
+}
+
+void SimCar::start_load(HostCanBus* bus, uint32_t percent, uint32_t can_id) {
+    LoadConfig* config = new LoadConfig { bus, percent, can_id };
+    xTaskCreate(load_task, "SIM_LOAD", 8192, config, 5, nullptr);
+}
+
+void SimCar::start_faults(uint32_t interval_ms) {
+    bus_off_interval_ms = interval_ms;
+    xTaskCreate(fault_task, "SIM_FAULTS", 8192, nullptr, 5, nullptr);
+}
+
+const SimCarResults* SimCar::get_results() {
+    return &results;
+}
@@ -0,0 +1,62 @@
+/**
+ * Host build: The car around the TCM, for tcm_sim and the host tests
+ *
+ * Simulated ECUs send the frames the TCM reads (BS_200, MS_210, EWM_230, MS_308, MS_608) at their cycle
+ * times, with the engine idling and the selector lever moved through P-R-N-D and back every so often.
+ * Every lever movement is timed from the EWM_230 frame carrying it to the first GS_418 frame that reports
+ * it (WHST), giving the end to end shifter latency through the CAN stack and the gearbox controller.
+ *
+ * A load generator adds a percentage of bus load on a CAN ID of its own (100% sends back to back), and
+ * fault injection puts the TCM's CAN controller bus off every so often, timing how long it is until the
+ * next GS_418 frame goes out.
+ *
+ * Every task here only runs in the simulation, so the results need no locking. Read them once HostSim::run() returns
+ */
+
+#ifndef __SIM_CAR_H_
+#define __SIM_CAR_H_
+
+#include <stdint.h>
+#include <vector>
+#include "shim/host_can_bus.h"
+#include "../src/gearbox.h"
+
+// Bitrate of the car's CAN bus
+#define SIM_CAR_BUS_BITRATE 500000
+// ECUs send at multiples of this
+#define SIM_CAR_ECU_TICK_MS 10
+
+typedef struct {
+    // End of the EWM_230 frame with a lever movement, to the end of the first GS_418 frame reporting it (us)
+    std::vector<uint32_t> shifter_latencies;
+    // Bus off, to the end of the next GS_418 frame (us)
+    std::vector<uint32_t> bus_off_gaps;
+    uint32_t gs418_frames;
+} SimCarResults;
+
+namespace SimCar {
+    /**
+     * Gives a simulated node the queues of a TWAI controller with the default driver config.
+     * 'filter' is nullptr to receive everything
+     */
+    void configure_node(HostCanBus* bus, const twai_filter_config_t* filter);
+
+    /**
+     * Starts the TCM the same way setup_tcm() in main.cpp does (CAN HAL on the bus given to HostSim::set_can_bus(),
+     * sensors, solenoids, gearbox controller, input manager and diagnostics). Returns nullptr if the CAN HAL failed to start
+     */
+    Gearbox* start_tcm();
+
+    // Starts the simulated ECUs on 'bus', moving the lever every 'shifter_interval_ms'
+    void start_ecus(HostCanBus* bus, uint32_t shifter_interval_ms);
+
+    // Starts sending 'percent' bus load on 'can_id' from 'bus'. Can be called for any number of load generators, each on a node of its own
+    void start_load(HostCanBus* bus, uint32_t percent, uint32_t can_id);
+
+    // Puts the TCM's CAN controller bus off every 'interval_ms'
+    void start_faults(uint32_t interval_ms);
+
+    const SimCarResults* get_results();
+}
+
+#endif // __SIM_CAR_H_
@@ -0,0 +1,120 @@
+#include "sim_io.h"
+#include "../src/sensors.h"
+#include "../src/solenoids/solenoids.h"
+#include "pins.h"
+
+SimInputs sim_inputs = {
+    .n2_rpm = 0,
+    .n3_rpm = 0,
+    .atf_temp_valid = false,
+    .atf_temp = 0,
+    .vbatt_mv = 12000,
+    .parking_lock = true
+};
+
+// PWM of each LEDC channel (8 bit)
+static uint8_t channel_pwm[LEDC_CHANNEL_MAX];
+
+bool Sensors::init_sensors() {
+    return true;
+}
+
+uint32_t Sensors::read_n2_rpm() {
+    return sim_inputs.n2_rpm;
+}
+
+uint32_t Sensors::read_n3_rpm() {
+    return sim_inputs.n3_rpm;
+}
+
+void Sensors::get_rpm_isr_stats(RpmIsrStats* n2, RpmIsrStats* n3) {
+    *n2 = {};
+    *n3 = {};
+}
+
+bool Sensors::read_vbatt(uint16_t* dest) {
+    *dest = sim_inputs.vbatt_mv;
+    return true;
+}
+
+bool Sensors::read_atf_temp(int* dest) {
+    if (!sim_inputs.atf_temp_valid || sim_inputs.parking_lock) {
+        return false; // Same as the real sensor, which cannot be read with the parking lock engaged
+    }
+    *dest = sim_inputs.atf_temp;
+    return true;
+}
+
+bool Sensors::parking_lock_engaged(bool* dest) {
+    *dest = sim_inputs.parking_lock;
+    return true;
+}
+
+Solenoid::Solenoid(const char *name, gpio_num_t pwm_pin, uint32_t frequency, ledc_channel_t channel, ledc_timer_t timer) {
+    this->name = name;
+    this->default_freq = frequency;
+    this->channel = channel;
+    this->timer = timer;
+    this->vref = 0;
+    this->vref_calibrated = true;
+    this->adc_reading = 0;
+    this->adc_reading_mutex = portMUX_INITIALIZER_UNLOCKED;
+    this->ready = true;
+    channel_pwm[channel] = 0;
+}
+
+void Solenoid::write_pwm(uint8_t pwm) {
+    channel_pwm[this->channel] = pwm;
+}
+
+void Solenoid::write_pwm_percent(uint16_t percent) {
+    uint32_t clamped = (percent > 1000) ? 1000 : percent;
+    this->write_pwm((255 * clamped) / 1000);
+}
+
+void Solenoid::write_pwm_percent_with_voltage(uint16_t percent, uint16_t curr_v_mv) {
+    uint32_t want_percent = (float)percent * solenoid_vref / (float)curr_v_mv;
+    this->write_pwm_percent(want_percent > 1000 ? 1000 : want_percent);
+}
+
+uint8_t Solenoid::get_pwm() {
+    return channel_pwm[this->channel];
+}
+
+uint16_t Solenoid::get_current_estimate() {
+    // No current sense, so assume the coil resistance is nominal
+    return (uint32_t)channel_pwm[this->channel] * SIM_SOLENOID_FULL_CURRENT_MA * sim_inputs.vbatt_mv / 12000 / 255;
+}
+
+bool Solenoid::init_ok() const {
+    return this->ready;
+}
+
+uint16_t Solenoid::get_vref() const {
+    return this->vref;
+}
+
+void Solenoid::__set_current_internal(uint16_t c) {
+    this->adc_reading = c;
+}
+
+void Solenoid::__set_vref(uint16_t ref) {
+    this->vref = ref;
+}
+
+Solenoid *sol_y3 = nullptr;
+Solenoid *sol_y4 = nullptr;
+Solenoid *sol_y5 = nullptr;
+Solenoid *sol_mpc = nullptr;
+Solenoid *sol_spc = nullptr;
+Solenoid *sol_tcc = nullptr;
+
+bool init_all_solenoids() {
+    sol_y3 = new Solenoid("Y3", PIN_Y3_PWM, 1000, LEDC_CHANNEL_0, LEDC_TIMER_0);
+    sol_y4 = new Solenoid("Y4", PIN_Y4_PWM, 1000, LEDC_CHANNEL_1, LEDC_TIMER_0);
+    sol_y5 = new Solenoid("Y5", PIN_Y5_PWM, 1000, LEDC_CHANNEL_2, LEDC_TIMER_0);
+    sol_mpc = new Solenoid("MPC", PIN_MPC_PWM, 1000, LEDC_CHANNEL_3, LEDC_TIMER_1);
+    sol_spc = new Solenoid("SPC", PIN_SPC_PWM, 1000, LEDC_CHANNEL_4, LEDC_TIMER_1);
+    sol_tcc = new Solenoid("TCC", PIN_TCC_PWM, 100, LEDC_CHANNEL_5, LEDC_TIMER_2);
+    return true;
+}
@@ -0,0 +1,28 @@
+/**
+ * Host build: Simulated sensors and solenoids
+ *
+ * Replaces sensors.cpp and solenoids.cpp. Sensor readings come from SimInputs, which the
+ * replay fills in from the log, and solenoid PWM is just stored so it can be read back.
+ */
+
+#ifndef __SIM_IO_H_
+#define __SIM_IO_H_
+
+#include <stdint.h>
+
+typedef struct {
+    uint32_t n2_rpm;
+    uint32_t n3_rpm;
+    bool atf_temp_valid;
+    // ATF temperature (x10 C)
+    int atf_temp;
+    uint16_t vbatt_mv;
+    bool parking_lock;
+} SimInputs;
+
+extern SimInputs sim_inputs;
+
+// Current (mA) a solenoid draws at 100% PWM with 12V on it
+#define SIM_SOLENOID_FULL_CURRENT_MA 2400
+
+#endif // __SIM_IO_H_
@@ -0,0 +1,137 @@
+#include "socketcan_bus.h"
+#include "shim/host_sim.h"
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include "esp_log.h"
+
+std::vector<SocketCanBus*> SocketCanBus::open_buses;
+
+SocketCanBus* SocketCanBus::open(const char* ifname) {
+    int fd = socket(PF_CAN, SOCK_RAW | SOCK_NONBLOCK, CAN_RAW);
+    if (fd < 0) {
+        ESP_LOGE("SOCKETCAN", "Could not create a CAN socket: %s", strerror(errno));
+        return nullptr;
+    }
+    struct ifreq ifr = {};
+    strncpy(ifr.ifr_name, ifname, IFNAMSIZ-1);
+    if (ioctl(fd, SIOCGIFINDEX, &ifr) < 0) {
+        ESP_LOGE("SOCKETCAN", "No CAN interface %s: %s", ifname, strerror(errno));
+        close(fd);
+        return nullptr;
+    }
+    struct sockaddr_can addr = {};
+    addr.can_family = AF_CAN;
+    addr.can_ifindex = ifr.ifr_ifindex;
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        ESP_LOGE("SOCKETCAN", "Could not bind to %s: %s", ifname, strerror(errno));
+        close(fd);
+        return nullptr;
+    }
+    SocketCanBus* bus = new SocketCanBus(fd);
+    open_buses.push_back(bus);
+    return bus;
+}
+
+SocketCanBus::~SocketCanBus() {
+    for (size_t i = 0; i < open_buses.size(); i++) {
+        if (open_buses[i] == this) {
+            open_buses.erase(open_buses.begin() + i);
+            break;
+        }
+    }
+    close(this->fd);
+}
+
+bool SocketCanBus::receive(twai_message_t* msg, uint64_t now) {
+    if (this->rx_queue.empty() || this->rx_queue.front().time > now) {
+        return false;
+    }
+    *msg = this->rx_queue.front().msg;
+    this->rx_queue.pop_front();
+    return true;
+}
+
+uint64_t SocketCanBus::get_next_rx_time() {
+    return this->rx_queue.empty() ? UINT64_MAX : this->rx_queue.front().time;
+}
+
+bool SocketCanBus::transmit(const twai_message_t* msg, uint64_t now) {
+    struct can_frame f = {};
+    f.can_id = msg->extd ? (msg->identifier & CAN_EFF_MASK) | CAN_EFF_FLAG : msg->identifier & CAN_SFF_MASK;
+    if (msg->rtr) {
+        f.can_id |= CAN_RTR_FLAG;
+    }
+    f.can_dlc = msg->data_length_code > 8 ? 8 : msg->data_length_code;
+    memcpy(f.data, msg->data, 8);
+    if (write(this->fd, &f, sizeof(f)) == sizeof(f)) {
+        return true;
+    }
+    if (errno == EAGAIN || errno == ENOBUFS) {
+        this->tx_blocked = true;
+    } else {
+        ESP_LOGE("SOCKETCAN", "Write failed: %s", strerror(errno));
+    }
+    return false;
+}
+
+void SocketCanBus::read_frames(uint64_t now) {
+    struct can_frame f;
+    bool got = false;
+    while (read(this->fd, &f, sizeof(f)) == sizeof(f)) {
+        if (f.can_id & CAN_ERR_FLAG) {
+            continue;
+        }
+        TimedFrame rx = {};
+        rx.msg.extd = (f.can_id & CAN_EFF_FLAG) != 0;
+        rx.msg.rtr = (f.can_id & CAN_RTR_FLAG) != 0;
+        rx.msg.identifier = f.can_id & (rx.msg.extd ? CAN_EFF_MASK : CAN_SFF_MASK);
+        rx.msg.data_length_code = f.can_dlc > 8 ? 8 : f.can_dlc;
+        memcpy(rx.msg.data, f.data, 8);
+        rx.time = now;
+        if (!this->filter_accepts(&rx.msg)) {
+            continue;
+        }
+        if (this->rx_queue.size() >= this->rx_queue_len) {
+            this->rx_overflow_count++;
+            continue;
+        }
+        this->rx_queue.push_back(rx);
+        got = true;
+    }
+    if (got) {
+        this->notify_rx(now);
+    }
+}
+
+bool SocketCanBus::wait_io(uint64_t max_wait_us) {
+    std::vector<struct pollfd> fds(open_buses.size());
+    for (size_t i = 0; i < open_buses.size(); i++) {
+        fds[i].fd = open_buses[i]->fd;
+        fds[i].events = POLLIN | (open_buses[i]->tx_blocked ? POLLOUT : 0);
+        fds[i].revents = 0;
+    }
+    struct timespec timeout = {
+        .tv_sec = (time_t)(max_wait_us / 1000000),
+        .tv_nsec = (long)(max_wait_us % 1000000) * 1000
+    };
+    return ppoll(fds.data(), fds.size(), &timeout, nullptr) > 0;
+}
+
+void SocketCanBus::handle_io() {
+    uint64_t now = HostSim::now();
+    for (SocketCanBus* bus : open_buses) {
+        bus->read_frames(now);
+        if (bus->tx_blocked) {
+            // Let the Tx task try again. If the kernel's queue is still full it just blocks again
+            bus->tx_blocked = false;
+            bus->notify_tx(now);
+        }
+    }
+}
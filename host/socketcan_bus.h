@@ -0,0 +1,55 @@
+/**
+ * Host build: Linux SocketCAN bus (vcan0 for a virtual bus shared with other processes, or can0 for a real one)
+ *
+ * This only works in real time, so the simulation has to be switched over with
+ * HostSim::set_real_time(SocketCanBus::wait_io, SocketCanBus::handle_io).
+ * Frames are timestamped when the scheduler picks them up, and the kernel queues frames we send
+ * (So get_tx_queue_len() is always 0, and transmit() only fails when the kernel's queue is full).
+ *
+ * Every SocketCanBus opened gets its own socket, and frames one socket sends are received by the other sockets
+ * on the same interface, so the firmware and simulated ECUs can share one vcan interface in the same process.
+ */
+
+#ifndef __SOCKETCAN_BUS_H_
+#define __SOCKETCAN_BUS_H_
+
+#include <stdint.h>
+#include <deque>
+#include <vector>
+#include "shim/host_can_bus.h"
+
+class SocketCanBus : public HostCanBus {
+    public:
+        // Opens a socket on 'ifname'. Returns nullptr (Having logged why) if that fails
+        static SocketCanBus* open(const char* ifname);
+        ~SocketCanBus();
+
+        bool receive(twai_message_t* msg, uint64_t now) override;
+        uint64_t get_next_rx_time() override;
+        bool transmit(const twai_message_t* msg, uint64_t now) override;
+        uint32_t get_tx_queue_len() override {
+            return 0;
+        }
+
+        // HostSim::IoWait / HostSim::IoHandler, over every open socket
+        static bool wait_io(uint64_t max_wait_us);
+        static void handle_io();
+    private:
+        explicit SocketCanBus(int fd) : fd(fd) {}
+        // Reads every frame waiting on the socket into the Rx queue
+        void read_frames(uint64_t now);
+
+        typedef struct {
+            twai_message_t msg;
+            uint64_t time;
+        } TimedFrame;
+
+        int fd;
+        std::deque<TimedFrame> rx_queue;
+        // transmit() failed as the kernel's queue was full, so wait for the socket to be writable
+        bool tx_blocked = false;
+
+        static std::vector<SocketCanBus*> open_buses;
+};
+
+#endif // __SOCKETCAN_BUS_H_
@@ -0,0 +1,290 @@
+/**
+ * Host build: Full TCM on a simulated bus
+ *
+ * Runs the complete TCM task set (CAN Rx/Tx, gearbox controller, input manager and diagnostics, started
+ * the same way setup_tcm() does) alongside simulated ECUs, either:
+ * - On the in-process virtual bus (Default), in lockstep with the simulated clock, so it runs
+ *   as fast as the code allows and every run is the same.
+ * - On a SocketCAN interface (-c vcan0), in real time. Other programs (candump, cangen, canplayer...)
+ *   can then share the bus. Use -n to leave out the simulated ECUs if something else provides them.
+ *
+ * The simulated ECUs (See sim_car.h) send the frames the TCM reads (BS_200, MS_210, EWM_230, MS_308, MS_608) at their cycle
+ * times, with the engine idling and the selector lever moved through P-R-N-D and back every few seconds.
+ * Every lever movement is timed from the EWM_230 frame carrying it to the first GS_418 frame that reports
+ * it (WHST), giving the end to end shifter latency through the CAN stack and the gearbox controller.
+ *
+ * A load generator (-l) adds the given percentage of bus load on a CAN ID of its own (-i), so the stack can be
+ * tested on a full bus (-l 100 sends back to back). With a CAN ID below 0x218 it wins arbitration against
+ * everything the TCM sends.
+ *
+ * Fault injection (-b) puts the TCM's CAN controller bus off every so often, so the recovery done by the
+ * CAN HAL's bus monitor can be seen end to end: How long the controller took to get back on the bus,
+ * and how long it was until the next GS_418 frame went out.
+ *
+ * Usage: tcm_sim [-t <seconds>] [-c <SocketCAN interface>] [-n] [-l <load %>] [-i <load CAN ID (hex)>]
+ *                [-s <shifter interval ms>] [-b <bus off interval ms>] [-o <bus log.log>] [-v <log level 0-5>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "shim/host_sim.h"
+#include "shim/host_can_bus.h"
+#include "virtual_bus.h"
+#include "socketcan_bus.h"
+#include "sim_car.h"
+#include "../src/canbus/egs_can_hal.h"
+#include "../src/canbus/can_filter.h"
+
+// Settings
+static uint32_t shifter_interval_ms = 2000;
+static uint32_t load_percent = 0;
+static uint32_t load_can_id = 0x0F0;
+static uint32_t bus_off_interval_ms = 0;
+static FILE* bus_log = nullptr;
+
+static void on_bus_frame(const twai_message_t* msg, uint64_t start, uint64_t end, const VirtualBusNode* sender) {
+    if (bus_log == nullptr) {
+        return;
+    }
+    fprintf(bus_log, "(%llu.%06llu) can0 %03X#", (unsigned long long)(end / 1000000), (unsigned long long)(end % 1000000), msg->identifier);
+    for (uint8_t i = 0; i < msg->data_length_code && i < 8; i++) {
+        fprintf(bus_log, "%02X", msg->data[i]);
+    }
+    fputc('\n', bus_log);
+}
+
+static void on_signal(int sig) {
+    HostSim::stop();
+}
+
+static uint32_t percentile(const std::vector<uint32_t>& sorted, uint32_t pct) {
+    return sorted[(sorted.size() - 1) * pct / 100];
+}
+
+static void print_latencies(const char* what, const char* events, const std::vector<uint32_t>& latencies) {
+    std::vector<uint32_t> sorted = latencies;
+    std::sort(sorted.begin(), sorted.end());
+    uint64_t total = 0;
+    for (uint32_t l : sorted) {
+        total += l;
+    }
+    printf(
+        "%s (us, %u %s): min %u, avg %llu, p50 %u, p99 %u, max %u\n",
+        what,
+        (uint32_t)sorted.size(),
+        events,
+        sorted.front(),
+        (unsigned long long)(total / sorted.size()),
+        percentile(sorted, 50),
+        percentile(sorted, 99),
+        sorted.back()
+    );
+}
+
+static void print_bus_stats() {
+    CanBusStats s = egs_can_hal->get_bus_stats();
+    printf(
+        "TCM CAN controller: TEC %u, REC %u. %u bus off, %u recovered (%u retries). Recovery time (us) last %u, max %u\n",
+        s.tx_error_counter,
+        s.rx_error_counter,
+        s.bus_off_count,
+        s.recovery_count,
+        s.recovery_retry_count,
+        s.last_recovery_us,
+        s.max_recovery_us
+    );
+    if (s.recovery_count == 0) {
+        return;
+    }
+    printf("Recovery time histogram:");
+    for (uint8_t i = 0; i < CAN_RECOVERY_HISTOGRAM_BUCKETS; i++) {
+        if (i < CAN_RECOVERY_HISTOGRAM_BUCKETS-1) {
+            printf(" <=%ums: %u", 1u << i, s.recovery_histogram[i]);
+        } else {
+            printf(" >%ums: %u", 1u << (i-1), s.recovery_histogram[i]);
+        }
+    }
+    putchar('\n');
+    const SimCarResults* results = SimCar::get_results();
+    if (!results->bus_off_gaps.empty()) {
+        print_latencies("Bus off to next GS_418", "bus offs", results->bus_off_gaps);
+    }
+}
+
+static void print_tcm_stats() {
+    uint32_t can_id;
+    TxFrameStats tx_stats;
+    CanRxStats rx_stats = egs_can_hal->get_rx_stats();
+    printf("TCM Rx: %u frames, %u dropped, %u rejected, %u Rx queue overflows\n", rx_stats.rx_count, rx_stats.dropped_count, rx_stats.rejected_count, rx_stats.rx_queue_overflow_count);
+    printf("TCM Rx ring: %u overflows, high water %u/%u. Drain latency (us) last %u, max %u\n", rx_stats.ring_overflow_count, rx_stats.ring_high_water, rx_stats.ring_size, rx_stats.last_drain_latency_us, rx_stats.max_drain_latency_us);
+    for (uint8_t i = 0; i < egs_can_hal->get_num_tx_frames(); i++) {
+        if (egs_can_hal->get_tx_frame_stats(i, &can_id, &tx_stats)) {
+            printf(
+                "TCM Tx 0x%03X: %u frames, %u out of cycle, %u failed. Deadlines missed %u. Lateness (us) max %u\n",
+                can_id,
+                tx_stats.tx_count,
+                tx_stats.urgent_count,
+                tx_stats.failed_count,
+                tx_stats.missed_count,
+                tx_stats.max_jitter
+            );
+        }
+    }
+    print_bus_stats();
+    const SimCarResults* results = SimCar::get_results();
+    if (results->shifter_latencies.empty()) {
+        printf("Shifter to GS_418 latency: No lever movements seen in GS_418 (%u GS_418 frames)\n", results->gs418_frames);
+        return;
+    }
+    print_latencies("Shifter to GS_418 latency", "lever movements", results->shifter_latencies);
+}
+
+static void print_node_stats(const VirtualBusNode* node) {
+    VirtualBusNodeStats s = node->get_stats();
+    printf(
+        "Node %s: %u Tx, %u Rx, lost arbitration %u times, max Tx latency %u us. %u filtered, %u Rx queue overflows\n",
+        node->get_name(),
+        s.tx_count,
+        s.rx_count,
+        s.arbitration_lost_count,
+        s.max_tx_latency_us,
+        node->get_filtered_count(),
+        node->get_rx_overflow_count()
+    );
+}
+
+int main(int argc, char** argv) {
+    double run_secs = -1;
+    const char* socketcan_if = nullptr;
+    bool sim_ecus = true;
+    const char* log_path = nullptr;
+    int log_level = ESP_LOG_WARN;
+    bool bad_args = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0) {
+            sim_ecus = false;
+        } else if (i+1 >= argc) {
+            bad_args = true;
+        } else if (strcmp(argv[i], "-t") == 0) {
+            run_secs = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-c") == 0) {
+            socketcan_if = argv[++i];
+        } else if (strcmp(argv[i], "-l") == 0) {
+            load_percent = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-i") == 0) {
+            load_can_id = strtoul(argv[++i], nullptr, 16) & 0x7FF;
+        } else if (strcmp(argv[i], "-s") == 0) {
+            shifter_interval_ms = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-b") == 0) {
+            bus_off_interval_ms = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-o") == 0) {
+            log_path = argv[++i];
+        } else if (strcmp(argv[i], "-v") == 0) {
+            log_level = atoi(argv[++i]);
+        } else {
+            bad_args = true;
+        }
+    }
+    if (bad_args || shifter_interval_ms < SIM_CAR_ECU_TICK_MS || load_percent > 100 || (log_path != nullptr && socketcan_if != nullptr)) {
+        fprintf(stderr, "Usage: %s [-t <seconds>] [-c <SocketCAN interface>] [-n] [-l <load %%>] [-i <load CAN ID (hex)>]\n", argv[0]);
+        fprintf(stderr, "       [-s <shifter interval ms>] [-b <bus off interval ms>] [-o <bus log.log> (Virtual bus only)] [-v <log level 0-5>]\n");
+        return 1;
+    }
+    if (run_secs < 0) {
+        run_secs = socketcan_if == nullptr ? 60 : 0; // Until Ctrl+C on a real bus
+    }
+    esp_log_level_set("*", (esp_log_level_t)log_level);
+    if (log_path != nullptr) {
+        bus_log = fopen(log_path, "w");
+        if (bus_log == nullptr) {
+            fprintf(stderr, "Could not create %s\n", log_path);
+            return 1;
+        }
+    }
+
+    VirtualBus* vbus = nullptr;
+    HostCanBus* tcm_bus;
+    HostCanBus* ecu_bus = nullptr;
+    HostCanBus* load_bus = nullptr;
+    if (socketcan_if != nullptr) {
+        HostSim::set_real_time(SocketCanBus::wait_io, SocketCanBus::handle_io);
+        tcm_bus = SocketCanBus::open(socketcan_if);
+        if (tcm_bus != nullptr && sim_ecus) {
+            ecu_bus = SocketCanBus::open(socketcan_if);
+        }
+        if (tcm_bus != nullptr && load_percent != 0) {
+            load_bus = SocketCanBus::open(socketcan_if);
+        }
+        if (tcm_bus == nullptr || (sim_ecus && ecu_bus == nullptr) || (load_percent != 0 && load_bus == nullptr)) {
+            fprintf(stderr, "Could not open %s\n", socketcan_if);
+            return 1;
+        }
+    } else {
+        vbus = new VirtualBus(SIM_CAR_BUS_BITRATE);
+        vbus->set_tap(on_bus_frame);
+        tcm_bus = vbus->add_node("TCM");
+        if (sim_ecus) {
+            ecu_bus = vbus->add_node("ECUs");
+        }
+        if (load_percent != 0) {
+            load_bus = vbus->add_node("LOAD");
+        }
+    }
+    if (ecu_bus != nullptr) {
+        SimCar::configure_node(ecu_bus, nullptr);
+    }
+    if (load_bus != nullptr) {
+        // Load generator never reads anything, so only let through its own CAN ID (Which nobody else sends)
+        twai_filter_config_t load_filter = calc_acceptance_filter(&load_can_id, 1);
+        SimCar::configure_node(load_bus, &load_filter);
+    }
+    HostSim::set_can_bus(tcm_bus);
+    signal(SIGINT, on_signal);
+
+    // Same start up as setup_tcm() in main.cpp
+    if (SimCar::start_tcm() == nullptr) {
+        fprintf(stderr, "CAN init failed\n");
+        return 1;
+    }
+
+    // Simulated ECUs, load generator and fault injection
+    if (ecu_bus != nullptr) {
+        SimCar::start_ecus(ecu_bus, shifter_interval_ms);
+    }
+    if (load_bus != nullptr) {
+        SimCar::start_load(load_bus, load_percent, load_can_id);
+    }
+    if (bus_off_interval_ms != 0) {
+        SimCar::start_faults(bus_off_interval_ms);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    HostSim::run(run_secs > 0 ? (uint64_t)(run_secs * 1000000) : UINT64_MAX);
+    double wall_secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double sim_secs = HostSim::now() / 1000000.0;
+    HostSim::shutdown();
+    if (bus_log != nullptr) {
+        fclose(bus_log);
+    }
+
+    printf("Simulated %.1f s in %.3f s (%.1fx real time)\n", sim_secs, wall_secs, wall_secs > 0 ? sim_secs / wall_secs : 0.0);
+    if (vbus != nullptr) {
+        VirtualBusStats bus_stats = vbus->get_stats();
+        printf("Bus: %u frames, %.1f%% load\n", bus_stats.frames, sim_secs > 0 ? bus_stats.busy_us / (sim_secs * 10000) : 0.0);
+        print_node_stats((VirtualBusNode*)tcm_bus);
+        if (ecu_bus != nullptr) {
+            print_node_stats((VirtualBusNode*)ecu_bus);
+        }
+        if (load_bus != nullptr) {
+            print_node_stats((VirtualBusNode*)load_bus);
+        }
+    }
+    print_tcm_stats();
+    printf("Task switches: %llu\n", (unsigned long long)HostSim::get_task_switches());
+    return 0;
+}
@@ -0,0 +1,175 @@
+#
+# Host build: Writes the cases for test_accessors and bench_accessors, from the CAN database
+#
+# Usage: gen_accessor_cases.py <ECU dir (Eg. lib/egs52_ecus)> <output header> <ECU name>...
+#
+# For every signal of the given ECUs in can_data.txt, the output has:
+# - An ACCESSOR_CASES entry with the signal's offset and length as the DB gives them, plus the generated
+#   setter and getter of the frame's union (From the ECU's header), for the test to check against each other.
+# - Per frame decode / encode functions, written the way the firmware did before the accessors worked on the
+#   payload in wire order (Big endian reassembly loop + shifts, to_bytes() loop), and with the accessors.
+#
+# Offsets count from the most significant bit of the payload read as a big endian number (Same as convert.py)
+
+import re
+import sys
+
+ecu_dir = sys.argv[1]
+output = sys.argv[2]
+ecu_names = sys.argv[3:]
+
+def as_unsigned(t: str) -> str:
+    """
+    Cast that reads a getter's return type as an unsigned number (char is signed on x86, so would sign extend)
+    """
+    return "(uint64_t)(uint8_t)" if t == "char" else "(uint64_t)"
+
+def read_db(path: str) -> dict:
+    """
+    Returns {ECU name: [(frame name, [(signal name, offset, length)])]}, skipping ISO-TP endpoints like convert.py does
+    """
+    ecus = {}
+    frames = None
+    signals = None
+    for line in open(path, 'r', encoding='utf-8'):
+        l = line.strip()
+        if l.startswith("#"):
+            continue
+        if l.startswith("ECU "):
+            frames = ecus.setdefault(l.split("ECU ")[1].strip(), [])
+            signals = None
+        elif l.startswith("FRAME"):
+            signals = []
+            frames.append((l.split("FRAME ")[1].split("(")[0].strip().removesuffix("h"), signals))
+        elif l.startswith("SIGNAL") and signals is not None:
+            name = l.split("SIGNAL ")[1].split(", ")[0].strip()
+            offset = int(l.split("OFFSET: ")[1].split(",")[0], 10)
+            length = int(l.split("LEN: ")[1].split(",")[0], 10)
+            signals.append((name, offset, length))
+    for name in ecus:
+        ecus[name] = [f for f in ecus[name] if len(f[1]) > 1]
+    return ecus
+
+def read_setter_types(path: str) -> dict:
+    """
+    Returns {frame name: {signal name: setter argument type}} from a generated ECU header
+    """
+    types = {}
+    pending = {}
+    for line in open(path, 'r', encoding='utf-8'):
+        m = re.search(r"void set_(\w+)\(([\w:]+) value\)", line)
+        if m:
+            pending[m.group(1)] = m.group(2)
+            continue
+        m = re.match(r"\s*}\s*(\w+);", line)
+        if m and pending:
+            types[m.group(1)] = pending
+            pending = {}
+    return types
+
+db = read_db("{}/can_data.txt".format(ecu_dir))
+cases = []
+frames = []
+for ecu in ecu_names:
+    types = read_setter_types("{}/src/{}.h".format(ecu_dir, ecu))
+    for frame, signals in db[ecu]:
+        usable = []
+        for name, offset, length in signals:
+            if frame not in types or name not in types[frame]:
+                print("ERROR. No setter for {}.{} in {}.h".format(frame, name, ecu))
+                sys.exit(1)
+            usable.append((name, offset, length, types[frame][name]))
+        frames.append((ecu, frame, usable))
+        cases += [(frame, s) for s in usable]
+
+out = """/**
+ * AUTOGENERATED BY gen_accessor_cases.py from {0}/can_data.txt ({1})
+ */
+
+#ifndef __ACCESSOR_CASES_H_
+#define __ACCESSOR_CASES_H_
+
+#include <stdint.h>
+#include <string.h>
+#include "canbus/can_egs52.h"
+""".format(ecu_dir.rstrip("/").split("/")[-1], ", ".join(ecu_names))
+for ecu in ecu_names:
+    out += "#include \"{}.h\"\n".format(ecu)
+out += """
+typedef struct {
+    const char* frame;
+    const char* signal;
+    uint8_t offset;
+    uint8_t length;
+    // Returns 'raw' with the signal set to 'value' by the generated setter
+    uint64_t (*set)(uint64_t raw, uint64_t value);
+    // Returns the signal in 'raw', as read by the generated getter
+    uint64_t (*get)(uint64_t raw);
+} AccessorCase;
+
+static const AccessorCase ACCESSOR_CASES[] = {
+"""
+for frame, (name, offset, length, t) in cases:
+    out += "    {{ \"{0}\", \"{1}\", {2}, {3},\n".format(frame, name, offset, length)
+    out += "        [](uint64_t raw, uint64_t value) -> uint64_t {{ {0} f; f.raw = raw; f.set_{1}(({2})value); return f.raw; }},\n".format(frame, name, t)
+    out += "        [](uint64_t raw) -> uint64_t {{ {0} f; f.raw = raw; return {2}f.get_{1}(); }} }},\n".format(frame, name, as_unsigned(t))
+out += "};\n"
+out += "#define NUM_ACCESSOR_CASES {}\n".format(len(cases))
+
+out += """
+typedef struct {
+    const char* frame;
+    // Sums every signal of the payload in 'data'
+    uint64_t (*old_decode)(const uint8_t* data);
+    uint64_t (*new_decode)(const uint8_t* data);
+    // Builds a payload in 'data' with every signal set from 'seed'
+    void (*old_encode)(uint64_t seed, uint8_t* data);
+    void (*new_encode)(uint64_t seed, uint8_t* data);
+} FrameCodec;
+"""
+for ecu, frame, signals in frames:
+    old_decode = ""
+    new_decode = ""
+    old_encode = ""
+    new_encode = ""
+    for i, (name, offset, length, t) in enumerate(signals):
+        mask = (1 << length) - 1
+        shift = 64 - offset - length
+        old_decode += "\n    sum += value >> {0} & 0x{1:x}ULL;".format(shift, mask)
+        new_decode += "\n    sum += {1}f.get_{0}();".format(name, as_unsigned(t))
+        old_encode += "\n    raw = (raw & ~(0x{1:x}ULL << {0})) | ((seed + {2}) & 0x{1:x}ULL) << {0};".format(shift, mask, i)
+        new_encode += "\n    f.set_{0}(({1})((seed + {2}) & 0x{3:x}ULL));".format(name, t, i, mask)
+    out += """
+// {0}
+__attribute__((noinline)) static uint64_t old_decode_{0}(const uint8_t* data) {{
+    uint64_t value = 0;
+    for (uint8_t i = 0; i < 8; i++) {{
+        value |= (uint64_t)data[i] << (8*(7-i));
+    }}
+    uint64_t sum = 0;{1}
+    return sum;
+}}
+__attribute__((noinline)) static uint64_t new_decode_{0}(const uint8_t* data) {{
+    {0} f;
+    memcpy(f.bytes, data, 8);
+    uint64_t sum = 0;{2}
+    return sum;
+}}
+__attribute__((noinline)) static void old_encode_{0}(uint64_t seed, uint8_t* data) {{
+    uint64_t raw = 0;{3}
+    for (uint8_t i = 0; i < 8; i++) {{
+        data[i] = raw >> (8*(7-i));
+    }}
+}}
+__attribute__((noinline)) static void new_encode_{0}(uint64_t seed, uint8_t* data) {{
+    {0} f = {{}};{4}
+    memcpy(data, f.bytes, 8);
+}}
+""".format(frame, old_decode, new_decode, old_encode, new_encode)
+out += "\nstatic const FrameCodec FRAME_CODECS[] = {\n"
+for ecu, frame, signals in frames:
+    out += "    {{ \"{0}\", old_decode_{0}, new_decode_{0}, old_encode_{0}, new_encode_{0} }},\n".format(frame)
+out += "};\n"
+out += "#define NUM_FRAME_CODECS {}\n".format(len(frames))
+out += "\n#endif // __ACCESSOR_CASES_H_\n"
+open(output, 'w').write(out)
@@ -0,0 +1,49 @@
+/**
+ * Host build: Checks used by the host tests (host/test)
+ *
+ * Every test is an executable of its own, as the simulation (See shim/host_sim.h) is global, and is run by ctest.
+ * A failed check is printed and the test carries on, so one run reports every failure. main() returns test_result().
+ */
+
+#ifndef __HOST_TEST_H_
+#define __HOST_TEST_H_
+
+#include <stdio.h>
+
+static int test_failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            test_failures++; \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+        } \
+    } while (0)
+
+// Integer checks, which also print both values
+#define CHECK_CMP(a, op, b) \
+    do { \
+        long long _a = (long long)(a); \
+        long long _b = (long long)(b); \
+        if (!(_a op _b)) { \
+            test_failures++; \
+            fprintf(stderr, "%s:%d: CHECK(%s %s %s) failed (%lld vs %lld)\n", __FILE__, __LINE__, #a, #op, #b, _a, _b); \
+        } \
+    } while (0)
+
+#define CHECK_EQ(a, b) CHECK_CMP(a, ==, b)
+#define CHECK_LE(a, b) CHECK_CMP(a, <=, b)
+#define CHECK_LT(a, b) CHECK_CMP(a, <, b)
+#define CHECK_GE(a, b) CHECK_CMP(a, >=, b)
+
+// Exit code of the test
+static inline int test_result() {
+    if (test_failures != 0) {
+        fprintf(stderr, "FAILED: %d check(s)\n", test_failures);
+        return 1;
+    }
+    printf("PASSED\n");
+    return 0;
+}
+
+#endif // __HOST_TEST_H_
@@ -0,0 +1,70 @@
+/**
+ * Host test: Generated frame accessors of GS, MS and ESP_SBC against the CAN database
+ *
+ * For every signal, on random payloads and values (See accessor_cases.h, generated by gen_accessor_cases.py):
+ * - The getter reads the same value as a big endian extract at the DB's offset and length
+ * - The setter stores the value there, and leaves every other bit of the payload alone
+ * - The getter reads back what the setter stored
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "test.h"
+#include "accessor_cases.h"
+
+#define ITERATIONS 2000
+
+// Reference: Signal at 'offset' (From the MSB) and 'length' in the payload read as a big endian number
+static uint64_t be_extract(uint64_t raw, uint8_t offset, uint8_t length) {
+    uint8_t bytes[8];
+    memcpy(bytes, &raw, 8);
+    uint64_t value = 0;
+    for (uint8_t i = 0; i < 8; i++) {
+        value = value << 8 | bytes[i];
+    }
+    return value >> (64 - offset - length) & ((1ULL << length) - 1);
+}
+
+static uint64_t be_field_mask(uint8_t offset, uint8_t length) {
+    uint64_t be = ((1ULL << length) - 1) << (64 - offset - length);
+    uint8_t bytes[8];
+    for (uint8_t i = 0; i < 8; i++) {
+        bytes[i] = be >> (8*(7-i));
+    }
+    uint64_t raw;
+    memcpy(&raw, bytes, 8);
+    return raw;
+}
+
+static uint64_t rand64() {
+    return (uint64_t)rand() << 62 ^ (uint64_t)rand() << 31 ^ (uint64_t)rand();
+}
+
+int main() {
+    srand(52);
+    for (uint32_t c = 0; c < NUM_ACCESSOR_CASES; c++) {
+        const AccessorCase* a = &ACCESSOR_CASES[c];
+        uint64_t length_mask = (1ULL << a->length) - 1;
+        uint64_t field = be_field_mask(a->offset, a->length);
+        uint32_t failures = 0;
+        for (uint32_t i = 0; i < ITERATIONS && failures == 0; i++) {
+            uint64_t raw = rand64();
+            // All zeros and all ones in the signal are the interesting values, so try them first
+            uint64_t value = i == 0 ? 0 : i == 1 ? length_mask : rand64() & length_mask;
+            if ((a->get(raw) & length_mask) != be_extract(raw, a->offset, a->length)) {
+                failures++;
+            }
+            uint64_t set = a->set(raw, value);
+            if (be_extract(set, a->offset, a->length) != value || (set & ~field) != (raw & ~field) || (a->get(set) & length_mask) != value) {
+                failures++;
+            }
+        }
+        if (failures != 0) {
+            fprintf(stderr, "%s.%s (Offset %u, length %u) does not match the DB\n", a->frame, a->signal, a->offset, a->length);
+        }
+        CHECK_EQ(failures, 0);
+    }
+    printf("%u signals checked\n", NUM_ACCESSOR_CASES);
+    return test_result();
+}
@@ -0,0 +1,121 @@
+/**
+ * Host test: ATF temperature of every raw ADC2 code (src/sensors.cpp), against the interpolation the table replaced
+ *
+ * Every code below PARKING_LOCK_RAW is put on the ATF pin in turn, right after a parking lock reading, so the
+ * sampler's filter starts again from exactly that code. The temperature read back must be within 0.1C (1 in x10 C)
+ * of the calibration curve followed by linear interpolation of atf_temp_lookup, in floating point.
+ * Codes from PARKING_LOCK_RAW up must read as parking lock engaged, with no temperature.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "test.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_adc_cal.h"
+#include "shim/host_sim.h"
+#include "virtual_bus.h"
+#include "../src/sensors.h"
+
+#define ADC_CHANNEL_VBATT ADC2_CHANNEL_8
+#define ADC_CHANNEL_ATF ADC2_CHANNEL_9
+#define PARKING_LOCK_RAW 3900
+#define MAX_RAW 4095
+#define ADC_SAMPLE_INTERVAL_MS 10
+// 0.1C
+#define MAX_ERROR 1
+
+typedef struct {
+    uint16_t v;
+    int temp;
+} TempPoint;
+
+// atf_temp_lookup in sensors.cpp (mV, x10 C)
+static const TempPoint TEMP_POINTS[] = {
+    {453, -400}, {468, -300}, {483, -200}, {498, -100}, {514, 0}, {531, 100}, {547, 200}, {565, 300},
+    {582, 400}, {600, 500}, {619, 600}, {636, 700}, {658, 800}, {678, 900}, {699, 1000}, {720, 1100},
+    {742, 1200}, {764, 1300}, {788, 1400}, {812, 1500}, {834, 1600}, {862, 1700}
+};
+#define NUM_TEMP_POINTS (sizeof(TEMP_POINTS)/sizeof(TEMP_POINTS[0]))
+
+static double interpolate(uint32_t raw) {
+    esp_adc_cal_characteristics_t cal;
+    esp_adc_cal_characterize(ADC_UNIT_2, ADC_ATTEN_11db, ADC_WIDTH_12Bit, 0, &cal);
+    double mv = esp_adc_cal_raw_to_voltage(raw, &cal);
+    if (mv <= TEMP_POINTS[0].v) {
+        return TEMP_POINTS[0].temp;
+    }
+    for (uint8_t i = 0; i < NUM_TEMP_POINTS - 1; i++) {
+        if (mv <= TEMP_POINTS[i+1].v) {
+            return TEMP_POINTS[i].temp + (TEMP_POINTS[i+1].temp - TEMP_POINTS[i].temp) * (mv - TEMP_POINTS[i].v) / (TEMP_POINTS[i+1].v - TEMP_POINTS[i].v);
+        }
+    }
+    return TEMP_POINTS[NUM_TEMP_POINTS-1].temp;
+}
+
+static uint32_t checked = 0;
+static uint32_t bad = 0;
+static uint32_t unreadable = 0;
+static uint32_t lock_checked = 0;
+static uint32_t lock_bad = 0;
+static double max_error = 0;
+static bool sweep_done = false;
+
+// Half a sample interval out of step with the sampler, so every value set is in place for its next conversions
+static void sweep_task(void*) {
+    vTaskDelay(ADC_SAMPLE_INTERVAL_MS / 2);
+    for (uint32_t raw = 0; raw < PARKING_LOCK_RAW; raw++) {
+        HostSim::set_adc2_raw(ADC_CHANNEL_ATF, MAX_RAW);
+        vTaskDelay(ADC_SAMPLE_INTERVAL_MS);
+        HostSim::set_adc2_raw(ADC_CHANNEL_ATF, raw);
+        vTaskDelay(ADC_SAMPLE_INTERVAL_MS);
+        int temp;
+        if (!Sensors::read_atf_temp(&temp)) {
+            unreadable++;
+            continue;
+        }
+        double error = abs(temp - interpolate(raw));
+        if (error > MAX_ERROR) {
+            fprintf(stderr, "Raw %u: %d, interpolated %.2f\n", raw, temp, interpolate(raw));
+            bad++;
+        }
+        if (error > max_error) {
+            max_error = error;
+        }
+        checked++;
+    }
+    for (uint32_t raw = PARKING_LOCK_RAW; raw <= MAX_RAW; raw++) {
+        HostSim::set_adc2_raw(ADC_CHANNEL_ATF, raw);
+        vTaskDelay(ADC_SAMPLE_INTERVAL_MS);
+        bool locked = false;
+        int temp;
+        if (!Sensors::parking_lock_engaged(&locked) || !locked || Sensors::read_atf_temp(&temp)) {
+            lock_bad++;
+        }
+        lock_checked++;
+    }
+    sweep_done = true;
+    HostSim::stop();
+    vTaskDelete(nullptr);
+}
+
+int main() {
+    esp_log_level_set("*", ESP_LOG_WARN);
+    VirtualBus* vbus = new VirtualBus(500000);
+    HostSim::set_can_bus(vbus->add_node("TCM"));
+    HostSim::set_adc2_raw(ADC_CHANNEL_VBATT, 1000);
+    HostSim::set_adc2_raw(ADC_CHANNEL_ATF, MAX_RAW);
+    CHECK(Sensors::init_sensors());
+    xTaskCreate(sweep_task, "SIM_ATF_SWEEP", 8192, nullptr, 5, nullptr);
+    HostSim::run();
+    HostSim::shutdown();
+
+    printf("%u codes: Largest difference to the interpolation %.2f (x10 C), %u outside 0.1C, %u unreadable. %u parking lock codes, %u wrong\n",
+        checked, max_error, bad, unreadable, lock_checked, lock_bad);
+    CHECK(sweep_done);
+    CHECK_EQ(checked, PARKING_LOCK_RAW);
+    CHECK_EQ(bad, 0);
+    CHECK_EQ(lock_checked, MAX_RAW + 1 - PARKING_LOCK_RAW);
+    CHECK_EQ(lock_bad, 0);
+    return test_result();
+}
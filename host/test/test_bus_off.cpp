@@ -0,0 +1,102 @@
+/**
+ * Host test: Bus off recovery (src/canbus/can_bus_monitor.cpp) of the full TCM
+ *
+ * Runs the TCM next to the simulated car (See sim_car.h), with the TCM's CAN controller put bus off every
+ * BUS_OFF_INTERVAL_MS through the TWAI shim (HostSim::inject_can_bus_off()). After every bus off, each GS_* frame
+ * must be back on the bus within MAX_GS_RESUME_US: Recovery itself (128 x 11 recessive bits, 2.8ms at 500kbps),
+ * plus the Tx task's next cycle (20ms), plus the time to send the other GS_* frames due on that tick.
+ * The monitor has to count every bus off and recovery, and put every recovery in the right histogram bucket.
+ */
+
+#include <stdio.h>
+#include <vector>
+#include "test.h"
+#include "shim/host_sim.h"
+#include "virtual_bus.h"
+#include "sim_car.h"
+#include "../src/canbus/egs_can_hal.h"
+
+#define RUN_TIME_US 10500000
+#define BUS_OFF_INTERVAL_MS 1000
+#define NUM_BUS_OFFS (RUN_TIME_US / (BUS_OFF_INTERVAL_MS * 1000))
+// 128 occurrences of 11 recessive bits at 500kbps
+#define RECOVERY_TIME_US (128 * 11 * 1000000 / SIM_CAR_BUS_BITRATE)
+#define MAX_GS_RESUME_US (RECOVERY_TIME_US + 20000 + 4 * CAN_FRAME_TIME_US)
+
+static const uint32_t GS_FRAMES[] = { GS_218_CAN_ID, GS_338_CAN_ID, GS_418_CAN_ID, GS_CUSTOM_558_CAN_ID };
+#define NUM_GS_FRAMES (sizeof(GS_FRAMES)/sizeof(GS_FRAMES[0]))
+
+// Time from each bus off to the end of the next frame of each GS_* ID (0 until it is seen)
+static uint32_t resume_us[NUM_BUS_OFFS][NUM_GS_FRAMES] = {};
+
+static void on_bus_frame(const twai_message_t* msg, uint64_t start, uint64_t end, const VirtualBusNode* sender) {
+    if (start < BUS_OFF_INTERVAL_MS * 1000) {
+        return;
+    }
+    // Most recent bus off before the frame started (The fault task injects them exactly on the interval)
+    uint64_t idx = start / (BUS_OFF_INTERVAL_MS * 1000) - 1;
+    uint64_t bus_off_time = (idx + 1) * BUS_OFF_INTERVAL_MS * 1000;
+    if (idx >= NUM_BUS_OFFS || start == bus_off_time) {
+        return;
+    }
+    for (uint8_t i = 0; i < NUM_GS_FRAMES; i++) {
+        if (msg->identifier == GS_FRAMES[i] && resume_us[idx][i] == 0) {
+            resume_us[idx][i] = (uint32_t)(end - bus_off_time);
+        }
+    }
+}
+
+int main() {
+    esp_log_level_set("*", ESP_LOG_NONE);
+    VirtualBus* vbus = new VirtualBus(SIM_CAR_BUS_BITRATE);
+    vbus->set_tap(on_bus_frame);
+    HostSim::set_can_bus(vbus->add_node("TCM"));
+    HostCanBus* ecu_bus = vbus->add_node("ECUs");
+    SimCar::configure_node(ecu_bus, nullptr);
+
+    CHECK(SimCar::start_tcm() != nullptr);
+    SimCar::start_ecus(ecu_bus, 2000);
+    SimCar::start_faults(BUS_OFF_INTERVAL_MS);
+    HostSim::run(RUN_TIME_US);
+    HostSim::shutdown();
+
+    uint32_t max_resume_us = 0;
+    for (uint32_t b = 0; b < NUM_BUS_OFFS; b++) {
+        for (uint8_t i = 0; i < NUM_GS_FRAMES; i++) {
+            if (resume_us[b][i] == 0 || resume_us[b][i] > MAX_GS_RESUME_US) {
+                fprintf(stderr, "Bus off %u: 0x%03X took %u us to resume\n", b, GS_FRAMES[i], resume_us[b][i]);
+                CHECK(false);
+            }
+            if (resume_us[b][i] > max_resume_us) {
+                max_resume_us = resume_us[b][i];
+            }
+        }
+    }
+    printf("%u bus offs. Longest from bus off to a GS_* frame resuming: %u us (Limit %u us)\n",
+        (uint32_t)NUM_BUS_OFFS, max_resume_us, (uint32_t)MAX_GS_RESUME_US);
+    // The TCM's own view of it, as seen by the simulated car
+    std::vector<uint32_t> gaps = SimCar::get_results()->bus_off_gaps;
+    CHECK_EQ(gaps.size(), NUM_BUS_OFFS);
+    for (uint32_t gap : gaps) {
+        CHECK_LE(gap, MAX_GS_RESUME_US);
+    }
+
+    CanBusStats s = egs_can_hal->get_bus_stats();
+    printf("Bus off %u, recovered %u (%u retries). Recovery time (us) last %u, max %u\n",
+        s.bus_off_count, s.recovery_count, s.recovery_retry_count, s.last_recovery_us, s.max_recovery_us);
+    CHECK_EQ(s.bus_off_count, NUM_BUS_OFFS);
+    CHECK_EQ(s.recovery_count, NUM_BUS_OFFS);
+    CHECK_EQ(s.recovery_retry_count, 0);
+    CHECK_GE(s.max_recovery_us, RECOVERY_TIME_US);
+    CHECK_LE(s.max_recovery_us, RECOVERY_TIME_US + 1000);
+    CHECK_EQ(s.tx_error_counter, 0);
+    CHECK((int)s.state == (int)CanBusState::ErrorActive);
+    // Every recovery took 2-4ms
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < CAN_RECOVERY_HISTOGRAM_BUCKETS; i++) {
+        total += s.recovery_histogram[i];
+    }
+    CHECK_EQ(total, s.recovery_count);
+    CHECK_EQ(s.recovery_histogram[2], s.recovery_count);
+    return test_result();
+}
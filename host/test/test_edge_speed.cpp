@@ -0,0 +1,239 @@
+/**
+ * Host test: Shaft speed from tooth edge times (include/edge_speed.h), with synthetic N2/N3 pulse trains
+ *
+ * - Constant speeds from creep (40RPM) to the fastest the sensors go (20000RPM, 20000 edges/s) read within 0.5%.
+ * - Ramps (Up to 300RPM, up to 3000RPM, down to 0) track the real speed more closely than the PCNT averaging
+ *   it replaced (Every 7th edge timestamped, 3 of those intervals averaged), and a stopped shaft reads 0.
+ * - A shaft slowing down reads no faster than one tooth in the time since the last one, the first two teeth after it
+ *   stopped give a reading again, and edges closer than EDGE_MIN_INTERVAL_US are ignored.
+ * - At the fastest edge rate, readers on other threads never see a torn reading whilst the ISR wraps the ring.
+ * - ISR load: What edge_ring_push() costs per edge on the host, and so the share of one core it takes at
+ *   12000 and 20000 edges/s. The ISR times on the ESP32 itself are logged every 10s (Sensors::get_rpm_isr_stats()).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <initializer_list>
+#include <thread>
+#include "test.h"
+#include "edge_speed.h"
+
+#define TEETH 60
+// Edges per second at the fastest N2/N3 speed
+#define MAX_EDGE_RATE 20000
+#define MIN_EDGE_RATE 12000
+#define RAMP_STEP_US 1000
+#define STRESS_EDGES 5000000
+#define LOAD_EDGES 20000000
+
+// Old PCNT path: Every 7th edge interrupts, the last 3 intervals between those are averaged
+#define PCNT_EDGES_PER_SAMPLE (TEETH / 8)
+#define PCNT_AVERAGE_SAMPLES 3
+
+typedef struct {
+    uint64_t samples[PCNT_AVERAGE_SAMPLES];
+    uint64_t total;
+    uint8_t sample_id;
+    uint64_t last_time;
+    uint32_t edges;
+} PcntModel;
+
+static void pcnt_edge(PcntModel* p, uint64_t now) {
+    if (++p->edges % PCNT_EDGES_PER_SAMPLE != 0) {
+        return;
+    }
+    p->total -= p->samples[p->sample_id];
+    p->samples[p->sample_id] = now - p->last_time;
+    p->total += p->samples[p->sample_id];
+    p->sample_id = (p->sample_id + 1) % PCNT_AVERAGE_SAMPLES;
+    p->last_time = now;
+}
+
+static uint32_t pcnt_rpm(const PcntModel* p, uint64_t now) {
+    if (now - p->last_time > EDGE_SPEED_TIMEOUT_US || p->total < PCNT_AVERAGE_SAMPLES) {
+        return 0;
+    }
+    return 1000000 * PCNT_EDGES_PER_SAMPLE / (p->total / PCNT_AVERAGE_SAMPLES);
+}
+
+// Generates the edges of a shaft whose speed changes linearly over each segment
+typedef struct {
+    double angle; // Teeth turned since the last edge
+    double time_us;
+} PulseTrain;
+
+typedef struct {
+    uint32_t steps;
+    double error_sum;
+    double pcnt_error_sum;
+    uint32_t first_nonzero_rpm;
+    uint32_t pcnt_first_nonzero_rpm;
+} RampResult;
+
+// Runs the shaft from 'from_rpm' to 'to_rpm' over 'duration_us', reading both ways every RAMP_STEP_US
+static void ramp(PulseTrain* t, EdgeRing* r, PcntModel* p, double from_rpm, double to_rpm, uint64_t duration_us, RampResult* res) {
+    for (uint64_t step = 0; step < duration_us; step += RAMP_STEP_US) {
+        for (uint32_t us = 0; us < RAMP_STEP_US; us++) {
+            double rpm = from_rpm + (to_rpm - from_rpm) * (step + us) / duration_us;
+            t->angle += rpm * TEETH / 60000000.0;
+            t->time_us += 1;
+            if (t->angle >= 1.0) {
+                t->angle -= 1.0;
+                edge_ring_push(r, (uint64_t)t->time_us);
+                pcnt_edge(p, (uint64_t)t->time_us);
+            }
+        }
+        double rpm = from_rpm + (to_rpm - from_rpm) * (step + RAMP_STEP_US) / duration_us;
+        uint64_t now = (uint64_t)t->time_us;
+        uint32_t edge = edge_ring_rpm(r, now, TEETH);
+        uint32_t pcnt = pcnt_rpm(p, now);
+        res->steps++;
+        res->error_sum += abs((int)edge - (int)(rpm + 0.5));
+        res->pcnt_error_sum += abs((int)pcnt - (int)(rpm + 0.5));
+        if (edge != 0 && res->first_nonzero_rpm == 0) {
+            res->first_nonzero_rpm = (uint32_t)rpm;
+        }
+        if (pcnt != 0 && res->pcnt_first_nonzero_rpm == 0) {
+            res->pcnt_first_nonzero_rpm = (uint32_t)rpm;
+        }
+    }
+}
+
+static void test_constant_speeds() {
+    static const uint32_t SPEEDS[] = { 40, 100, 300, 1000, 3000, 6000, MIN_EDGE_RATE, MAX_EDGE_RATE };
+    for (uint32_t rpm : SPEEDS) {
+        EdgeRing r = {};
+        double interval = 60000000.0 / (rpm * TEETH);
+        uint64_t now = 0;
+        // Two revolutions, so the reading has settled
+        for (uint32_t i = 1; i <= 2 * TEETH; i++) {
+            now = (uint64_t)(1000 + i * interval);
+            edge_ring_push(&r, now);
+        }
+        uint32_t reading = edge_ring_rpm(&r, now, TEETH);
+        CHECK_LE(abs((int)reading - (int)rpm), rpm / 200 + 1);
+        // Half a tooth later it still reads the same
+        CHECK_EQ(edge_ring_rpm(&r, now + (uint64_t)(interval / 2), TEETH), reading);
+    }
+}
+
+static void test_ramps() {
+    EdgeRing r = {};
+    PcntModel p = {};
+    PulseTrain t = { 0, 1000 };
+    RampResult up_slow = {};
+    RampResult up = {};
+    RampResult down = {};
+    ramp(&t, &r, &p, 0, 300, 2000000, &up_slow);
+    ramp(&t, &r, &p, 300, 3000, 2000000, &up);
+    ramp(&t, &r, &p, 3000, 0, 3000000, &down);
+    RampResult total = {};
+    for (const RampResult* res : { &up_slow, &up, &down }) {
+        total.steps += res->steps;
+        total.error_sum += res->error_sum;
+        total.pcnt_error_sum += res->pcnt_error_sum;
+    }
+    printf("Ramps: Mean error %.1fRPM (PCNT averaging %.1fRPM). 0-300RPM: %.1fRPM (PCNT %.1fRPM), first reading at %uRPM (PCNT %uRPM)\n",
+        total.error_sum / total.steps, total.pcnt_error_sum / total.steps,
+        up_slow.error_sum / up_slow.steps, up_slow.pcnt_error_sum / up_slow.steps,
+        up_slow.first_nonzero_rpm, up_slow.pcnt_first_nonzero_rpm);
+    CHECK(total.error_sum < total.pcnt_error_sum / 2);
+    CHECK(total.error_sum / total.steps < 5.0);
+    CHECK(up_slow.first_nonzero_rpm < up_slow.pcnt_first_nonzero_rpm);
+    // Stopped
+    uint64_t now = (uint64_t)t.time_us;
+    CHECK_EQ(edge_ring_rpm(&r, now + EDGE_SPEED_TIMEOUT_US + 1, TEETH), 0);
+}
+
+static void test_decay_and_glitches() {
+    EdgeRing r = {};
+    uint64_t now = 1000;
+    // 1000RPM is 1000us per tooth
+    for (uint32_t i = 0; i < TEETH; i++) {
+        now += 1000;
+        edge_ring_push(&r, now);
+    }
+    CHECK_EQ(edge_ring_rpm(&r, now, TEETH), 1000);
+    // Noise right after an edge is ignored
+    edge_ring_push(&r, now + EDGE_MIN_INTERVAL_US - 1);
+    CHECK_EQ(r.head.load(), TEETH);
+    CHECK_EQ(edge_ring_rpm(&r, now + 500, TEETH), 1000);
+    // Next tooth overdue: No faster than one tooth in the time since the last one
+    CHECK_EQ(edge_ring_rpm(&r, now + 2000, TEETH), 500);
+    CHECK_EQ(edge_ring_rpm(&r, now + 10000, TEETH), 100);
+    CHECK_EQ(edge_ring_rpm(&r, now + EDGE_SPEED_TIMEOUT_US + 1, TEETH), 0);
+    // First tooth after stopping gives no speed yet, the one after does
+    now += 1000000;
+    edge_ring_push(&r, now);
+    CHECK_EQ(edge_ring_rpm(&r, now, TEETH), 0);
+    now += 2000;
+    edge_ring_push(&r, now);
+    CHECK_EQ(edge_ring_rpm(&r, now, TEETH), 500);
+}
+
+// ISR thread running flat out at the fastest edge spacing, readers checking every reading
+static EdgeRing stress_ring = {};
+static std::atomic<uint64_t> stress_now{0};
+static std::atomic<bool> stress_done{false};
+
+static void stress_isr() {
+    uint64_t now = 1000;
+    for (uint32_t i = 0; i < STRESS_EDGES; i++) {
+        now += 1000000 / MAX_EDGE_RATE;
+        edge_ring_push(&stress_ring, now);
+        stress_now.store(now, std::memory_order_release);
+    }
+    stress_done.store(true);
+}
+
+static void stress_reader(uint32_t* reads, uint32_t* bad) {
+    while (!stress_done.load()) {
+        uint64_t now = stress_now.load(std::memory_order_acquire);
+        if (stress_ring.head.load() < 2 * TEETH) {
+            continue;
+        }
+        uint32_t rpm = edge_ring_rpm(&stress_ring, now, TEETH);
+        (*reads)++;
+        if (rpm != MAX_EDGE_RATE) {
+            (*bad)++;
+        }
+    }
+}
+
+static void test_max_speed_readers() {
+    uint32_t reads[2] = {};
+    uint32_t bad[2] = {};
+    std::thread a(stress_reader, &reads[0], &bad[0]);
+    std::thread b(stress_reader, &reads[1], &bad[1]);
+    stress_isr();
+    a.join();
+    b.join();
+    printf("%u edges at %u edges/s: %u readings, %u wrong\n", STRESS_EDGES, MAX_EDGE_RATE, reads[0] + reads[1], bad[0] + bad[1]);
+    CHECK_EQ(bad[0] + bad[1], 0);
+}
+
+static void test_isr_load() {
+    EdgeRing r = {};
+    uint64_t now = 1000;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < LOAD_EDGES; i++) {
+        now += 1000000 / MAX_EDGE_RATE;
+        edge_ring_push(&r, now);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count() / LOAD_EDGES;
+    printf("edge_ring_push(): %.1fns per edge on the host. ISR load at %u edges/s: %.3f%%, at %u edges/s: %.3f%%\n",
+        ns, MIN_EDGE_RATE, ns * MIN_EDGE_RATE / 1e7, MAX_EDGE_RATE, ns * MAX_EDGE_RATE / 1e7);
+    CHECK_EQ(r.head.load(), LOAD_EDGES);
+}
+
+int main() {
+    test_constant_speeds();
+    test_ramps();
+    test_decay_and_glitches();
+    test_max_speed_readers();
+    test_isr_load();
+    return test_result();
+}
@@ -0,0 +1,261 @@
+/**
+ * Host test: Message counter and CRC protection of EGS53 frames (lib/egs53_ecus/src/EGS53_PROTECTION.h)
+ *
+ * - The CRC matches the published CRC-8/SAE-J1850 check value and the AUTOSAR CRC library examples,
+ *   and the generated table matches the polynomial.
+ * - FRAME_PROTECTION has exactly the frames with MC_ / CRC_ signals in the CAN database, at their positions.
+ * - frame_protect() / frame_get_counter() / frame_check_crc() round trip every frame and counter value,
+ *   and every single bit error in the covered bytes is caught.
+ * - End to end on the virtual bus: Egs53Can sends ENG_RQ1_TCM with a counter going up by one and a good CRC,
+ *   and rejects received frames with a bad CRC.
+ *
+ * Usage: test_egs53_protection <lib/egs53_ecus/can_data.txt>
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include "test.h"
+#include "shim/host_sim.h"
+#include "virtual_bus.h"
+#include "canbus/can_egs53.h"
+
+#define BUS_BITRATE 500000
+#define RUN_TIME_US 1000000
+#define ENG_RS3_PT_CYCLE_MS 10
+// Every this many ENG_RS3_PT frames has a bad CRC
+#define BAD_CRC_EVERY 5
+
+typedef struct {
+    const uint8_t* data;
+    uint8_t len;
+    uint8_t crc;
+} CrcVector;
+
+static uint8_t crc_bitwise(const uint8_t* data, uint8_t len) {
+    uint8_t crc = CRC8_J1850_INIT;
+    for (uint8_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (uint8_t b = 0; b < 8; b++) {
+            crc = crc & 0x80 ? (uint8_t)(crc << 1) ^ 0x1D : (uint8_t)(crc << 1);
+        }
+    }
+    return crc ^ CRC8_J1850_XOR_OUT;
+}
+
+static void test_crc() {
+    static const uint8_t CHECK_STRING[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    static const uint8_t V1[] = { 0x00, 0x00, 0x00, 0x00 };
+    static const uint8_t V2[] = { 0xF2, 0x01, 0x83 };
+    static const uint8_t V3[] = { 0x0F, 0xAA, 0x00, 0x55 };
+    static const uint8_t V4[] = { 0x00, 0xFF, 0x55, 0x11 };
+    static const uint8_t V5[] = { 0x33, 0x22, 0x55, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF };
+    static const uint8_t V6[] = { 0x92, 0x6B, 0x55 };
+    static const uint8_t V7[] = { 0xFF, 0xFF, 0xFF, 0xFF };
+    static const CrcVector VECTORS[] = {
+        { CHECK_STRING, sizeof(CHECK_STRING), 0x4B },
+        { V1, sizeof(V1), 0x59 },
+        { V2, sizeof(V2), 0x37 },
+        { V3, sizeof(V3), 0x79 },
+        { V4, sizeof(V4), 0xB8 },
+        { V5, sizeof(V5), 0xCB },
+        { V6, sizeof(V6), 0x8C },
+        { V7, sizeof(V7), 0x74 },
+    };
+    for (const CrcVector& v : VECTORS) {
+        // A frame whose CRC byte comes right after the data
+        FrameProtection p = { 0, v.len, 0xFF, 0, 0 };
+        CHECK_EQ(frame_calc_crc(&p, v.data), v.crc);
+    }
+    for (uint16_t i = 0; i < 256; i++) {
+        uint8_t crc = (uint8_t)i;
+        for (uint8_t b = 0; b < 8; b++) {
+            crc = crc & 0x80 ? (uint8_t)(crc << 1) ^ 0x1D : (uint8_t)(crc << 1);
+        }
+        CHECK_EQ(CRC8_J1850_TABLE[i], crc);
+    }
+}
+
+// Reads {CAN ID: protection} of every frame with a message counter or CRC from the CAN database
+static std::map<uint32_t, FrameProtection> read_db(const char* path) {
+    std::map<uint32_t, FrameProtection> frames;
+    FILE* f = fopen(path, "r");
+    CHECK(f != nullptr);
+    if (f == nullptr) {
+        return frames;
+    }
+    char line[512];
+    uint32_t can_id = 0;
+    while (fgets(line, sizeof(line), f) != nullptr) {
+        const char* frame = strstr(line, "FRAME ");
+        const char* sig = strstr(line, "SIGNAL ");
+        const char* offset = strstr(line, "OFFSET: ");
+        const char* len = strstr(line, "LEN: ");
+        if (frame != nullptr && strchr(frame, '(') != nullptr) {
+            can_id = strtoul(strchr(frame, '(') + 1, nullptr, 16);
+        } else if (sig != nullptr && offset != nullptr && len != nullptr) {
+            bool mc = strncmp(sig + 7, "MC_", 3) == 0;
+            bool crc = strncmp(sig + 7, "CRC_", 4) == 0;
+            if (!mc && !crc) {
+                continue;
+            }
+            uint32_t o = strtoul(offset + 8, nullptr, 10);
+            uint32_t l = strtoul(len + 5, nullptr, 10);
+            if (frames.find(can_id) == frames.end()) {
+                frames[can_id] = FrameProtection { can_id, 0xFF, 0xFF, 0, 0 };
+            }
+            FrameProtection* p = &frames[can_id];
+            // Offsets count from the most significant bit of the payload read as a big endian number
+            if (mc) {
+                p->counter_byte = o / 8;
+                p->counter_shift = 8 - (o % 8) - l;
+                p->counter_mask = (1 << l) - 1;
+            } else {
+                CHECK_EQ(l, 8);
+                CHECK_EQ(o % 8, 0);
+                p->crc_byte = o / 8;
+            }
+        }
+    }
+    fclose(f);
+    return frames;
+}
+
+static void test_descriptors(const char* db_path) {
+    std::map<uint32_t, FrameProtection> db = read_db(db_path);
+    CHECK_EQ(db.size(), FRAME_PROTECTION_COUNT);
+    for (uint8_t i = 0; i < FRAME_PROTECTION_COUNT; i++) {
+        const FrameProtection* p = &FRAME_PROTECTION[i];
+        if (i > 0) {
+            CHECK_LT(FRAME_PROTECTION[i-1].can_id, p->can_id);
+        }
+        CHECK(frame_protection_lookup(p->can_id) == p);
+        auto it = db.find(p->can_id);
+        CHECK(it != db.end());
+        if (it != db.end()) {
+            CHECK_EQ(p->crc_byte, it->second.crc_byte);
+            CHECK_EQ(p->counter_byte, it->second.counter_byte);
+            CHECK_EQ(p->counter_shift, it->second.counter_shift);
+            CHECK_EQ(p->counter_mask, it->second.counter_mask);
+        }
+    }
+    CHECK(frame_protection_lookup(0x000) == nullptr);
+    CHECK(frame_protection_lookup(0x7FF) == nullptr);
+    CHECK(frame_protection_lookup(FRAME_PROTECTION[0].can_id + 1) == nullptr);
+}
+
+static void test_round_trip() {
+    uint32_t seed = 1;
+    for (uint8_t i = 0; i < FRAME_PROTECTION_COUNT; i++) {
+        const FrameProtection* p = &FRAME_PROTECTION[i];
+        for (uint16_t counter = 0; counter <= (uint16_t)p->counter_mask + 1; counter++) {
+            uint8_t data[8];
+            for (uint8_t b = 0; b < 8; b++) {
+                seed = seed * 1103515245 + 12345;
+                data[b] = seed >> 16;
+            }
+            uint8_t orig[8];
+            memcpy(orig, data, 8);
+            frame_protect(p, data, (uint8_t)counter);
+            CHECK_EQ(frame_get_counter(p, data), counter & p->counter_mask);
+            CHECK(frame_check_crc(p, data));
+            // Nothing but the counter and CRC changes
+            for (uint8_t b = 0; b < 8; b++) {
+                uint8_t counter_bits = b == p->counter_byte ? p->counter_mask << p->counter_shift : 0;
+                if (b != p->crc_byte) {
+                    CHECK_EQ(data[b] & ~counter_bits, orig[b] & ~counter_bits);
+                }
+            }
+            if (p->crc_byte == 0xFF) {
+                continue;
+            }
+            CHECK_EQ(data[p->crc_byte], crc_bitwise(data, p->crc_byte));
+            for (uint8_t bit = 0; bit < p->crc_byte * 8; bit++) {
+                data[bit / 8] ^= 1 << (bit % 8);
+                CHECK(!frame_check_crc(p, data));
+                data[bit / 8] ^= 1 << (bit % 8);
+            }
+        }
+    }
+}
+
+// End to end: ENG_RQ1_TCM sent by the TCM
+static uint32_t eng_rq1_frames = 0;
+static uint32_t eng_rq1_bad = 0;
+static uint8_t eng_rq1_last_counter = 0;
+
+static void on_bus_frame(const twai_message_t* msg, uint64_t start, uint64_t end, const VirtualBusNode* sender) {
+    if (strcmp(sender->get_name(), "TCM") != 0 || msg->identifier != ENG_RQ1_TCM_CAN_ID) {
+        return;
+    }
+    const FrameProtection* p = frame_protection_lookup(ENG_RQ1_TCM_CAN_ID);
+    uint8_t counter = frame_get_counter(p, msg->data);
+    if (!frame_check_crc(p, msg->data) || (eng_rq1_frames != 0 && counter != ((eng_rq1_last_counter + 1) & p->counter_mask))) {
+        eng_rq1_bad++;
+    }
+    eng_rq1_last_counter = counter;
+    eng_rq1_frames++;
+}
+
+static uint32_t bad_crc_sent = 0;
+
+// Engine ECU: Sends ENG_RS3_PT with a counter going up by one, with a bad CRC on every BAD_CRC_EVERY'th
+static void engine_task(void* params) {
+    HostCanBus* bus = (HostCanBus*)params;
+    const FrameProtection* p = frame_protection_lookup(ENG_RS3_PT_CAN_ID);
+    uint32_t n = 0;
+    uint8_t counter = 0;
+    TickType_t last_wake = xTaskGetTickCount();
+    while (true) {
+        twai_message_t msg = {};
+        msg.identifier = ENG_RS3_PT_CAN_ID;
+        msg.data_length_code = 8;
+        msg.data[0] = (uint8_t)n;
+        frame_protect(p, msg.data, counter);
+        if (++n % BAD_CRC_EVERY == 0) {
+            msg.data[p->crc_byte] ^= 0x01;
+            bad_crc_sent++;
+        } else {
+            counter++;
+        }
+        bus->transmit(&msg, HostSim::now());
+        vTaskDelayUntil(&last_wake, ENG_RS3_PT_CYCLE_MS);
+    }
+}
+
+static void test_end_to_end() {
+    VirtualBus* vbus = new VirtualBus(BUS_BITRATE);
+    vbus->set_tap(on_bus_frame);
+    HostSim::set_can_bus(vbus->add_node("TCM"));
+    HostCanBus* ecu_bus = vbus->add_node("ECM");
+    twai_general_config_t config = TWAI_GENERAL_CONFIG_DEFAULT(GPIO_NUM_NC, GPIO_NUM_NC, TWAI_MODE_NORMAL);
+    ecu_bus->configure(&config, nullptr);
+
+    Egs53Can* can = new Egs53Can("EGS53", 20);
+    CHECK(can->begin_tasks());
+    xTaskCreate(engine_task, "SIM_ENGINE", 8192, ecu_bus, 5, nullptr);
+    HostSim::run(RUN_TIME_US);
+    HostSim::shutdown();
+
+    CanRxStats rx_stats = can->get_rx_stats();
+    printf("ENG_RQ1_TCM: %u frames, %u bad. TCM Rx: %u frames, %u rejected (%u sent with a bad CRC)\n",
+        eng_rq1_frames, eng_rq1_bad, rx_stats.rx_count, rx_stats.rejected_count, bad_crc_sent);
+    CHECK_GE(eng_rq1_frames, RUN_TIME_US / 20000 - 1);
+    CHECK_EQ(eng_rq1_bad, 0);
+    CHECK_GE(bad_crc_sent, 1);
+    CHECK_EQ(rx_stats.rejected_count, bad_crc_sent);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: test_egs53_protection <can_data.txt>\n");
+        return 1;
+    }
+    esp_log_level_set("*", ESP_LOG_WARN);
+    test_crc();
+    test_descriptors(argv[1]);
+    test_round_trip();
+    test_end_to_end();
+    return test_result();
+}
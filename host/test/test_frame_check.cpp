@@ -0,0 +1,153 @@
+/**
+ * Host test: Message counter, toggle and parity checks of received frames (include/ecu_frame_check.h)
+ *
+ * - Counter: A frame repeating the counter of the last accepted frame is rejected, unless it starts a new
+ *   sequence (First frame, or FRAME_SEQUENCE_TIMEOUT_US since the last one).
+ * - Toggle: A toggle that stops changing is accepted until FRAME_TOGGLE_TIMEOUT_US, then rejected until it changes.
+ * - Parity: Every combination of the bits covered, with bits outside the mask ignored.
+ * - Generated code: ECU_ESP_SBC rejects and counts repeated and corrupt BS_200 frames, and keeps the last good one.
+ */
+
+#include <stdio.h>
+#include "test.h"
+#include "../src/canbus/egs_can_hal.h"
+
+#define COUNTER_MASK 0x0000000000003C00ULL
+#define TOGGLE_MASK 0x0000000000000001ULL
+// BS_200: BLS_PA over BLS
+#define PARITY_MASK 0x0000000000004300ULL
+#define CYCLE_US 20000
+
+static uint64_t counter_value(uint8_t counter) {
+    return ((uint64_t)counter << 10) & COUNTER_MASK;
+}
+
+static void test_counter() {
+    FrameCheckState s = {};
+    uint64_t now = CYCLE_US;
+    // The first frame always starts a sequence
+    CHECK(frame_sequence_check(&s, counter_value(3), COUNTER_MASK, 0, now) == FrameCheckResult::Ok);
+    for (uint8_t i = 4; i < 40; i++) {
+        now += CYCLE_US;
+        CHECK(frame_sequence_check(&s, counter_value(i), COUNTER_MASK, 0, now) == FrameCheckResult::Ok);
+    }
+    // Repeated frames are rejected for as long as they keep coming, and the next new counter is accepted
+    uint8_t last = 39;
+    for (uint8_t i = 0; i < 50; i++) {
+        now += CYCLE_US;
+        CHECK(frame_sequence_check(&s, counter_value(last) | 0xFF00000000000000ULL, COUNTER_MASK, 0, now) == FrameCheckResult::Counter);
+    }
+    now += CYCLE_US;
+    CHECK(frame_sequence_check(&s, counter_value(last + 1), COUNTER_MASK, 0, now) == FrameCheckResult::Ok);
+    // Skipping counter values is not a repeat
+    now += CYCLE_US;
+    CHECK(frame_sequence_check(&s, counter_value(last + 5), COUNTER_MASK, 0, now) == FrameCheckResult::Ok);
+    // After a gap, the same counter starts a new sequence
+    now += FRAME_SEQUENCE_TIMEOUT_US;
+    CHECK(frame_sequence_check(&s, counter_value(last + 5), COUNTER_MASK, 0, now) == FrameCheckResult::Counter);
+    now += FRAME_SEQUENCE_TIMEOUT_US + 1;
+    CHECK(frame_sequence_check(&s, counter_value(last + 5), COUNTER_MASK, 0, now) == FrameCheckResult::Ok);
+    // Bits outside the mask do not count
+    now += CYCLE_US;
+    CHECK(frame_sequence_check(&s, counter_value(last + 5) | 0x00FF, COUNTER_MASK, 0, now) == FrameCheckResult::Counter);
+}
+
+static void test_toggle() {
+    FrameCheckState s = {};
+    uint64_t now = CYCLE_US;
+    uint64_t toggle = 0;
+    // Toggling every other frame (40ms) is fine
+    for (uint32_t i = 0; i < 100; i++) {
+        if (i % 2 == 0) {
+            toggle ^= TOGGLE_MASK;
+        }
+        CHECK(frame_sequence_check(&s, toggle, 0, TOGGLE_MASK, now) == FrameCheckResult::Ok);
+        now += CYCLE_US;
+    }
+    // Frozen: Accepted until FRAME_TOGGLE_TIMEOUT_US since it last changed, then rejected
+    uint64_t changed = now - 2 * CYCLE_US;
+    uint32_t accepted = 0;
+    uint32_t rejected = 0;
+    for (uint32_t i = 0; i < 20; i++) {
+        FrameCheckResult res = frame_sequence_check(&s, toggle, 0, TOGGLE_MASK, now);
+        if (now - changed <= FRAME_TOGGLE_TIMEOUT_US) {
+            CHECK(res == FrameCheckResult::Ok);
+            accepted++;
+        } else {
+            CHECK(res == FrameCheckResult::Toggle);
+            rejected++;
+        }
+        now += CYCLE_US;
+    }
+    CHECK_GE(accepted, 1);
+    CHECK_GE(rejected, 1);
+    // Toggling again is accepted straight away
+    toggle ^= TOGGLE_MASK;
+    CHECK(frame_sequence_check(&s, toggle, 0, TOGGLE_MASK, now) == FrameCheckResult::Ok);
+    now += CYCLE_US;
+    CHECK(frame_sequence_check(&s, toggle, 0, TOGGLE_MASK, now) == FrameCheckResult::Ok);
+
+    // With a counter too, a frozen toggle is caught even though the counter keeps going
+    FrameCheckState c = {};
+    now = CYCLE_US;
+    for (uint8_t i = 0; i < 20; i++) {
+        FrameCheckResult res = frame_sequence_check(&c, counter_value(i), COUNTER_MASK, TOGGLE_MASK, now);
+        CHECK(res == (now - CYCLE_US > FRAME_TOGGLE_TIMEOUT_US ? FrameCheckResult::Toggle : FrameCheckResult::Ok));
+        now += CYCLE_US;
+    }
+}
+
+static void test_parity() {
+    // Every combination of BLS_PA and BLS
+    for (uint8_t bits = 0; bits < 8; bits++) {
+        uint64_t value = (bits & 0x1 ? 0x0100ULL : 0) | (bits & 0x2 ? 0x0200ULL : 0) | (bits & 0x4 ? 0x4000ULL : 0);
+        bool even = (__builtin_popcount(bits) & 1) == 0;
+        CHECK(frame_parity_ok(value, PARITY_MASK) == even);
+        // Bits outside the mask do not count
+        CHECK(frame_parity_ok(value | ~PARITY_MASK, PARITY_MASK) == even);
+    }
+    CHECK(frame_parity_ok(0, 0));
+}
+
+static uint64_t bs200(uint8_t counter, BS_200h_BLS bls, bool parity) {
+    BS_200 f = {};
+    f.set_BZ200h(counter);
+    f.set_BLS(bls);
+    f.set_BLS_PA(parity);
+    return f.raw;
+}
+
+static void test_generated() {
+    ECU_ESP_SBC esp;
+    uint64_t now = CYCLE_US;
+    CHECK(esp.import_frame_at(0, bs200(0, BS_200h_BLS::BREMSE_BET, true), now) == FrameCheckResult::Ok);
+    now += CYCLE_US;
+    CHECK(esp.import_frame_at(0, bs200(1, BS_200h_BLS::BREMSE_NBET, false), now) == FrameCheckResult::Ok);
+    uint64_t last_good = now;
+    now += CYCLE_US;
+    CHECK(esp.import_frame_at(0, bs200(1, BS_200h_BLS::BREMSE_BET, true), now) == FrameCheckResult::Counter);
+    now += CYCLE_US;
+    // Brake pressed, but the parity bit is not set
+    CHECK(esp.import_frame_at(0, bs200(2, BS_200h_BLS::BREMSE_BET, false), now) == FrameCheckResult::Parity);
+    now += CYCLE_US;
+    CHECK(!esp.import_frames(bs200(1, BS_200h_BLS::SNV, true), BS_200_CAN_ID, now));
+
+    FrameArrivalStats s;
+    CHECK(esp.get_frame_stats_at(0, &s));
+    CHECK_EQ(s.rx_count, 2);
+    CHECK_EQ(s.rejected_count, 3);
+    CHECK_EQ(s.last_time, last_good);
+    // The getters still return the last good frame
+    BS_200 dest;
+    CHECK(esp.get_BS_200(now, 1000000, &dest));
+    CHECK_EQ(dest.get_BZ200h(), 1);
+    CHECK(dest.get_BLS() == BS_200h_BLS::BREMSE_NBET);
+}
+
+int main() {
+    test_counter();
+    test_toggle();
+    test_parity();
+    test_generated();
+    return test_result();
+}
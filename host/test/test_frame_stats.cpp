@@ -0,0 +1,74 @@
+/**
+ * Host test: Arrival statistics of the generated ECU classes, read and updated from several threads
+ *
+ * - The statistics are published by the Rx task, so a reader never sees a half updated copy
+ *   (Every frame n is imported at n ms, so last_time must always be rx_count ms).
+ * - Getters on several tasks finding the same frame stale count it once.
+ */
+
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+#include "test.h"
+#include "../src/canbus/egs_can_hal.h"
+
+#define FRAMES 200000
+#define STALE_ROUNDS 500
+#define STALE_READS 200
+
+static ECU_MS ms;
+static std::atomic<bool> done{false};
+
+static void importer() {
+    for (uint64_t n = 1; n <= FRAMES; n++) {
+        ms.import_frame_at(0, n, n * 1000);
+    }
+    done.store(true);
+}
+
+static void stats_reader(uint32_t* reads, uint32_t* bad) {
+    FrameArrivalStats s;
+    while (!done.load()) {
+        ms.get_frame_stats_at(0, &s);
+        (*reads)++;
+        if (s.last_time != (uint64_t)s.rx_count * 1000 || (s.rx_count > 1 && s.last_interval != 1000)) {
+            (*bad)++;
+        }
+    }
+}
+
+static void stale_reader() {
+    MS_210 dest;
+    for (uint32_t i = 0; i < STALE_READS; i++) {
+        ms.get_MS_210(UINT64_MAX / 2, 1000, &dest);
+    }
+}
+
+int main() {
+    uint32_t reads = 0;
+    uint32_t bad = 0;
+    std::thread r(stats_reader, &reads, &bad);
+    std::thread w(importer);
+    w.join();
+    r.join();
+    printf("Stats: %u reads whilst importing, %u inconsistent\n", reads, bad);
+    CHECK_EQ(bad, 0);
+    FrameArrivalStats s;
+    CHECK(ms.get_frame_stats_at(0, &s));
+    CHECK_EQ(s.rx_count, FRAMES);
+    CHECK_EQ(s.stale_count, 0);
+
+    // Every frame is read whilst stale by 3 threads at once, but only counted once
+    for (uint32_t i = 0; i < STALE_ROUNDS; i++) {
+        ms.import_frame_at(0, i, (uint64_t)(FRAMES + 1 + i) * 1000);
+        std::thread a(stale_reader);
+        std::thread b(stale_reader);
+        stale_reader();
+        a.join();
+        b.join();
+    }
+    CHECK(ms.get_frame_stats_at(0, &s));
+    printf("Stale: %u of %u frames\n", s.stale_count, STALE_ROUNDS);
+    CHECK_EQ(s.stale_count, STALE_ROUNDS);
+    return test_result();
+}
@@ -0,0 +1,270 @@
+/**
+ * Host test: ISO-TP transport (src/canbus/iso_tp.cpp)
+ *
+ * Plays the tester against an IsoTp instance, calling it the way the CAN Rx and Tx tasks do, with the times
+ * given by the script. Covers single frames, first frame -> flow control -> consecutive frames in both directions
+ * (Including block sizes and STmin), flow control WAIT and overflow, and the N_Bs and N_Cr timeouts.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "canbus/iso_tp.h"
+
+#define TESTER_ID 0x7E1
+#define TCM_ID 0x7E9
+
+static DiagIsoTpInfo make_info(uint8_t bs, uint8_t st_min) {
+    DiagIsoTpInfo info = { TCM_ID, TESTER_ID, bs, st_min };
+    return info;
+}
+
+static void send(IsoTp* tp, uint64_t now, uint8_t b0, uint8_t b1 = 0, uint8_t b2 = 0, uint8_t b3 = 0,
+                 uint8_t b4 = 0, uint8_t b5 = 0, uint8_t b6 = 0, uint8_t b7 = 0) {
+    const uint8_t data[8] = { b0, b1, b2, b3, b4, b5, b6, b7 };
+    tp->on_frame_received(data, 8, now);
+}
+
+// Sends 'len' bytes of 'payload' from 'pos' as consecutive frames, starting with sequence number 'seq'
+static void send_consecutive(IsoTp* tp, uint64_t now, const uint8_t* payload, uint16_t len, uint16_t* pos, uint8_t* seq, uint8_t count) {
+    for (uint8_t i = 0; i < count && *pos < len; i++) {
+        uint8_t data[8] = {};
+        data[0] = 0x20 | *seq;
+        uint16_t n = len - *pos > 7 ? 7 : len - *pos;
+        memcpy(&data[1], &payload[*pos], n);
+        tp->on_frame_received(data, 8, now);
+        *pos += n;
+        *seq = (*seq + 1) & 0x0F;
+    }
+}
+
+// Takes the frame the Tx task would send at 'now' and marks it sent. Returns false if there was none
+static bool take_tx(IsoTp* tp, uint64_t now, uint8_t* data) {
+    if (!tp->get_tx_frame(now, data)) {
+        return false;
+    }
+    tp->on_frame_sent(now);
+    return true;
+}
+
+static void fill_payload(uint8_t* payload, uint16_t len) {
+    for (uint16_t i = 0; i < len; i++) {
+        payload[i] = (uint8_t)(i * 7 + 3);
+    }
+}
+
+static void test_single_frame() {
+    IsoTp tp(make_info(8, 0));
+    uint16_t len = 0;
+    uint8_t frame[8];
+    CHECK(tp.get_request(&len) == nullptr);
+    send(&tp, 1000, 0x02, 0x21, 0x01);
+    const uint8_t* req = tp.get_request(&len);
+    CHECK(req != nullptr);
+    CHECK_EQ(len, 2);
+    if (req != nullptr) {
+        CHECK_EQ(req[0], 0x21);
+        CHECK_EQ(req[1], 0x01);
+    }
+    // Nothing to send back for a single frame, and the next request waits until this one is released
+    CHECK(!tp.get_tx_frame(1000, frame));
+    send(&tp, 2000, 0x01, 0x3E);
+    req = tp.get_request(&len);
+    CHECK(req != nullptr && len == 2 && req[0] == 0x21);
+    tp.release_request();
+    CHECK(tp.get_request(&len) == nullptr);
+    // Length 0, or longer than the frame, is not a request
+    send(&tp, 3000, 0x00, 0x3E);
+    tp.on_frame_received((const uint8_t*)"\x03\x3E\x00", 3, 3000);
+    CHECK(tp.get_request(&len) == nullptr);
+    CHECK_EQ(tp.get_stats().rx_messages, 1);
+
+    // Single frame response
+    uint8_t* buf = tp.get_response_buffer();
+    CHECK(buf != nullptr);
+    buf[0] = 0x7E;
+    buf[1] = 0x00;
+    CHECK(tp.send_response(2));
+    CHECK(tp.get_response_buffer() == nullptr);
+    CHECK_EQ(tp.get_tx_wait_us(4000), 0);
+    CHECK(take_tx(&tp, 4000, frame));
+    CHECK_EQ(frame[0], 0x02);
+    CHECK_EQ(frame[1], 0x7E);
+    CHECK_EQ(frame[2], 0x00);
+    CHECK_EQ(tp.get_stats().tx_messages, 1);
+    CHECK(tp.get_response_buffer() != nullptr);
+    CHECK_EQ(tp.get_tx_wait_us(4000), UINT32_MAX);
+}
+
+static void test_multi_frame_request() {
+    const uint8_t bs = 2;
+    IsoTp tp(make_info(bs, 0x05));
+    uint8_t payload[40];
+    const uint16_t len = sizeof(payload);
+    fill_payload(payload, len);
+    uint8_t frame[8];
+    uint64_t now = 10000;
+
+    send(&tp, now, 0x10 | (len >> 8), len & 0xFF, payload[0], payload[1], payload[2], payload[3], payload[4], payload[5]);
+    uint16_t pos = 6;
+    uint8_t seq = 1;
+    uint16_t blocks = 0;
+    uint16_t req_len = 0;
+    while (tp.get_request(&req_len) == nullptr && blocks < 10) {
+        // Flow control before every block: Continue to send, with our block size and STmin
+        CHECK_EQ(tp.get_tx_wait_us(now), 0);
+        CHECK(take_tx(&tp, now, frame));
+        CHECK_EQ(frame[0], 0x30);
+        CHECK_EQ(frame[1], bs);
+        CHECK_EQ(frame[2], 0x05);
+        blocks++;
+        now += 5000;
+        send_consecutive(&tp, now, payload, len, &pos, &seq, bs);
+    }
+    // 6 bytes in the first frame, then blocks of 2 consecutive frames of 7 bytes
+    CHECK_EQ(blocks, (len - 6 + 13) / 14);
+    const uint8_t* req = tp.get_request(&req_len);
+    CHECK(req != nullptr);
+    CHECK_EQ(req_len, len);
+    CHECK(req != nullptr && memcmp(req, payload, len) == 0);
+    CHECK(!tp.get_tx_frame(now, frame));
+    CHECK_EQ(tp.get_stats().rx_messages, 1);
+    CHECK_EQ(tp.get_stats().aborted, 0);
+    tp.release_request();
+
+    // Wrong sequence number aborts the request
+    send(&tp, now, 0x10, 20, 1, 2, 3, 4, 5, 6);
+    CHECK(take_tx(&tp, now, frame));
+    send(&tp, now, 0x22, 7, 8, 9, 10, 11, 12, 13);
+    CHECK_EQ(tp.get_stats().aborted, 1);
+    send(&tp, now, 0x21, 7, 8, 9, 10, 11, 12, 13);
+    send(&tp, now, 0x22, 14, 15, 16, 17, 18, 19, 20);
+    CHECK(tp.get_request(&req_len) == nullptr);
+    CHECK(!tp.get_tx_frame(now, frame));
+}
+
+static void test_multi_frame_response() {
+    IsoTp tp(make_info(8, 0));
+    uint8_t payload[100];
+    const uint16_t len = sizeof(payload);
+    fill_payload(payload, len);
+    uint8_t frame[8];
+    uint64_t now = 50000;
+
+    memcpy(tp.get_response_buffer(), payload, len);
+    CHECK(tp.send_response(len));
+    CHECK(!tp.send_response(len)); // Still sending the first one
+    CHECK(take_tx(&tp, now, frame));
+    CHECK_EQ(frame[0], 0x10 | (len >> 8));
+    CHECK_EQ(frame[1], len & 0xFF);
+    CHECK(memcmp(&frame[2], payload, 6) == 0);
+    uint8_t received[sizeof(payload)] = {};
+    memcpy(received, &frame[2], 6);
+    uint16_t pos = 6;
+    uint8_t seq = 1;
+
+    // Nothing goes out until the tester's flow control frame
+    CHECK(!tp.get_tx_frame(now, frame));
+    CHECK_EQ(tp.get_tx_wait_us(now), UINT32_MAX);
+
+    // WAIT restarts N_Bs, so waiting twice for most of the timeout must not abort
+    now += ISO_TP_TIMEOUT_US - 1000;
+    send(&tp, now, 0x31, 0, 0);
+    now += ISO_TP_TIMEOUT_US - 1000;
+    tp.get_tx_wait_us(now);
+    CHECK_EQ(tp.get_stats().aborted, 0);
+    CHECK(!tp.get_tx_frame(now, frame));
+
+    // Continue to send, blocks of 3, STmin 2ms then 0xF5 (500us)
+    send(&tp, now, 0x30, 3, 2);
+    uint16_t blocks = 1;
+    while (pos < len) {
+        CHECK_EQ(tp.get_tx_wait_us(now), 0);
+        CHECK(take_tx(&tp, now, frame));
+        CHECK_EQ(frame[0], 0x20 | seq);
+        uint16_t n = len - pos > 7 ? 7 : len - pos;
+        memcpy(&received[pos], &frame[1], n);
+        pos += n;
+        seq = (seq + 1) & 0x0F;
+        if (pos >= len) {
+            break;
+        }
+        uint32_t wait = tp.get_tx_wait_us(now);
+        if (wait == UINT32_MAX) {
+            // End of the block
+            CHECK(!tp.get_tx_frame(now, frame));
+            now += 100;
+            send(&tp, now, 0x30, 3, 0xF5);
+            blocks++;
+        } else {
+            // Inside a block, the next frame waits for STmin
+            CHECK_EQ(wait, blocks == 1 ? 2000 : 500);
+            CHECK(!tp.get_tx_frame(now + wait - 1, frame));
+            now += wait;
+        }
+    }
+    CHECK(memcmp(received, payload, len) == 0);
+    CHECK_EQ(blocks, ((len - 6 + 6) / 7 + 2) / 3);
+    CHECK_EQ(tp.get_stats().tx_messages, 1);
+    CHECK_EQ(tp.get_stats().aborted, 0);
+    CHECK(tp.get_response_buffer() != nullptr);
+}
+
+static void test_flow_control_overflow() {
+    IsoTp tp(make_info(8, 0));
+    uint8_t frame[8];
+    CHECK(tp.send_response(20));
+    CHECK(take_tx(&tp, 1000, frame));
+    send(&tp, 2000, 0x32, 0, 0);
+    CHECK_EQ(tp.get_stats().aborted, 1);
+    CHECK_EQ(tp.get_stats().tx_messages, 0);
+    CHECK(!tp.get_tx_frame(3000, frame));
+    // A late continue to send is ignored, and the next response can go
+    send(&tp, 3000, 0x30, 0, 0);
+    CHECK(!tp.get_tx_frame(3000, frame));
+    CHECK(tp.get_response_buffer() != nullptr);
+    CHECK(tp.send_response(3));
+}
+
+static void test_timeouts() {
+    IsoTp tp(make_info(8, 0));
+    uint8_t frame[8];
+    uint16_t len;
+
+    // N_Bs: No flow control after our first frame
+    CHECK(tp.send_response(20));
+    CHECK(take_tx(&tp, 1000, frame));
+    tp.get_tx_wait_us(1000 + ISO_TP_TIMEOUT_US);
+    CHECK_EQ(tp.get_stats().aborted, 0);
+    tp.get_tx_wait_us(1000 + ISO_TP_TIMEOUT_US + 1);
+    CHECK_EQ(tp.get_stats().aborted, 1);
+    CHECK(tp.get_response_buffer() != nullptr);
+    send(&tp, 1000 + ISO_TP_TIMEOUT_US + 2, 0x30, 0, 0);
+    CHECK(!tp.get_tx_frame(1000 + ISO_TP_TIMEOUT_US + 2, frame));
+
+    // N_Cr: Tester stops sending consecutive frames. Timed from the last frame, not the first frame
+    uint64_t now = 5000000;
+    send(&tp, now, 0x10, 20, 1, 2, 3, 4, 5, 6);
+    CHECK(take_tx(&tp, now, frame));
+    now += ISO_TP_TIMEOUT_US / 2;
+    send(&tp, now, 0x21, 7, 8, 9, 10, 11, 12, 13);
+    tp.get_tx_wait_us(now + ISO_TP_TIMEOUT_US);
+    CHECK_EQ(tp.get_stats().aborted, 1);
+    tp.get_tx_wait_us(now + ISO_TP_TIMEOUT_US + 1);
+    CHECK_EQ(tp.get_stats().aborted, 2);
+    send(&tp, now + ISO_TP_TIMEOUT_US + 2, 0x22, 14, 15, 16, 17, 18, 19, 20);
+    CHECK(tp.get_request(&len) == nullptr);
+
+    // Next request goes through as normal
+    send(&tp, now + ISO_TP_TIMEOUT_US + 3, 0x02, 0x10, 0x92);
+    CHECK(tp.get_request(&len) != nullptr && len == 2);
+}
+
+int main() {
+    test_single_frame();
+    test_multi_frame_request();
+    test_multi_frame_response();
+    test_flow_control_overflow();
+    test_timeouts();
+    return test_result();
+}
@@ -0,0 +1,94 @@
+/**
+ * Host test: KWP2000 server (src/diag/kwp2000.cpp)
+ *
+ * Plays the tester against a Kwp2000Server, calling it the way the CAN Tx task does: Requests as they arrive,
+ * and get_periodic_response() every millisecond in between. Checks that periodic live data carries on whilst the
+ * tester sends TesterPresent, and stops (Along with an upload) once it has sent nothing for the S3 timeout.
+ */
+
+#include <stdio.h>
+#include "test.h"
+#include "shim/host_sim.h"
+#include "virtual_bus.h"
+#include "diag/kwp2000.h"
+#include "canbus/can_recorder.h"
+
+#define TESTER_PRESENT_INTERVAL_US 2000000
+#define TESTER_GONE_TIME_US 10000000
+#define RUN_TIME_US 30000000
+
+static const LiveDataField FIELDS[] = { LiveDataField::N2Rpm, LiveDataField::N3Rpm };
+
+static Kwp2000Server* server = nullptr;
+static uint8_t resp[ISO_TP_MAX_PAYLOAD];
+static uint32_t periodic_count = 0;
+static uint64_t last_periodic_time = 0;
+static uint64_t last_request_time = 0;
+
+static uint16_t request(const uint8_t* req, uint16_t len) {
+    last_request_time = HostSim::now();
+    return server->process_request(req, len, resp, sizeof(resp));
+}
+
+// Tester: Starts fast periodic live data, keeps the session up with TesterPresent until TESTER_GONE_TIME_US, then goes quiet
+static void tester_task(void* params) {
+    const uint8_t start_fast[] = { KWP_SID_READ_DATA_BY_LOCAL_ID, KWP_LID_LIVE_DATA, KWP_TX_MODE_FAST };
+    const uint8_t tester_present[] = { KWP_SID_TESTER_PRESENT, 0x01 };
+    uint16_t len = request(start_fast, sizeof(start_fast));
+    CHECK_EQ(len, 6);
+    CHECK_EQ(resp[0], KWP_SID_READ_DATA_BY_LOCAL_ID + 0x40);
+    uint64_t next_tp = HostSim::now() + TESTER_PRESENT_INTERVAL_US;
+    while (true) {
+        uint64_t now = HostSim::now();
+        if (now >= next_tp && now < TESTER_GONE_TIME_US) {
+            len = request(tester_present, sizeof(tester_present));
+            CHECK_EQ(len, 1);
+            next_tp += TESTER_PRESENT_INTERVAL_US;
+        }
+        if (server->get_periodic_response(now, resp, sizeof(resp)) != 0) {
+            CHECK_LE(now - last_request_time, KWP_S3_TIMEOUT_US);
+            periodic_count++;
+            last_periodic_time = now;
+        }
+        vTaskDelay(1);
+    }
+}
+
+int main() {
+    esp_log_level_set("*", ESP_LOG_WARN);
+    // Nothing is sent on it, it just keeps the simulation running until RUN_TIME_US
+    VirtualBus* vbus = new VirtualBus(500000);
+    HostSim::set_can_bus(vbus->add_node("TCM"));
+    server = new Kwp2000Server(nullptr, FIELDS, sizeof(FIELDS)/sizeof(FIELDS[0]));
+
+    // An empty request has no service ID to read, so it gets no response
+    CHECK_EQ(server->process_request(nullptr, 0, resp, sizeof(resp)), 0);
+
+    xTaskCreate(tester_task, "TESTER", 8192, nullptr, 5, nullptr);
+    HostSim::run(RUN_TIME_US);
+
+    // Periodic data every 20ms until S3 after the last TesterPresent, then nothing
+    printf("%u periodic responses, last at %llu us (Last request at %llu us)\n",
+        periodic_count, (unsigned long long)last_periodic_time, (unsigned long long)last_request_time);
+    CHECK_GE(periodic_count, (last_request_time + KWP_S3_TIMEOUT_US) / 20000 - 2);
+    CHECK_GE(last_periodic_time, last_request_time + KWP_S3_TIMEOUT_US - 20000);
+    CHECK_LE(last_periodic_time, last_request_time + KWP_S3_TIMEOUT_US);
+    CHECK_EQ(server->get_periodic_response(RUN_TIME_US + 20000, resp, sizeof(resp)), 0);
+
+    // Upload the tester walks away from is ended by S3, so the recorder records again
+    const uint8_t upload[] = { KWP_SID_REQUEST_UPLOAD };
+    const uint8_t transfer[] = { KWP_SID_TRANSFER_DATA };
+    uint64_t now = HostSim::now();
+    CHECK_EQ(server->process_request(upload, sizeof(upload), resp, sizeof(resp)), 5);
+    CHECK(can_recorder.is_frozen());
+    server->get_periodic_response(now + KWP_S3_TIMEOUT_US, resp, sizeof(resp));
+    CHECK(can_recorder.is_frozen());
+    server->get_periodic_response(now + KWP_S3_TIMEOUT_US + 1, resp, sizeof(resp));
+    CHECK(!can_recorder.is_frozen());
+    CHECK_EQ(server->process_request(transfer, sizeof(transfer), resp, sizeof(resp)), 3);
+    CHECK_EQ(resp[0], KWP_NEGATIVE_RESPONSE);
+    CHECK_EQ(resp[2], KWP_NRC_CONDITIONS_NOT_CORRECT);
+
+    HostSim::shutdown();
+    return test_result();
+}
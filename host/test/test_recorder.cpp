@@ -0,0 +1,225 @@
+/**
+ * Host test: CAN flight recorder (src/canbus/can_recorder.cpp), read out over KWP2000 and converted by lib/recorder_to_log.py
+ *
+ * Records an Rx frame every millisecond and a Tx frame every 10ms, long enough for the Rx ring to wrap, then triggers.
+ * Checks that the capture read out (RequestUpload / TransferData / RequestTransferExit) holds the full ring of history
+ * before the trigger and RECORDER_POST_TRIGGER_US after it, with no frame missing, and that recorder_to_log.py turns it
+ * into a candump log of exactly those frames, in bus order.
+ *
+ * Usage: test_recorder <python> <lib/recorder_to_log.py> <directory for the capture and logs>
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "test.h"
+#include "shim/host_sim.h"
+#include "virtual_bus.h"
+#include "diag/kwp2000.h"
+#include "canbus/can_recorder.h"
+
+#define RX_INTERVAL_US 1000
+#define TX_EVERY_RX 10
+// Rx ring wraps well before this
+#define TRIGGER_TIME_US 90000000
+#define RUN_TIME_US (TRIGGER_TIME_US + RECORDER_POST_TRIGGER_US + 1000000)
+
+typedef struct {
+    uint64_t time;
+    uint32_t can_id;
+    uint8_t data[8];
+} Frame;
+
+// Every frame recorded, in the order it was recorded
+static std::vector<Frame> rx_frames;
+static std::vector<Frame> tx_frames;
+static uint64_t freeze_time = 0;
+
+static void make_frame(std::vector<Frame>* frames, uint32_t can_id, uint32_t n) {
+    Frame f = { HostSim::now(), can_id, {} };
+    memcpy(f.data, &n, 4);
+    f.data[4] = 0xA5;
+    f.data[7] = (uint8_t)can_id;
+    frames->push_back(f);
+}
+
+// Plays the CAN Rx and Tx tasks (Both rings are written from this one task, which the recorder does not mind)
+static void bus_task(void* params) {
+    uint32_t n = 0;
+    TickType_t last_wake = xTaskGetTickCount();
+    while (true) {
+        if (!can_recorder.is_frozen()) {
+            make_frame(&rx_frames, 0x200 + (n & 3), n);
+            can_recorder.record_rx(rx_frames.back().can_id, 8, rx_frames.back().data, rx_frames.back().time);
+            if (n % TX_EVERY_RX == 0 && !can_recorder.is_frozen()) {
+                make_frame(&tx_frames, 0x418, n);
+                can_recorder.record_tx(tx_frames.back().can_id, 8, tx_frames.back().data, tx_frames.back().time);
+            }
+            if (can_recorder.is_frozen()) {
+                freeze_time = HostSim::now();
+            }
+        }
+        if (HostSim::now() == TRIGGER_TIME_US) {
+            can_recorder.trigger(RecorderTrigger::Overspeed);
+        }
+        n++;
+        vTaskDelayUntil(&last_wake, RX_INTERVAL_US / 1000);
+    }
+}
+
+// Reads the capture out the way a tester does
+static std::vector<uint8_t> upload_capture(Kwp2000Server* server) {
+    static uint8_t resp[ISO_TP_MAX_PAYLOAD];
+    std::vector<uint8_t> capture;
+    const uint8_t upload[] = { KWP_SID_REQUEST_UPLOAD };
+    const uint8_t transfer[] = { KWP_SID_TRANSFER_DATA };
+    const uint8_t exit[] = { KWP_SID_REQUEST_TRANSFER_EXIT };
+    CHECK_EQ(server->process_request(upload, sizeof(upload), resp, sizeof(resp)), 5);
+    CHECK_EQ(resp[0], KWP_SID_REQUEST_UPLOAD + 0x40);
+    uint32_t size = (uint32_t)resp[1] << 24 | (uint32_t)resp[2] << 16 | (uint32_t)resp[3] << 8 | resp[4];
+    while (true) {
+        uint16_t len = server->process_request(transfer, sizeof(transfer), resp, sizeof(resp));
+        CHECK(len >= 1 && resp[0] == KWP_SID_TRANSFER_DATA + 0x40);
+        if (len <= 1) {
+            break;
+        }
+        CHECK_LE(len - 1, KWP_UPLOAD_BLOCK_LEN);
+        capture.insert(capture.end(), &resp[1], &resp[len]);
+    }
+    CHECK_EQ(capture.size(), size);
+    CHECK_EQ(server->process_request(exit, sizeof(exit), resp, sizeof(resp)), 1);
+    return capture;
+}
+
+static void check_entries(const uint8_t* entries, uint32_t count, const std::vector<Frame>& frames, uint64_t trigger_time, uint16_t tx_flag) {
+    // The ring keeps the newest frames
+    CHECK_LE(count, frames.size());
+    size_t first = frames.size() - count;
+    for (uint32_t i = 0; i < count; i++) {
+        RecorderEntry e;
+        memcpy(&e, &entries[i * sizeof(RecorderEntry)], sizeof(e));
+        const Frame& f = frames[first + i];
+        if (e.time_offset != (int64_t)(f.time - trigger_time) || e.can_id != (f.can_id | tx_flag) || e.dlc != 8 ||
+            memcmp(e.data, f.data, 8) != 0) {
+            CHECK_EQ(e.can_id, f.can_id | tx_flag);
+            CHECK_EQ(e.time_offset, (int64_t)(f.time - trigger_time));
+            CHECK(memcmp(e.data, f.data, 8) == 0);
+            break;
+        }
+    }
+}
+
+static bool run_script(const char* python, const char* script, const std::string& capture, const std::string& log) {
+    std::string cmd = std::string("\"") + python + "\" \"" + script + "\" \"" + capture + "\" \"" + log + "\" vcan0";
+    return system(cmd.c_str()) == 0;
+}
+
+// Checks the candump log lists 'frames' (Rx then Tx of the same time), in bus order
+static void check_candump(const std::string& path, const std::vector<Frame>& rx, size_t rx_first, const std::vector<Frame>& tx, size_t tx_first) {
+    FILE* f = fopen(path.c_str(), "r");
+    CHECK(f != nullptr);
+    if (f == nullptr) {
+        return;
+    }
+    size_t ri = rx_first;
+    size_t ti = tx_first;
+    char line[128];
+    uint32_t lines = 0;
+    uint32_t bad = 0;
+    while (fgets(line, sizeof(line), f) != nullptr) {
+        lines++;
+        const Frame* e;
+        if (ri < rx.size() && (ti >= tx.size() || rx[ri].time <= tx[ti].time)) {
+            e = &rx[ri++];
+        } else if (ti < tx.size()) {
+            e = &tx[ti++];
+        } else {
+            bad++;
+            continue;
+        }
+        char expected[128];
+        snprintf(expected, sizeof(expected), "(%llu.%06llu) vcan0 %03X#%02X%02X%02X%02X%02X%02X%02X%02X\n",
+            (unsigned long long)(e->time / 1000000), (unsigned long long)(e->time % 1000000), e->can_id,
+            e->data[0], e->data[1], e->data[2], e->data[3], e->data[4], e->data[5], e->data[6], e->data[7]);
+        if (strcmp(line, expected) != 0) {
+            if (bad == 0) {
+                fprintf(stderr, "Line %u is '%s', expected '%s'", lines, line, expected);
+            }
+            bad++;
+        }
+    }
+    fclose(f);
+    CHECK_EQ(lines, (rx.size() - rx_first) + (tx.size() - tx_first));
+    CHECK_EQ(bad, 0);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        fprintf(stderr, "Usage: test_recorder <python> <recorder_to_log.py> <output directory>\n");
+        return 1;
+    }
+    esp_log_level_set("*", ESP_LOG_WARN);
+    VirtualBus* vbus = new VirtualBus(500000);
+    HostSim::set_can_bus(vbus->add_node("TCM"));
+    CHECK(can_recorder.init());
+    xTaskCreate(bus_task, "BUS", 8192, nullptr, 5, nullptr);
+    HostSim::run(RUN_TIME_US);
+
+    // Recording carries on for RECORDER_POST_TRIGGER_US after the trigger, then stops
+    CHECK(can_recorder.is_frozen());
+    CHECK_GE(freeze_time, TRIGGER_TIME_US + RECORDER_POST_TRIGGER_US);
+    CHECK_LE(freeze_time, TRIGGER_TIME_US + RECORDER_POST_TRIGGER_US + 2 * RX_INTERVAL_US);
+
+    Kwp2000Server server(nullptr, nullptr, 0);
+    std::vector<uint8_t> capture = upload_capture(&server);
+    CHECK(!can_recorder.is_frozen()); // RequestTransferExit starts recording again
+    HostSim::shutdown();
+
+    CHECK_GE(capture.size(), sizeof(RecorderHeader));
+    if (capture.size() < sizeof(RecorderHeader)) {
+        return test_result();
+    }
+    RecorderHeader header;
+    memcpy(&header, capture.data(), sizeof(header));
+    CHECK_EQ(header.magic, RECORDER_MAGIC);
+    CHECK_EQ(header.version, RECORDER_VERSION);
+    CHECK_EQ((uint8_t)header.trigger, (uint8_t)RecorderTrigger::Overspeed);
+    CHECK_EQ(header.entry_size, sizeof(RecorderEntry));
+    CHECK_EQ(header.trigger_time, TRIGGER_TIME_US);
+    // Full Rx ring (Less the slot that is never read out), every Tx frame as that ring has not wrapped
+    CHECK_EQ(header.rx_count, RECORDER_RX_RECORDS - 1);
+    CHECK_EQ(header.tx_count, tx_frames.size());
+    CHECK_EQ(capture.size(), sizeof(RecorderHeader) + (header.rx_count + header.tx_count) * sizeof(RecorderEntry));
+    if (capture.size() != sizeof(RecorderHeader) + (header.rx_count + header.tx_count) * sizeof(RecorderEntry)) {
+        return test_result();
+    }
+    const uint8_t* entries = capture.data() + sizeof(RecorderHeader);
+    check_entries(entries, header.rx_count, rx_frames, TRIGGER_TIME_US, 0);
+    check_entries(entries + header.rx_count * sizeof(RecorderEntry), header.tx_count, tx_frames, TRIGGER_TIME_US, RECORDER_TX_FLAG);
+
+    // History either side of the trigger
+    size_t rx_first = rx_frames.size() - header.rx_count;
+    uint64_t pre_us = TRIGGER_TIME_US - rx_frames[rx_first].time;
+    uint64_t post_us = rx_frames.back().time - TRIGGER_TIME_US;
+    printf("Capture: %u Rx, %u Tx frames, %.3f s before the trigger, %.3f s after (%u bytes)\n",
+        header.rx_count, header.tx_count, pre_us / 1000000.0, post_us / 1000000.0, (uint32_t)capture.size());
+    CHECK_EQ(pre_us, (uint64_t)(RECORDER_RX_RECORDS - 1) * RX_INTERVAL_US - post_us - RX_INTERVAL_US);
+    CHECK_GE(post_us, RECORDER_POST_TRIGGER_US);
+
+    // Round trip through recorder_to_log.py
+    std::string dir = argv[3];
+    std::string capture_path = dir + "/test_recorder_capture.bin";
+    FILE* f = fopen(capture_path.c_str(), "wb");
+    CHECK(f != nullptr);
+    if (f == nullptr) {
+        return test_result();
+    }
+    fwrite(capture.data(), 1, capture.size(), f);
+    fclose(f);
+    CHECK(run_script(argv[1], argv[2], capture_path, dir + "/test_recorder.log"));
+    check_candump(dir + "/test_recorder.log", rx_frames, rx_first, tx_frames, 0);
+    CHECK(run_script(argv[1], argv[2], capture_path, dir + "/test_recorder.asc"));
+    return test_result();
+}
@@ -0,0 +1,78 @@
+/**
+ * Host test: The CAN HAL receiving a completely full bus (src/canbus/can_rx_ring.cpp)
+ *
+ * A flood node sends MS_210 back to back for FLOOD_TIME_US, so every frame on the bus passes the TCM's acceptance
+ * filter and goes through the driver's Rx queue, the drain task, the Rx ring and the notification that wakes the Rx task.
+ * Every frame sent must be decoded, without the driver's queue or the ring ever overflowing.
+ *
+ * The simulation does not model CPU time, so this checks that no frame is lost on the way, not how far the ring fills
+ * on the real hardware.
+ */
+
+#include <stdio.h>
+#include "test.h"
+#include "shim/host_sim.h"
+#include "virtual_bus.h"
+#include "sim_car.h"
+#include "../src/canbus/egs_can_hal.h"
+
+#define FLOOD_TIME_US 5000000
+// Time left after the flood for the last frames to be decoded
+#define RUN_TIME_US (FLOOD_TIME_US + 100000)
+
+static uint32_t sent = 0;
+
+static void flood_task(void* params) {
+    HostCanBus* bus = (HostCanBus*)params;
+    twai_message_t msg = {};
+    msg.identifier = MS_210_CAN_ID;
+    msg.data_length_code = 8;
+    while (HostSim::now() < FLOOD_TIME_US) {
+        msg.data[0] = (uint8_t)sent;
+        // Keeps the Tx queue full, so there is never a gap on the bus
+        if (bus->wait_transmit(&msg, FLOOD_TIME_US)) {
+            sent++;
+        }
+    }
+    vTaskDelete(nullptr);
+}
+
+int main() {
+    esp_log_level_set("*", ESP_LOG_WARN);
+    VirtualBus* vbus = new VirtualBus(SIM_CAR_BUS_BITRATE);
+    HostSim::set_can_bus(vbus->add_node("TCM"));
+    HostCanBus* flood_bus = vbus->add_node("FLOOD");
+    SimCar::configure_node(flood_bus, nullptr);
+
+    egs_can_hal = new EgsCanHal("EGS52", 20);
+    CHECK(egs_can_hal->begin_tasks());
+    xTaskCreate(flood_task, "SIM_FLOOD", 8192, flood_bus, 5, nullptr);
+    HostSim::run(RUN_TIME_US);
+    HostSim::shutdown();
+
+    VirtualBusStats bus_stats = vbus->get_stats();
+    CanRxStats s = egs_can_hal->get_rx_stats();
+    printf("Bus: %u frames, %.1f%% load during the flood. Sent %u, TCM received %u\n",
+        bus_stats.frames, bus_stats.busy_us * 100.0 / FLOOD_TIME_US, sent, s.rx_count);
+    printf("Driver queue overflows %u, ring overflows %u, ring high water %u/%u\n",
+        s.rx_queue_overflow_count, s.ring_overflow_count, s.ring_high_water, s.ring_size);
+    // Every bit time of the flood is taken (The TCM's own frames are the rest)
+    CHECK(bus_stats.busy_us * 100.0 / FLOOD_TIME_US > 99.9);
+    CHECK_GE(sent, FLOOD_TIME_US / (CAN_FRAME_TIME_US * 2));
+    CHECK_EQ(s.rx_count, sent);
+    CHECK_EQ(s.dropped_count, 0);
+    CHECK_EQ(s.rejected_count, 0);
+    CHECK_EQ(s.rx_queue_overflow_count, 0);
+    CHECK_EQ(s.ring_overflow_count, 0);
+    CHECK_GE(s.ring_high_water, 1);
+    CHECK_EQ(s.ring_size, CAN_RX_RING_FRAMES);
+    // The MS_210 in the ECU is the last one sent
+    FrameArrivalStats f;
+    for (uint8_t i = 0; i < egs_can_hal->get_num_rx_frames(); i++) {
+        uint32_t can_id;
+        if (egs_can_hal->get_rx_frame_stats(i, &can_id, &f) && can_id == MS_210_CAN_ID) {
+            CHECK_EQ(f.rx_count, sent);
+        }
+    }
+    return test_result();
+}
@@ -0,0 +1,208 @@
+/**
+ * Host test: Latency from a frame arriving to the CAN HAL having imported it
+ *
+ * The ECUs send the frames the TCM reads at their cycle times, amongst the rest of the car's traffic (~40% bus load).
+ * A probe task at the lowest priority is woken at the end of every frame the TCM reads, and polls the
+ * frame's arrival statistics every PROBE_STEP_US until the Rx task has imported it.
+ *
+ * The simulation does not model CPU time, so what is checked is that nothing waits: The drain task must take every
+ * frame out of the driver's Rx queue before the next one arrives (Most frames in the queue at once is 1), and the
+ * Rx task must decode every frame before the next one lands in the Rx ring (Ring high water mark is 1). A task that
+ * polled rather than blocked on the frame would let frames pile up in between.
+ *
+ * The latencies are printed, not checked. In simulated time they only show waiting, not the time the code takes.
+ * The wall clock time from the end of the frame to the probe seeing it imported is the time the drain and Rx tasks
+ * took on the host, plus the host's thread switches between them, so it depends on what else the host is running.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <vector>
+#include "test.h"
+#include "shim/host_sim.h"
+#include "virtual_bus.h"
+#include "../src/canbus/egs_can_hal.h"
+
+#define BUS_BITRATE 500000
+#define RUN_TIME_US 10000000
+#define PROBE_STEP_US 10
+
+typedef struct {
+    uint32_t can_id;
+    uint16_t cycle_ms;
+} SimFrame;
+
+// Frames the TCM reads
+static const SimFrame READ_FRAMES[] = {
+    { BS_200_CAN_ID, 20 },
+    { MS_210_CAN_ID, 20 },
+    { EWM_230_CAN_ID, 20 },
+    { MS_308_CAN_ID, 20 },
+    { MS_608_CAN_ID, 100 },
+};
+
+// Rest of the traffic on the bus (Not all of these have headers in this build)
+static const SimFrame OTHER_FRAMES[] = {
+    { 0x208, 10 }, // BS_208
+    { 0x270, 10 }, // BS_270
+    { 0x300, 20 }, // BS_300
+    { 0x328, 20 }, // BS_328
+    { 0x212, 10 }, // MS_212
+    { 0x268, 10 }, // MS_268
+    { 0x2F3, 20 }, // MS_2F3
+    { 0x312, 20 }, // MS_312
+    { 0x240, 10 }, // EZS_240
+    { 0x248, 20 }, // ZGW_248
+    { 0x408, 20 }, // KOMBI_408
+    { 0x412, 20 }, // KOMBI_412
+    { 0x410, 20 }, // KLA_410
+    { 0x236, 10 }, // LRW_236
+    { 0x238, 20 }, // MRM_238
+    { 0x3B4, 50 }, // PSM_3B4
+    { 0x530, 100 }, // LWR_530
+    { 0x580, 100 }, // AAD_580
+};
+
+static TaskHandle_t probe_handle = nullptr;
+typedef struct {
+    // Simulated time
+    uint64_t time;
+    std::chrono::steady_clock::time_point wall_time;
+} Arrival;
+
+// Every frame the TCM reads, that has not been imported yet
+static std::deque<Arrival> arrivals;
+static std::vector<uint32_t> latencies;
+static std::vector<uint32_t> wall_latencies;
+static uint8_t bs200_counter = 0;
+
+static bool is_read_frame(uint32_t can_id) {
+    for (const SimFrame& f : READ_FRAMES) {
+        if (f.can_id == can_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void send_frame(HostCanBus* bus, uint32_t can_id) {
+    twai_message_t msg = {};
+    msg.identifier = can_id;
+    msg.data_length_code = 8;
+    if (can_id == BS_200_CAN_ID) {
+        // The TCM throws away frames that repeat the counter
+        BS_200 bs200 = {};
+        bs200.set_BZ200h(bs200_counter);
+        bs200_counter = (bs200_counter + 1) & 0x0F;
+        memcpy(msg.data, bs200.bytes, 8);
+    }
+    bus->transmit(&msg, HostSim::now());
+}
+
+// Sends every frame at its cycle time, each ECU starting at a different point in its cycle
+static void ecu_task(void* params) {
+    HostCanBus* bus = (HostCanBus*)params;
+    TickType_t last_wake = xTaskGetTickCount();
+    uint32_t tick = 0;
+    while (true) {
+        for (uint8_t i = 0; i < sizeof(READ_FRAMES)/sizeof(READ_FRAMES[0]); i++) {
+            if ((tick + i * 3) % READ_FRAMES[i].cycle_ms == 0) {
+                send_frame(bus, READ_FRAMES[i].can_id);
+            }
+        }
+        for (uint8_t i = 0; i < sizeof(OTHER_FRAMES)/sizeof(OTHER_FRAMES[0]); i++) {
+            if ((tick + i * 7) % OTHER_FRAMES[i].cycle_ms == 0) {
+                send_frame(bus, OTHER_FRAMES[i].can_id);
+            }
+        }
+        tick++;
+        vTaskDelayUntil(&last_wake, 1);
+    }
+}
+
+static uint32_t count_imported() {
+    uint32_t total = 0;
+    uint32_t can_id;
+    FrameArrivalStats s;
+    for (uint8_t i = 0; i < egs_can_hal->get_num_rx_frames(); i++) {
+        if (egs_can_hal->get_rx_frame_stats(i, &can_id, &s)) {
+            total += s.rx_count;
+        }
+    }
+    return total;
+}
+
+static void probe_task(void* params) {
+    uint32_t imported = 0;
+    while (true) {
+        uint32_t now_imported = count_imported();
+        while (imported < now_imported && !arrivals.empty()) {
+            latencies.push_back((uint32_t)(HostSim::now() - arrivals.front().time));
+            wall_latencies.push_back((uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - arrivals.front().wall_time).count());
+            arrivals.pop_front();
+            imported++;
+        }
+        HostSim::block_current_task(arrivals.empty() ? UINT64_MAX : HostSim::now() + PROBE_STEP_US);
+    }
+}
+
+static void on_bus_frame(const twai_message_t* msg, uint64_t start, uint64_t end, const VirtualBusNode* sender) {
+    if (strcmp(sender->get_name(), "ECUs") == 0 && is_read_frame(msg->identifier)) {
+        arrivals.push_back({ end, std::chrono::steady_clock::now() });
+        HostSim::wake_task_at(probe_handle, end);
+    }
+}
+
+// Prints the distribution of 'latencies'
+static void print_latencies(const char* what, std::vector<uint32_t>& latencies) {
+    std::sort(latencies.begin(), latencies.end());
+    printf("%s (us, %u frames): p50 %u, p99 %u, max %u\n", what, (uint32_t)latencies.size(),
+        latencies[(latencies.size() - 1) / 2], latencies[(latencies.size() - 1) * 99 / 100], latencies.back());
+}
+
+int main() {
+    esp_log_level_set("*", ESP_LOG_WARN);
+    VirtualBus* vbus = new VirtualBus(BUS_BITRATE);
+    vbus->set_tap(on_bus_frame);
+    VirtualBusNode* tcm_bus = vbus->add_node("TCM");
+    HostSim::set_can_bus(tcm_bus);
+    HostCanBus* ecu_bus = vbus->add_node("ECUs");
+    twai_general_config_t config = TWAI_GENERAL_CONFIG_DEFAULT(GPIO_NUM_NC, GPIO_NUM_NC, TWAI_MODE_NORMAL);
+    ecu_bus->configure(&config, nullptr);
+
+    egs_can_hal = new EgsCanHal("EGS52", 20);
+    CHECK(egs_can_hal->begin_tasks());
+    xTaskCreate(ecu_task, "SIM_ECUS", 8192, ecu_bus, 5, nullptr);
+    xTaskCreate(probe_task, "PROBE", 8192, nullptr, 1, &probe_handle);
+
+    auto start = std::chrono::steady_clock::now();
+    HostSim::run(RUN_TIME_US);
+    double wall_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    HostSim::shutdown();
+
+    VirtualBusStats bus_stats = vbus->get_stats();
+    CanRxStats rx_stats = egs_can_hal->get_rx_stats();
+    printf("Bus: %u frames, %.1f%% load\n", bus_stats.frames, bus_stats.busy_us * 100.0 / RUN_TIME_US);
+    VirtualBusNodeStats tcm_stats = tcm_bus->get_stats();
+    printf("TCM Rx: %u frames, %u dropped, %u rejected, %u Rx queue overflows, %u ring overflows\n",
+        rx_stats.rx_count, rx_stats.dropped_count, rx_stats.rejected_count, rx_stats.rx_queue_overflow_count, rx_stats.ring_overflow_count);
+    printf("Most frames waiting: %u in the driver's Rx queue, %u in the Rx ring\n", tcm_stats.max_rx_queue_depth, rx_stats.ring_high_water);
+    CHECK(!latencies.empty());
+    if (!latencies.empty()) {
+        print_latencies("Arrival to import, simulated", latencies);
+        print_latencies("Arrival to import, host wall clock", wall_latencies);
+    }
+    // Host time includes the probe and the simulated ECUs, so this is an upper bound
+    printf("Host CPU time per frame on the bus: %.2f us\n", wall_us / bus_stats.frames);
+    CHECK_LE(arrivals.size(), 1); // The last frame may still be on its way
+    CHECK_EQ(rx_stats.rejected_count, 0);
+    CHECK_EQ(rx_stats.rx_queue_overflow_count, 0);
+    CHECK_EQ(rx_stats.ring_overflow_count, 0);
+    CHECK_EQ(tcm_stats.max_rx_queue_depth, 1);
+    CHECK_EQ(rx_stats.ring_high_water, 1);
+    return test_result();
+}
@@ -0,0 +1,156 @@
+/**
+ * Host test: The firmware's sensors (src/sensors.cpp) on simulated GPIO, PCNT and ADC2 (See shim/host_sensors.cpp)
+ *
+ * Built once for each N2/N3 speed capture mode: test_sensors with the default edge capture (A GPIO interrupt
+ * per tooth), and test_sensors_pcnt with RPM_PCNT_CAPTURE (A PCNT interrupt every 7 teeth).
+ *
+ * - A pulse generator task runs N2 and N3 through constant speeds from 300RPM up to 20000RPM (20000 edges/s),
+ *   then stops. Readings taken every RPM_READ_INTERVAL_MS once a speed has settled must be within 1%, and a
+ *   stopped shaft must read 0.
+ * - Every edge (Or every 7th) must have run the ISR once. How long the ISRs took is printed, with the share of one
+ *   core they would take at 12000 and 20000 edges/s. XTHAL_GET_CCOUNT() counts host time here, so this compares
+ *   the two modes, it is not what they take on an ESP32.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "test.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "shim/host_sim.h"
+#include "virtual_bus.h"
+#include "pins.h"
+#include "../src/sensors.h"
+
+#define TEETH 60
+#define SPEED_SEGMENT_US 500000
+#define STOPPED_US 200000
+#define RPM_READ_INTERVAL_MS 5
+#define HOST_CPU_MHZ 240
+
+// Readings are not checked until the old speed has gone from them: For this many teeth of the slower shaft (N3),
+// plus 5ms (The shortest span edge capture averages over)
+#ifdef RPM_PCNT_CAPTURE
+#define MODE_NAME "PCNT"
+#define EDGES_PER_ISR (TEETH / 8)
+// 3 samples averaged, plus the partial one the speed changed in
+#define SETTLE_TEETH (4 * EDGES_PER_ISR)
+#else
+#define MODE_NAME "Edge capture"
+#define EDGES_PER_ISR 1
+#define SETTLE_TEETH 2
+#endif
+#define SETTLE_MIN_US 5000
+
+static const uint32_t SPEEDS[] = { 300, 1000, 3000, 6000, 12000, 20000 };
+#define NUM_SPEEDS (sizeof(SPEEDS)/sizeof(SPEEDS[0]))
+#define PULSE_END_US (NUM_SPEEDS * SPEED_SEGMENT_US)
+
+static uint64_t settle_us(uint32_t n2_rpm) {
+    return SETTLE_MIN_US + (uint64_t)SETTLE_TEETH * 60000000 / (n2_rpm / 2 * TEETH);
+}
+
+static uint32_t n2_edges = 0;
+static uint32_t n3_edges = 0;
+
+// N3 turns at half the speed of N2 (As in 1st gear, near enough)
+static void pulse_task(void*) {
+    double n2_next = 0;
+    double n3_next = 0;
+    for (uint32_t s = 0; s < NUM_SPEEDS; s++) {
+        double end = (s + 1) * SPEED_SEGMENT_US;
+        double n2_interval = 60000000.0 / ((double)SPEEDS[s] * TEETH);
+        double n3_interval = n2_interval * 2;
+        while (true) {
+            double next = n2_next < n3_next ? n2_next : n3_next;
+            if (next >= end) {
+                break;
+            }
+            if ((uint64_t)next > HostSim::now()) {
+                HostSim::block_current_task((uint64_t)next);
+            }
+            if (n2_next <= next) {
+                HostSim::gpio_edge(PIN_N2);
+                n2_edges++;
+                n2_next += n2_interval;
+            }
+            if (n3_next <= next) {
+                HostSim::gpio_edge(PIN_N3);
+                n3_edges++;
+                n3_next += n3_interval;
+            }
+        }
+    }
+    vTaskDelete(nullptr);
+}
+
+typedef struct {
+    uint32_t checked;
+    uint32_t bad;
+    int max_error;
+} RpmCheck;
+
+static RpmCheck n2_check[NUM_SPEEDS] = {};
+static RpmCheck n3_check[NUM_SPEEDS] = {};
+static uint32_t stopped_nonzero = 0;
+
+static void check_rpm(RpmCheck* c, uint32_t reading, uint32_t rpm) {
+    int error = abs((int)reading - (int)rpm);
+    c->checked++;
+    if (error > (int)(rpm / 100 + 1)) {
+        c->bad++;
+    }
+    if (error > c->max_error) {
+        c->max_error = error;
+    }
+}
+
+static void reader_task(void*) {
+    TickType_t last_wake = xTaskGetTickCount();
+    while (true) {
+        uint64_t now = HostSim::now();
+        uint32_t n2 = Sensors::read_n2_rpm();
+        uint32_t n3 = Sensors::read_n3_rpm();
+        if (now < PULSE_END_US) {
+            uint32_t s = now / SPEED_SEGMENT_US;
+            if (now - s * SPEED_SEGMENT_US >= settle_us(SPEEDS[s])) {
+                check_rpm(&n2_check[s], n2, SPEEDS[s]);
+                check_rpm(&n3_check[s], n3, SPEEDS[s] / 2);
+            }
+        } else if (now > PULSE_END_US + 100000 && (n2 != 0 || n3 != 0)) {
+            stopped_nonzero++;
+        }
+        vTaskDelayUntil(&last_wake, RPM_READ_INTERVAL_MS);
+    }
+}
+
+int main() {
+    esp_log_level_set("*", ESP_LOG_WARN);
+    VirtualBus* vbus = new VirtualBus(500000);
+    HostSim::set_can_bus(vbus->add_node("TCM"));
+    CHECK(Sensors::init_sensors());
+    xTaskCreate(pulse_task, "SIM_PULSES", 8192, nullptr, 10, nullptr);
+    xTaskCreate(reader_task, "SIM_RPM_READER", 8192, nullptr, 5, nullptr);
+    HostSim::run(PULSE_END_US + STOPPED_US);
+    HostSim::shutdown();
+
+    printf("%s: %u N2 edges, %u N3 edges\n", MODE_NAME, n2_edges, n3_edges);
+    for (uint32_t s = 0; s < NUM_SPEEDS; s++) {
+        printf("N2 %5uRPM: %u readings, max error %dRPM. N3 %5uRPM: %u readings, max error %dRPM\n",
+            SPEEDS[s], n2_check[s].checked, n2_check[s].max_error, SPEEDS[s] / 2, n3_check[s].checked, n3_check[s].max_error);
+        CHECK_GE(n2_check[s].checked, (SPEED_SEGMENT_US - settle_us(SPEEDS[s])) / (RPM_READ_INTERVAL_MS * 1000) - 1);
+        CHECK_EQ(n2_check[s].bad, 0);
+        CHECK_EQ(n3_check[s].bad, 0);
+    }
+    CHECK_EQ(stopped_nonzero, 0);
+
+    RpmIsrStats n2;
+    RpmIsrStats n3;
+    Sensors::get_rpm_isr_stats(&n2, &n3);
+    CHECK_EQ(n2.count, n2_edges / EDGES_PER_ISR);
+    CHECK_EQ(n3.count, n3_edges / EDGES_PER_ISR);
+    double max_us = (double)(n2.max_cycles > n3.max_cycles ? n2.max_cycles : n3.max_cycles) / HOST_CPU_MHZ;
+    printf("ISR runs: N2 %u, N3 %u. Longest %.2fus (Host time). Worst case load at 12000 edges/s %.2f%%, at 20000 edges/s %.2f%%\n",
+        n2.count, n3.count, max_us, max_us * 12000 / EDGES_PER_ISR / 10000, max_us * 20000 / EDGES_PER_ISR / 10000);
+    return test_result();
+}
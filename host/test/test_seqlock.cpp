@@ -0,0 +1,94 @@
+/**
+ * Host test: Seqlock (include/seqlock.h) under a writer and a reader thread running flat out
+ *
+ * Every value written has the same number in all of its words, so a torn read (Words from two different
+ * writes) shows up as a mismatch. Each read must also come back with the sequence number of the write
+ * that stored it, and the values a reader sees must never go backwards.
+ */
+
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+#include "test.h"
+#include "seqlock.h"
+
+#define WRITES 2000000
+// Large enough that a copy takes a while, giving the writer plenty of chances to overtake a reader
+#define VALUE_WORDS 64
+
+typedef struct {
+    uint32_t words[VALUE_WORDS];
+} Value;
+
+static Seqlock<Value> lock;
+static std::atomic<bool> done{false};
+
+static void writer() {
+    Value v;
+    for (uint32_t n = 1; n <= WRITES; n++) {
+        for (uint32_t i = 0; i < VALUE_WORDS; i++) {
+            v.words[i] = n;
+        }
+        lock.write(v);
+    }
+    done.store(true);
+}
+
+typedef struct {
+    uint32_t reads;
+    uint32_t torn;
+    uint32_t wrong_seq;
+    uint32_t backwards;
+    uint32_t changes;
+} ReaderResult;
+
+static void reader(ReaderResult* r) {
+    Value v;
+    uint32_t last = 0;
+    *r = {};
+    while (!done.load()) {
+        uint32_t seq = lock.read(&v);
+        r->reads++;
+        for (uint32_t i = 1; i < VALUE_WORDS; i++) {
+            if (v.words[i] != v.words[0]) {
+                r->torn++;
+                break;
+            }
+        }
+        if (seq != v.words[0]) {
+            r->wrong_seq++;
+        }
+        if (v.words[0] < last) {
+            r->backwards++;
+        } else if (v.words[0] != last) {
+            r->changes++;
+        }
+        last = v.words[0];
+    }
+}
+
+int main() {
+    ReaderResult results[2];
+    std::thread readers[2] = {
+        std::thread(reader, &results[0]),
+        std::thread(reader, &results[1])
+    };
+    std::thread w(writer);
+    w.join();
+    for (std::thread& t : readers) {
+        t.join();
+    }
+    for (const ReaderResult& r : results) {
+        printf("Reader: %u reads, %u new values, %u torn, %u wrong sequence numbers, %u went backwards\n",
+            r.reads, r.changes, r.torn, r.wrong_seq, r.backwards);
+        CHECK_EQ(r.torn, 0);
+        CHECK_EQ(r.wrong_seq, 0);
+        CHECK_EQ(r.backwards, 0);
+        // Make sure the threads actually overlapped
+        CHECK_GE(r.changes, 2);
+    }
+    Value v;
+    CHECK_EQ(lock.read(&v), WRITES);
+    CHECK_EQ(v.words[VALUE_WORDS - 1], WRITES);
+    return test_result();
+}
@@ -0,0 +1,160 @@
+/**
+ * Host test: N2/N3 speed and acceleration estimator (include/shaft_estimator.h), with the gains in gearbox.h
+ *
+ * Synthetic N2 pulse train through the edge capture code (edge_speed.h), each tooth moved by up to 1% of a tooth
+ * for uneven tooth spacing: Steady 2500RPM, then a 400ms inertia phase at -2500RPM/s, steady again, then a ramp
+ * back up at 2000RPM/s. The gearbox controller reads the speed every 20ms and updates the estimator, as in
+ * Gearbox::calc_input_rpm().
+ *
+ * With N2_N3_ESTIMATOR_ALPHA / _BETA:
+ * - The acceleration is past half the real value within MAX_ACCEL_LAG_US of the inertia phase starting.
+ * - The acceleration noise at steady speed is under MAX_ACCEL_NOISE (And well under differencing the raw readings).
+ * - The speed stays within MAX_SPEED_ERROR of the real speed, ramps included.
+ * - Confidence is 100% at steady speed with this much measurement noise (N2_N3_NOISE_RPM), and 0 once readings stop.
+ * And the gains are where these balance. Beta is the smallest that meets the lag bound: Halving it makes the
+ * acceleration too slow, doubling it only doubles the noise without getting there any sooner. Halving alpha lets the
+ * speed fall too far behind in the ramps, and taking the measurement as is (Alpha 1) makes the speed noisier and the
+ * acceleration slower.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "test.h"
+#include "edge_speed.h"
+#include "shaft_estimator.h"
+#include "../src/gearbox.h"
+
+#define TEETH 60
+#define CONTROLLER_TICK_US 20000
+#define TOOTH_JITTER 0.01
+#define STEADY_RPM 2500.0
+#define INERTIA_ACCEL -2500.0
+#define RAMP_ACCEL 2000.0
+// Phases (us)
+#define STEADY_END 1000000
+#define INERTIA_END 1400000
+#define SETTLED_END 1800000
+#define RAMP_END 2300000
+
+#define MAX_ACCEL_LAG_US 60000
+#define MAX_ACCEL_NOISE 150.0
+#define MAX_SPEED_ERROR 40.0
+
+typedef struct {
+    // Time from the inertia phase starting to the acceleration being past half its real value (us)
+    uint64_t accel_lag_us;
+    // RMS acceleration over the second half of the first steady phase (RPM/s)
+    double accel_noise;
+    // Same, from differencing consecutive raw readings
+    double raw_accel_noise;
+    double max_speed_error;
+    // RMS speed error over the second half of the first steady phase (RPM)
+    double speed_noise;
+    uint8_t min_steady_confidence;
+} Result;
+
+static double true_rpm(double t) {
+    double rpm = STEADY_RPM;
+    rpm += INERTIA_ACCEL * (fmin(fmax(t, STEADY_END), INERTIA_END) - STEADY_END) / 1e6;
+    rpm += RAMP_ACCEL * (fmin(fmax(t, SETTLED_END), RAMP_END) - SETTLED_END) / 1e6;
+    return rpm;
+}
+
+static Result run_trace(float alpha, float beta) {
+    Result res = {};
+    res.accel_lag_us = UINT64_MAX;
+    res.min_steady_confidence = 100;
+    EdgeRing ring = {};
+    ShaftEstimator est(alpha, beta, N2_N3_NOISE_RPM);
+    uint32_t seed = 1;
+    double angle = 0;
+    // Next edge is at this angle (1 tooth, moved by the jitter)
+    double next_edge = 1.0;
+    double noise_sum = 0;
+    double raw_noise_sum = 0;
+    double speed_noise_sum = 0;
+    uint32_t noise_n = 0;
+    uint32_t last_raw = 0;
+    for (uint64_t t = 1; t <= RAMP_END + 500000; t++) {
+        angle += true_rpm(t) * TEETH / 60000000.0;
+        if (angle >= next_edge) {
+            edge_ring_push(&ring, t);
+            seed = seed * 1103515245 + 12345;
+            double jitter = ((seed >> 16) & 0x7FFF) / 32767.0 * 2 - 1;
+            next_edge += 1.0 + jitter * TOOTH_JITTER;
+        }
+        if (t % CONTROLLER_TICK_US != 0) {
+            continue;
+        }
+        uint32_t raw = edge_ring_rpm(&ring, t, TEETH);
+        est.update(raw, t);
+        ShaftEstimate e = est.get(t);
+        if (t >= STEADY_END / 2 && t < STEADY_END) {
+            noise_sum += e.accel * e.accel;
+            double raw_accel = ((double)raw - last_raw) * 1e6 / CONTROLLER_TICK_US;
+            raw_noise_sum += raw_accel * raw_accel;
+            speed_noise_sum += (e.speed - STEADY_RPM) * (e.speed - STEADY_RPM);
+            noise_n++;
+            if (e.confidence < res.min_steady_confidence) {
+                res.min_steady_confidence = e.confidence;
+            }
+        }
+        if (t >= STEADY_END && res.accel_lag_us == UINT64_MAX && e.accel < INERTIA_ACCEL / 2) {
+            res.accel_lag_us = t - STEADY_END;
+        }
+        if (t >= STEADY_END / 2) {
+            double error = fabs(e.speed - true_rpm(t));
+            if (error > res.max_speed_error) {
+                res.max_speed_error = error;
+            }
+        }
+        last_raw = raw;
+    }
+    res.accel_noise = sqrt(noise_sum / noise_n);
+    res.raw_accel_noise = sqrt(raw_noise_sum / noise_n);
+    res.speed_noise = sqrt(speed_noise_sum / noise_n);
+    return res;
+}
+
+static void print_result(const char* name, float alpha, float beta, const Result* r) {
+    printf("%s (alpha %.2f, beta %.2f): Accel lag %lluus, accel noise %.0fRPM/s (Raw differencing %.0fRPM/s), max speed error %.1fRPM, speed noise %.1fRPM, steady confidence %u%%\n",
+        name, alpha, beta, (unsigned long long)r->accel_lag_us, r->accel_noise, r->raw_accel_noise, r->max_speed_error, r->speed_noise, r->min_steady_confidence);
+}
+
+int main() {
+    Result r = run_trace(N2_N3_ESTIMATOR_ALPHA, N2_N3_ESTIMATOR_BETA);
+    print_result("gearbox.h", N2_N3_ESTIMATOR_ALPHA, N2_N3_ESTIMATOR_BETA, &r);
+    CHECK_LE(r.accel_lag_us, MAX_ACCEL_LAG_US);
+    CHECK(r.accel_noise < MAX_ACCEL_NOISE);
+    CHECK(r.accel_noise < r.raw_accel_noise / 3);
+    CHECK(r.max_speed_error < MAX_SPEED_ERROR);
+    CHECK_EQ(r.min_steady_confidence, 100);
+
+    Result slow = run_trace(N2_N3_ESTIMATOR_ALPHA, N2_N3_ESTIMATOR_BETA / 2);
+    print_result("Half beta", N2_N3_ESTIMATOR_ALPHA, N2_N3_ESTIMATOR_BETA / 2, &slow);
+    CHECK(slow.accel_lag_us > MAX_ACCEL_LAG_US);
+    Result noisy = run_trace(N2_N3_ESTIMATOR_ALPHA, N2_N3_ESTIMATOR_BETA * 2);
+    print_result("Double beta", N2_N3_ESTIMATOR_ALPHA, N2_N3_ESTIMATOR_BETA * 2, &noisy);
+    CHECK_GE(noisy.accel_lag_us, r.accel_lag_us);
+    CHECK(noisy.accel_noise > r.accel_noise * 1.5);
+    Result smooth = run_trace(N2_N3_ESTIMATOR_ALPHA / 2, N2_N3_ESTIMATOR_BETA);
+    print_result("Half alpha", N2_N3_ESTIMATOR_ALPHA / 2, N2_N3_ESTIMATOR_BETA, &smooth);
+    Result raw = run_trace(1.0f, N2_N3_ESTIMATOR_BETA);
+    print_result("Alpha 1", 1.0f, N2_N3_ESTIMATOR_BETA, &raw);
+    CHECK(smooth.max_speed_error > MAX_SPEED_ERROR);
+    CHECK(raw.speed_noise > r.speed_noise * 1.2);
+    CHECK(raw.accel_lag_us > r.accel_lag_us);
+
+    // Readings stop: No confidence, and the next reading starts again from scratch
+    ShaftEstimator est(N2_N3_ESTIMATOR_ALPHA, N2_N3_ESTIMATOR_BETA, N2_N3_NOISE_RPM);
+    for (uint64_t t = CONTROLLER_TICK_US; t <= 1000000; t += CONTROLLER_TICK_US) {
+        est.update(1000.0f + t / 1000, t);
+    }
+    CHECK_EQ(est.get(1000000).confidence, 100);
+    CHECK_EQ(est.get(1000000 + SHAFT_ESTIMATE_TIMEOUT_US + 1).confidence, 0);
+    est.update(500, 2000000);
+    ShaftEstimate e = est.get(2000000);
+    CHECK(e.speed == 500.0f);
+    CHECK(e.accel == 0.0f);
+    return test_result();
+}
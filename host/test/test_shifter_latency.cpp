@@ -0,0 +1,82 @@
+/**
+ * Host test: Shifter to GS_418 latency of the full TCM on a fully loaded bus
+ *
+ * Runs the TCM task set next to the simulated car (See sim_car.h), with a load generator winning arbitration against
+ * everything the TCM sends (HIGH_LOAD_PERCENT on a low CAN ID) and another one filling every gap left (On the highest
+ * CAN ID), so the bus is at 100%. Every lever movement must show up in GS_418 within MAX_SHIFTER_LATENCY_US:
+ * One gearbox controller tick (20ms), plus one GS_418 cycle (20ms), plus a little for frames queued behind the load.
+ * The TCM must not lose a frame or miss a Tx deadline doing so.
+ */
+
+#include <stdio.h>
+#include <algorithm>
+#include <vector>
+#include "test.h"
+#include "shim/host_sim.h"
+#include "virtual_bus.h"
+#include "sim_car.h"
+#include "../src/canbus/egs_can_hal.h"
+#include "../src/canbus/can_filter.h"
+
+#define RUN_TIME_US 60000000
+#define SHIFTER_INTERVAL_MS 2000
+#define HIGH_LOAD_PERCENT 60
+#define HIGH_LOAD_CAN_ID 0x0F0
+#define FILL_LOAD_CAN_ID 0x7F0
+#define MAX_SHIFTER_LATENCY_US 50000
+
+static HostCanBus* add_load_node(VirtualBus* vbus, const char* name, uint32_t can_id) {
+    HostCanBus* bus = vbus->add_node(name);
+    twai_filter_config_t filter = calc_acceptance_filter(&can_id, 1);
+    SimCar::configure_node(bus, &filter);
+    return bus;
+}
+
+int main() {
+    esp_log_level_set("*", ESP_LOG_NONE);
+    VirtualBus* vbus = new VirtualBus(SIM_CAR_BUS_BITRATE);
+    HostSim::set_can_bus(vbus->add_node("TCM"));
+    HostCanBus* ecu_bus = vbus->add_node("ECUs");
+    SimCar::configure_node(ecu_bus, nullptr);
+    HostCanBus* high_load_bus = add_load_node(vbus, "HIGH_LOAD", HIGH_LOAD_CAN_ID);
+    HostCanBus* fill_load_bus = add_load_node(vbus, "FILL_LOAD", FILL_LOAD_CAN_ID);
+
+    CHECK(SimCar::start_tcm() != nullptr);
+    SimCar::start_ecus(ecu_bus, SHIFTER_INTERVAL_MS);
+    SimCar::start_load(high_load_bus, HIGH_LOAD_PERCENT, HIGH_LOAD_CAN_ID);
+    SimCar::start_load(fill_load_bus, 100, FILL_LOAD_CAN_ID);
+    HostSim::run(RUN_TIME_US);
+    HostSim::shutdown();
+
+    VirtualBusStats bus_stats = vbus->get_stats();
+    double load = bus_stats.busy_us * 100.0 / RUN_TIME_US;
+    printf("Bus: %u frames, %.1f%% load\n", bus_stats.frames, load);
+    CHECK(load > 99.9);
+
+    const SimCarResults* results = SimCar::get_results();
+    std::vector<uint32_t> latencies = results->shifter_latencies;
+    // The last movement may still be on its way
+    CHECK_GE(latencies.size(), RUN_TIME_US / (SHIFTER_INTERVAL_MS * 1000) - 2);
+    if (!latencies.empty()) {
+        std::sort(latencies.begin(), latencies.end());
+        printf("Shifter to GS_418 latency (us, %u lever movements): min %u, p50 %u, max %u\n",
+            (uint32_t)latencies.size(), latencies.front(), latencies[(latencies.size() - 1) / 2], latencies.back());
+        CHECK_LE(latencies.back(), MAX_SHIFTER_LATENCY_US);
+    }
+
+    CanRxStats rx_stats = egs_can_hal->get_rx_stats();
+    CHECK_EQ(rx_stats.rejected_count, 0);
+    CHECK_EQ(rx_stats.rx_queue_overflow_count, 0);
+    CHECK_EQ(rx_stats.ring_overflow_count, 0);
+    uint32_t can_id;
+    TxFrameStats tx_stats;
+    for (uint8_t i = 0; i < egs_can_hal->get_num_tx_frames(); i++) {
+        if (egs_can_hal->get_tx_frame_stats(i, &can_id, &tx_stats)) {
+            printf("TCM Tx 0x%03X: %u frames, %u failed, %u deadlines missed\n", can_id, tx_stats.tx_count, tx_stats.failed_count, tx_stats.missed_count);
+            CHECK_GE(tx_stats.tx_count, RUN_TIME_US / 20000 - 1);
+            CHECK_EQ(tx_stats.failed_count, 0);
+            CHECK_EQ(tx_stats.missed_count, 0);
+        }
+    }
+    return test_result();
+}
@@ -0,0 +1,78 @@
+/**
+ * Host test: Every VehicleSnapshot field expires at its own age
+ *
+ * The engine sends MS_210 (Pedal) and MS_308 (Engine RPM) once, then goes quiet. With the gearbox controller's
+ * expiries, the pedal must be gone after 100ms whilst the engine RPM is still valid, until 250ms.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "test.h"
+#include "shim/host_sim.h"
+#include "virtual_bus.h"
+#include "../src/canbus/egs_can_hal.h"
+
+#define BUS_BITRATE 500000
+
+static const VehicleSnapshotExpiry EXPIRY = {
+    .wheels_ms = 250,
+    .engine_rpm_ms = 250,
+    .shifter_position_ms = 250,
+    .pedal_ms = 100,
+    .engine_coolant_temp_ms = 250
+};
+
+static void engine_task(void* params) {
+    HostCanBus* bus = (HostCanBus*)params;
+    twai_message_t msg = {};
+    msg.data_length_code = 8;
+    MS_210 ms210 = {};
+    ms210.set_PW(42);
+    msg.identifier = MS_210_CAN_ID;
+    memcpy(msg.data, ms210.bytes, 8);
+    bus->transmit(&msg, HostSim::now());
+    MS_308 ms308 = {};
+    ms308.set_NMOT(800);
+    msg.identifier = MS_308_CAN_ID;
+    memcpy(msg.data, ms308.bytes, 8);
+    bus->transmit(&msg, HostSim::now());
+    vTaskDelay(portMAX_DELAY);
+}
+
+static void check_task(void* params) {
+    VehicleSnapshot s;
+    vTaskDelay(50);
+    egs_can_hal->get_vehicle_snapshot(HostSim::now(), &EXPIRY, &s);
+    CHECK(s.is_valid(SNAPSHOT_PEDAL));
+    CHECK_EQ(s.pedal, 42);
+    CHECK(s.is_valid(SNAPSHOT_ENGINE_RPM));
+    CHECK_EQ(s.engine_rpm, 800);
+    vTaskDelay(100);
+    egs_can_hal->get_vehicle_snapshot(HostSim::now(), &EXPIRY, &s);
+    CHECK(!s.is_valid(SNAPSHOT_PEDAL));
+    CHECK(s.is_valid(SNAPSHOT_ENGINE_RPM));
+    CHECK_EQ(s.engine_rpm, 800);
+    vTaskDelay(150);
+    egs_can_hal->get_vehicle_snapshot(HostSim::now(), &EXPIRY, &s);
+    CHECK(!s.is_valid(SNAPSHOT_PEDAL));
+    CHECK(!s.is_valid(SNAPSHOT_ENGINE_RPM));
+    HostSim::stop();
+    vTaskDelay(portMAX_DELAY);
+}
+
+int main() {
+    esp_log_level_set("*", ESP_LOG_WARN);
+    VirtualBus* vbus = new VirtualBus(BUS_BITRATE);
+    HostSim::set_can_bus(vbus->add_node("TCM"));
+    HostCanBus* ecu_bus = vbus->add_node("ECUs");
+    twai_general_config_t config = TWAI_GENERAL_CONFIG_DEFAULT(GPIO_NUM_NC, GPIO_NUM_NC, TWAI_MODE_NORMAL);
+    ecu_bus->configure(&config, nullptr);
+
+    egs_can_hal = new EgsCanHal("EGS52", 20);
+    CHECK(egs_can_hal->begin_tasks());
+    xTaskCreate(engine_task, "SIM_ENGINE", 8192, ecu_bus, 5, nullptr);
+    xTaskCreate(check_task, "CHECK", 8192, nullptr, 1, nullptr);
+    HostSim::run(1000000);
+    HostSim::shutdown();
+    return test_result();
+}
@@ -0,0 +1,221 @@
+#include "virtual_bus.h"
+#include "shim/host_sim.h"
+
+// CRC field polynomial of classic CAN
+#define CAN_CRC15_POLY 0x4599
+// Bits after the CRC, which are not stuffed (CRC delimiter, ACK slot + delimiter, EOF, interframe space)
+#define CAN_FRAME_TAIL_BITS (1 + 2 + 7 + 3)
+// SOF to the end of the CRC of the longest frame (Extended, 8 data bytes)
+#define CAN_MAX_STUFFED_BITS (1 + 32 + 6 + 64 + 15)
+
+bool VirtualBusNode::receive(twai_message_t* msg, uint64_t now) {
+    if (this->rx_queue.empty() || this->rx_queue.front().time > now) {
+        return false;
+    }
+    *msg = this->rx_queue.front().msg;
+    this->rx_queue.pop_front();
+    return true;
+}
+
+uint64_t VirtualBusNode::get_next_rx_time() {
+    return this->rx_queue.empty() ? UINT64_MAX : this->rx_queue.front().time;
+}
+
+bool VirtualBusNode::transmit(const twai_message_t* msg, uint64_t now) {
+    // tx_queue_len frames wait in the driver's queue, plus the one in the controller's Tx buffer
+    if (this->tx_queue.size() > this->tx_queue_len) {
+        return false;
+    }
+    this->tx_queue.push_back(TimedFrame { .msg = *msg, .time = now });
+    this->bus->on_frame_queued();
+    return true;
+}
+
+VirtualBus::VirtualBus(uint32_t bitrate) {
+    this->bitrate = bitrate;
+    esp_timer_create_args_t args = {
+        .callback = &VirtualBus::on_timer,
+        .arg = this,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "VBUS",
+        .skip_unhandled_events = false
+    };
+    esp_timer_create(&args, &this->timer);
+}
+
+VirtualBus::~VirtualBus() {
+    esp_timer_stop(this->timer);
+    esp_timer_delete(this->timer);
+    for (VirtualBusNode* n : this->nodes) {
+        delete n;
+    }
+}
+
+VirtualBusNode* VirtualBus::add_node(const char* name) {
+    VirtualBusNode* n = new VirtualBusNode(this, name);
+    this->nodes.push_back(n);
+    return n;
+}
+
+uint32_t VirtualBus::frame_bits(const twai_message_t* msg) {
+    uint8_t bits[CAN_MAX_STUFFED_BITS];
+    uint32_t n = 0;
+    bool rtr = msg->rtr;
+    uint8_t dlc = msg->data_length_code > 8 ? 8 : msg->data_length_code;
+    bits[n++] = 0; // SOF
+    if (msg->extd) {
+        for (int i = 28; i >= 18; i--) {
+            bits[n++] = msg->identifier >> i & 1;
+        }
+        bits[n++] = 1; // SRR
+        bits[n++] = 1; // IDE
+        for (int i = 17; i >= 0; i--) {
+            bits[n++] = msg->identifier >> i & 1;
+        }
+        bits[n++] = rtr;
+        bits[n++] = 0; // r1
+        bits[n++] = 0; // r0
+    } else {
+        for (int i = 10; i >= 0; i--) {
+            bits[n++] = msg->identifier >> i & 1;
+        }
+        bits[n++] = rtr;
+        bits[n++] = 0; // IDE
+        bits[n++] = 0; // r0
+    }
+    for (int i = 3; i >= 0; i--) {
+        bits[n++] = msg->data_length_code >> i & 1;
+    }
+    if (!rtr) {
+        for (uint8_t b = 0; b < dlc; b++) {
+            for (int i = 7; i >= 0; i--) {
+                bits[n++] = msg->data[b] >> i & 1;
+            }
+        }
+    }
+    uint16_t crc = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        bool crc_next = bits[i] ^ (crc >> 14 & 1);
+        crc = (crc << 1) & 0x7FFF;
+        if (crc_next) {
+            crc ^= CAN_CRC15_POLY;
+        }
+    }
+    for (int i = 14; i >= 0; i--) {
+        bits[n++] = crc >> i & 1;
+    }
+    // A stuff bit follows every 5 identical bits (And counts towards the next run)
+    uint32_t stuff = 0;
+    uint8_t last = bits[0];
+    uint8_t run = 1;
+    for (uint32_t i = 1; i < n; i++) {
+        if (bits[i] == last) {
+            run++;
+        } else {
+            last = bits[i];
+            run = 1;
+        }
+        if (run == 5) {
+            stuff++;
+            last ^= 1;
+            run = 1;
+        }
+    }
+    return n + stuff + CAN_FRAME_TAIL_BITS;
+}
+
+uint32_t VirtualBus::frame_time_us(const twai_message_t* msg) const {
+    return (uint32_t)((uint64_t)frame_bits(msg) * 1000000 / this->bitrate);
+}
+
+void VirtualBus::on_frame_queued() {
+    if (!this->busy) {
+        // Arbitrate once everything else due now has run, so every node
+        // queueing a frame at the same time gets to take part
+        this->busy = true;
+        esp_timer_start_once(this->timer, 0);
+    }
+}
+
+void VirtualBusNode::clear_tx_queue() {
+    // A frame already on the bus is finished
+    size_t keep = this->bus->sender == this ? 1 : 0;
+    while (this->tx_queue.size() > keep) {
+        this->tx_queue.pop_back();
+    }
+}
+
+void VirtualBus::on_timer(void* arg) {
+    VirtualBus* bus = (VirtualBus*)arg;
+    if (bus->sender != nullptr) {
+        bus->end_frame();
+    }
+    bus->arbitrate();
+}
+
+void VirtualBus::end_frame() {
+    uint64_t now = HostSim::now();
+    VirtualBusNode* from = this->sender;
+    VirtualBusNode::TimedFrame f = from->tx_queue.front();
+    from->tx_queue.pop_front();
+    from->stats.tx_count++;
+    if (now - f.time > from->stats.max_tx_latency_us) {
+        from->stats.max_tx_latency_us = now - f.time;
+    }
+    from->notify_tx(now);
+    this->stats.frames++;
+    this->stats.busy_us += now - this->frame_start;
+    for (VirtualBusNode* to : this->nodes) {
+        if (to == from || !to->filter_accepts(&f.msg)) {
+            continue;
+        }
+        if (to->rx_queue.size() >= to->rx_queue_len) {
+            to->rx_overflow_count++;
+            continue;
+        }
+        to->rx_queue.push_back(VirtualBusNode::TimedFrame { .msg = f.msg, .time = now });
+        to->stats.rx_count++;
+        if (to->rx_queue.size() > to->stats.max_rx_queue_depth) {
+            to->stats.max_rx_queue_depth = to->rx_queue.size();
+        }
+        to->notify_rx(now);
+    }
+    if (this->tap != nullptr) {
+        this->tap(&f.msg, this->frame_start, now, from);
+    }
+    this->sender = nullptr;
+}
+
+// Arbitration field as a number, lowest wins. A standard frame beats an extended frame with the same base ID
+static uint64_t arbitration_key(const twai_message_t* msg) {
+    if (msg->extd) {
+        return (uint64_t)(msg->identifier >> 18 & 0x7FF) << 20 | 1 << 19 | (msg->identifier & 0x3FFFF) << 1 | msg->rtr;
+    }
+    return (uint64_t)(msg->identifier & 0x7FF) << 20 | msg->rtr << 18;
+}
+
+void VirtualBus::arbitrate() {
+    VirtualBusNode* winner = nullptr;
+    uint64_t best = UINT64_MAX;
+    for (VirtualBusNode* n : this->nodes) {
+        if (!n->tx_queue.empty()) {
+            uint64_t key = arbitration_key(&n->tx_queue.front().msg);
+            if (key < best) {
+                best = key;
+                winner = n;
+            }
+        }
+    }
+    if (winner == nullptr) {
+        this->busy = false;
+        return;
+    }
+    for (VirtualBusNode* n : this->nodes) {
+        if (n != winner && !n->tx_queue.empty()) {
+            n->stats.arbitration_lost_count++;
+        }
+    }
+    this->sender = winner;
+    this->frame_start = HostSim::now();
+    esp_timer_start_once(this->timer, this->frame_time_us(&winner->tx_queue.front().msg));
+}
@@ -0,0 +1,127 @@
+/**
+ * Host build: In-process virtual CAN bus
+ *
+ * Connects any number of nodes (The firmware's TWAI driver, simulated ECUs, load generators...)
+ * in lockstep with the simulated clock. The bus is modelled at the frame level:
+ * - Every frame occupies the bus for its real length at the configured bitrate, stuff bits and
+ *   interframe space included, so the bus saturates at the same load the car's bus does.
+ * - Each node sends its Tx queue in order (Like the TWAI controller does). When the bus goes idle, the
+ *   head frames of every node arbitrate, and the lowest CAN ID wins.
+ * - A frame is received by every other node at the end of the frame, through that node's
+ *   acceptance filter and into its Rx queue (Frames are lost if the queue is full).
+ */
+
+#ifndef __VIRTUAL_BUS_H_
+#define __VIRTUAL_BUS_H_
+
+#include <stdint.h>
+#include <deque>
+#include <vector>
+#include "shim/host_can_bus.h"
+#include "esp_timer.h"
+
+class VirtualBus;
+
+typedef struct {
+    uint32_t tx_count;
+    uint32_t rx_count;
+    // Times the head of our Tx queue lost arbitration to another node
+    uint32_t arbitration_lost_count;
+    // Longest time a frame took from transmit() to the end of it on the bus
+    uint32_t max_tx_latency_us;
+    // Most received frames that have been waiting in our Rx queue at once (Counting the one that just arrived)
+    uint32_t max_rx_queue_depth;
+} VirtualBusNodeStats;
+
+// A node on the virtual bus
+class VirtualBusNode : public HostCanBus {
+    public:
+        bool receive(twai_message_t* msg, uint64_t now) override;
+        uint64_t get_next_rx_time() override;
+        bool transmit(const twai_message_t* msg, uint64_t now) override;
+        uint32_t get_tx_queue_len() override {
+            return this->tx_queue.size();
+        }
+        void clear_tx_queue() override;
+
+        const char* get_name() const {
+            return this->name;
+        }
+
+        VirtualBusNodeStats get_stats() const {
+            return this->stats;
+        }
+    private:
+        friend class VirtualBus;
+        VirtualBusNode(VirtualBus* bus, const char* name) : bus(bus), name(name) {}
+
+        typedef struct {
+            twai_message_t msg;
+            // Time the frame was queued (Tx) or arrived (Rx)
+            uint64_t time;
+        } TimedFrame;
+
+        VirtualBus* bus;
+        const char* name;
+        std::deque<TimedFrame> tx_queue;
+        std::deque<TimedFrame> rx_queue;
+        VirtualBusNodeStats stats = {};
+};
+
+typedef struct {
+    uint32_t frames;
+    // Time the bus was busy sending frames
+    uint64_t busy_us;
+} VirtualBusStats;
+
+// Called with every frame that makes it onto the bus, at the end of the frame
+typedef void (*VirtualBusTap)(const twai_message_t* msg, uint64_t start, uint64_t end, const VirtualBusNode* sender);
+
+class VirtualBus {
+    public:
+        explicit VirtualBus(uint32_t bitrate);
+        ~VirtualBus();
+
+        // Adds a node. The node belongs to the bus
+        VirtualBusNode* add_node(const char* name);
+
+        void set_tap(VirtualBusTap tap) {
+            this->tap = tap;
+        }
+
+        VirtualBusStats get_stats() const {
+            return this->stats;
+        }
+
+        uint32_t get_bitrate() const {
+            return this->bitrate;
+        }
+
+        // Length of 'msg' on the bus in bits (Including stuff bits and the interframe space)
+        static uint32_t frame_bits(const twai_message_t* msg);
+
+        // Time 'msg' occupies the bus for
+        uint32_t frame_time_us(const twai_message_t* msg) const;
+    private:
+        friend class VirtualBusNode;
+        // A node has queued a frame
+        void on_frame_queued();
+        static void on_timer(void* arg);
+        // Delivers the frame on the bus to every other node
+        void end_frame();
+        // Starts sending the winning head frame, if any node has one
+        void arbitrate();
+
+        uint32_t bitrate;
+        std::vector<VirtualBusNode*> nodes;
+        esp_timer_handle_t timer;
+        // Arbitration is pending or a frame is on the bus
+        bool busy = false;
+        // Node whose head frame is on the bus (nullptr whilst waiting to arbitrate)
+        VirtualBusNode* sender = nullptr;
+        uint64_t frame_start = 0;
+        VirtualBusTap tap = nullptr;
+        VirtualBusStats stats = {};
+};
+
+#endif // __VIRTUAL_BUS_H_
@@ -0,0 +1,76 @@
+#ifndef __ECU_FRAME_CHECK_H_
+#define __ECU_FRAME_CHECK_H_
+
+#include <stdint.h>
+
+/**
+ * Receive side validation of the message counter, toggle and parity signals of a CAN frame.
+ *
+ * convert.py generates a check for every frame read by the TCM that has such signals, which runs
+ * before the frame is stored. A frame that fails is thrown away, so a frozen or repeated frame
+ * from a failing ECU can never make old data look fresh to the getters.
+ *
+ * All masks are in wire order (See the generated frame unions), so the checks need no byte swapping.
+ */
+
+// A toggle bit that has not changed for this long is frozen (They toggle every 40ms +-10)
+#define FRAME_TOGGLE_TIMEOUT_US 100000
+// A frame that has not been received for this long starts a new sequence (Its counter and toggle are not compared)
+#define FRAME_SEQUENCE_TIMEOUT_US 500000
+
+enum class FrameCheckResult : uint8_t {
+    Ok,
+    // Message counter did not change since the last frame (Repeated frame)
+    Counter,
+    // Toggle bit has not changed for FRAME_TOGGLE_TIMEOUT_US (Frozen frame)
+    Toggle,
+    // A parity bit does not match the bits it covers (Corrupt frame)
+    Parity
+};
+
+// Sequence state of a checked frame. Only touched by the CAN Rx task
+typedef struct {
+    // Counter and toggle bits of the last accepted frame
+    uint64_t last_counter;
+    uint64_t last_toggle;
+    // Time the toggle bits of accepted frames last changed
+    uint64_t toggle_time;
+    // Time the frame was last received (Accepted or not)
+    uint64_t last_rx_time;
+} FrameCheckState;
+
+/**
+ * Returns true if the bits of 'value' in 'mask' (The parity bit, and the bits it covers)
+ * have even parity
+ */
+inline bool frame_parity_ok(uint64_t value, uint64_t mask) {
+    return (__builtin_popcountll(value & mask) & 1) == 0;
+}
+
+/**
+ * Checks the message counter ('counter_mask') and toggle ('toggle_mask') of a frame received at 'now'
+ * against the last accepted frame, and makes it the last accepted frame if it passes.
+ * Either mask may be 0 if the frame has no such signal
+ */
+inline FrameCheckResult frame_sequence_check(FrameCheckState* s, uint64_t value, uint64_t counter_mask, uint64_t toggle_mask, uint64_t now) {
+    uint64_t counter = value & counter_mask;
+    uint64_t toggle = value & toggle_mask;
+    bool in_sequence = s->last_rx_time != 0 && now - s->last_rx_time <= FRAME_SEQUENCE_TIMEOUT_US;
+    s->last_rx_time = now;
+    if (in_sequence) {
+        if (counter_mask != 0 && counter == s->last_counter) {
+            return FrameCheckResult::Counter;
+        }
+        if (toggle_mask != 0 && toggle == s->last_toggle && now - s->toggle_time > FRAME_TOGGLE_TIMEOUT_US) {
+            return FrameCheckResult::Toggle;
+        }
+    }
+    if (!in_sequence || toggle != s->last_toggle) {
+        s->toggle_time = now;
+    }
+    s->last_counter = counter;
+    s->last_toggle = toggle;
+    return FrameCheckResult::Ok;
+}
+
+#endif // __ECU_FRAME_CHECK_H_
@@ -0,0 +1,85 @@
+#ifndef __ECU_FRAME_STATS_H_
+#define __ECU_FRAME_STATS_H_
+
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * Arrival statistics of a CAN frame received from another ECU.
+ *
+ * All intervals are in microseconds. Interval fields are 0 until the frame
+ * has been received at least twice.
+ */
+typedef struct {
+    // Number of times the frame has been received
+    uint32_t rx_count;
+    // Interval between the last 2 frames
+    uint32_t last_interval;
+    // Shortest interval seen
+    uint32_t min_interval;
+    // Longest interval seen
+    uint32_t max_interval;
+    // Exponentially weighted moving average of the interval (alpha = 1/8)
+    uint32_t ewma_interval;
+    // Number of times the frame went stale (Counted once per received frame by the getters, see FrameStaleCounter)
+    uint32_t stale_count;
+    // Frames thrown away as they failed validation (See ecu_frame_check.h). Not included in rx_count
+    uint32_t rejected_count;
+    // Timestamp of the last frame
+    uint64_t last_time;
+} FrameArrivalStats;
+
+#define EWMA_INTERVAL_SHIFT 3 // alpha = 1/8
+
+/**
+ * Updates the arrival statistics of a frame received at 'timestamp'. Only call from the CAN Rx task!
+ */
+inline void update_arrival_stats(FrameArrivalStats* s, uint64_t timestamp) {
+    if (s->rx_count != 0 && timestamp > s->last_time) {
+        uint64_t delta = timestamp - s->last_time;
+        uint32_t interval = delta > UINT32_MAX ? UINT32_MAX : (uint32_t)delta;
+        if (s->rx_count == 1) {
+            s->min_interval = interval;
+            s->max_interval = interval;
+            s->ewma_interval = interval;
+        } else {
+            if (interval < s->min_interval) {
+                s->min_interval = interval;
+            }
+            if (interval > s->max_interval) {
+                s->max_interval = interval;
+            }
+            s->ewma_interval += ((int32_t)(interval - s->ewma_interval)) >> EWMA_INTERVAL_SHIFT;
+        }
+        s->last_interval = interval;
+    }
+    s->last_time = timestamp;
+    s->rx_count++;
+}
+
+/**
+ * Number of times a frame went stale. The getters count this from whichever task calls them,
+ * so unlike the rest of the statistics it is not owned by the CAN Rx task
+ */
+typedef struct {
+    std::atomic<uint32_t> count;
+    // Sequence number (See Seqlock::read()) of the stored frame which was last counted as stale
+    std::atomic<uint32_t> mark;
+} FrameStaleCounter;
+
+/**
+ * Records that a getter found the stored frame with sequence number 'seq' stale. Each received frame
+ * is only counted once, no matter how many tasks read it whilst stale
+ */
+inline void mark_frame_stale(FrameStaleCounter* s, uint32_t seq) {
+    uint32_t mark = s->mark.load(std::memory_order_relaxed);
+    // Only ever move the mark forwards, so a task that read an older frame cannot count it again
+    while ((int32_t)(seq - mark) > 0) {
+        if (s->mark.compare_exchange_weak(mark, seq, std::memory_order_relaxed)) {
+            s->count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+#endif // __ECU_FRAME_STATS_H_
@@ -0,0 +1,100 @@
+#ifndef __EDGE_SPEED_H_
+#define __EDGE_SPEED_H_
+
+#include <stdint.h>
+#include <atomic>
+
+/**
+ * Shaft speed from the timestamps of individual sensor edges (One per tooth)
+ *
+ * An ISR pushes the time of every edge into an EdgeRing. Readers work out the speed over the most recent
+ * edges spanning at least EDGE_SPEED_WINDOW_US (Always at least one tooth, at most one revolution).
+ * At low speed that means every tooth gives a new reading, and at high speed a few teeth are averaged
+ * to smooth out tooth spacing errors. Once the shaft slows down so much that the next tooth is overdue,
+ * the reading decays with the time since the last tooth instead of holding the last speed.
+ *
+ * Single writer (The ISR), any number of readers, no locking
+ */
+
+// Must be a power of 2, and more than the teeth per revolution
+#define EDGE_RING_SIZE 64
+// Shortest time the edges used for a reading have to span
+#define EDGE_SPEED_WINDOW_US 5000
+// No edge for this long means the shaft has stopped (Reads 0)
+#define EDGE_SPEED_TIMEOUT_US 100000
+// Edges closer together than this are noise (About 80000RPM at 60 teeth), same as the old PCNT filter
+#define EDGE_MIN_INTERVAL_US 13
+
+typedef struct {
+    // Time of each edge (us)
+    uint64_t times[EDGE_RING_SIZE];
+    // Number of edges ever pushed. Only the ISR writes this
+    std::atomic<uint32_t> head{0};
+} EdgeRing;
+
+/**
+ * ISR: Records an edge at 'now'. Always inlined, so it ends up in IRAM with the ISR
+ */
+__attribute__((always_inline))
+inline void edge_ring_push(EdgeRing* r, uint64_t now) {
+    uint32_t head = r->head.load(std::memory_order_relaxed);
+    if (head != 0 && now - r->times[(head - 1) & (EDGE_RING_SIZE - 1)] < EDGE_MIN_INTERVAL_US) {
+        return;
+    }
+    r->times[head & (EDGE_RING_SIZE - 1)] = now;
+    r->head.store(head + 1, std::memory_order_release);
+}
+
+/**
+ * Returns the speed (RPM) of a shaft with 'teeth_per_rev' teeth at 'now', from the edges in 'r'
+ */
+inline uint32_t edge_ring_rpm(const EdgeRing* r, uint64_t now, uint8_t teeth_per_rev) {
+    uint32_t head;
+    uint32_t n;
+    uint64_t first;
+    uint64_t last;
+    do {
+        head = r->head.load(std::memory_order_acquire);
+        if (head < 2) {
+            return 0;
+        }
+        last = r->times[(head - 1) & (EDGE_RING_SIZE - 1)];
+        // An edge can land between the caller reading the time and us reading the ring
+        if (now < last) {
+            now = last;
+        }
+        if (now - last > EDGE_SPEED_TIMEOUT_US) {
+            return 0;
+        }
+        uint32_t max_n = head - 1;
+        if (max_n > teeth_per_rev) {
+            max_n = teeth_per_rev;
+        }
+        if (max_n > EDGE_RING_SIZE - 2) {
+            max_n = EDGE_RING_SIZE - 2;
+        }
+        n = 1;
+        first = r->times[(head - 2) & (EDGE_RING_SIZE - 1)];
+        while (n < max_n && last - first < EDGE_SPEED_WINDOW_US) {
+            uint64_t prev = r->times[(head - 2 - n) & (EDGE_RING_SIZE - 1)];
+            // Edges from before the shaft stopped say nothing about how fast it turns now
+            if (first - prev > EDGE_SPEED_TIMEOUT_US) {
+                break;
+            }
+            n++;
+            first = prev;
+        }
+        // Try again if the ISR has gone round the ring and overwritten edges we used
+    } while (r->head.load(std::memory_order_acquire) - head > EDGE_RING_SIZE - 1 - n);
+    if (last - first > EDGE_SPEED_TIMEOUT_US) {
+        return 0; // First tooth after the shaft was stopped
+    }
+    // If the next tooth is overdue, the shaft is turning no faster than one tooth in the time since the last one
+    uint64_t elapsed = now - last;
+    if (elapsed * n > last - first) {
+        return (uint32_t)(60000000ULL / (teeth_per_rev * elapsed));
+    }
+    return (uint32_t)(60000000ULL * n / (teeth_per_rev * (last - first)));
+}
+
+#endif // __EDGE_SPEED_H_
@@ -0,0 +1,74 @@
+#ifndef __SEQLOCK_H_
+#define __SEQLOCK_H_
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+/**
+ * Double buffered seqlock, for passing a value from ONE writer to any number of readers
+ * (Even across cores) without critical sections or tearing.
+ *
+ * The writer always writes into the buffer readers are NOT pointed at, then publishes it by
+ * bumping the sequence number. This means a writer that is preempted mid-write never blocks a reader,
+ * the reader just gets the previous value. A reader only has to retry if the writer published
+ * a new value whilst it was copying.
+ *
+ * The buffers are held as 32 bit atomics (Accessed relaxed, so plain loads and stores), as a reader
+ * can copy a buffer whilst the writer is filling it. Copying a plain T then would be a data race.
+ *
+ * T must be trivially copyable
+ */
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable<T>::value, "Seqlock only works on trivially copyable types");
+public:
+    /**
+     * Publishes a new value. Must only ever be called from a single writer (Task or ISR).
+     * Always inlined, so an IRAM ISR never calls into flash
+     */
+    __attribute__((always_inline))
+    inline void write(const T& value) {
+        uint32_t s = this->seq.load(std::memory_order_relaxed);
+        uint32_t words[WORDS] = {};
+        memcpy(words, &value, sizeof(T));
+        // The buffer being written is the one published two writes ago, which a slow reader can still be copying.
+        // Without this fence, our stores to it could become visible before the sequence number the last
+        // write stored, and that reader would then not see the sequence number change under it
+        std::atomic_thread_fence(std::memory_order_release);
+        std::atomic<uint32_t>* buffer = this->buffers[(s + 1) & 1];
+        for (uint32_t i = 0; i < WORDS; i++) {
+            buffer[i].store(words[i], std::memory_order_relaxed);
+        }
+        this->seq.store(s + 1, std::memory_order_release);
+    }
+
+    /**
+     * Copies the last published value into 'dest', and returns its sequence number
+     * (Which goes up by 1 with every write)
+     */
+    inline uint32_t read(T* dest) const {
+        uint32_t words[WORDS];
+        uint32_t s1;
+        uint32_t s2;
+        do {
+            s1 = this->seq.load(std::memory_order_acquire);
+            const std::atomic<uint32_t>* buffer = this->buffers[s1 & 1];
+            for (uint32_t i = 0; i < WORDS; i++) {
+                words[i] = buffer[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            s2 = this->seq.load(std::memory_order_relaxed);
+        } while (s1 != s2);
+        memcpy(dest, words, sizeof(T));
+        return s1;
+    }
+private:
+    static const uint32_t WORDS = (sizeof(T) + 3) / 4;
+
+    std::atomic<uint32_t> seq{0};
+    std::atomic<uint32_t> buffers[2][WORDS] = {};
+};
+
+#endif // __SEQLOCK_H_
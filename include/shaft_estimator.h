@@ -0,0 +1,88 @@
+#ifndef __SHAFT_ESTIMATOR_H_
+#define __SHAFT_ESTIMATOR_H_
+
+#include <stdint.h>
+#include <math.h>
+#include "seqlock.h"
+
+/**
+ * Alpha-beta estimator of the speed and acceleration of a shaft
+ *
+ * Each update() predicts the speed at the time of the new measurement from the last speed and acceleration,
+ * then corrects the speed by 'alpha' of the residual (Measurement - prediction), and the acceleration by 'beta'
+ * of it per second since the last update. So every update costs the same handful of float operations.
+ *
+ * Confidence (0-100%) is 100 whilst the average size of the residuals is within the expected measurement
+ * noise, and falls as they grow past it (50% at twice the noise). It is 0 once no measurement has come in
+ * for SHAFT_ESTIMATE_TIMEOUT_US.
+ *
+ * update() must only be called from one task. get() is safe to call from any task
+ */
+
+// Start the estimate again (Speed = measurement, no acceleration) after a gap this long between measurements
+#define SHAFT_ESTIMATE_TIMEOUT_US 200000
+// How quickly the average residual follows new residuals
+#define SHAFT_RESIDUAL_SMOOTHING 0.1f
+
+typedef struct {
+    // RPM
+    float speed;
+    // RPM per second
+    float accel;
+    // 0-100%
+    uint8_t confidence;
+    // Time of the last measurement (us)
+    uint64_t time;
+} ShaftEstimate;
+
+class ShaftEstimator {
+    public:
+        ShaftEstimator(float alpha, float beta, float noise_rpm) {
+            this->alpha = alpha;
+            this->beta = beta;
+            this->noise_rpm = noise_rpm;
+        }
+
+        // Takes the measured speed 'rpm' at 'now' (us)
+        void update(float rpm, uint64_t now) {
+            if (this->state.time == 0 || now <= this->state.time || now - this->state.time > SHAFT_ESTIMATE_TIMEOUT_US) {
+                this->speed = rpm;
+                this->state.accel = 0;
+                // Until the residuals say otherwise, a fresh estimate is only half trusted
+                this->avg_residual = this->noise_rpm * 2;
+            } else {
+                float dt = (float)(now - this->state.time) / 1000000.0f;
+                float predicted = this->speed + this->state.accel * dt;
+                float residual = rpm - predicted;
+                this->speed = predicted + this->alpha * residual;
+                this->state.accel += this->beta * residual / dt;
+                this->avg_residual += (fabsf(residual) - this->avg_residual) * SHAFT_RESIDUAL_SMOOTHING;
+            }
+            // A shaft speed sensor cannot tell direction, so the speed never goes below 0
+            this->state.speed = this->speed < 0 ? 0 : this->speed;
+            this->state.confidence = this->avg_residual <= this->noise_rpm ? 100 : (uint8_t)(100.0f * this->noise_rpm / this->avg_residual);
+            this->state.time = now;
+            this->published.write(this->state);
+        }
+
+        // Gets the last estimate, with no confidence if its measurement is older than SHAFT_ESTIMATE_TIMEOUT_US at 'now'
+        ShaftEstimate get(uint64_t now) const {
+            ShaftEstimate e;
+            this->published.read(&e);
+            if (e.time == 0 || (now > e.time && now - e.time > SHAFT_ESTIMATE_TIMEOUT_US)) {
+                e.confidence = 0;
+            }
+            return e;
+        }
+    private:
+        float alpha;
+        float beta;
+        float noise_rpm;
+        // Unclamped speed (Only touched by update())
+        float speed = 0;
+        float avg_residual = 0;
+        ShaftEstimate state = {};
+        Seqlock<ShaftEstimate> published;
+};
+
+#endif // __SHAFT_ESTIMATOR_H_
@@ -1,10 +1,20 @@
 #
 # Converts the can_data.txt files into C++ headers for this project!
 #
-# This program takes 2 arguments:
+# This program takes 2 to 4 arguments:
 # 1. Input can_data.txt file
 # 2. Output directory for header files
 # 3. Optional - Global #ifdef guard for file
+# 4. Optional - File listing the frames the CAN HAL reads off the bus (consumed_frames.txt), one frame
+#    name per line (Eg. MS_210). Generation fails if a listed frame is not in the input file
+#
+# Besides one header per ECU, this writes <MODE>_DISPATCH.h (CAN ID to ECU storage lookup), and
+# <MODE>_PROTECTION.h for databases with message counter / CRC protected frames.
+#
+# Every frame gets its CAN ID, enums and data union (The TCM builds its own frames with them), but only
+# consumed frames get storage, an import case and a getter in the ECU_XXX classes and an entry in the
+# dispatch table. ECUs with no consumed frames get no class at all. The RAM and flash this saves is printed.
+# So a HAL that reads a frame missing from the list does not compile, as the getter does not exist
 
 import os
 import sys
@@ -19,6 +29,16 @@ if len(sys.argv) > 3:
     global_guard=sys.argv[3]
     output_guard = True
 
+consumed_list = None
+if len(sys.argv) > 4:
+    consumed_list = sys.argv[4]
+
+# Size of one storage slot of an ECU_XXX class on the ESP32
+# (Seqlock<EcuFrame> + FrameArrivalStats + Seqlock<FrameArrivalStats> + FrameStaleCounter)
+ECU_SLOT_BYTES = 36 + 40 + 84 + 8
+# Size of one EcuDispatchEntry
+DISPATCH_ENTRY_BYTES = 8
+
 def clear_bit(mask, bit):
     return mask & ~(1<<bit)
 
@@ -86,13 +106,29 @@ class Signal:
             conv_to = ". Conversion formula (To raw from real): y=(x{1:+})/{0:.2f}".format(self.number_data[0], self.number_data[1]*-1)
             conv_from = ". Conversion formula (To real from raw): y=({0:.2f}x){1:+}".format(self.number_data[0], self.number_data[1])
 
+        shift = 64-self.length-self.offset
+        first_byte = self.offset // 8
+        if first_byte == (self.offset+self.length-1) // 8:
+            # Signal sits within a single byte of the payload, so no byte swapping is needed
+            byte_shift = 8-self.length-(self.offset % 8)
+            byte_mask = (~(f_mask << byte_shift)) & 0xFF
+            return """
+    /** Sets {0}{6}{8} */
+    void set_{1}({2} value){{ bytes[{3}] = (bytes[{3}] & 0x{5:02x}) | ((uint8_t)value & 0x{4:x}) << {9}; }}
+
+    /** Gets {0}{7}{8} */
+    {2} get_{1}() const {{ return ({2})(bytes[{3}] >> {9} & 0x{4:x}); }}
+        """.format(self.desc, self.name, self.get_return_data_type(frame_name), first_byte, f_mask, byte_mask, conv_to, conv_from, unit_str, byte_shift)
+
+        # Signal spans bytes. Masks are swapped at generation time, so only the value needs a bswap at runtime
+        wire_mask = int.from_bytes(mask.to_bytes(8, 'big'), 'little')
         return """
     /** Sets {0}{6}{8} */
-    void set_{1}({2} value){{ raw = (raw & 0x{5:{fill}16x}) | ((uint64_t)value & 0x{4:x}) << {3}; }}
+    void set_{1}({2} value){{ raw = (raw & 0x{5:{fill}16x}) | __builtin_bswap64(((uint64_t)value & 0x{4:x}) << {3}); }}
 
     /** Gets {0}{7}{8} */
-    {2} get_{1}() const {{ return ({2})(raw >> {3} & 0x{4:x}); }}
-        """.format(self.desc, self.name, self.get_return_data_type(frame_name), 64-self.length-self.offset, f_mask, mask, conv_to, conv_from, unit_str, fill='0')
+    {2} get_{1}() const {{ return ({2})(__builtin_bswap64(raw) >> {3} & 0x{4:x}); }}
+        """.format(self.desc, self.name, self.get_return_data_type(frame_name), shift, f_mask, wire_mask, conv_to, conv_from, unit_str, fill='0')
 
     def add_enum(self, e: EnumEntry):
         self.enum_table.append(e)
@@ -119,6 +155,22 @@ class Signal:
         else:
             print(dt)
 
+    def get_wire_mask(self) -> int:
+        """
+        Bits of the signal within the raw (Wire order) payload
+        """
+        mask = ((1 << self.length) - 1) << (64 - self.length - self.offset)
+        return int.from_bytes(mask.to_bytes(8, 'big'), 'little')
+
+    def is_counter(self) -> bool:
+        return self.is_number and self.desc.lower().startswith("message counter")
+
+    def is_toggle(self) -> bool:
+        return self.is_bool and "TGL" in self.name
+
+    def is_parity(self) -> bool:
+        return self.is_bool and ("PAR" in self.name or self.name.endswith("_PA")) and "parity" in self.desc.lower()
+
 class Frame:
     def __init__(self, name: str, id: int):
         self.name = name
@@ -128,10 +180,62 @@ class Frame:
     def add_signal(self, s: Signal):
         self.signals.append(s)
 
+    def find_signal(self, name: str) -> Signal:
+        for s in self.signals:
+            if s.name == name:
+                return s
+        return None
+
+    def get_checks(self):
+        """
+        Returns the receive side checks of the frame (See ecu_frame_check.h), as
+        (counter mask, toggle mask, [(parity mask, parity signal, covered signal names)], description).
+
+        Which bits a parity signal covers is not in can_data.txt, so it comes from the names:
+        XXX_PA covers XXX, and XXXPAR_YYY covers XXX_YYY along with the matching toggle (XXXTGL_YYY),
+        the same way the TCM computes the parity of its own frames. The parity is even (The parity bit
+        and the bits it covers have an even number of 1s)
+        """
+        counter_mask = 0
+        toggle_mask = 0
+        parities = []
+        desc = []
+        for s in self.signals:
+            if s.is_counter():
+                counter_mask |= s.get_wire_mask()
+                desc.append("counter {}".format(s.name))
+            elif s.is_toggle():
+                toggle_mask |= s.get_wire_mask()
+                desc.append("toggle {}".format(s.name))
+            elif s.is_parity():
+                if s.name.endswith("_PA"):
+                    covered = [self.find_signal(s.name[:-3])]
+                else:
+                    prefix, suffix = s.name.rsplit("PAR", 1)
+                    value_name = prefix.rstrip("_") + ("_" + suffix.lstrip("_") if suffix else "")
+                    covered = [self.find_signal(value_name), self.find_signal(prefix + "TGL" + suffix)]
+                covered = [c for c in covered if c is not None and not c.is_parity()]
+                if len(covered) == 0:
+                    print("WARNING. Cannot tell what parity signal {} of {} covers, it is not checked".format(s.name, self.name))
+                    continue
+                mask = s.get_wire_mask()
+                for c in covered:
+                    mask |= c.get_wire_mask()
+                names = [c.name for c in covered]
+                parities.append((mask, s.name, names))
+                desc.append("parity {} over {}".format(s.name, "+".join(names)))
+        return (counter_mask, toggle_mask, parities, ", ".join(desc))
+
+    def has_checks(self) -> bool:
+        counter_mask, toggle_mask, parities, _ = self.get_checks()
+        return counter_mask != 0 or toggle_mask != 0 or len(parities) != 0
+
 class ECU:
     def __init__(self, name: str):
         self.name = name
         self.frames=[]
+        # Frames with storage in the ECU_XXX class. Index is the storage slot
+        self.stored=[]
 
     def add_frame(self, f: Frame):
         self.frames.append(f)
@@ -144,7 +248,6 @@ class ECU:
                 self.frames.append(x)
 
     def make_output_str(self) -> str:
-        self.filter_frames()
         # Create output header string
 
         guard = ""
@@ -166,6 +269,13 @@ class ECU:
 #define __ECU_{0}_H_
 
 #include <stdint.h>
+#include "seqlock.h"
+#include "ecu_frame_stats.h"
+#include "ecu_frame_check.h"
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+    #error "Generated CAN frame accessors assume a little endian CPU"
+#endif
     """.format(self.name, guard)
 
         for f in self.frames:
@@ -178,15 +288,20 @@ class ECU:
                 if s.is_enum:
                     tmp += "/** {} */".format(s.desc)
                     tmp += "\nenum class {}_{} {{".format(x.name, s.name)
+                    seen = set()
                     for e in s.enum_table:
-                        tmp += "\n\t{} = {}, // {}".format(e.name, e.raw, e.desc)
+                        # can_data.txt reuses a name for every raw value of a range (DEFAULT, ALL...).
+                        # Repeats get the raw value appended, so the enum still compiles
+                        name = e.name if e.name not in seen else "{}_{}".format(e.name, e.raw)
+                        seen.add(e.name)
+                        tmp += "\n\t{} = {}, // {}".format(name, e.raw, e.desc)
                     tmp += "\n};\n\n"
 
         # Now create our type unions for CAN Frames!
         for x in self.frames:
             struct_name = x.name.strip().removesuffix("h")
             tmp += "\n\ntypedef union {" # Struct name
-            tmp += "\n\tuint64_t raw;" # Store raw value
+            tmp += "\n\tuint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)" # Store raw value
             tmp += "\n\tuint8_t bytes[8];"
             tmp += "\n\n\t/** Gets CAN ID of {} */".format(struct_name)
             tmp += "\n\tuint32_t get_canid(){{ return {}_CAN_ID; }}".format(struct_name)
@@ -200,7 +315,15 @@ class ECU:
 
         # Now magic to create the class ;)
 
-        num_frames = len(self.frames)
+        num_frames = len(self.stored)
+        num_checks = len([f for f in self.stored if f.has_checks()])
+        num_sequences = len([f for f in self.stored if f.get_checks()[0] != 0 or f.get_checks()[1] != 0])
+        if num_frames == 0:
+            tmp += "\n\n// No frames of ECU '{}' are read by the TCM, so it has no storage class".format(self.name)
+            tmp += "\n#endif // __ECU_{}_H_".format(self.name)
+            if output_guard:
+                tmp += "\n\n#endif // {}".format(global_guard)
+            return tmp
 
         tmp += "\n\nclass ECU_{} {{".format(self.name)
         tmp += "\n\tpublic:"
@@ -209,26 +332,77 @@ class ECU:
         /**
          * @brief Imports the CAN frame given the CAN ID, CAN Contents, and current timestamp
          *
-         * Returns true if the frame was imported successfully, and false if import failed (Due to non-matching CAN ID).
+         * Returns true if the frame was imported successfully, and false if import failed (Due to non-matching CAN ID,
+         * or the frame failing validation).
          *
-         * NOTE: The endianness of the value cannot be guaranteed. It is up to the caller to correct the byte order!
+         * 'value' is the CAN payload in wire order, as copied straight out of the CAN controller's data buffer
          */
         bool import_frames(uint64_t value, uint32_t can_id, uint64_t timestamp_now) {
             switch(can_id) {"""
-        for idx, frame in enumerate(self.frames):
+        for idx, frame in enumerate(self.stored):
             tmp += """
                 case {0}_CAN_ID:
-                    LAST_FRAME_TIMES[{1}] = timestamp_now;
-                    FRAME_DATA[{1}] = value;
-                    return true;""".format(frame.name.strip().removesuffix("h"), idx)
+                    return import_frame_at({1}, value, timestamp_now) == FrameCheckResult::Ok;""".format(frame.name.strip().removesuffix("h"), idx)
         tmp += """
                 default:
                     return false;
             }
         }
+
+        /**
+         * @brief Imports the CAN frame directly into storage slot 'slot', as returned by the
+         * generated RX dispatch table. This skips the CAN ID switch entirely.
+         *
+         * A frame that fails validation of its message counter, toggle or parity signals is not stored
+         * (And is counted in its arrival statistics), and the reason is returned.
+         *
+         * 'value' is the CAN payload in wire order, as copied straight out of the CAN controller's data buffer
+         */
+        FrameCheckResult import_frame_at(uint8_t slot, uint64_t value, uint64_t timestamp_now) {"""
+        if num_checks != 0:
+            tmp += """
+            FrameCheckResult res = check_frame_at(slot, value, timestamp_now);
+            if (res != FrameCheckResult::Ok) {
+                reject_frame_at(slot);
+                return res;
+            }"""
+        tmp += """
+            FRAMES[slot].write(EcuFrame { .data = value, .timestamp = timestamp_now });
+            update_arrival_stats(&RX_STATS[slot], timestamp_now);
+            STATS[slot].write(RX_STATS[slot]);
+            return FrameCheckResult::Ok;
+        }
+
+        /**
+         * Counts a frame in storage slot 'slot' that failed a check made outside this class (Such as a CRC).
+         * Only call from the CAN Rx task
+         */
+        void reject_frame_at(uint8_t slot) {
+            RX_STATS[slot].rejected_count++;
+            STATS[slot].write(RX_STATS[slot]);
+        }
+
+        /** Returns the number of frames stored by this ECU (Only the frames the TCM reads) */
+        uint8_t get_num_frames() const {
+            return NUM_FRAMES;
+        }
+
+        /**
+         * Copies the arrival statistics of the frame in storage slot 'slot' to 'dest'. Safe to call from any task.
+         *
+         * Returns false if 'slot' is out of range.
+         */
+        bool get_frame_stats_at(uint8_t slot, FrameArrivalStats* dest) const {
+            if (slot >= NUM_FRAMES || dest == nullptr) {
+                return false;
+            }
+            STATS[slot].read(dest);
+            dest->stale_count = STALE[slot].count.load(std::memory_order_relaxed);
+            return true;
+        }
         """
         # Now do getters!
-        for idx, frame in enumerate(self.frames):
+        for idx, frame in enumerate(self.stored):
             tmp += """
         /** Sets data in pointer to {0}
           * 
@@ -238,19 +412,68 @@ class ECU:
           * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
           */
         bool get_{0}(uint64_t now, uint64_t max_expire_time, {0}* dest) const {{
-            if (LAST_FRAME_TIMES[{1}] == 0 || dest == nullptr) {{ // CAN Frame has not been seen on bus yet / NULL pointer
+            EcuFrame f;
+            uint32_t seq = FRAMES[{1}].read(&f); // Data and timestamp are always from the same frame
+            if (f.timestamp == 0 || dest == nullptr) {{ // CAN Frame has not been seen on bus yet / NULL pointer
                 return false;
-            }} else if (now - LAST_FRAME_TIMES[{1}] > max_expire_time) {{ // CAN Frame has not refreshed in valid interval
+            }} else if (now > f.timestamp && now - f.timestamp > max_expire_time) {{ // CAN Frame has not refreshed in valid interval
+                mark_frame_stale(&STALE[{1}], seq);
                 return false;
             }} else {{ // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[{1}];
+                dest->raw = f.data;
                 return true;
             }}
         }}
             """.format(frame.name.strip().removesuffix("h"), idx)
         tmp += "\n\tprivate:"
-        tmp += "\n\t\tuint64_t FRAME_DATA[{0}];".format(num_frames)
-        tmp += "\n\t\tuint64_t LAST_FRAME_TIMES[{0}];".format(num_frames)
+        if num_checks != 0:
+            tmp += """
+        /**
+         * Checks the message counter, toggle and parity signals of a frame for storage slot 'slot'.
+         * Only call from the CAN Rx task
+         */
+        FrameCheckResult check_frame_at(uint8_t slot, uint64_t value, uint64_t timestamp_now) {
+            switch(slot) {"""
+            check_idx = 0
+            for idx, frame in enumerate(self.stored):
+                if not frame.has_checks():
+                    continue
+                counter_mask, toggle_mask, parities, _ = frame.get_checks()
+                tmp += """
+                case {0}: // {1}""".format(idx, frame.name.strip().removesuffix("h"))
+                for mask, name, covered in parities:
+                    tmp += """
+                    if (!frame_parity_ok(value, 0x{0:016X}ULL)) {{ // {1} over {2}
+                        return FrameCheckResult::Parity;
+                    }}""".format(mask, name, "+".join(covered))
+                if counter_mask != 0 or toggle_mask != 0:
+                    tmp += """
+                    return frame_sequence_check(&CHECKS[{0}], value, 0x{1:016X}ULL, 0x{2:016X}ULL, timestamp_now);""".format(check_idx, counter_mask, toggle_mask)
+                    check_idx += 1
+                else:
+                    tmp += """
+                    return FrameCheckResult::Ok;"""
+            tmp += """
+                default:
+                    return FrameCheckResult::Ok;
+            }
+        }
+"""
+        tmp += "\n\t\ttypedef struct {"
+        tmp += "\n\t\t\tuint64_t data;"
+        tmp += "\n\t\t\tuint64_t timestamp;"
+        tmp += "\n\t\t} EcuFrame;"
+        tmp += "\n\t\t// Written by the CAN Rx task, read by any other task"
+        tmp += "\n\t\tSeqlock<EcuFrame> FRAMES[{0}];".format(num_frames)
+        tmp += "\n\t\t// Arrival statistics. Only touched by the CAN Rx task, which publishes them to STATS"
+        tmp += "\n\t\tFrameArrivalStats RX_STATS[{0}] = {{}};".format(num_frames)
+        tmp += "\n\t\tSeqlock<FrameArrivalStats> STATS[{0}];".format(num_frames)
+        tmp += "\n\t\t// Staleness, counted by the getters from any task"
+        tmp += "\n\t\tmutable FrameStaleCounter STALE[{0}] = {{}};".format(num_frames)
+        if num_sequences != 0:
+            tmp += "\n\t\t// Message counter / toggle state of the frames that have them. Only touched by the CAN Rx task"
+            tmp += "\n\t\tFrameCheckState CHECKS[{0}] = {{}};".format(num_sequences)
+        tmp += "\n\t\tstatic const uint8_t NUM_FRAMES = {0};".format(num_frames)
         tmp += "\n};"
 
         # Lastly append endif guard
@@ -260,6 +483,379 @@ class ECU:
         return tmp
 
 
+def find_dispatch_table_size(ids) -> int:
+    """
+    Finds the smallest table size where 'can_id % size' does not collide for any of the CAN IDs.
+    Standard CAN IDs are 11 bits, so 2048 always works as a last resort
+    """
+    for size in range(max(len(ids), 1), 2049):
+        if len(set(i % size for i in ids)) == len(ids):
+            return size
+    return 2048
+
+def read_consumed_list(path: str) -> list:
+    """
+    Reads the names of the consumed frames from 'path'. Blank lines and # comments are ignored
+    """
+    names = []
+    for line in open(path, 'r'):
+        name = line.split("#")[0].strip()
+        if name:
+            names.append(name)
+    return names
+
+def find_consumed_frames(ecus) -> list:
+    """
+    Returns the frames named in the consumed frame list, sorted by CAN ID.
+    Every name must be a frame in the DB. With no list, every frame is assumed to be consumed
+    """
+    frames = {}
+    if consumed_list is not None:
+        by_name = {}
+        for ecu in ecus:
+            for frame in ecu.frames:
+                by_name.setdefault(frame.name.strip().removesuffix("h"), frame)
+        unknown = False
+        for name in read_consumed_list(consumed_list):
+            if name not in by_name:
+                print("ERROR. Consumed frame {} (In {}) is not defined for {}".format(name, consumed_list, global_guard))
+                unknown = True
+                continue
+            frames[by_name[name].can_id] = by_name[name]
+        if unknown:
+            sys.exit(1)
+    if len(frames) == 0:
+        print("NOTE. No consumed frames listed for {}, assuming all frames are consumed".format(global_guard))
+        for ecu in ecus:
+            for frame in ecu.frames:
+                frames.setdefault(frame.can_id, frame)
+    return [frames[i] for i in sorted(frames.keys())]
+
+def select_stored_frames(ecus, consumed):
+    """
+    Gives every ECU the consumed frames it owns (ecu.stored).
+    A consumed CAN ID defined by more than one ECU is an error, as the dispatch table can only
+    send it to one of them, so generation fails rather than picking one
+    """
+    consumed_ids = set(f.can_id for f in consumed)
+    owners = {}
+    duplicated = False
+    for ecu in ecus:
+        ecu.stored = []
+        for frame in ecu.frames:
+            if frame.can_id in owners:
+                if frame.can_id in consumed_ids:
+                    print("ERROR. CAN ID 0x{:04X} ({}) is defined by both ECU {} and ECU {}".format(frame.can_id, frame.name, owners[frame.can_id], ecu.name))
+                    duplicated = True
+                else:
+                    print("WARNING. CAN ID 0x{:04X} ({}) is defined by both ECU {} and ECU {} (Not consumed, so not stored)".format(frame.can_id, frame.name, owners[frame.can_id], ecu.name))
+                continue
+            owners[frame.can_id] = ecu.name
+            if frame.can_id in consumed_ids:
+                ecu.stored.append(frame)
+    if duplicated:
+        print("ERROR. Remove the duplicate frames from can_data.txt for {}. No headers were written".format(global_guard))
+        sys.exit(1)
+
+def print_savings_report(ecus):
+    """
+    Prints the RAM and flash saved by only generating storage and dispatch for consumed frames
+    """
+    all_ids = set(frame.can_id for ecu in ecus for frame in ecu.frames)
+    stored_ids = [frame.can_id for ecu in ecus for frame in ecu.stored]
+    print("{}: Frame storage generated for {} of {} CAN IDs".format(global_guard, len(stored_ids), len(all_ids)))
+    ram_saved = 0
+    for ecu in ecus:
+        if len(ecu.stored) == 0:
+            # The HAL never had an instance of a class it reads nothing from, so no RAM is saved
+            print("    ECU_{}: 0/{} frames stored (No class)".format(ecu.name, len(ecu.frames)))
+            continue
+        dropped = len(ecu.frames) - len(ecu.stored)
+        ram_saved += dropped * ECU_SLOT_BYTES
+        print("    ECU_{}: {}/{} frames stored, {} bytes of RAM saved".format(
+            ecu.name, len(ecu.stored), len(ecu.frames), dropped * ECU_SLOT_BYTES
+        ))
+    full_table = find_dispatch_table_size(list(all_ids)) * DISPATCH_ENTRY_BYTES
+    table = find_dispatch_table_size(stored_ids) * DISPATCH_ENTRY_BYTES
+    print("    RAM saved (One instance of each ECU class the HAL reads from): {} bytes".format(ram_saved))
+    for ecu in ecus:
+        for frame in ecu.stored:
+            if frame.has_checks():
+                print("    Rx validation of {}: {}".format(frame.name.strip().removesuffix("h"), frame.get_checks()[3]))
+    print("    Flash saved (Dispatch table): {} bytes ({} -> {} bytes)".format(full_table - table, full_table, table))
+
+def make_dispatch_str(ecus) -> str:
+    guard = ""
+    if output_guard:
+        guard = "#ifdef {0}".format(global_guard)
+    entries = {}
+    for ecu in ecus:
+        for idx, frame in enumerate(ecu.stored):
+            entries[frame.can_id] = (ecu.name, idx, frame.name.strip().removesuffix("h"))
+    size = find_dispatch_table_size(list(entries.keys()))
+    table = [None] * size
+    for can_id, e in entries.items():
+        table[can_id % size] = (can_id, e)
+
+    tmp = """
+/**
+* AUTOGENERATED BY convert.py
+* DO NOT EDIT THIS FILE!
+*
+* IF MODIFICATIONS NEED TO BE MADE, MODIFY can_data.txt!
+*
+* CAN ID to ECU storage dispatch table
+*/
+
+{0}
+
+#ifndef __ECU_DISPATCH_H_
+#define __ECU_DISPATCH_H_
+
+#include <stdint.h>
+""".format(guard)
+    tmp += "\n/** ECUs which own frames on the CANBUS */"
+    tmp += "\nenum class EcuId : uint8_t {"
+    for idx, ecu in enumerate(ecus):
+        tmp += "\n\t{} = {},".format(ecu.name, idx)
+    tmp += "\n\tNONE = 0xFF, // Unused table entry"
+    tmp += "\n};\n"
+    tmp += """
+typedef struct {{
+	uint32_t can_id;
+	EcuId ecu;
+	uint8_t slot; // Storage slot of the frame within the ECU_XXX class (See ECU_XXX::import_frame_at)
+}} EcuDispatchEntry;
+
+#define ECU_DISPATCH_TABLE_SIZE {0}
+
+/**
+ * Perfect hash table of every CAN ID the TCM reads in this build mode.
+ * The entry for a CAN ID is located at ECU_DISPATCH_TABLE[can_id % ECU_DISPATCH_TABLE_SIZE]
+ */
+static const EcuDispatchEntry ECU_DISPATCH_TABLE[ECU_DISPATCH_TABLE_SIZE] = {{""".format(size)
+    for e in table:
+        if e is None:
+            tmp += "\n\t{ 0x0000, EcuId::NONE, 0 },"
+        else:
+            tmp += "\n\t{{ 0x{0:04X}, EcuId::{1}, {2} }}, // {3}".format(e[0], e[1][0], e[1][1], e[1][2])
+    tmp += """
+};
+
+/**
+ * @brief Looks up the ECU and storage slot that own a CAN ID, in constant time.
+ *
+ * Returns nullptr if the CAN ID is not read by the TCM in this build mode
+ */
+static inline const EcuDispatchEntry* ecu_dispatch_lookup(uint32_t can_id) {
+    const EcuDispatchEntry* e = &ECU_DISPATCH_TABLE[can_id % ECU_DISPATCH_TABLE_SIZE];
+    if (e->ecu == EcuId::NONE || e->can_id != can_id) {
+        return nullptr;
+    }
+    return e;
+}
+"""
+    consumed = [f for ecu in ecus for f in ecu.stored]
+    consumed.sort(key=lambda f: f.can_id)
+    tmp += """
+/**
+ * CAN IDs the HAL actually reads off the bus (Sorted). Used to program the
+ * acceptance filter of the CAN controller, so other frames never reach the CPU
+ */
+#define ECU_RX_ID_COUNT {0}
+static const uint32_t ECU_RX_IDS[ECU_RX_ID_COUNT] = {{""".format(len(consumed))
+    for f in consumed:
+        tmp += "\n\t0x{:04X}, // {}".format(f.can_id, f.name.strip().removesuffix("h"))
+    tmp += """
+};
+
+#endif // __ECU_DISPATCH_H_"""
+    if output_guard:
+        tmp += "\n\n#endif // {}".format(global_guard)
+    return tmp
+
+# SAE J1850 CRC8, as used by the CRC_<FRAME> signals
+CRC8_J1850_POLY = 0x1D
+
+def make_crc8_table(poly: int) -> list:
+    """
+    CRC8 (MSB first) of every byte value, so the firmware can compute the CRC a byte at a time
+    """
+    table = []
+    for i in range(0, 256):
+        crc = i
+        for bit in range(0, 8):
+            crc = ((crc << 1) ^ poly) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+        table.append(crc)
+    return table
+
+def find_protected_frames(ecus) -> list:
+    """
+    Returns (frame, crc signal, counter signal) of every frame with a CRC (CRC_<FRAME>) and/or
+    a message counter (MC_<FRAME>), sorted by CAN ID. Either signal may be None
+    """
+    frames = {}
+    for ecu in ecus:
+        for frame in ecu.frames:
+            name = frame.name.strip().removesuffix("h")
+            crc = None
+            counter = None
+            for s in frame.signals:
+                if s.name == "CRC_{}".format(name):
+                    crc = s
+                elif s.name == "MC_{}".format(name):
+                    counter = s
+            if crc is None and counter is None:
+                continue
+            if crc is not None and (crc.length != 8 or crc.offset % 8 != 0):
+                raise ValueError("CRC of {} is not a whole byte".format(name))
+            if counter is not None and counter.offset // 8 != (counter.offset+counter.length-1) // 8:
+                raise ValueError("Message counter of {} spans bytes".format(name))
+            frames.setdefault(frame.can_id, (frame, crc, counter))
+    return [frames[i] for i in sorted(frames.keys())]
+
+def make_protection_str(protected) -> str:
+    guard = ""
+    if output_guard:
+        guard = "#ifdef {0}".format(global_guard)
+    tmp = """
+/**
+* AUTOGENERATED BY convert.py
+* DO NOT EDIT THIS FILE!
+*
+* IF MODIFICATIONS NEED TO BE MADE, MODIFY can_data.txt!
+*
+* Message counter and CRC (SAE J1850) protection of CAN frames
+*/
+
+{0}
+
+#ifndef __ECU_PROTECTION_H_
+#define __ECU_PROTECTION_H_
+
+#include <stdint.h>
+
+#define CRC8_J1850_INIT 0xFF
+#define CRC8_J1850_XOR_OUT 0xFF
+
+/** CRC8 of every byte value with the SAE J1850 polynomial (0x{1:02X}). Indexed by (crc ^ data byte) */
+static const uint8_t CRC8_J1850_TABLE[256] = {{""".format(guard, CRC8_J1850_POLY)
+    table = make_crc8_table(CRC8_J1850_POLY)
+    for row in range(0, 256, 16):
+        tmp += "\n\t" + " ".join("0x{:02X},".format(x) for x in table[row:row+16])
+    tmp += """
+};
+
+typedef struct {
+	uint32_t can_id;
+	uint8_t crc_byte; // Payload byte holding the CRC, which covers every byte before it (0xFF if the frame has no CRC)
+	uint8_t counter_byte; // Payload byte holding the message counter (0xFF if the frame has no counter)
+	uint8_t counter_shift; // Position of the counter within its byte
+	uint8_t counter_mask; // Mask of the counter (After shifting). The counter wraps around after this value
+} FrameProtection;
+"""
+    tmp += "\n#define FRAME_PROTECTION_COUNT {0}".format(len(protected))
+    tmp += """
+
+/** Protection of every frame with a message counter or CRC (Sorted by CAN ID) */
+static const FrameProtection FRAME_PROTECTION[FRAME_PROTECTION_COUNT] = {"""
+    for frame, crc, counter in protected:
+        crc_byte = 0xFF
+        counter_byte = 0xFF
+        counter_shift = 0
+        counter_mask = 0
+        if crc is not None:
+            crc_byte = crc.offset // 8
+        if counter is not None:
+            counter_byte = counter.offset // 8
+            counter_shift = 8-counter.length-(counter.offset % 8)
+            counter_mask = (1 << counter.length) - 1
+        tmp += "\n\t{{ 0x{0:04X}, 0x{1:02X}, 0x{2:02X}, {3}, 0x{4:02X} }}, // {5}".format(frame.can_id, crc_byte, counter_byte, counter_shift, counter_mask, frame.name.strip().removesuffix("h"))
+    tmp += """
+};
+
+/**
+ * @brief Looks up the protection of a CAN ID.
+ *
+ * Returns nullptr if the frame has no message counter or CRC. HALs should look this up once per frame they
+ * send, rather than on every transmission
+ */
+static inline const FrameProtection* frame_protection_lookup(uint32_t can_id) {
+    uint8_t lo = 0;
+    uint8_t hi = FRAME_PROTECTION_COUNT;
+    while (lo < hi) {
+        uint8_t mid = (lo + hi) / 2;
+        if (FRAME_PROTECTION[mid].can_id < can_id) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == FRAME_PROTECTION_COUNT || FRAME_PROTECTION[lo].can_id != can_id) {
+        return nullptr;
+    }
+    return &FRAME_PROTECTION[lo];
+}
+
+/** Calculates the CRC of 'data' (The payload of the frame protected by 'p') */
+static inline uint8_t frame_calc_crc(const FrameProtection* p, const uint8_t* data) {
+    uint8_t crc = CRC8_J1850_INIT;
+    for (uint8_t i = 0; i < p->crc_byte; i++) {
+        crc = CRC8_J1850_TABLE[crc ^ data[i]];
+    }
+    return crc ^ CRC8_J1850_XOR_OUT;
+}
+
+/**
+ * @brief Writes message counter 'counter' into 'data', and then the CRC.
+ *
+ * Every other signal of the frame must already be set, as they are covered by the CRC
+ */
+static inline void frame_protect(const FrameProtection* p, uint8_t* data, uint8_t counter) {
+    if (p->counter_byte != 0xFF) {
+        data[p->counter_byte] = (data[p->counter_byte] & ~(p->counter_mask << p->counter_shift)) | (counter & p->counter_mask) << p->counter_shift;
+    }
+    if (p->crc_byte != 0xFF) {
+        data[p->crc_byte] = frame_calc_crc(p, data);
+    }
+}
+
+/** Gets the message counter from 'data' (0 if the frame has no counter) */
+static inline uint8_t frame_get_counter(const FrameProtection* p, const uint8_t* data) {
+    if (p->counter_byte == 0xFF) {
+        return 0;
+    }
+    return data[p->counter_byte] >> p->counter_shift & p->counter_mask;
+}
+
+/** Returns true if the CRC in 'data' is correct (Or the frame has no CRC) */
+static inline bool frame_check_crc(const FrameProtection* p, const uint8_t* data) {
+    return p->crc_byte == 0xFF || data[p->crc_byte] == frame_calc_crc(p, data);
+}
+
+#endif // __ECU_PROTECTION_H_"""
+    if output_guard:
+        tmp += "\n\n#endif // {}".format(global_guard)
+    return tmp
+
+def protection_file_name() -> str:
+    if output_guard:
+        return "{}_PROTECTION.h".format(global_guard.removesuffix("_MODE"))
+    return "PROTECTION.h"
+
+def dispatch_file_name() -> str:
+    if output_guard:
+        return "{}_DISPATCH.h".format(global_guard.removesuffix("_MODE"))
+    return "DISPATCH.h"
+
+def write_ecu(ecu: ECU):
+    open("{}/{}.h".format(output_dir, ecu.name), 'w').write(ecu.make_output_str()) # Write tmp output str to file
+
+def add_ecu(ecu: ECU):
+    ecu.filter_frames()
+    all_ecus.append(ecu)
+
+all_ecus = []
 current_ecu: ECU = None
 current_frame: Frame = None
 current_signal: Signal = None
@@ -279,7 +875,7 @@ for line in input_file:
                 if current_frame and current_ecu:
                     current_ecu.add_frame(current_frame)
                     current_frame = None
-                open("{}/{}.h".format(output_dir, current_ecu.name), 'w').write(current_ecu.make_output_str()) # Write tmp output str to file
+                add_ecu(current_ecu)
             current_ecu = ECU(ecu)
         elif l.startswith("FRAME"):
             frame_name = l.split("FRAME ")[1].split("(")[0].strip()
@@ -319,5 +915,15 @@ if current_signal and current_frame:
 if current_frame and current_ecu:
     current_ecu.add_frame(current_frame)
     current_frame = None
-# Write last ECU in DB
-open("{}/{}.h".format(output_dir, current_ecu.name), 'w').write(current_ecu.make_output_str()) # Write tmp output str to file
\ No newline at end of file
+add_ecu(current_ecu)
+# Storage is only generated for frames the HAL reads, so work those out before writing any ECU
+select_stored_frames(all_ecus, find_consumed_frames(all_ecus))
+for ecu in all_ecus:
+    write_ecu(ecu)
+print_savings_report(all_ecus)
+# Lastly write the dispatch table covering every ECU in the DB
+open("{}/{}".format(output_dir, dispatch_file_name()), 'w').write(make_dispatch_str(all_ecus))
+# And the message counter / CRC protection table, if any frame is protected
+protected_frames = find_protected_frames(all_ecus)
+if len(protected_frames) != 0:
+    open("{}/{}".format(output_dir, protection_file_name()), 'w').write(make_protection_str(protected_frames))
\ No newline at end of file
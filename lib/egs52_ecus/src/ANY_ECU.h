@@ -14,6 +14,13 @@
 #define __ECU_ANY_ECU_H_
 
 #include <stdint.h>
+#include "seqlock.h"
+#include "ecu_frame_stats.h"
+#include "ecu_frame_check.h"
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+    #error "Generated CAN frame accessors assume a little endian CPU"
+#endif
     
 #define ARCADE_A2_CAN_ID 0x0035
 #define MS_ANZ_CAN_ID 0x033D
@@ -224,670 +231,670 @@ enum class VG_428h_ANFN_VG {
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of ARCADE_A2 */
 	uint32_t get_canid(){ return ARCADE_A2_CAN_ID; }
     /** Sets Confirm bit for all crazy events, tox */
-    void set_CONF_CRASH(bool value){ raw = (raw & 0x7fffffffffffffff) | ((uint64_t)value & 0x1) << 63; }
+    void set_CONF_CRASH(bool value){ bytes[0] = (bytes[0] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Confirm bit for all crazy events, tox */
-    bool get_CONF_CRASH() const { return (bool)(raw >> 63 & 0x1); }
+    bool get_CONF_CRASH() const { return (bool)(bytes[0] >> 7 & 0x1); }
         
     /** Sets Frontal event 2 */
-    void set_CRASH_F(bool value){ raw = (raw & 0xdfffffffffffffff) | ((uint64_t)value & 0x1) << 61; }
+    void set_CRASH_F(bool value){ bytes[0] = (bytes[0] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Frontal event 2 */
-    bool get_CRASH_F() const { return (bool)(raw >> 61 & 0x1); }
+    bool get_CRASH_F() const { return (bool)(bytes[0] >> 5 & 0x1); }
         
     /** Sets Frontal event 5 */
-    void set_CRASH_C(bool value){ raw = (raw & 0xfbffffffffffffff) | ((uint64_t)value & 0x1) << 58; }
+    void set_CRASH_C(bool value){ bytes[0] = (bytes[0] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets Frontal event 5 */
-    bool get_CRASH_C() const { return (bool)(raw >> 58 & 0x1); }
+    bool get_CRASH_C() const { return (bool)(bytes[0] >> 2 & 0x1); }
         
 } ARCADE_A2;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of MS_ANZ */
 	uint32_t get_canid(){ return MS_ANZ_CAN_ID; }
     /** Sets Number of ASA alert */
-    void set_ASS_WARN(MS_ANZ_ASS_WARN value){ raw = (raw & 0xffff0fffffffffff) | ((uint64_t)value & 0xf) << 44; }
+    void set_ASS_WARN(MS_ANZ_ASS_WARN value){ bytes[2] = (bytes[2] & 0x0f) | ((uint8_t)value & 0xf) << 4; }
 
     /** Gets Number of ASA alert */
-    MS_ANZ_ASS_WARN get_ASS_WARN() const { return (MS_ANZ_ASS_WARN)(raw >> 44 & 0xf); }
+    MS_ANZ_ASS_WARN get_ASS_WARN() const { return (MS_ANZ_ASS_WARN)(bytes[2] >> 4 & 0xf); }
         
     /** Sets Number of ASA status message */
-    void set_ASS_DSPL(MS_ANZ_ASS_DSPL value){ raw = (raw & 0xfffff0ffffffffff) | ((uint64_t)value & 0xf) << 40; }
+    void set_ASS_DSPL(MS_ANZ_ASS_DSPL value){ bytes[2] = (bytes[2] & 0xf0) | ((uint8_t)value & 0xf) << 0; }
 
     /** Gets Number of ASA status message */
-    MS_ANZ_ASS_DSPL get_ASS_DSPL() const { return (MS_ANZ_ASS_DSPL)(raw >> 40 & 0xf); }
+    MS_ANZ_ASS_DSPL get_ASS_DSPL() const { return (MS_ANZ_ASS_DSPL)(bytes[2] >> 0 & 0xf); }
         
     /** Sets suppress lamp test during stop phase */
-    void set_ASS_LTEST_AUS(bool value){ raw = (raw & 0xffffff7fffffffff) | ((uint64_t)value & 0x1) << 39; }
+    void set_ASS_LTEST_AUS(bool value){ bytes[3] = (bytes[3] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets suppress lamp test during stop phase */
-    bool get_ASS_LTEST_AUS() const { return (bool)(raw >> 39 & 0x1); }
+    bool get_ASS_LTEST_AUS() const { return (bool)(bytes[3] >> 7 & 0x1); }
         
 } MS_ANZ;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of SBW_232 */
 	uint32_t get_canid(){ return SBW_232_CAN_ID; }
     /** Sets transmitter recognition */
-    void set_SID_SBW(SBW_232h_SID_SBW value){ raw = (raw & 0x3fffffffffffffff) | ((uint64_t)value & 0x3) << 62; }
+    void set_SID_SBW(SBW_232h_SID_SBW value){ bytes[0] = (bytes[0] & 0x3f) | ((uint8_t)value & 0x3) << 6; }
 
     /** Gets transmitter recognition */
-    SBW_232h_SID_SBW get_SID_SBW() const { return (SBW_232h_SID_SBW)(raw >> 62 & 0x3); }
+    SBW_232h_SID_SBW get_SID_SBW() const { return (SBW_232h_SID_SBW)(bytes[0] >> 6 & 0x3); }
         
     /** Sets Steering wheel keys "+", "-" actuated */
-    void set_LRT_PM3(SBW_232h_LRT_PM3 value){ raw = (raw & 0xf8ffffffffffffff) | ((uint64_t)value & 0x7) << 56; }
+    void set_LRT_PM3(SBW_232h_LRT_PM3 value){ bytes[0] = (bytes[0] & 0xf8) | ((uint8_t)value & 0x7) << 0; }
 
     /** Gets Steering wheel keys "+", "-" actuated */
-    SBW_232h_LRT_PM3 get_LRT_PM3() const { return (SBW_232h_LRT_PM3)(raw >> 56 & 0x7); }
+    SBW_232h_LRT_PM3 get_LRT_PM3() const { return (SBW_232h_LRT_PM3)(bytes[0] >> 0 & 0x7); }
         
     /** Sets Shift-by-Wire control element ID */
-    void set_SBWB_ID(SBW_232h_SBWB_ID value){ raw = (raw & 0xff3fffffffffffff) | ((uint64_t)value & 0x3) << 54; }
+    void set_SBWB_ID(SBW_232h_SBWB_ID value){ bytes[1] = (bytes[1] & 0x3f) | ((uint8_t)value & 0x3) << 6; }
 
     /** Gets Shift-by-Wire control element ID */
-    SBW_232h_SBWB_ID get_SBWB_ID() const { return (SBW_232h_SBWB_ID)(raw >> 54 & 0x3); }
+    SBW_232h_SBWB_ID get_SBWB_ID() const { return (SBW_232h_SBWB_ID)(bytes[1] >> 6 & 0x3); }
         
     /** Sets Shift-by-Wire control P-button */
-    void set_SBWB_ST_P(SBW_232h_SBWB_ST_P value){ raw = (raw & 0xffcfffffffffffff) | ((uint64_t)value & 0x3) << 52; }
+    void set_SBWB_ST_P(SBW_232h_SBWB_ST_P value){ bytes[1] = (bytes[1] & 0xcf) | ((uint8_t)value & 0x3) << 4; }
 
     /** Gets Shift-by-Wire control P-button */
-    SBW_232h_SBWB_ST_P get_SBWB_ST_P() const { return (SBW_232h_SBWB_ST_P)(raw >> 52 & 0x3); }
+    SBW_232h_SBWB_ST_P get_SBWB_ST_P() const { return (SBW_232h_SBWB_ST_P)(bytes[1] >> 4 & 0x3); }
         
     /** Sets Shift-by-Wire control Status RND */
-    void set_SBWB_ST_RND(SBW_232h_SBWB_ST_RND value){ raw = (raw & 0xfff0ffffffffffff) | ((uint64_t)value & 0xf) << 48; }
+    void set_SBWB_ST_RND(SBW_232h_SBWB_ST_RND value){ bytes[1] = (bytes[1] & 0xf0) | ((uint8_t)value & 0xf) << 0; }
 
     /** Gets Shift-by-Wire control Status RND */
-    SBW_232h_SBWB_ST_RND get_SBWB_ST_RND() const { return (SBW_232h_SBWB_ST_RND)(raw >> 48 & 0xf); }
+    SBW_232h_SBWB_ST_RND get_SBWB_ST_RND() const { return (SBW_232h_SBWB_ST_RND)(bytes[1] >> 0 & 0xf); }
         
     /** Sets Message counter. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_BZ232h(uint8_t value){ raw = (raw & 0xffff0fffffffffff) | ((uint64_t)value & 0xf) << 44; }
+    void set_BZ232h(uint8_t value){ bytes[2] = (bytes[2] & 0x0f) | ((uint8_t)value & 0xf) << 4; }
 
     /** Gets Message counter. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_BZ232h() const { return (uint8_t)(raw >> 44 & 0xf); }
+    uint8_t get_BZ232h() const { return (uint8_t)(bytes[2] >> 4 & 0xf); }
         
 } SBW_232;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of ART_250 */
 	uint32_t get_canid(){ return ART_250_CAN_ID; }
     /** Sets Switching Difference Art */
-    void set_SLV_ART(ART_250h_SLV_ART value){ raw = (raw & 0x0fffffffffffffff) | ((uint64_t)value & 0xf) << 60; }
+    void set_SLV_ART(ART_250h_SLV_ART value){ bytes[0] = (bytes[0] & 0x0f) | ((uint8_t)value & 0xf) << 4; }
 
     /** Gets Switching Difference Art */
-    ART_250h_SLV_ART get_SLV_ART() const { return (ART_250h_SLV_ART)(raw >> 60 & 0xf); }
+    ART_250h_SLV_ART get_SLV_ART() const { return (ART_250h_SLV_ART)(bytes[0] >> 4 & 0xf); }
         
     /** Sets Type in order */
-    void set_ART_OK(bool value){ raw = (raw & 0xf7ffffffffffffff) | ((uint64_t)value & 0x1) << 59; }
+    void set_ART_OK(bool value){ bytes[0] = (bytes[0] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Type in order */
-    bool get_ART_OK() const { return (bool)(raw >> 59 & 0x1); }
+    bool get_ART_OK() const { return (bool)(bytes[0] >> 3 & 0x1); }
         
     /** Sets Type brakes */
-    void set_ART_BRE(bool value){ raw = (raw & 0xfbffffffffffffff) | ((uint64_t)value & 0x1) << 58; }
+    void set_ART_BRE(bool value){ bytes[0] = (bytes[0] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets Type brakes */
-    bool get_ART_BRE() const { return (bool)(raw >> 58 & 0x1); }
+    bool get_ART_BRE() const { return (bool)(bytes[0] >> 2 & 0x1); }
         
     /** Sets Brake light suppression */
-    void set_BL_UNT(bool value){ raw = (raw & 0xfdffffffffffffff) | ((uint64_t)value & 0x1) << 57; }
+    void set_BL_UNT(bool value){ bytes[0] = (bytes[0] & 0xfd) | ((uint8_t)value & 0x1) << 1; }
 
     /** Gets Brake light suppression */
-    bool get_BL_UNT() const { return (bool)(raw >> 57 & 0x1); }
+    bool get_BL_UNT() const { return (bool)(bytes[0] >> 1 & 0x1); }
         
     /** Sets Suppression Dynamic fully detection */
-    void set_DYN_UNT(bool value){ raw = (raw & 0xfeffffffffffffff) | ((uint64_t)value & 0x1) << 56; }
+    void set_DYN_UNT(bool value){ bytes[0] = (bytes[0] & 0xfe) | ((uint8_t)value & 0x1) << 0; }
 
     /** Gets Suppression Dynamic fully detection */
-    bool get_DYN_UNT() const { return (bool)(raw >> 56 & 0x1); }
+    bool get_DYN_UNT() const { return (bool)(bytes[0] >> 0 & 0x1); }
         
     /** Sets Engine torque Request Parity (just parity) */
-    void set_MPAR_ART(bool value){ raw = (raw & 0xff7fffffffffffff) | ((uint64_t)value & 0x1) << 55; }
+    void set_MPAR_ART(bool value){ bytes[1] = (bytes[1] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Engine torque Request Parity (just parity) */
-    bool get_MPAR_ART() const { return (bool)(raw >> 55 & 0x1); }
+    bool get_MPAR_ART() const { return (bool)(bytes[1] >> 7 & 0x1); }
         
     /** Sets Engine torque request dynamic */
-    void set_MDYN_ART(bool value){ raw = (raw & 0xffbfffffffffffff) | ((uint64_t)value & 0x1) << 54; }
+    void set_MDYN_ART(bool value){ bytes[1] = (bytes[1] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Engine torque request dynamic */
-    bool get_MDYN_ART() const { return (bool)(raw >> 54 & 0x1); }
+    bool get_MDYN_ART() const { return (bool)(bytes[1] >> 6 & 0x1); }
         
     /** Sets City Assistant regulates */
-    void set_CAS_REG(bool value){ raw = (raw & 0xffdfffffffffffff) | ((uint64_t)value & 0x1) << 53; }
+    void set_CAS_REG(bool value){ bytes[1] = (bytes[1] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets City Assistant regulates */
-    bool get_CAS_REG() const { return (bool)(raw >> 53 & 0x1); }
+    bool get_CAS_REG() const { return (bool)(bytes[1] >> 5 & 0x1); }
         
     /** Sets Limiter regulates */
-    void set_LIM_REG(bool value){ raw = (raw & 0xffffbfffffffffff) | ((uint64_t)value & 0x1) << 46; }
+    void set_LIM_REG(bool value){ bytes[2] = (bytes[2] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Limiter regulates */
-    bool get_LIM_REG() const { return (bool)(raw >> 46 & 0x1); }
+    bool get_LIM_REG() const { return (bool)(bytes[2] >> 6 & 0x1); }
         
     /** Sets Type regulates */
-    void set_ART_REG(bool value){ raw = (raw & 0xffffdfffffffffff) | ((uint64_t)value & 0x1) << 45; }
+    void set_ART_REG(bool value){ bytes[2] = (bytes[2] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Type regulates */
-    bool get_ART_REG() const { return (bool)(raw >> 45 & 0x1); }
+    bool get_ART_REG() const { return (bool)(bytes[2] >> 5 & 0x1); }
         
     /** Sets Ford. Engine torque. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_M_ART(uint16_t value){ raw = (raw & 0xffffe000ffffffff) | ((uint64_t)value & 0x1fff) << 32; }
+    void set_M_ART(uint16_t value){ raw = (raw & 0xffffffff00e0ffff) | __builtin_bswap64(((uint64_t)value & 0x1fff) << 32); }
 
     /** Gets Ford. Engine torque. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_M_ART() const { return (uint16_t)(raw >> 32 & 0x1fff); }
+    uint16_t get_M_ART() const { return (uint16_t)(__builtin_bswap64(raw) >> 32 & 0x1fff); }
         
     /** Sets Message counter. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_BZ250h(uint8_t value){ raw = (raw & 0xffffffff0fffffff) | ((uint64_t)value & 0xf) << 28; }
+    void set_BZ250h(uint8_t value){ bytes[4] = (bytes[4] & 0x0f) | ((uint8_t)value & 0xf) << 4; }
 
     /** Gets Message counter. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_BZ250h() const { return (uint8_t)(raw >> 28 & 0xf); }
+    uint8_t get_BZ250h() const { return (uint8_t)(bytes[4] >> 4 & 0xf); }
         
     /** Sets brake torque (0000h: passive value). Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_MBRE_ART(uint16_t value){ raw = (raw & 0xfffffffff000ffff) | ((uint64_t)value & 0xfff) << 16; }
+    void set_MBRE_ART(uint16_t value){ raw = (raw & 0xffff00f0ffffffff) | __builtin_bswap64(((uint64_t)value & 0xfff) << 16); }
 
     /** Gets brake torque (0000h: passive value). Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_MBRE_ART() const { return (uint16_t)(raw >> 16 & 0xfff); }
+    uint16_t get_MBRE_ART() const { return (uint16_t)(__builtin_bswap64(raw) >> 16 & 0xfff); }
         
     /** Sets Art desire: "Active recirculation" */
-    void set_AKT_R_ART(bool value){ raw = (raw & 0xffffffffffff7fff) | ((uint64_t)value & 0x1) << 15; }
+    void set_AKT_R_ART(bool value){ bytes[6] = (bytes[6] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Art desire: "Active recirculation" */
-    bool get_AKT_R_ART() const { return (bool)(raw >> 15 & 0x1); }
+    bool get_AKT_R_ART() const { return (bool)(bytes[6] >> 7 & 0x1); }
         
     /** Sets Gear, upper limit */
-    void set_GMAX_ART(ART_250h_GMAX_ART value){ raw = (raw & 0xffffffffffffc7ff) | ((uint64_t)value & 0x7) << 11; }
+    void set_GMAX_ART(ART_250h_GMAX_ART value){ bytes[6] = (bytes[6] & 0xc7) | ((uint8_t)value & 0x7) << 3; }
 
     /** Gets Gear, upper limit */
-    ART_250h_GMAX_ART get_GMAX_ART() const { return (ART_250h_GMAX_ART)(raw >> 11 & 0x7); }
+    ART_250h_GMAX_ART get_GMAX_ART() const { return (ART_250h_GMAX_ART)(bytes[6] >> 3 & 0x7); }
         
     /** Sets Gear, lower limit */
-    void set_GMIN_ART(ART_250h_GMIN_ART value){ raw = (raw & 0xfffffffffffff8ff) | ((uint64_t)value & 0x7) << 8; }
+    void set_GMIN_ART(ART_250h_GMIN_ART value){ bytes[6] = (bytes[6] & 0xf8) | ((uint8_t)value & 0x7) << 0; }
 
     /** Gets Gear, lower limit */
-    ART_250h_GMIN_ART get_GMIN_ART() const { return (ART_250h_GMIN_ART)(raw >> 8 & 0x7); }
+    ART_250h_GMIN_ART get_GMIN_ART() const { return (ART_250h_GMIN_ART)(bytes[6] >> 0 & 0x7); }
         
 } ART_250;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of ART_258 */
 	uint32_t get_canid(){ return ART_258_CAN_ID; }
     /** Sets Turn the display on type display */
-    void set_ART_DSPL_EIN(bool value){ raw = (raw & 0x7fffffffffffffff) | ((uint64_t)value & 0x1) << 63; }
+    void set_ART_DSPL_EIN(bool value){ bytes[0] = (bytes[0] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Turn the display on type display */
-    bool get_ART_DSPL_EIN() const { return (bool)(raw >> 63 & 0x1); }
+    bool get_ART_DSPL_EIN() const { return (bool)(bytes[0] >> 7 & 0x1); }
         
     /** Sets detection standing object */
-    void set_S_OBJ(bool value){ raw = (raw & 0xbfffffffffffffff) | ((uint64_t)value & 0x1) << 62; }
+    void set_S_OBJ(bool value){ bytes[0] = (bytes[0] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets detection standing object */
-    bool get_S_OBJ() const { return (bool)(raw >> 62 & 0x1); }
+    bool get_S_OBJ() const { return (bool)(bytes[0] >> 6 & 0x1); }
         
     /** Sets Art Warning */
-    void set_ART_WT(bool value){ raw = (raw & 0xdfffffffffffffff) | ((uint64_t)value & 0x1) << 61; }
+    void set_ART_WT(bool value){ bytes[0] = (bytes[0] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Art Warning */
-    bool get_ART_WT() const { return (bool)(raw >> 61 & 0x1); }
+    bool get_ART_WT() const { return (bool)(bytes[0] >> 5 & 0x1); }
         
     /** Sets Art Infolampe */
-    void set_ART_INFO(bool value){ raw = (raw & 0xefffffffffffffff) | ((uint64_t)value & 0x1) << 60; }
+    void set_ART_INFO(bool value){ bytes[0] = (bytes[0] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets Art Infolampe */
-    bool get_ART_INFO() const { return (bool)(raw >> 60 & 0x1); }
+    bool get_ART_INFO() const { return (bool)(bytes[0] >> 4 & 0x1); }
         
     /** Sets Art error code */
-    void set_ART_ERR(ART_258h_ART_ERR value){ raw = (raw & 0xf0ffffffffffffff) | ((uint64_t)value & 0xf) << 56; }
+    void set_ART_ERR(ART_258h_ART_ERR value){ bytes[0] = (bytes[0] & 0xf0) | ((uint8_t)value & 0xf) << 0; }
 
     /** Gets Art error code */
-    ART_258h_ART_ERR get_ART_ERR() const { return (ART_258h_ART_ERR)(raw >> 56 & 0xf); }
+    ART_258h_ART_ERR get_ART_ERR() const { return (ART_258h_ART_ERR)(bytes[0] >> 0 & 0xf); }
         
     /** Sets set type speed. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_V_ART(uint8_t value){ raw = (raw & 0xff00ffffffffffff) | ((uint64_t)value & 0xff) << 48; }
+    void set_V_ART(uint8_t value){ bytes[1] = (bytes[1] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets set type speed. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_V_ART() const { return (uint8_t)(raw >> 48 & 0xff); }
+    uint8_t get_V_ART() const { return (uint8_t)(bytes[1] >> 0 & 0xff); }
         
     /** Sets distance relevant object. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_ABST_R_OBJ(uint8_t value){ raw = (raw & 0xffff00ffffffffff) | ((uint64_t)value & 0xff) << 40; }
+    void set_ABST_R_OBJ(uint8_t value){ bytes[2] = (bytes[2] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets distance relevant object. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_ABST_R_OBJ() const { return (uint8_t)(raw >> 40 & 0xff); }
+    uint8_t get_ABST_R_OBJ() const { return (uint8_t)(bytes[2] >> 0 & 0xff); }
         
     /** Sets driver request. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_SOLL_ABST(uint8_t value){ raw = (raw & 0xffffff00ffffffff) | ((uint64_t)value & 0xff) << 32; }
+    void set_SOLL_ABST(uint8_t value){ bytes[3] = (bytes[3] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets driver request. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_SOLL_ABST() const { return (uint8_t)(raw >> 32 & 0xff); }
+    uint8_t get_SOLL_ABST() const { return (uint8_t)(bytes[3] >> 0 & 0xff); }
         
     /** Sets Display "Winter tire limitation achieved" on the display */
-    void set_ART_DSPL_PGB(bool value){ raw = (raw & 0xffffffff7fffffff) | ((uint64_t)value & 0x1) << 31; }
+    void set_ART_DSPL_PGB(bool value){ bytes[4] = (bytes[4] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Display "Winter tire limitation achieved" on the display */
-    bool get_ART_DSPL_PGB() const { return (bool)(raw >> 31 & 0x1); }
+    bool get_ART_DSPL_PGB() const { return (bool)(bytes[4] >> 7 & 0x1); }
         
     /** Sets Display "DTR OFF [0]" on the display */
-    void set_ART_VFBR(bool value){ raw = (raw & 0xffffffffbfffffff) | ((uint64_t)value & 0x1) << 30; }
+    void set_ART_VFBR(bool value){ bytes[4] = (bytes[4] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Display "DTR OFF [0]" on the display */
-    bool get_ART_VFBR() const { return (bool)(raw >> 30 & 0x1); }
+    bool get_ART_VFBR() const { return (bool)(bytes[4] >> 6 & 0x1); }
         
     /** Sets Display "---" on the display */
-    void set_ART_DSPL_LIM(bool value){ raw = (raw & 0xffffffffdfffffff) | ((uint64_t)value & 0x1) << 29; }
+    void set_ART_DSPL_LIM(bool value){ bytes[4] = (bytes[4] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Display "---" on the display */
-    bool get_ART_DSPL_LIM() const { return (bool)(raw >> 29 & 0x1); }
+    bool get_ART_DSPL_LIM() const { return (bool)(bytes[4] >> 5 & 0x1); }
         
     /** Sets Spacer control mpomat turned on */
-    void set_ART_EIN(bool value){ raw = (raw & 0xffffffffefffffff) | ((uint64_t)value & 0x1) << 28; }
+    void set_ART_EIN(bool value){ bytes[4] = (bytes[4] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets Spacer control mpomat turned on */
-    bool get_ART_EIN() const { return (bool)(raw >> 28 & 0x1); }
+    bool get_ART_EIN() const { return (bool)(bytes[4] >> 4 & 0x1); }
         
     /** Sets Relevant object recognized */
-    void set_OBJ_ERK(bool value){ raw = (raw & 0xfffffffff7ffffff) | ((uint64_t)value & 0x1) << 27; }
+    void set_OBJ_ERK(bool value){ bytes[4] = (bytes[4] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Relevant object recognized */
-    bool get_OBJ_ERK() const { return (bool)(raw >> 27 & 0x1); }
+    bool get_OBJ_ERK() const { return (bool)(bytes[4] >> 3 & 0x1); }
         
     /** Sets Turn on style segment display */
-    void set_ART_SEG_EIN(bool value){ raw = (raw & 0xfffffffffbffffff) | ((uint64_t)value & 0x1) << 26; }
+    void set_ART_SEG_EIN(bool value){ bytes[4] = (bytes[4] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets Turn on style segment display */
-    bool get_ART_SEG_EIN() const { return (bool)(raw >> 26 & 0x1); }
+    bool get_ART_SEG_EIN() const { return (bool)(bytes[4] >> 2 & 0x1); }
         
     /** Sets Fluid indicator flash */
-    void set_ART_DSPL_BL(bool value){ raw = (raw & 0xfffffffffdffffff) | ((uint64_t)value & 0x1) << 25; }
+    void set_ART_DSPL_BL(bool value){ bytes[4] = (bytes[4] & 0xfd) | ((uint8_t)value & 0x1) << 1; }
 
     /** Gets Fluid indicator flash */
-    bool get_ART_DSPL_BL() const { return (bool)(raw >> 25 & 0x1); }
+    bool get_ART_DSPL_BL() const { return (bool)(bytes[4] >> 1 & 0x1); }
         
     /** Sets Art Tempomat on */
-    void set_TM_EIN_ART(bool value){ raw = (raw & 0xfffffffffeffffff) | ((uint64_t)value & 0x1) << 24; }
+    void set_TM_EIN_ART(bool value){ bytes[4] = (bytes[4] & 0xfe) | ((uint8_t)value & 0x1) << 0; }
 
     /** Gets Art Tempomat on */
-    bool get_TM_EIN_ART() const { return (bool)(raw >> 24 & 0x1); }
+    bool get_TM_EIN_ART() const { return (bool)(bytes[4] >> 0 & 0x1); }
         
     /** Sets Speed ​​recognized target vehicle. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_V_ZIEL(uint8_t value){ raw = (raw & 0xffffffffff00ffff) | ((uint64_t)value & 0xff) << 16; }
+    void set_V_ZIEL(uint8_t value){ bytes[5] = (bytes[5] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Speed ​​recognized target vehicle. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_V_ZIEL() const { return (uint8_t)(raw >> 16 & 0xff); }
+    uint8_t get_V_ZIEL() const { return (uint8_t)(bytes[5] >> 0 & 0xff); }
         
     /** Sets Minimum display time in the display new trigger */
-    void set_ART_DSPL_NEU(bool value){ raw = (raw & 0xffffffffffff7fff) | ((uint64_t)value & 0x1) << 15; }
+    void set_ART_DSPL_NEU(bool value){ bytes[6] = (bytes[6] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Minimum display time in the display new trigger */
-    bool get_ART_DSPL_NEU() const { return (bool)(raw >> 15 & 0x1); }
+    bool get_ART_DSPL_NEU() const { return (bool)(bytes[6] >> 7 & 0x1); }
         
     /** Sets Type is overplayed by the driver */
-    void set_ART_UEBERSP(bool value){ raw = (raw & 0xffffffffffffbfff) | ((uint64_t)value & 0x1) << 14; }
+    void set_ART_UEBERSP(bool value){ bytes[6] = (bytes[6] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Type is overplayed by the driver */
-    bool get_ART_UEBERSP() const { return (bool)(raw >> 14 & 0x1); }
+    bool get_ART_UEBERSP() const { return (bool)(bytes[6] >> 6 & 0x1); }
         
     /** Sets Display of system availability after system error */
-    void set_ART_REAKT(bool value){ raw = (raw & 0xffffffffffffdfff) | ((uint64_t)value & 0x1) << 13; }
+    void set_ART_REAKT(bool value){ bytes[6] = (bytes[6] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Display of system availability after system error */
-    bool get_ART_REAKT() const { return (bool)(raw >> 13 & 0x1); }
+    bool get_ART_REAKT() const { return (bool)(bytes[6] >> 5 & 0x1); }
         
     /** Sets Art distance warning is switched on */
-    void set_ART_ABW_AKT(bool value){ raw = (raw & 0xffffffffffffefff) | ((uint64_t)value & 0x1) << 12; }
+    void set_ART_ABW_AKT(bool value){ bytes[6] = (bytes[6] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets Art distance warning is switched on */
-    bool get_ART_ABW_AKT() const { return (bool)(raw >> 12 & 0x1); }
+    bool get_ART_ABW_AKT() const { return (bool)(bytes[6] >> 4 & 0x1); }
         
     /** Sets Object Offer Spacer Wizard */
-    void set_OBJ_AGB(bool value){ raw = (raw & 0xfffffffffffff7ff) | ((uint64_t)value & 0x1) << 11; }
+    void set_OBJ_AGB(bool value){ bytes[6] = (bytes[6] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Object Offer Spacer Wizard */
-    bool get_OBJ_AGB() const { return (bool)(raw >> 11 & 0x1); }
+    bool get_OBJ_AGB() const { return (bool)(bytes[6] >> 3 & 0x1); }
         
     /** Sets LED spacer wizard flashing */
-    void set_AAS_LED_BL(bool value){ raw = (raw & 0xfffffffffffffbff) | ((uint64_t)value & 0x1) << 10; }
+    void set_AAS_LED_BL(bool value){ bytes[6] = (bytes[6] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets LED spacer wizard flashing */
-    bool get_AAS_LED_BL() const { return (bool)(raw >> 10 & 0x1); }
+    bool get_AAS_LED_BL() const { return (bool)(bytes[6] >> 2 & 0x1); }
         
     /** Sets Active function */
-    void set_ASSIST_FKT_AKT(ART_258h_ASSIST_FKT_AKT value){ raw = (raw & 0xfffffffffffffcff) | ((uint64_t)value & 0x3) << 8; }
+    void set_ASSIST_FKT_AKT(ART_258h_ASSIST_FKT_AKT value){ bytes[6] = (bytes[6] & 0xfc) | ((uint8_t)value & 0x3) << 0; }
 
     /** Gets Active function */
-    ART_258h_ASSIST_FKT_AKT get_ASSIST_FKT_AKT() const { return (ART_258h_ASSIST_FKT_AKT)(raw >> 8 & 0x3); }
+    ART_258h_ASSIST_FKT_AKT get_ASSIST_FKT_AKT() const { return (ART_258h_ASSIST_FKT_AKT)(bytes[6] >> 0 & 0x3); }
         
     /** Sets CAS Display request */
-    void set_CAS_ERR_ANZ_V2(ART_258h_CAS_ERR_ANZ_V2 value){ raw = (raw & 0xffffffffffffff1f) | ((uint64_t)value & 0x7) << 5; }
+    void set_CAS_ERR_ANZ_V2(ART_258h_CAS_ERR_ANZ_V2 value){ bytes[7] = (bytes[7] & 0x1f) | ((uint8_t)value & 0x7) << 5; }
 
     /** Gets CAS Display request */
-    ART_258h_CAS_ERR_ANZ_V2 get_CAS_ERR_ANZ_V2() const { return (ART_258h_CAS_ERR_ANZ_V2)(raw >> 5 & 0x7); }
+    ART_258h_CAS_ERR_ANZ_V2 get_CAS_ERR_ANZ_V2() const { return (ART_258h_CAS_ERR_ANZ_V2)(bytes[7] >> 5 & 0x7); }
         
     /** Sets Assistance system Display request */
-    void set_ASSIST_ANZ_V2(ART_258h_ASSIST_ANZ_V2 value){ raw = (raw & 0xffffffffffffffe0) | ((uint64_t)value & 0x1f) << 0; }
+    void set_ASSIST_ANZ_V2(ART_258h_ASSIST_ANZ_V2 value){ bytes[7] = (bytes[7] & 0xe0) | ((uint8_t)value & 0x1f) << 0; }
 
     /** Gets Assistance system Display request */
-    ART_258h_ASSIST_ANZ_V2 get_ASSIST_ANZ_V2() const { return (ART_258h_ASSIST_ANZ_V2)(raw >> 0 & 0x1f); }
+    ART_258h_ASSIST_ANZ_V2 get_ASSIST_ANZ_V2() const { return (ART_258h_ASSIST_ANZ_V2)(bytes[7] >> 0 & 0x1f); }
         
 } ART_258;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of PSM_3B4 */
 	uint32_t get_canid(){ return PSM_3B4_CAN_ID; }
     /** Sets Work Speed Control - ParityBit */
-    void set_PSM_ADR_PAR(bool value){ raw = (raw & 0x7fffffffffffffff) | ((uint64_t)value & 0x1) << 63; }
+    void set_PSM_ADR_PAR(bool value){ bytes[0] = (bytes[0] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Work Speed Control - ParityBit */
-    bool get_PSM_ADR_PAR() const { return (bool)(raw >> 63 & 0x1); }
+    bool get_PSM_ADR_PAR() const { return (bool)(bytes[0] >> 7 & 0x1); }
         
     /** Sets Labor speed control - Togglebit */
-    void set_PSM_ADR_TGL(bool value){ raw = (raw & 0xbfffffffffffffff) | ((uint64_t)value & 0x1) << 62; }
+    void set_PSM_ADR_TGL(bool value){ bytes[0] = (bytes[0] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Labor speed control - Togglebit */
-    bool get_PSM_ADR_TGL() const { return (bool)(raw >> 62 & 0x1); }
+    bool get_PSM_ADR_TGL() const { return (bool)(bytes[0] >> 6 & 0x1); }
         
     /** Sets working speed control active */
-    void set_PSM_ADR_AKT(bool value){ raw = (raw & 0xdfffffffffffffff) | ((uint64_t)value & 0x1) << 61; }
+    void set_PSM_ADR_AKT(bool value){ bytes[0] = (bytes[0] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets working speed control active */
-    bool get_PSM_ADR_AKT() const { return (bool)(raw >> 61 & 0x1); }
+    bool get_PSM_ADR_AKT() const { return (bool)(bytes[0] >> 5 & 0x1); }
         
     /** Sets Motoroll speed ADR. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_PSM_N_SOLL(uint16_t value){ raw = (raw & 0xff0000ffffffffff) | ((uint64_t)value & 0xffff) << 40; }
+    void set_PSM_N_SOLL(uint16_t value){ raw = (raw & 0xffffffffff0000ff) | __builtin_bswap64(((uint64_t)value & 0xffff) << 40); }
 
     /** Gets Motoroll speed ADR. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_PSM_N_SOLL() const { return (uint16_t)(raw >> 40 & 0xffff); }
+    uint16_t get_PSM_N_SOLL() const { return (uint16_t)(__builtin_bswap64(raw) >> 40 & 0xffff); }
         
     /** Sets Tomentic limitation - parity bit */
-    void set_PSM_MOM_PAR(bool value){ raw = (raw & 0xffffff7fffffffff) | ((uint64_t)value & 0x1) << 39; }
+    void set_PSM_MOM_PAR(bool value){ bytes[3] = (bytes[3] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Tomentic limitation - parity bit */
-    bool get_PSM_MOM_PAR() const { return (bool)(raw >> 39 & 0x1); }
+    bool get_PSM_MOM_PAR() const { return (bool)(bytes[3] >> 7 & 0x1); }
         
     /** Sets Tomentic limitation - Togglebit */
-    void set_PSM_MOM_TGL(bool value){ raw = (raw & 0xffffffbfffffffff) | ((uint64_t)value & 0x1) << 38; }
+    void set_PSM_MOM_TGL(bool value){ bytes[3] = (bytes[3] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Tomentic limitation - Togglebit */
-    bool get_PSM_MOM_TGL() const { return (bool)(raw >> 38 & 0x1); }
+    bool get_PSM_MOM_TGL() const { return (bool)(bytes[3] >> 6 & 0x1); }
         
     /** Sets Tomentic limitation active */
-    void set_PSM_MOM_AKT(bool value){ raw = (raw & 0xffffffdfffffffff) | ((uint64_t)value & 0x1) << 37; }
+    void set_PSM_MOM_AKT(bool value){ bytes[3] = (bytes[3] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Tomentic limitation active */
-    bool get_PSM_MOM_AKT() const { return (bool)(raw >> 37 & 0x1); }
+    bool get_PSM_MOM_AKT() const { return (bool)(bytes[3] >> 5 & 0x1); }
         
     /** Sets Maximum engine torque. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_PSM_MOM_SOLL(uint16_t value){ raw = (raw & 0xffffffe000ffffff) | ((uint64_t)value & 0x1fff) << 24; }
+    void set_PSM_MOM_SOLL(uint16_t value){ raw = (raw & 0xffffff00e0ffffff) | __builtin_bswap64(((uint64_t)value & 0x1fff) << 24); }
 
     /** Gets Maximum engine torque. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_PSM_MOM_SOLL() const { return (uint16_t)(raw >> 24 & 0x1fff); }
+    uint16_t get_PSM_MOM_SOLL() const { return (uint16_t)(__builtin_bswap64(raw) >> 24 & 0x1fff); }
         
     /** Sets Speed limitation - parity bit */
-    void set_PSM_DZ_PAR(bool value){ raw = (raw & 0xffffffffff7fffff) | ((uint64_t)value & 0x1) << 23; }
+    void set_PSM_DZ_PAR(bool value){ bytes[5] = (bytes[5] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Speed limitation - parity bit */
-    bool get_PSM_DZ_PAR() const { return (bool)(raw >> 23 & 0x1); }
+    bool get_PSM_DZ_PAR() const { return (bool)(bytes[5] >> 7 & 0x1); }
         
     /** Sets Speed limitation - Togglebit */
-    void set_PSM_DZ_TGL(bool value){ raw = (raw & 0xffffffffffbfffff) | ((uint64_t)value & 0x1) << 22; }
+    void set_PSM_DZ_TGL(bool value){ bytes[5] = (bytes[5] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Speed limitation - Togglebit */
-    bool get_PSM_DZ_TGL() const { return (bool)(raw >> 22 & 0x1); }
+    bool get_PSM_DZ_TGL() const { return (bool)(bytes[5] >> 6 & 0x1); }
         
     /** Sets Speed limitation active */
-    void set_PSM_DZ_AKT(bool value){ raw = (raw & 0xffffffffffdfffff) | ((uint64_t)value & 0x1) << 21; }
+    void set_PSM_DZ_AKT(bool value){ bytes[5] = (bytes[5] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Speed limitation active */
-    bool get_PSM_DZ_AKT() const { return (bool)(raw >> 21 & 0x1); }
+    bool get_PSM_DZ_AKT() const { return (bool)(bytes[5] >> 5 & 0x1); }
         
     /** Sets Maximum speed. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_PSM_DZ_MAX(uint16_t value){ raw = (raw & 0xffffffffffff0000) | ((uint64_t)value & 0xffff) << 0; }
+    void set_PSM_DZ_MAX(uint16_t value){ raw = (raw & 0x0000ffffffffffff) | __builtin_bswap64(((uint64_t)value & 0xffff) << 0); }
 
     /** Gets Maximum speed. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_PSM_DZ_MAX() const { return (uint16_t)(raw >> 0 & 0xffff); }
+    uint16_t get_PSM_DZ_MAX() const { return (uint16_t)(__builtin_bswap64(raw) >> 0 & 0xffff); }
         
 } PSM_3B4;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of PSM_3B8 */
 	uint32_t get_canid(){ return PSM_3B8_CAN_ID; }
     /** Sets Speed Control - Parity Bit */
-    void set_PSM_V_PAR(bool value){ raw = (raw & 0x7fffffffffffffff) | ((uint64_t)value & 0x1) << 63; }
+    void set_PSM_V_PAR(bool value){ bytes[0] = (bytes[0] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Speed Control - Parity Bit */
-    bool get_PSM_V_PAR() const { return (bool)(raw >> 63 & 0x1); }
+    bool get_PSM_V_PAR() const { return (bool)(bytes[0] >> 7 & 0x1); }
         
     /** Sets Speed limitation - Togglebit */
-    void set_PSM_V_TGL(bool value){ raw = (raw & 0xbfffffffffffffff) | ((uint64_t)value & 0x1) << 62; }
+    void set_PSM_V_TGL(bool value){ bytes[0] = (bytes[0] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Speed limitation - Togglebit */
-    bool get_PSM_V_TGL() const { return (bool)(raw >> 62 & 0x1); }
+    bool get_PSM_V_TGL() const { return (bool)(bytes[0] >> 6 & 0x1); }
         
     /** Sets Speed limitation active */
-    void set_PSM_V_AKT(bool value){ raw = (raw & 0xdfffffffffffffff) | ((uint64_t)value & 0x1) << 61; }
+    void set_PSM_V_AKT(bool value){ bytes[0] = (bytes[0] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Speed limitation active */
-    bool get_PSM_V_AKT() const { return (bool)(raw >> 61 & 0x1); }
+    bool get_PSM_V_AKT() const { return (bool)(bytes[0] >> 5 & 0x1); }
         
     /** Sets Speed limit. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_PSM_V_SOLL(uint8_t value){ raw = (raw & 0xff00ffffffffffff) | ((uint64_t)value & 0xff) << 48; }
+    void set_PSM_V_SOLL(uint8_t value){ bytes[1] = (bytes[1] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Speed limit. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_PSM_V_SOLL() const { return (uint8_t)(raw >> 48 & 0xff); }
+    uint8_t get_PSM_V_SOLL() const { return (uint8_t)(bytes[1] >> 0 & 0xff); }
         
     /** Sets Speed limitation - parity bit */
-    void set_PSM_DZ_PAR(bool value){ raw = (raw & 0xffff7fffffffffff) | ((uint64_t)value & 0x1) << 47; }
+    void set_PSM_DZ_PAR(bool value){ bytes[2] = (bytes[2] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Speed limitation - parity bit */
-    bool get_PSM_DZ_PAR() const { return (bool)(raw >> 47 & 0x1); }
+    bool get_PSM_DZ_PAR() const { return (bool)(bytes[2] >> 7 & 0x1); }
         
     /** Sets Speed limitation - Togglebit */
-    void set_PSM_DZ_TGL(bool value){ raw = (raw & 0xffffbfffffffffff) | ((uint64_t)value & 0x1) << 46; }
+    void set_PSM_DZ_TGL(bool value){ bytes[2] = (bytes[2] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Speed limitation - Togglebit */
-    bool get_PSM_DZ_TGL() const { return (bool)(raw >> 46 & 0x1); }
+    bool get_PSM_DZ_TGL() const { return (bool)(bytes[2] >> 6 & 0x1); }
         
     /** Sets Motor Remote Start active */
-    void set_PSM_FERN_START(bool value){ raw = (raw & 0xffffdfffffffffff) | ((uint64_t)value & 0x1) << 45; }
+    void set_PSM_FERN_START(bool value){ bytes[2] = (bytes[2] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Motor Remote Start active */
-    bool get_PSM_FERN_START() const { return (bool)(raw >> 45 & 0x1); }
+    bool get_PSM_FERN_START() const { return (bool)(bytes[2] >> 5 & 0x1); }
         
     /** Sets Motor Remote Stop active */
-    void set_PSM_FERN_STOP(bool value){ raw = (raw & 0xffffefffffffffff) | ((uint64_t)value & 0x1) << 44; }
+    void set_PSM_FERN_STOP(bool value){ bytes[2] = (bytes[2] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets Motor Remote Stop active */
-    bool get_PSM_FERN_STOP() const { return (bool)(raw >> 44 & 0x1); }
+    bool get_PSM_FERN_STOP() const { return (bool)(bytes[2] >> 4 & 0x1); }
         
     /** Sets lock accelerator pedal module */
-    void set_PSM_FPM_SP(bool value){ raw = (raw & 0xfffff7ffffffffff) | ((uint64_t)value & 0x1) << 43; }
+    void set_PSM_FPM_SP(bool value){ bytes[2] = (bytes[2] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets lock accelerator pedal module */
-    bool get_PSM_FPM_SP() const { return (bool)(raw >> 43 & 0x1); }
+    bool get_PSM_FPM_SP() const { return (bool)(bytes[2] >> 3 & 0x1); }
         
 } PSM_3B8;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of VG_428 */
 	uint32_t get_canid(){ return VG_428_CAN_ID; }
     /** Sets Error VG (ECU Failure Detected) */
-    void set_VG_ERR(bool value){ raw = (raw & 0xdfffffffffffffff) | ((uint64_t)value & 0x1) << 61; }
+    void set_VG_ERR(bool value){ bytes[0] = (bytes[0] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Error VG (ECU Failure Detected) */
-    bool get_VG_ERR() const { return (bool)(raw >> 61 & 0x1); }
+    bool get_VG_ERR() const { return (bool)(bytes[0] >> 5 & 0x1); }
         
     /** Sets Current gear distribution gear */
-    void set_VG_GANG(VG_428h_VG_GANG value){ raw = (raw & 0xf8ffffffffffffff) | ((uint64_t)value & 0x7) << 56; }
+    void set_VG_GANG(VG_428h_VG_GANG value){ bytes[0] = (bytes[0] & 0xf8) | ((uint8_t)value & 0x7) << 0; }
 
     /** Gets Current gear distribution gear */
-    VG_428h_VG_GANG get_VG_GANG() const { return (VG_428h_VG_GANG)(raw >> 56 & 0x7); }
+    VG_428h_VG_GANG get_VG_GANG() const { return (VG_428h_VG_GANG)(bytes[0] >> 0 & 0x7); }
         
     /** Sets VG - Request "n" Parity (straight parity) */
-    void set_ANFNPAR_VG(bool value){ raw = (raw & 0xfff7ffffffffffff) | ((uint64_t)value & 0x1) << 51; }
+    void set_ANFNPAR_VG(bool value){ bytes[1] = (bytes[1] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets VG - Request "n" Parity (straight parity) */
-    bool get_ANFNPAR_VG() const { return (bool)(raw >> 51 & 0x1); }
+    bool get_ANFNPAR_VG() const { return (bool)(bytes[1] >> 3 & 0x1); }
         
     /** Sets VG - ANG.Load "N" Toggle 20ms (1 / Embassy) */
-    void set_ANFNTGL_VG(bool value){ raw = (raw & 0xfffbffffffffffff) | ((uint64_t)value & 0x1) << 50; }
+    void set_ANFNTGL_VG(bool value){ bytes[1] = (bytes[1] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets VG - ANG.Load "N" Toggle 20ms (1 / Embassy) */
-    bool get_ANFNTGL_VG() const { return (bool)(raw >> 50 & 0x1); }
+    bool get_ANFNTGL_VG() const { return (bool)(bytes[1] >> 2 & 0x1); }
         
     /** Sets VG request "N" */
-    void set_ANFN_VG(VG_428h_ANFN_VG value){ raw = (raw & 0xfffcffffffffffff) | ((uint64_t)value & 0x3) << 48; }
+    void set_ANFN_VG(VG_428h_ANFN_VG value){ bytes[1] = (bytes[1] & 0xfc) | ((uint8_t)value & 0x3) << 0; }
 
     /** Gets VG request "N" */
-    VG_428h_ANFN_VG get_ANFN_VG() const { return (VG_428h_ANFN_VG)(raw >> 48 & 0x3); }
+    VG_428h_ANFN_VG get_ANFN_VG() const { return (VG_428h_ANFN_VG)(bytes[1] >> 0 & 0x3); }
         
 } VG_428;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of LWR_530 */
 	uint32_t get_canid(){ return LWR_530_CAN_ID; }
     /** Sets Display message 7: "Baltic view currently not available" */
-    void set_LWR_M7(bool value){ raw = (raw & 0xbfffffffffffffff) | ((uint64_t)value & 0x1) << 62; }
+    void set_LWR_M7(bool value){ bytes[0] = (bytes[0] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Display message 7: "Baltic view currently not available" */
-    bool get_LWR_M7() const { return (bool)(raw >> 62 & 0x1); }
+    bool get_LWR_M7() const { return (bool)(bytes[0] >> 6 & 0x1); }
         
     /** Sets Display message 6: "Bolt match right" */
-    void set_LWR_M6(bool value){ raw = (raw & 0xdfffffffffffffff) | ((uint64_t)value & 0x1) << 61; }
+    void set_LWR_M6(bool value){ bytes[0] = (bytes[0] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Display message 6: "Bolt match right" */
-    bool get_LWR_M6() const { return (bool)(raw >> 61 & 0x1); }
+    bool get_LWR_M6() const { return (bool)(bytes[0] >> 5 & 0x1); }
         
     /** Sets Display message 5: "Bolt view left" */
-    void set_LWR_M5(bool value){ raw = (raw & 0xefffffffffffffff) | ((uint64_t)value & 0x1) << 60; }
+    void set_LWR_M5(bool value){ bytes[0] = (bytes[0] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets Display message 5: "Bolt view left" */
-    bool get_LWR_M5() const { return (bool)(raw >> 60 & 0x1); }
+    bool get_LWR_M5() const { return (bool)(bytes[0] >> 4 & 0x1); }
         
     /** Sets Display message 4: "Curve light currently not available" (white / 5x flashing with 1Hz) */
-    void set_LWR_M4(bool value){ raw = (raw & 0xf7ffffffffffffff) | ((uint64_t)value & 0x1) << 59; }
+    void set_LWR_M4(bool value){ bytes[0] = (bytes[0] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Display message 4: "Curve light currently not available" (white / 5x flashing with 1Hz) */
-    bool get_LWR_M4() const { return (bool)(raw >> 59 & 0x1); }
+    bool get_LWR_M4() const { return (bool)(bytes[0] >> 3 & 0x1); }
         
     /** Sets Display message 3: "Curve light currently not available" (white). */
-    void set_LWR_M3(bool value){ raw = (raw & 0xfbffffffffffffff) | ((uint64_t)value & 0x1) << 58; }
+    void set_LWR_M3(bool value){ bytes[0] = (bytes[0] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets Display message 3: "Curve light currently not available" (white). */
-    bool get_LWR_M3() const { return (bool)(raw >> 58 & 0x1); }
+    bool get_LWR_M3() const { return (bool)(bytes[0] >> 2 & 0x1); }
         
     /** Sets Display message 2: "Curve light, replacement light activated!"(White) */
-    void set_LWR_M2(bool value){ raw = (raw & 0xfdffffffffffffff) | ((uint64_t)value & 0x1) << 57; }
+    void set_LWR_M2(bool value){ bytes[0] = (bytes[0] & 0xfd) | ((uint8_t)value & 0x1) << 1; }
 
     /** Gets Display message 2: "Curve light, replacement light activated!"(White) */
-    bool get_LWR_M2() const { return (bool)(raw >> 57 & 0x1); }
+    bool get_LWR_M2() const { return (bool)(bytes[0] >> 1 & 0x1); }
         
     /** Sets Display message 1: "Curve light defective! Drive to the workshop" */
-    void set_LWR_M1(bool value){ raw = (raw & 0xfeffffffffffffff) | ((uint64_t)value & 0x1) << 56; }
+    void set_LWR_M1(bool value){ bytes[0] = (bytes[0] & 0xfe) | ((uint8_t)value & 0x1) << 0; }
 
     /** Gets Display message 1: "Curve light defective! Drive to the workshop" */
-    bool get_LWR_M1() const { return (bool)(raw >> 56 & 0x1); }
+    bool get_LWR_M1() const { return (bool)(bytes[0] >> 0 & 0x1); }
         
     /** Sets Substitution lowlight left */
-    void set_SUB_ABL_L(bool value){ raw = (raw & 0xff7fffffffffffff) | ((uint64_t)value & 0x1) << 55; }
+    void set_SUB_ABL_L(bool value){ bytes[1] = (bytes[1] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Substitution lowlight left */
-    bool get_SUB_ABL_L() const { return (bool)(raw >> 55 & 0x1); }
+    bool get_SUB_ABL_L() const { return (bool)(bytes[1] >> 7 & 0x1); }
         
     /** Sets Substitution low beam right */
-    void set_SUB_ABL_R(bool value){ raw = (raw & 0xffbfffffffffffff) | ((uint64_t)value & 0x1) << 54; }
+    void set_SUB_ABL_R(bool value){ bytes[1] = (bytes[1] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Substitution low beam right */
-    bool get_SUB_ABL_R() const { return (bool)(raw >> 54 & 0x1); }
+    bool get_SUB_ABL_R() const { return (bool)(bytes[1] >> 6 & 0x1); }
         
 } LWR_530;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of CONFIG_6FF */
 	uint32_t get_canid(){ return CONFIG_6FF_CAN_ID; }
     /** Sets E-suction fan: basic ventilation */
-    void set_GBL_AUS(bool value){ raw = (raw & 0x7fffffffffffffff) | ((uint64_t)value & 0x1) << 63; }
+    void set_GBL_AUS(bool value){ bytes[0] = (bytes[0] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets E-suction fan: basic ventilation */
-    bool get_GBL_AUS() const { return (bool)(raw >> 63 & 0x1); }
+    bool get_GBL_AUS() const { return (bool)(bytes[0] >> 7 & 0x1); }
         
     /** Sets Air conditioning available */
-    void set_KLA_VH(bool value){ raw = (raw & 0xffffffffffffdfff) | ((uint64_t)value & 0x1) << 13; }
+    void set_KLA_VH(bool value){ bytes[6] = (bytes[6] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Air conditioning available */
-    bool get_KLA_VH() const { return (bool)(raw >> 13 & 0x1); }
+    bool get_KLA_VH() const { return (bool)(bytes[6] >> 5 & 0x1); }
         
     /** Sets Differential lock behind available */
-    void set_DSH_VH(bool value){ raw = (raw & 0xfffffffffffffff7) | ((uint64_t)value & 0x1) << 3; }
+    void set_DSH_VH(bool value){ bytes[7] = (bytes[7] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Differential lock behind available */
-    bool get_DSH_VH() const { return (bool)(raw >> 3 & 0x1); }
+    bool get_DSH_VH() const { return (bool)(bytes[7] >> 3 & 0x1); }
         
     /** Sets Differential lock center available */
-    void set_DSM_VH(bool value){ raw = (raw & 0xfffffffffffffffb) | ((uint64_t)value & 0x1) << 2; }
+    void set_DSM_VH(bool value){ bytes[7] = (bytes[7] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets Differential lock center available */
-    bool get_DSM_VH() const { return (bool)(raw >> 2 & 0x1); }
+    bool get_DSM_VH() const { return (bool)(bytes[7] >> 2 & 0x1); }
         
     /** Sets Differential lock in front available */
-    void set_DSV_VH(bool value){ raw = (raw & 0xfffffffffffffffd) | ((uint64_t)value & 0x1) << 1; }
+    void set_DSV_VH(bool value){ bytes[7] = (bytes[7] & 0xfd) | ((uint8_t)value & 0x1) << 1; }
 
     /** Gets Differential lock in front available */
-    bool get_DSV_VH() const { return (bool)(raw >> 1 & 0x1); }
+    bool get_DSV_VH() const { return (bool)(bytes[7] >> 1 & 0x1); }
         
     /** Sets distribution gear control available */
-    void set_VG_VH(bool value){ raw = (raw & 0xfffffffffffffffe) | ((uint64_t)value & 0x1) << 0; }
+    void set_VG_VH(bool value){ bytes[7] = (bytes[7] & 0xfe) | ((uint8_t)value & 0x1) << 0; }
 
     /** Gets distribution gear control available */
-    bool get_VG_VH() const { return (bool)(raw >> 0 & 0x1); }
+    bool get_VG_VH() const { return (bool)(bytes[7] >> 0 & 0x1); }
         
 } CONFIG_6FF;
 
@@ -898,240 +905,118 @@ class ECU_ANY_ECU {
         /**
          * @brief Imports the CAN frame given the CAN ID, CAN Contents, and current timestamp
          *
-         * Returns true if the frame was imported successfully, and false if import failed (Due to non-matching CAN ID).
+         * Returns true if the frame was imported successfully, and false if import failed (Due to non-matching CAN ID,
+         * or the frame failing validation).
          *
-         * NOTE: The endianness of the value cannot be guaranteed. It is up to the caller to correct the byte order!
+         * 'value' is the CAN payload in wire order, as copied straight out of the CAN controller's data buffer
          */
         bool import_frames(uint64_t value, uint32_t can_id, uint64_t timestamp_now) {
             switch(can_id) {
-                case ARCADE_A2_CAN_ID:
-                    LAST_FRAME_TIMES[0] = timestamp_now;
-                    FRAME_DATA[0] = value;
-                    return true;
-                case MS_ANZ_CAN_ID:
-                    LAST_FRAME_TIMES[1] = timestamp_now;
-                    FRAME_DATA[1] = value;
-                    return true;
                 case SBW_232_CAN_ID:
-                    LAST_FRAME_TIMES[2] = timestamp_now;
-                    FRAME_DATA[2] = value;
-                    return true;
-                case ART_250_CAN_ID:
-                    LAST_FRAME_TIMES[3] = timestamp_now;
-                    FRAME_DATA[3] = value;
-                    return true;
-                case ART_258_CAN_ID:
-                    LAST_FRAME_TIMES[4] = timestamp_now;
-                    FRAME_DATA[4] = value;
-                    return true;
-                case PSM_3B4_CAN_ID:
-                    LAST_FRAME_TIMES[5] = timestamp_now;
-                    FRAME_DATA[5] = value;
-                    return true;
-                case PSM_3B8_CAN_ID:
-                    LAST_FRAME_TIMES[6] = timestamp_now;
-                    FRAME_DATA[6] = value;
-                    return true;
-                case VG_428_CAN_ID:
-                    LAST_FRAME_TIMES[7] = timestamp_now;
-                    FRAME_DATA[7] = value;
-                    return true;
-                case LWR_530_CAN_ID:
-                    LAST_FRAME_TIMES[8] = timestamp_now;
-                    FRAME_DATA[8] = value;
-                    return true;
-                case CONFIG_6FF_CAN_ID:
-                    LAST_FRAME_TIMES[9] = timestamp_now;
-                    FRAME_DATA[9] = value;
-                    return true;
+                    return import_frame_at(0, value, timestamp_now) == FrameCheckResult::Ok;
                 default:
                     return false;
             }
         }
-        
-        /** Sets data in pointer to ARCADE_A2
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_ARCADE_A2(uint64_t now, uint64_t max_expire_time, ARCADE_A2* dest) const {
-            if (LAST_FRAME_TIMES[0] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[0] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[0];
-                return true;
-            }
-        }
-            
-        /** Sets data in pointer to MS_ANZ
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_MS_ANZ(uint64_t now, uint64_t max_expire_time, MS_ANZ* dest) const {
-            if (LAST_FRAME_TIMES[1] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[1] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[1];
-                return true;
-            }
-        }
-            
-        /** Sets data in pointer to SBW_232
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_SBW_232(uint64_t now, uint64_t max_expire_time, SBW_232* dest) const {
-            if (LAST_FRAME_TIMES[2] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[2] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[2];
-                return true;
-            }
-        }
-            
-        /** Sets data in pointer to ART_250
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_ART_250(uint64_t now, uint64_t max_expire_time, ART_250* dest) const {
-            if (LAST_FRAME_TIMES[3] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[3] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[3];
-                return true;
-            }
-        }
-            
-        /** Sets data in pointer to ART_258
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_ART_258(uint64_t now, uint64_t max_expire_time, ART_258* dest) const {
-            if (LAST_FRAME_TIMES[4] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[4] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[4];
-                return true;
+
+        /**
+         * @brief Imports the CAN frame directly into storage slot 'slot', as returned by the
+         * generated RX dispatch table. This skips the CAN ID switch entirely.
+         *
+         * A frame that fails validation of its message counter, toggle or parity signals is not stored
+         * (And is counted in its arrival statistics), and the reason is returned.
+         *
+         * 'value' is the CAN payload in wire order, as copied straight out of the CAN controller's data buffer
+         */
+        FrameCheckResult import_frame_at(uint8_t slot, uint64_t value, uint64_t timestamp_now) {
+            FrameCheckResult res = check_frame_at(slot, value, timestamp_now);
+            if (res != FrameCheckResult::Ok) {
+                reject_frame_at(slot);
+                return res;
             }
+            FRAMES[slot].write(EcuFrame { .data = value, .timestamp = timestamp_now });
+            update_arrival_stats(&RX_STATS[slot], timestamp_now);
+            STATS[slot].write(RX_STATS[slot]);
+            return FrameCheckResult::Ok;
         }
-            
-        /** Sets data in pointer to PSM_3B4
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_PSM_3B4(uint64_t now, uint64_t max_expire_time, PSM_3B4* dest) const {
-            if (LAST_FRAME_TIMES[5] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[5] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[5];
-                return true;
-            }
+
+        /**
+         * Counts a frame in storage slot 'slot' that failed a check made outside this class (Such as a CRC).
+         * Only call from the CAN Rx task
+         */
+        void reject_frame_at(uint8_t slot) {
+            RX_STATS[slot].rejected_count++;
+            STATS[slot].write(RX_STATS[slot]);
         }
-            
-        /** Sets data in pointer to PSM_3B8
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_PSM_3B8(uint64_t now, uint64_t max_expire_time, PSM_3B8* dest) const {
-            if (LAST_FRAME_TIMES[6] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[6] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[6];
-                return true;
-            }
+
+        /** Returns the number of frames stored by this ECU (Only the frames the TCM reads) */
+        uint8_t get_num_frames() const {
+            return NUM_FRAMES;
         }
-            
-        /** Sets data in pointer to VG_428
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_VG_428(uint64_t now, uint64_t max_expire_time, VG_428* dest) const {
-            if (LAST_FRAME_TIMES[7] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[7] > max_expire_time) { // CAN Frame has not refreshed in valid interval
+
+        /**
+         * Copies the arrival statistics of the frame in storage slot 'slot' to 'dest'. Safe to call from any task.
+         *
+         * Returns false if 'slot' is out of range.
+         */
+        bool get_frame_stats_at(uint8_t slot, FrameArrivalStats* dest) const {
+            if (slot >= NUM_FRAMES || dest == nullptr) {
                 return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[7];
-                return true;
             }
+            STATS[slot].read(dest);
+            dest->stale_count = STALE[slot].count.load(std::memory_order_relaxed);
+            return true;
         }
-            
-        /** Sets data in pointer to LWR_530
+        
+        /** Sets data in pointer to SBW_232
           * 
           * If this function returns false, then the CAN Frame is invalid or has not been seen
           * on the CANBUS network yet. Meaning it's data cannot be used.
           *
           * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
           */
-        bool get_LWR_530(uint64_t now, uint64_t max_expire_time, LWR_530* dest) const {
-            if (LAST_FRAME_TIMES[8] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
+        bool get_SBW_232(uint64_t now, uint64_t max_expire_time, SBW_232* dest) const {
+            EcuFrame f;
+            uint32_t seq = FRAMES[0].read(&f); // Data and timestamp are always from the same frame
+            if (f.timestamp == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
                 return false;
-            } else if (now - LAST_FRAME_TIMES[8] > max_expire_time) { // CAN Frame has not refreshed in valid interval
+            } else if (now > f.timestamp && now - f.timestamp > max_expire_time) { // CAN Frame has not refreshed in valid interval
+                mark_frame_stale(&STALE[0], seq);
                 return false;
             } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[8];
+                dest->raw = f.data;
                 return true;
             }
         }
             
-        /** Sets data in pointer to CONFIG_6FF
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_CONFIG_6FF(uint64_t now, uint64_t max_expire_time, CONFIG_6FF* dest) const {
-            if (LAST_FRAME_TIMES[9] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[9] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[9];
-                return true;
+	private:
+        /**
+         * Checks the message counter, toggle and parity signals of a frame for storage slot 'slot'.
+         * Only call from the CAN Rx task
+         */
+        FrameCheckResult check_frame_at(uint8_t slot, uint64_t value, uint64_t timestamp_now) {
+            switch(slot) {
+                case 0: // SBW_232
+                    return frame_sequence_check(&CHECKS[0], value, 0x0000000000F00000ULL, 0x0000000000000000ULL, timestamp_now);
+                default:
+                    return FrameCheckResult::Ok;
             }
         }
-            
-	private:
-		uint64_t FRAME_DATA[10];
-		uint64_t LAST_FRAME_TIMES[10];
+
+		typedef struct {
+			uint64_t data;
+			uint64_t timestamp;
+		} EcuFrame;
+		// Written by the CAN Rx task, read by any other task
+		Seqlock<EcuFrame> FRAMES[1];
+		// Arrival statistics. Only touched by the CAN Rx task, which publishes them to STATS
+		FrameArrivalStats RX_STATS[1] = {};
+		Seqlock<FrameArrivalStats> STATS[1];
+		// Staleness, counted by the getters from any task
+		mutable FrameStaleCounter STALE[1] = {};
+		// Message counter / toggle state of the frames that have them. Only touched by the CAN Rx task
+		FrameCheckState CHECKS[1] = {};
+		static const uint8_t NUM_FRAMES = 1;
 };
 #endif // __ECU_ANY_ECU_H_
 
@@ -0,0 +1,82 @@
+
+/**
+* AUTOGENERATED BY convert.py
+* DO NOT EDIT THIS FILE!
+*
+* IF MODIFICATIONS NEED TO BE MADE, MODIFY can_data.txt!
+*
+* CAN ID to ECU storage dispatch table
+*/
+
+#ifdef EGS52_MODE
+
+#ifndef __ECU_DISPATCH_H_
+#define __ECU_DISPATCH_H_
+
+#include <stdint.h>
+
+/** ECUs which own frames on the CANBUS */
+enum class EcuId : uint8_t {
+	ESP_SBC = 0,
+	MS = 1,
+	GS = 2,
+	EWM = 3,
+	EZS = 4,
+	KOMBI = 5,
+	MRM = 6,
+	ANY_ECU = 7,
+	NONE = 0xFF, // Unused table entry
+};
+
+typedef struct {
+	uint32_t can_id;
+	EcuId ecu;
+	uint8_t slot; // Storage slot of the frame within the ECU_XXX class (See ECU_XXX::import_frame_at)
+} EcuDispatchEntry;
+
+#define ECU_DISPATCH_TABLE_SIZE 7
+
+/**
+ * Perfect hash table of every CAN ID the TCM reads in this build mode.
+ * The entry for a CAN ID is located at ECU_DISPATCH_TABLE[can_id % ECU_DISPATCH_TABLE_SIZE]
+ */
+static const EcuDispatchEntry ECU_DISPATCH_TABLE[ECU_DISPATCH_TABLE_SIZE] = {
+	{ 0x0230, EcuId::EWM, 0 }, // EWM_230
+	{ 0x0200, EcuId::ESP_SBC, 0 }, // BS_200
+	{ 0x0232, EcuId::ANY_ECU, 0 }, // SBW_232
+	{ 0x0210, EcuId::MS, 0 }, // MS_210
+	{ 0x0608, EcuId::MS, 2 }, // MS_608
+	{ 0x0000, EcuId::NONE, 0 },
+	{ 0x0308, EcuId::MS, 1 }, // MS_308
+};
+
+/**
+ * @brief Looks up the ECU and storage slot that own a CAN ID, in constant time.
+ *
+ * Returns nullptr if the CAN ID is not read by the TCM in this build mode
+ */
+static inline const EcuDispatchEntry* ecu_dispatch_lookup(uint32_t can_id) {
+    const EcuDispatchEntry* e = &ECU_DISPATCH_TABLE[can_id % ECU_DISPATCH_TABLE_SIZE];
+    if (e->ecu == EcuId::NONE || e->can_id != can_id) {
+        return nullptr;
+    }
+    return e;
+}
+
+/**
+ * CAN IDs the HAL actually reads off the bus (Sorted). Used to program the
+ * acceptance filter of the CAN controller, so other frames never reach the CPU
+ */
+#define ECU_RX_ID_COUNT 6
+static const uint32_t ECU_RX_IDS[ECU_RX_ID_COUNT] = {
+	0x0200, // BS_200
+	0x0210, // MS_210
+	0x0230, // EWM_230
+	0x0232, // SBW_232
+	0x0308, // MS_308
+	0x0608, // MS_608
+};
+
+#endif // __ECU_DISPATCH_H_
+
+#endif // EGS52_MODE
\ No newline at end of file
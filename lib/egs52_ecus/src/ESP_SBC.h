@@ -14,6 +14,13 @@
 #define __ECU_ESP_SBC_H_
 
 #include <stdint.h>
+#include "seqlock.h"
+#include "ecu_frame_stats.h"
+#include "ecu_frame_check.h"
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+    #error "Generated CAN frame accessors assume a little endian CPU"
+#endif
     
 #define BS_200_CAN_ID 0x0200
 #define BS_208_CAN_ID 0x0208
@@ -203,464 +210,464 @@ enum class BS_328h_ESP_DSPL {
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of BS_200 */
 	uint32_t get_canid(){ return BS_200_CAN_ID; }
     /** Sets Brake defective control lamp (EBV_KL at 463/461 / NCV2) */
-    void set_BRE_KL(bool value){ raw = (raw & 0x7fffffffffffffff) | ((uint64_t)value & 0x1) << 63; }
+    void set_BRE_KL(bool value){ bytes[0] = (bytes[0] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Brake defective control lamp (EBV_KL at 463/461 / NCV2) */
-    bool get_BRE_KL() const { return (bool)(raw >> 63 & 0x1); }
+    bool get_BRE_KL() const { return (bool)(bytes[0] >> 7 & 0x1); }
         
     /** Sets Bas defective control lamp */
-    void set_BAS_KL(bool value){ raw = (raw & 0xbfffffffffffffff) | ((uint64_t)value & 0x1) << 62; }
+    void set_BAS_KL(bool value){ bytes[0] = (bytes[0] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Bas defective control lamp */
-    bool get_BAS_KL() const { return (bool)(raw >> 62 & 0x1); }
+    bool get_BAS_KL() const { return (bool)(bytes[0] >> 6 & 0x1); }
         
     /** Sets ESP Infolramp flashing light */
-    void set_ESP_INFO_BL(bool value){ raw = (raw & 0xdfffffffffffffff) | ((uint64_t)value & 0x1) << 61; }
+    void set_ESP_INFO_BL(bool value){ bytes[0] = (bytes[0] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets ESP Infolramp flashing light */
-    bool get_ESP_INFO_BL() const { return (bool)(raw >> 61 & 0x1); }
+    bool get_ESP_INFO_BL() const { return (bool)(bytes[0] >> 5 & 0x1); }
         
     /** Sets ESP Info lamp permanent light */
-    void set_ESP_INFO_DL(bool value){ raw = (raw & 0xefffffffffffffff) | ((uint64_t)value & 0x1) << 60; }
+    void set_ESP_INFO_DL(bool value){ bytes[0] = (bytes[0] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets ESP Info lamp permanent light */
-    bool get_ESP_INFO_DL() const { return (bool)(raw >> 60 & 0x1); }
+    bool get_ESP_INFO_DL() const { return (bool)(bytes[0] >> 4 & 0x1); }
         
     /** Sets ESP defective control lamp */
-    void set_ESP_KL(bool value){ raw = (raw & 0xf7ffffffffffffff) | ((uint64_t)value & 0x1) << 59; }
+    void set_ESP_KL(bool value){ bytes[0] = (bytes[0] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets ESP defective control lamp */
-    bool get_ESP_KL() const { return (bool)(raw >> 59 & 0x1); }
+    bool get_ESP_KL() const { return (bool)(bytes[0] >> 3 & 0x1); }
         
     /** Sets ABS defective control lamp */
-    void set_ABS_KL(bool value){ raw = (raw & 0xfbffffffffffffff) | ((uint64_t)value & 0x1) << 58; }
+    void set_ABS_KL(bool value){ bytes[0] = (bytes[0] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets ABS defective control lamp */
-    bool get_ABS_KL() const { return (bool)(raw >> 58 & 0x1); }
+    bool get_ABS_KL() const { return (bool)(bytes[0] >> 2 & 0x1); }
         
     /** Sets brake pad wear control lamp */
-    void set_BBV_KL(bool value){ raw = (raw & 0xfeffffffffffffff) | ((uint64_t)value & 0x1) << 56; }
+    void set_BBV_KL(bool value){ bytes[0] = (bytes[0] & 0xfe) | ((uint8_t)value & 0x1) << 0; }
 
     /** Gets brake pad wear control lamp */
-    bool get_BBV_KL() const { return (bool)(raw >> 56 & 0x1); }
+    bool get_BBV_KL() const { return (bool)(bytes[0] >> 0 & 0x1); }
         
     /** Sets Brake light suppression (EBV_KL at 163 / T0 / T1N) */
-    void set_BLS_UNT(bool value){ raw = (raw & 0xff7fffffffffffff) | ((uint64_t)value & 0x1) << 55; }
+    void set_BLS_UNT(bool value){ bytes[1] = (bytes[1] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Brake light suppression (EBV_KL at 163 / T0 / T1N) */
-    bool get_BLS_UNT() const { return (bool)(raw >> 55 & 0x1); }
+    bool get_BLS_UNT() const { return (bool)(bytes[1] >> 7 & 0x1); }
         
     /** Sets BLS Parity (straight parity) */
-    void set_BLS_PA(bool value){ raw = (raw & 0xffbfffffffffffff) | ((uint64_t)value & 0x1) << 54; }
+    void set_BLS_PA(bool value){ bytes[1] = (bytes[1] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets BLS Parity (straight parity) */
-    bool get_BLS_PA() const { return (bool)(raw >> 54 & 0x1); }
+    bool get_BLS_PA() const { return (bool)(bytes[1] >> 6 & 0x1); }
         
     /** Sets Message counter. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_BZ200h(uint8_t value){ raw = (raw & 0xffc3ffffffffffff) | ((uint64_t)value & 0xf) << 50; }
+    void set_BZ200h(uint8_t value){ bytes[1] = (bytes[1] & 0xc3) | ((uint8_t)value & 0xf) << 2; }
 
     /** Gets Message counter. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_BZ200h() const { return (uint8_t)(raw >> 50 & 0xf); }
+    uint8_t get_BZ200h() const { return (uint8_t)(bytes[1] >> 2 & 0xf); }
         
     /** Sets brake light switch */
-    void set_BLS(BS_200h_BLS value){ raw = (raw & 0xfffcffffffffffff) | ((uint64_t)value & 0x3) << 48; }
+    void set_BLS(BS_200h_BLS value){ bytes[1] = (bytes[1] & 0xfc) | ((uint8_t)value & 0x3) << 0; }
 
     /** Gets brake light switch */
-    BS_200h_BLS get_BLS() const { return (BS_200h_BLS)(raw >> 48 & 0x3); }
+    BS_200h_BLS get_BLS() const { return (BS_200h_BLS)(bytes[1] >> 0 & 0x3); }
         
     /** Sets rotary direction wheel front left */
-    void set_DRTGVL(BS_200h_DRTGVL value){ raw = (raw & 0xffff3fffffffffff) | ((uint64_t)value & 0x3) << 46; }
+    void set_DRTGVL(BS_200h_DRTGVL value){ bytes[2] = (bytes[2] & 0x3f) | ((uint8_t)value & 0x3) << 6; }
 
     /** Gets rotary direction wheel front left */
-    BS_200h_DRTGVL get_DRTGVL() const { return (BS_200h_DRTGVL)(raw >> 46 & 0x3); }
+    BS_200h_DRTGVL get_DRTGVL() const { return (BS_200h_DRTGVL)(bytes[2] >> 6 & 0x3); }
         
     /** Sets wheel speed front left. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_DVL(uint16_t value){ raw = (raw & 0xffffc000ffffffff) | ((uint64_t)value & 0x3fff) << 32; }
+    void set_DVL(uint16_t value){ raw = (raw & 0xffffffff00c0ffff) | __builtin_bswap64(((uint64_t)value & 0x3fff) << 32); }
 
     /** Gets wheel speed front left. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_DVL() const { return (uint16_t)(raw >> 32 & 0x3fff); }
+    uint16_t get_DVL() const { return (uint16_t)(__builtin_bswap64(raw) >> 32 & 0x3fff); }
         
     /** Sets direction of rotation wheel front right */
-    void set_DRTGVR(BS_200h_DRTGVR value){ raw = (raw & 0xffffffff3fffffff) | ((uint64_t)value & 0x3) << 30; }
+    void set_DRTGVR(BS_200h_DRTGVR value){ bytes[4] = (bytes[4] & 0x3f) | ((uint8_t)value & 0x3) << 6; }
 
     /** Gets direction of rotation wheel front right */
-    BS_200h_DRTGVR get_DRTGVR() const { return (BS_200h_DRTGVR)(raw >> 30 & 0x3); }
+    BS_200h_DRTGVR get_DRTGVR() const { return (BS_200h_DRTGVR)(bytes[4] >> 6 & 0x3); }
         
     /** Sets Right speed front right. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_DVR(uint16_t value){ raw = (raw & 0xffffffffc000ffff) | ((uint64_t)value & 0x3fff) << 16; }
+    void set_DVR(uint16_t value){ raw = (raw & 0xffff00c0ffffffff) | __builtin_bswap64(((uint64_t)value & 0x3fff) << 16); }
 
     /** Gets Right speed front right. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_DVR() const { return (uint16_t)(raw >> 16 & 0x3fff); }
+    uint16_t get_DVR() const { return (uint16_t)(__builtin_bswap64(raw) >> 16 & 0x3fff); }
         
     /** Sets Rad Left for Cruise */
-    void set_DRTGTM(BS_200h_DRTGTM value){ raw = (raw & 0xffffffffffff3fff) | ((uint64_t)value & 0x3) << 14; }
+    void set_DRTGTM(BS_200h_DRTGTM value){ bytes[6] = (bytes[6] & 0x3f) | ((uint8_t)value & 0x3) << 6; }
 
     /** Gets Rad Left for Cruise */
-    BS_200h_DRTGTM get_DRTGTM() const { return (BS_200h_DRTGTM)(raw >> 14 & 0x3); }
+    BS_200h_DRTGTM get_DRTGTM() const { return (BS_200h_DRTGTM)(bytes[6] >> 6 & 0x3); }
         
     /** Sets wheel speed links for cruise control. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_TM_DL(uint16_t value){ raw = (raw & 0xffffffffffffc000) | ((uint64_t)value & 0x3fff) << 0; }
+    void set_TM_DL(uint16_t value){ raw = (raw & 0x00c0ffffffffffff) | __builtin_bswap64(((uint64_t)value & 0x3fff) << 0); }
 
     /** Gets wheel speed links for cruise control. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_TM_DL() const { return (uint16_t)(raw >> 0 & 0x3fff); }
+    uint16_t get_TM_DL() const { return (uint16_t)(__builtin_bswap64(raw) >> 0 & 0x3fff); }
         
 } BS_200;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of BS_208 */
 	uint32_t get_canid(){ return BS_208_CAN_ID; }
     /** Sets ESP / Art-Wish: "Active Retract" */
-    void set_AKT_R_ESP(bool value){ raw = (raw & 0x7fffffffffffffff) | ((uint64_t)value & 0x1) << 63; }
+    void set_AKT_R_ESP(bool value){ bytes[0] = (bytes[0] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets ESP / Art-Wish: "Active Retract" */
-    bool get_AKT_R_ESP() const { return (bool)(raw >> 63 & 0x1); }
+    bool get_AKT_R_ESP() const { return (bool)(bytes[0] >> 7 & 0x1); }
         
     /** Sets Gear requirement of art */
-    void set_MINMAX_ART(bool value){ raw = (raw & 0xbfffffffffffffff) | ((uint64_t)value & 0x1) << 62; }
+    void set_MINMAX_ART(bool value){ bytes[0] = (bytes[0] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Gear requirement of art */
-    bool get_MINMAX_ART() const { return (bool)(raw >> 62 & 0x1); }
+    bool get_MINMAX_ART() const { return (bool)(bytes[0] >> 6 & 0x1); }
         
     /** Sets Gear, upper limit */
-    void set_GMAX_ESP(BS_208h_GMAX_ESP value){ raw = (raw & 0xc7ffffffffffffff) | ((uint64_t)value & 0x7) << 59; }
+    void set_GMAX_ESP(BS_208h_GMAX_ESP value){ bytes[0] = (bytes[0] & 0xc7) | ((uint8_t)value & 0x7) << 3; }
 
     /** Gets Gear, upper limit */
-    BS_208h_GMAX_ESP get_GMAX_ESP() const { return (BS_208h_GMAX_ESP)(raw >> 59 & 0x7); }
+    BS_208h_GMAX_ESP get_GMAX_ESP() const { return (BS_208h_GMAX_ESP)(bytes[0] >> 3 & 0x7); }
         
     /** Sets Gear, lower limit */
-    void set_GMIN_ESP(BS_208h_GMIN_ESP value){ raw = (raw & 0xf8ffffffffffffff) | ((uint64_t)value & 0x7) << 56; }
+    void set_GMIN_ESP(BS_208h_GMIN_ESP value){ bytes[0] = (bytes[0] & 0xf8) | ((uint8_t)value & 0x7) << 0; }
 
     /** Gets Gear, lower limit */
-    BS_208h_GMIN_ESP get_GMIN_ESP() const { return (BS_208h_GMIN_ESP)(raw >> 56 & 0x7); }
+    BS_208h_GMIN_ESP get_GMIN_ESP() const { return (BS_208h_GMIN_ESP)(bytes[0] >> 0 & 0x7); }
         
     /** Sets Suppression Dynamic fully detection */
-    void set_DDYN_UNT(bool value){ raw = (raw & 0xff7fffffffffffff) | ((uint64_t)value & 0x1) << 55; }
+    void set_DDYN_UNT(bool value){ bytes[1] = (bytes[1] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Suppression Dynamic fully detection */
-    bool get_DDYN_UNT() const { return (bool)(raw >> 55 & 0x1); }
+    bool get_DDYN_UNT() const { return (bool)(bytes[1] >> 7 & 0x1); }
         
     /** Sets system condition */
-    void set_SZS(BS_208h_SZS value){ raw = (raw & 0xff9fffffffffffff) | ((uint64_t)value & 0x3) << 53; }
+    void set_SZS(BS_208h_SZS value){ bytes[1] = (bytes[1] & 0x9f) | ((uint8_t)value & 0x3) << 5; }
 
     /** Gets system condition */
-    BS_208h_SZS get_SZS() const { return (BS_208h_SZS)(raw >> 53 & 0x3); }
+    BS_208h_SZS get_SZS() const { return (BS_208h_SZS)(bytes[1] >> 5 & 0x3); }
         
     /** Sets Tempomat operation */
-    void set_TM_AUS(bool value){ raw = (raw & 0xffefffffffffffff) | ((uint64_t)value & 0x1) << 52; }
+    void set_TM_AUS(bool value){ bytes[1] = (bytes[1] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets Tempomat operation */
-    bool get_TM_AUS() const { return (bool)(raw >> 52 & 0x1); }
+    bool get_TM_AUS() const { return (bool)(bytes[1] >> 4 & 0x1); }
         
     /** Sets Switching Difference ESP */
-    void set_SLV_ESP(BS_208h_SLV_ESP value){ raw = (raw & 0xfff0ffffffffffff) | ((uint64_t)value & 0xf) << 48; }
+    void set_SLV_ESP(BS_208h_SLV_ESP value){ bytes[1] = (bytes[1] & 0xf0) | ((uint8_t)value & 0xf) << 0; }
 
     /** Gets Switching Difference ESP */
-    BS_208h_SLV_ESP get_SLV_ESP() const { return (BS_208h_SLV_ESP)(raw >> 48 & 0xf); }
+    BS_208h_SLV_ESP get_SLV_ESP() const { return (BS_208h_SLV_ESP)(bytes[1] >> 0 & 0xf); }
         
     /** Sets ESP brake engagement active */
-    void set_BRE_AKT_ESP(bool value){ raw = (raw & 0xffff7fffffffffff) | ((uint64_t)value & 0x1) << 47; }
+    void set_BRE_AKT_ESP(bool value){ bytes[2] = (bytes[2] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets ESP brake engagement active */
-    bool get_BRE_AKT_ESP() const { return (bool)(raw >> 47 & 0x1); }
+    bool get_BRE_AKT_ESP() const { return (bool)(bytes[2] >> 7 & 0x1); }
         
     /** Sets ESP request: "N" Insert */
-    void set_ANFN(BS_208h_ANFN value){ raw = (raw & 0xffff9fffffffffff) | ((uint64_t)value & 0x3) << 45; }
+    void set_ANFN(BS_208h_ANFN value){ bytes[2] = (bytes[2] & 0x9f) | ((uint8_t)value & 0x3) << 5; }
 
     /** Gets ESP request: "N" Insert */
-    BS_208h_ANFN get_ANFN() const { return (BS_208h_ANFN)(raw >> 45 & 0x3); }
+    BS_208h_ANFN get_ANFN() const { return (BS_208h_ANFN)(bytes[2] >> 5 & 0x3); }
         
     /** Sets ART brake intervention active */
-    void set_BRE_AKT_ART(bool value){ raw = (raw & 0xffffefffffffffff) | ((uint64_t)value & 0x1) << 44; }
+    void set_BRE_AKT_ART(bool value){ bytes[2] = (bytes[2] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets ART brake intervention active */
-    bool get_BRE_AKT_ART() const { return (bool)(raw >> 44 & 0x1); }
+    bool get_BRE_AKT_ART() const { return (bool)(bytes[2] >> 4 & 0x1); }
         
     /** Sets set braking torque (BR240 factor 1.8 larger). Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_MBRE_ESP(uint16_t value){ raw = (raw & 0xfffff000ffffffff) | ((uint64_t)value & 0xfff) << 32; }
+    void set_MBRE_ESP(uint16_t value){ raw = (raw & 0xffffffff00f0ffff) | __builtin_bswap64(((uint64_t)value & 0xfff) << 32); }
 
     /** Gets set braking torque (BR240 factor 1.8 larger). Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_MBRE_ESP() const { return (uint16_t)(raw >> 32 & 0xfff); }
+    uint16_t get_MBRE_ESP() const { return (uint16_t)(__builtin_bswap64(raw) >> 32 & 0xfff); }
         
     /** Sets rotary direction wheel rear right */
-    void set_DRTGHR(BS_208h_DRTGHR value){ raw = (raw & 0xffffffff3fffffff) | ((uint64_t)value & 0x3) << 30; }
+    void set_DRTGHR(BS_208h_DRTGHR value){ bytes[4] = (bytes[4] & 0x3f) | ((uint8_t)value & 0x3) << 6; }
 
     /** Gets rotary direction wheel rear right */
-    BS_208h_DRTGHR get_DRTGHR() const { return (BS_208h_DRTGHR)(raw >> 30 & 0x3); }
+    BS_208h_DRTGHR get_DRTGHR() const { return (BS_208h_DRTGHR)(bytes[4] >> 6 & 0x3); }
         
     /** Sets Rear wheel speed. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_DHR(uint16_t value){ raw = (raw & 0xffffffffc000ffff) | ((uint64_t)value & 0x3fff) << 16; }
+    void set_DHR(uint16_t value){ raw = (raw & 0xffff00c0ffffffff) | __builtin_bswap64(((uint64_t)value & 0x3fff) << 16); }
 
     /** Gets Rear wheel speed. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_DHR() const { return (uint16_t)(raw >> 16 & 0x3fff); }
+    uint16_t get_DHR() const { return (uint16_t)(__builtin_bswap64(raw) >> 16 & 0x3fff); }
         
     /** Sets rotary direction wheel rear left */
-    void set_DRTGHL(BS_208h_DRTGHL value){ raw = (raw & 0xffffffffffff3fff) | ((uint64_t)value & 0x3) << 14; }
+    void set_DRTGHL(BS_208h_DRTGHL value){ bytes[6] = (bytes[6] & 0x3f) | ((uint8_t)value & 0x3) << 6; }
 
     /** Gets rotary direction wheel rear left */
-    BS_208h_DRTGHL get_DRTGHL() const { return (BS_208h_DRTGHL)(raw >> 14 & 0x3); }
+    BS_208h_DRTGHL get_DRTGHL() const { return (BS_208h_DRTGHL)(bytes[6] >> 6 & 0x3); }
         
     /** Sets Rear wheel speed. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_DHL(uint16_t value){ raw = (raw & 0xffffffffffffc000) | ((uint64_t)value & 0x3fff) << 0; }
+    void set_DHL(uint16_t value){ raw = (raw & 0x00c0ffffffffffff) | __builtin_bswap64(((uint64_t)value & 0x3fff) << 0); }
 
     /** Gets Rear wheel speed. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_DHL() const { return (uint16_t)(raw >> 0 & 0x3fff); }
+    uint16_t get_DHL() const { return (uint16_t)(__builtin_bswap64(raw) >> 0 & 0x3fff); }
         
 } BS_208;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of BS_270 */
 	uint32_t get_canid(){ return BS_270_CAN_ID; }
     /** Sets Impulse ring counter wheel rear left (48 per revolution). Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_RIZ_HL(uint8_t value){ raw = (raw & 0x00ffffffffffffff) | ((uint64_t)value & 0xff) << 56; }
+    void set_RIZ_HL(uint8_t value){ bytes[0] = (bytes[0] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Impulse ring counter wheel rear left (48 per revolution). Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_RIZ_HL() const { return (uint8_t)(raw >> 56 & 0xff); }
+    uint8_t get_RIZ_HL() const { return (uint8_t)(bytes[0] >> 0 & 0xff); }
         
     /** Sets Impulse ring counter wheel rear right (48 per revolution). Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_RIZ_HR(uint8_t value){ raw = (raw & 0xff00ffffffffffff) | ((uint64_t)value & 0xff) << 48; }
+    void set_RIZ_HR(uint8_t value){ bytes[1] = (bytes[1] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Impulse ring counter wheel rear right (48 per revolution). Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_RIZ_HR() const { return (uint8_t)(raw >> 48 & 0xff); }
+    uint8_t get_RIZ_HR() const { return (uint8_t)(bytes[1] >> 0 & 0xff); }
         
     /** Sets Alerts PlatRollwarner */
-    void set_PRW_WARN(BS_270h_PRW_WARN value){ raw = (raw & 0xffff0fffffffffff) | ((uint64_t)value & 0xf) << 44; }
+    void set_PRW_WARN(BS_270h_PRW_WARN value){ bytes[2] = (bytes[2] & 0x0f) | ((uint8_t)value & 0xf) << 4; }
 
     /** Gets Alerts PlatRollwarner */
-    BS_270h_PRW_WARN get_PRW_WARN() const { return (BS_270h_PRW_WARN)(raw >> 44 & 0xf); }
+    BS_270h_PRW_WARN get_PRW_WARN() const { return (BS_270h_PRW_WARN)(bytes[2] >> 4 & 0xf); }
         
     /** Sets Status flat tyre warner */
-    void set_PRW_ST(BS_270h_PRW_ST value){ raw = (raw & 0xfffff8ffffffffff) | ((uint64_t)value & 0x7) << 40; }
+    void set_PRW_ST(BS_270h_PRW_ST value){ bytes[2] = (bytes[2] & 0xf8) | ((uint8_t)value & 0x7) << 0; }
 
     /** Gets Status flat tyre warner */
-    BS_270h_PRW_ST get_PRW_ST() const { return (BS_270h_PRW_ST)(raw >> 40 & 0x7); }
+    BS_270h_PRW_ST get_PRW_ST() const { return (BS_270h_PRW_ST)(bytes[2] >> 0 & 0x7); }
         
 } BS_270;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of BS_300 */
 	uint32_t get_canid(){ return BS_300_CAN_ID; }
     /** Sets Engine torque Request Parity (just parity) */
-    void set_DMPAR_ART(bool value){ raw = (raw & 0x7fffffffffffffff) | ((uint64_t)value & 0x1) << 63; }
+    void set_DMPAR_ART(bool value){ bytes[0] = (bytes[0] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Engine torque Request Parity (just parity) */
-    bool get_DMPAR_ART() const { return (bool)(raw >> 63 & 0x1); }
+    bool get_DMPAR_ART() const { return (bool)(bytes[0] >> 7 & 0x1); }
         
     /** Sets Engine torque request dynamic */
-    void set_DMDYN_ART(bool value){ raw = (raw & 0xbfffffffffffffff) | ((uint64_t)value & 0x1) << 62; }
+    void set_DMDYN_ART(bool value){ bytes[0] = (bytes[0] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Engine torque request dynamic */
-    bool get_DMDYN_ART() const { return (bool)(raw >> 62 & 0x1); }
+    bool get_DMDYN_ART() const { return (bool)(bytes[0] >> 6 & 0x1); }
         
     /** Sets Bas-control active */
-    void set_BAS_AKT(bool value){ raw = (raw & 0xdfffffffffffffff) | ((uint64_t)value & 0x1) << 61; }
+    void set_BAS_AKT(bool value){ bytes[0] = (bytes[0] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Bas-control active */
-    bool get_BAS_AKT() const { return (bool)(raw >> 61 & 0x1); }
+    bool get_BAS_AKT() const { return (bool)(bytes[0] >> 5 & 0x1); }
         
     /** Sets full braking (ABS regulates all 4 wheels) */
-    void set_VOLLBRE(bool value){ raw = (raw & 0xefffffffffffffff) | ((uint64_t)value & 0x1) << 60; }
+    void set_VOLLBRE(bool value){ bytes[0] = (bytes[0] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets full braking (ABS regulates all 4 wheels) */
-    bool get_VOLLBRE() const { return (bool)(raw >> 60 & 0x1); }
+    bool get_VOLLBRE() const { return (bool)(bytes[0] >> 4 & 0x1); }
         
     /** Sets Enable Art */
-    void set_ART_E(bool value){ raw = (raw & 0xf7ffffffffffffff) | ((uint64_t)value & 0x1) << 59; }
+    void set_ART_E(bool value){ bytes[0] = (bytes[0] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Enable Art */
-    bool get_ART_E() const { return (bool)(raw >> 59 & 0x1); }
+    bool get_ART_E() const { return (bool)(bytes[0] >> 3 & 0x1); }
         
     /** Sets ESP giermom control active */
-    void set_ESP_GIER_AKT(bool value){ raw = (raw & 0xfbffffffffffffff) | ((uint64_t)value & 0x1) << 58; }
+    void set_ESP_GIER_AKT(bool value){ bytes[0] = (bytes[0] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets ESP giermom control active */
-    bool get_ESP_GIER_AKT() const { return (bool)(raw >> 58 & 0x1); }
+    bool get_ESP_GIER_AKT() const { return (bool)(bytes[0] >> 2 & 0x1); }
         
     /** Sets Initialization Steering Angle Sensor O.K. */
-    void set_LWS_INI_OK(bool value){ raw = (raw & 0xfdffffffffffffff) | ((uint64_t)value & 0x1) << 57; }
+    void set_LWS_INI_OK(bool value){ bytes[0] = (bytes[0] & 0xfd) | ((uint8_t)value & 0x1) << 1; }
 
     /** Gets Initialization Steering Angle Sensor O.K. */
-    bool get_LWS_INI_OK() const { return (bool)(raw >> 57 & 0x1); }
+    bool get_LWS_INI_OK() const { return (bool)(bytes[0] >> 1 & 0x1); }
         
     /** Sets Initialization steering angle sensor possible */
-    void set_LWS_INI_EIN(bool value){ raw = (raw & 0xfeffffffffffffff) | ((uint64_t)value & 0x1) << 56; }
+    void set_LWS_INI_EIN(bool value){ bytes[0] = (bytes[0] & 0xfe) | ((uint8_t)value & 0x1) << 0; }
 
     /** Gets Initialization steering angle sensor possible */
-    bool get_LWS_INI_EIN() const { return (bool)(raw >> 56 & 0x1); }
+    bool get_LWS_INI_EIN() const { return (bool)(bytes[0] >> 0 & 0x1); }
         
     /** Sets Engine torque Request Parity (just parity) */
-    void set_MPAR_ESP(bool value){ raw = (raw & 0xff7fffffffffffff) | ((uint64_t)value & 0x1) << 55; }
+    void set_MPAR_ESP(bool value){ bytes[1] = (bytes[1] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Engine torque Request Parity (just parity) */
-    bool get_MPAR_ESP() const { return (bool)(raw >> 55 & 0x1); }
+    bool get_MPAR_ESP() const { return (bool)(bytes[1] >> 7 & 0x1); }
         
     /** Sets Engine torque request dynamic */
-    void set_MDYN_ESP(bool value){ raw = (raw & 0xffbfffffffffffff) | ((uint64_t)value & 0x1) << 54; }
+    void set_MDYN_ESP(bool value){ bytes[1] = (bytes[1] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Engine torque request dynamic */
-    bool get_MDYN_ESP() const { return (bool)(raw >> 54 & 0x1); }
+    bool get_MDYN_ESP() const { return (bool)(bytes[1] >> 6 & 0x1); }
         
     /** Sets drive torque control active */
-    void set_AMR_AKT_ESP(bool value){ raw = (raw & 0xffdfffffffffffff) | ((uint64_t)value & 0x1) << 53; }
+    void set_AMR_AKT_ESP(bool value){ bytes[1] = (bytes[1] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets drive torque control active */
-    bool get_AMR_AKT_ESP() const { return (bool)(raw >> 53 & 0x1); }
+    bool get_AMR_AKT_ESP() const { return (bool)(bytes[1] >> 5 & 0x1); }
         
     /** Sets Send cycle time */
-    void set_T_Z(BS_300h_T_Z value){ raw = (raw & 0xffe7ffffffffffff) | ((uint64_t)value & 0x3) << 51; }
+    void set_T_Z(BS_300h_T_Z value){ bytes[1] = (bytes[1] & 0xe7) | ((uint8_t)value & 0x3) << 3; }
 
     /** Gets Send cycle time */
-    BS_300h_T_Z get_T_Z() const { return (BS_300h_T_Z)(raw >> 51 & 0x3); }
+    BS_300h_T_Z get_T_Z() const { return (BS_300h_T_Z)(bytes[1] >> 3 & 0x3); }
         
     /** Sets driver brakes parity (straight parity) */
-    void set_SFB_PA(bool value){ raw = (raw & 0xfffbffffffffffff) | ((uint64_t)value & 0x1) << 50; }
+    void set_SFB_PA(bool value){ bytes[1] = (bytes[1] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets driver brakes parity (straight parity) */
-    bool get_SFB_PA() const { return (bool)(raw >> 50 & 0x1); }
+    bool get_SFB_PA() const { return (bool)(bytes[1] >> 2 & 0x1); }
         
     /** Sets driver brakes */
-    void set_SFB(BS_300h_SFB value){ raw = (raw & 0xfffcffffffffffff) | ((uint64_t)value & 0x3) << 48; }
+    void set_SFB(BS_300h_SFB value){ bytes[1] = (bytes[1] & 0xfc) | ((uint8_t)value & 0x3) << 0; }
 
     /** Gets driver brakes */
-    BS_300h_SFB get_SFB() const { return (BS_300h_SFB)(raw >> 48 & 0x3); }
+    BS_300h_SFB get_SFB() const { return (BS_300h_SFB)(bytes[1] >> 0 & 0x3); }
         
     /** Sets Motor torque toggle 40ms + -10 */
-    void set_DMTGL_ART(bool value){ raw = (raw & 0xffff7fffffffffff) | ((uint64_t)value & 0x1) << 47; }
+    void set_DMTGL_ART(bool value){ bytes[2] = (bytes[2] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Motor torque toggle 40ms + -10 */
-    bool get_DMTGL_ART() const { return (bool)(raw >> 47 & 0x1); }
+    bool get_DMTGL_ART() const { return (bool)(bytes[2] >> 7 & 0x1); }
         
     /** Sets Engine torque request min */
-    void set_DMMIN_ART(bool value){ raw = (raw & 0xffffbfffffffffff) | ((uint64_t)value & 0x1) << 46; }
+    void set_DMMIN_ART(bool value){ bytes[2] = (bytes[2] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Engine torque request min */
-    bool get_DMMIN_ART() const { return (bool)(raw >> 46 & 0x1); }
+    bool get_DMMIN_ART() const { return (bool)(bytes[2] >> 6 & 0x1); }
         
     /** Sets Engine torque request max */
-    void set_DMMAX_ART(bool value){ raw = (raw & 0xffffdfffffffffff) | ((uint64_t)value & 0x1) << 45; }
+    void set_DMMAX_ART(bool value){ bytes[2] = (bytes[2] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Engine torque request max */
-    bool get_DMMAX_ART() const { return (bool)(raw >> 45 & 0x1); }
+    bool get_DMMAX_ART() const { return (bool)(bytes[2] >> 5 & 0x1); }
         
     /** Sets Ford.Engine torque. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_DM_ART(uint16_t value){ raw = (raw & 0xffffe000ffffffff) | ((uint64_t)value & 0x1fff) << 32; }
+    void set_DM_ART(uint16_t value){ raw = (raw & 0xffffffff00e0ffff) | __builtin_bswap64(((uint64_t)value & 0x1fff) << 32); }
 
     /** Gets Ford.Engine torque. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_DM_ART() const { return (uint16_t)(raw >> 32 & 0x1fff); }
+    uint16_t get_DM_ART() const { return (uint16_t)(__builtin_bswap64(raw) >> 32 & 0x1fff); }
         
     /** Sets Motor torque toggle 40ms + -10 */
-    void set_MTGL_ESP(bool value){ raw = (raw & 0xffffffff7fffffff) | ((uint64_t)value & 0x1) << 31; }
+    void set_MTGL_ESP(bool value){ bytes[4] = (bytes[4] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Motor torque toggle 40ms + -10 */
-    bool get_MTGL_ESP() const { return (bool)(raw >> 31 & 0x1); }
+    bool get_MTGL_ESP() const { return (bool)(bytes[4] >> 7 & 0x1); }
         
     /** Sets Engine torque request min */
-    void set_MMIN_ESP(bool value){ raw = (raw & 0xffffffffbfffffff) | ((uint64_t)value & 0x1) << 30; }
+    void set_MMIN_ESP(bool value){ bytes[4] = (bytes[4] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Engine torque request min */
-    bool get_MMIN_ESP() const { return (bool)(raw >> 30 & 0x1); }
+    bool get_MMIN_ESP() const { return (bool)(bytes[4] >> 6 & 0x1); }
         
     /** Sets Engine torque request max */
-    void set_MMAX_ESP(bool value){ raw = (raw & 0xffffffffdfffffff) | ((uint64_t)value & 0x1) << 29; }
+    void set_MMAX_ESP(bool value){ bytes[4] = (bytes[4] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Engine torque request max */
-    bool get_MMAX_ESP() const { return (bool)(raw >> 29 & 0x1); }
+    bool get_MMAX_ESP() const { return (bool)(bytes[4] >> 5 & 0x1); }
         
     /** Sets Ford.Engine torque. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_M_ESP(uint16_t value){ raw = (raw & 0xffffffffe000ffff) | ((uint64_t)value & 0x1fff) << 16; }
+    void set_M_ESP(uint16_t value){ raw = (raw & 0xffff00e0ffffffff) | __builtin_bswap64(((uint64_t)value & 0x1fff) << 16); }
 
     /** Gets Ford.Engine torque. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_M_ESP() const { return (uint16_t)(raw >> 16 & 0x1fff); }
+    uint16_t get_M_ESP() const { return (uint16_t)(__builtin_bswap64(raw) >> 16 & 0x1fff); }
         
     /** Sets raw signal yaw rate without reconciliation / filtering (+ = left). Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_GIER_ROH(uint16_t value){ raw = (raw & 0xffffffffffff0000) | ((uint64_t)value & 0xffff) << 0; }
+    void set_GIER_ROH(uint16_t value){ raw = (raw & 0x0000ffffffffffff) | __builtin_bswap64(((uint64_t)value & 0xffff) << 0); }
 
     /** Gets raw signal yaw rate without reconciliation / filtering (+ = left). Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_GIER_ROH() const { return (uint16_t)(raw >> 0 & 0xffff); }
+    uint16_t get_GIER_ROH() const { return (uint16_t)(__builtin_bswap64(raw) >> 0 & 0xffff); }
         
 } BS_300;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of BS_328 */
 	uint32_t get_canid(){ return BS_328_CAN_ID; }
     /** Sets WMS Parity (straight parity) */
-    void set_WMS_PA(bool value){ raw = (raw & 0x7fffffffffffffff) | ((uint64_t)value & 0x1) << 63; }
+    void set_WMS_PA(bool value){ bytes[0] = (bytes[0] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets WMS Parity (straight parity) */
-    bool get_WMS_PA() const { return (bool)(raw >> 63 & 0x1); }
+    bool get_WMS_PA() const { return (bool)(bytes[0] >> 7 & 0x1); }
         
     /** Sets target wobble moment change. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_WMS(uint16_t value){ raw = (raw & 0x8000ffffffffffff) | ((uint64_t)value & 0x7fff) << 48; }
+    void set_WMS(uint16_t value){ raw = (raw & 0xffffffffffff0080) | __builtin_bswap64(((uint64_t)value & 0x7fff) << 48); }
 
     /** Gets target wobble moment change. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_WMS() const { return (uint16_t)(raw >> 48 & 0x7fff); }
+    uint16_t get_WMS() const { return (uint16_t)(__builtin_bswap64(raw) >> 48 & 0x7fff); }
         
     /** Sets Vehicle lateral acceleration. The focus (+ = left). Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_AY_S(uint8_t value){ raw = (raw & 0xffff00ffffffffff) | ((uint64_t)value & 0xff) << 40; }
+    void set_AY_S(uint8_t value){ bytes[2] = (bytes[2] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Vehicle lateral acceleration. The focus (+ = left). Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_AY_S() const { return (uint8_t)(raw >> 40 & 0xff); }
+    uint8_t get_AY_S() const { return (uint8_t)(bytes[2] >> 0 & 0xff); }
         
     /** Sets ESP display messages */
-    void set_ESP_DSPL(BS_328h_ESP_DSPL value){ raw = (raw & 0xffffffffe0ffffff) | ((uint64_t)value & 0x1f) << 24; }
+    void set_ESP_DSPL(BS_328h_ESP_DSPL value){ bytes[4] = (bytes[4] & 0xe0) | ((uint8_t)value & 0x1f) << 0; }
 
     /** Gets ESP display messages */
-    BS_328h_ESP_DSPL get_ESP_DSPL() const { return (BS_328h_ESP_DSPL)(raw >> 24 & 0x1f); }
+    BS_328h_ESP_DSPL get_ESP_DSPL() const { return (BS_328h_ESP_DSPL)(bytes[4] >> 0 & 0x1f); }
         
     /** Sets Emergency braking (brake light blink) */
-    void set_NOTBRE(bool value){ raw = (raw & 0xffffffffffbfffff) | ((uint64_t)value & 0x1) << 22; }
+    void set_NOTBRE(bool value){ bytes[5] = (bytes[5] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Emergency braking (brake light blink) */
-    bool get_NOTBRE() const { return (bool)(raw >> 22 & 0x1); }
+    bool get_NOTBRE() const { return (bool)(bytes[5] >> 6 & 0x1); }
         
     /** Sets Open clutch */
-    void set_KPL_OEF(bool value){ raw = (raw & 0xfffffffffff7ffff) | ((uint64_t)value & 0x1) << 19; }
+    void set_KPL_OEF(bool value){ bytes[5] = (bytes[5] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Open clutch */
-    bool get_KPL_OEF() const { return (bool)(raw >> 19 & 0x1); }
+    bool get_KPL_OEF() const { return (bool)(bytes[5] >> 3 & 0x1); }
         
     /** Sets Message counter. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_BZ328h(uint8_t value){ raw = (raw & 0xfffffffffff8ffff) | ((uint64_t)value & 0x7) << 16; }
+    void set_BZ328h(uint8_t value){ bytes[5] = (bytes[5] & 0xf8) | ((uint8_t)value & 0x7) << 0; }
 
     /** Gets Message counter. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_BZ328h() const { return (uint8_t)(raw >> 16 & 0x7); }
+    uint8_t get_BZ328h() const { return (uint8_t)(bytes[5] >> 0 & 0x7); }
         
     /** Sets Impulse ring counter wheel front left (48 per revolution). Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_RIZ_VL(uint8_t value){ raw = (raw & 0xffffffffffff00ff) | ((uint64_t)value & 0xff) << 8; }
+    void set_RIZ_VL(uint8_t value){ bytes[6] = (bytes[6] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Impulse ring counter wheel front left (48 per revolution). Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_RIZ_VL() const { return (uint8_t)(raw >> 8 & 0xff); }
+    uint8_t get_RIZ_VL() const { return (uint8_t)(bytes[6] >> 0 & 0xff); }
         
     /** Sets Impulse ring counter wheel front right (48 per revolution). Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_RIZ_VR(uint8_t value){ raw = (raw & 0xffffffffffffff00) | ((uint64_t)value & 0xff) << 0; }
+    void set_RIZ_VR(uint8_t value){ bytes[7] = (bytes[7] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Impulse ring counter wheel front right (48 per revolution). Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_RIZ_VR() const { return (uint8_t)(raw >> 0 & 0xff); }
+    uint8_t get_RIZ_VR() const { return (uint8_t)(bytes[7] >> 0 & 0xff); }
         
 } BS_328;
 
@@ -671,130 +678,121 @@ class ECU_ESP_SBC {
         /**
          * @brief Imports the CAN frame given the CAN ID, CAN Contents, and current timestamp
          *
-         * Returns true if the frame was imported successfully, and false if import failed (Due to non-matching CAN ID).
+         * Returns true if the frame was imported successfully, and false if import failed (Due to non-matching CAN ID,
+         * or the frame failing validation).
          *
-         * NOTE: The endianness of the value cannot be guaranteed. It is up to the caller to correct the byte order!
+         * 'value' is the CAN payload in wire order, as copied straight out of the CAN controller's data buffer
          */
         bool import_frames(uint64_t value, uint32_t can_id, uint64_t timestamp_now) {
             switch(can_id) {
                 case BS_200_CAN_ID:
-                    LAST_FRAME_TIMES[0] = timestamp_now;
-                    FRAME_DATA[0] = value;
-                    return true;
-                case BS_208_CAN_ID:
-                    LAST_FRAME_TIMES[1] = timestamp_now;
-                    FRAME_DATA[1] = value;
-                    return true;
-                case BS_270_CAN_ID:
-                    LAST_FRAME_TIMES[2] = timestamp_now;
-                    FRAME_DATA[2] = value;
-                    return true;
-                case BS_300_CAN_ID:
-                    LAST_FRAME_TIMES[3] = timestamp_now;
-                    FRAME_DATA[3] = value;
-                    return true;
-                case BS_328_CAN_ID:
-                    LAST_FRAME_TIMES[4] = timestamp_now;
-                    FRAME_DATA[4] = value;
-                    return true;
+                    return import_frame_at(0, value, timestamp_now) == FrameCheckResult::Ok;
                 default:
                     return false;
             }
         }
-        
-        /** Sets data in pointer to BS_200
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_BS_200(uint64_t now, uint64_t max_expire_time, BS_200* dest) const {
-            if (LAST_FRAME_TIMES[0] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[0] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[0];
-                return true;
+
+        /**
+         * @brief Imports the CAN frame directly into storage slot 'slot', as returned by the
+         * generated RX dispatch table. This skips the CAN ID switch entirely.
+         *
+         * A frame that fails validation of its message counter, toggle or parity signals is not stored
+         * (And is counted in its arrival statistics), and the reason is returned.
+         *
+         * 'value' is the CAN payload in wire order, as copied straight out of the CAN controller's data buffer
+         */
+        FrameCheckResult import_frame_at(uint8_t slot, uint64_t value, uint64_t timestamp_now) {
+            FrameCheckResult res = check_frame_at(slot, value, timestamp_now);
+            if (res != FrameCheckResult::Ok) {
+                reject_frame_at(slot);
+                return res;
             }
+            FRAMES[slot].write(EcuFrame { .data = value, .timestamp = timestamp_now });
+            update_arrival_stats(&RX_STATS[slot], timestamp_now);
+            STATS[slot].write(RX_STATS[slot]);
+            return FrameCheckResult::Ok;
         }
-            
-        /** Sets data in pointer to BS_208
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_BS_208(uint64_t now, uint64_t max_expire_time, BS_208* dest) const {
-            if (LAST_FRAME_TIMES[1] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[1] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[1];
-                return true;
-            }
+
+        /**
+         * Counts a frame in storage slot 'slot' that failed a check made outside this class (Such as a CRC).
+         * Only call from the CAN Rx task
+         */
+        void reject_frame_at(uint8_t slot) {
+            RX_STATS[slot].rejected_count++;
+            STATS[slot].write(RX_STATS[slot]);
         }
-            
-        /** Sets data in pointer to BS_270
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_BS_270(uint64_t now, uint64_t max_expire_time, BS_270* dest) const {
-            if (LAST_FRAME_TIMES[2] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[2] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[2];
-                return true;
-            }
+
+        /** Returns the number of frames stored by this ECU (Only the frames the TCM reads) */
+        uint8_t get_num_frames() const {
+            return NUM_FRAMES;
         }
-            
-        /** Sets data in pointer to BS_300
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_BS_300(uint64_t now, uint64_t max_expire_time, BS_300* dest) const {
-            if (LAST_FRAME_TIMES[3] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[3] > max_expire_time) { // CAN Frame has not refreshed in valid interval
+
+        /**
+         * Copies the arrival statistics of the frame in storage slot 'slot' to 'dest'. Safe to call from any task.
+         *
+         * Returns false if 'slot' is out of range.
+         */
+        bool get_frame_stats_at(uint8_t slot, FrameArrivalStats* dest) const {
+            if (slot >= NUM_FRAMES || dest == nullptr) {
                 return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[3];
-                return true;
             }
+            STATS[slot].read(dest);
+            dest->stale_count = STALE[slot].count.load(std::memory_order_relaxed);
+            return true;
         }
-            
-        /** Sets data in pointer to BS_328
+        
+        /** Sets data in pointer to BS_200
           * 
           * If this function returns false, then the CAN Frame is invalid or has not been seen
           * on the CANBUS network yet. Meaning it's data cannot be used.
           *
           * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
           */
-        bool get_BS_328(uint64_t now, uint64_t max_expire_time, BS_328* dest) const {
-            if (LAST_FRAME_TIMES[4] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
+        bool get_BS_200(uint64_t now, uint64_t max_expire_time, BS_200* dest) const {
+            EcuFrame f;
+            uint32_t seq = FRAMES[0].read(&f); // Data and timestamp are always from the same frame
+            if (f.timestamp == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
                 return false;
-            } else if (now - LAST_FRAME_TIMES[4] > max_expire_time) { // CAN Frame has not refreshed in valid interval
+            } else if (now > f.timestamp && now - f.timestamp > max_expire_time) { // CAN Frame has not refreshed in valid interval
+                mark_frame_stale(&STALE[0], seq);
                 return false;
             } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[4];
+                dest->raw = f.data;
                 return true;
             }
         }
             
 	private:
-		uint64_t FRAME_DATA[5];
-		uint64_t LAST_FRAME_TIMES[5];
+        /**
+         * Checks the message counter, toggle and parity signals of a frame for storage slot 'slot'.
+         * Only call from the CAN Rx task
+         */
+        FrameCheckResult check_frame_at(uint8_t slot, uint64_t value, uint64_t timestamp_now) {
+            switch(slot) {
+                case 0: // BS_200
+                    if (!frame_parity_ok(value, 0x0000000000004300ULL)) { // BLS_PA over BLS
+                        return FrameCheckResult::Parity;
+                    }
+                    return frame_sequence_check(&CHECKS[0], value, 0x0000000000003C00ULL, 0x0000000000000000ULL, timestamp_now);
+                default:
+                    return FrameCheckResult::Ok;
+            }
+        }
+
+		typedef struct {
+			uint64_t data;
+			uint64_t timestamp;
+		} EcuFrame;
+		// Written by the CAN Rx task, read by any other task
+		Seqlock<EcuFrame> FRAMES[1];
+		// Arrival statistics. Only touched by the CAN Rx task, which publishes them to STATS
+		FrameArrivalStats RX_STATS[1] = {};
+		Seqlock<FrameArrivalStats> STATS[1];
+		// Staleness, counted by the getters from any task
+		mutable FrameStaleCounter STALE[1] = {};
+		// Message counter / toggle state of the frames that have them. Only touched by the CAN Rx task
+		FrameCheckState CHECKS[1] = {};
+		static const uint8_t NUM_FRAMES = 1;
 };
 #endif // __ECU_ESP_SBC_H_
 
@@ -14,6 +14,13 @@
 #define __ECU_EWM_H_
 
 #include <stdint.h>
+#include "seqlock.h"
+#include "ecu_frame_stats.h"
+#include "ecu_frame_check.h"
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+    #error "Generated CAN frame accessors assume a little endian CPU"
+#endif
     
 #define EWM_230_CAN_ID 0x0230
 
@@ -34,40 +41,40 @@ enum class EWM_230h_WHC {
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of EWM_230 */
 	uint32_t get_canid(){ return EWM_230_CAN_ID; }
     /** Sets Driving program */
-    void set_W_S(bool value){ raw = (raw & 0x7fffffffffffffff) | ((uint64_t)value & 0x1) << 63; }
+    void set_W_S(bool value){ bytes[0] = (bytes[0] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Driving program */
-    bool get_W_S() const { return (bool)(raw >> 63 & 0x1); }
+    bool get_W_S() const { return (bool)(bytes[0] >> 7 & 0x1); }
         
     /** Sets Driving program button actuated */
-    void set_FPT(bool value){ raw = (raw & 0xbfffffffffffffff) | ((uint64_t)value & 0x1) << 62; }
+    void set_FPT(bool value){ bytes[0] = (bytes[0] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Driving program button actuated */
-    bool get_FPT() const { return (bool)(raw >> 62 & 0x1); }
+    bool get_FPT() const { return (bool)(bytes[0] >> 6 & 0x1); }
         
     /** Sets Kickdown */
-    void set_KD(bool value){ raw = (raw & 0xdfffffffffffffff) | ((uint64_t)value & 0x1) << 61; }
+    void set_KD(bool value){ bytes[0] = (bytes[0] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Kickdown */
-    bool get_KD() const { return (bool)(raw >> 61 & 0x1); }
+    bool get_KD() const { return (bool)(bytes[0] >> 5 & 0x1); }
         
     /** Sets barrier magnet energized */
-    void set_SPERR(bool value){ raw = (raw & 0xefffffffffffffff) | ((uint64_t)value & 0x1) << 60; }
+    void set_SPERR(bool value){ bytes[0] = (bytes[0] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets barrier magnet energized */
-    bool get_SPERR() const { return (bool)(raw >> 60 & 0x1); }
+    bool get_SPERR() const { return (bool)(bytes[0] >> 4 & 0x1); }
         
     /** Sets gear selector lever position (NAG only) */
-    void set_WHC(EWM_230h_WHC value){ raw = (raw & 0xf0ffffffffffffff) | ((uint64_t)value & 0xf) << 56; }
+    void set_WHC(EWM_230h_WHC value){ bytes[0] = (bytes[0] & 0xf0) | ((uint8_t)value & 0xf) << 0; }
 
     /** Gets gear selector lever position (NAG only) */
-    EWM_230h_WHC get_WHC() const { return (EWM_230h_WHC)(raw >> 56 & 0xf); }
+    EWM_230h_WHC get_WHC() const { return (EWM_230h_WHC)(bytes[0] >> 0 & 0xf); }
         
 } EWM_230;
 
@@ -78,20 +85,63 @@ class ECU_EWM {
         /**
          * @brief Imports the CAN frame given the CAN ID, CAN Contents, and current timestamp
          *
-         * Returns true if the frame was imported successfully, and false if import failed (Due to non-matching CAN ID).
+         * Returns true if the frame was imported successfully, and false if import failed (Due to non-matching CAN ID,
+         * or the frame failing validation).
          *
-         * NOTE: The endianness of the value cannot be guaranteed. It is up to the caller to correct the byte order!
+         * 'value' is the CAN payload in wire order, as copied straight out of the CAN controller's data buffer
          */
         bool import_frames(uint64_t value, uint32_t can_id, uint64_t timestamp_now) {
             switch(can_id) {
                 case EWM_230_CAN_ID:
-                    LAST_FRAME_TIMES[0] = timestamp_now;
-                    FRAME_DATA[0] = value;
-                    return true;
+                    return import_frame_at(0, value, timestamp_now) == FrameCheckResult::Ok;
                 default:
                     return false;
             }
         }
+
+        /**
+         * @brief Imports the CAN frame directly into storage slot 'slot', as returned by the
+         * generated RX dispatch table. This skips the CAN ID switch entirely.
+         *
+         * A frame that fails validation of its message counter, toggle or parity signals is not stored
+         * (And is counted in its arrival statistics), and the reason is returned.
+         *
+         * 'value' is the CAN payload in wire order, as copied straight out of the CAN controller's data buffer
+         */
+        FrameCheckResult import_frame_at(uint8_t slot, uint64_t value, uint64_t timestamp_now) {
+            FRAMES[slot].write(EcuFrame { .data = value, .timestamp = timestamp_now });
+            update_arrival_stats(&RX_STATS[slot], timestamp_now);
+            STATS[slot].write(RX_STATS[slot]);
+            return FrameCheckResult::Ok;
+        }
+
+        /**
+         * Counts a frame in storage slot 'slot' that failed a check made outside this class (Such as a CRC).
+         * Only call from the CAN Rx task
+         */
+        void reject_frame_at(uint8_t slot) {
+            RX_STATS[slot].rejected_count++;
+            STATS[slot].write(RX_STATS[slot]);
+        }
+
+        /** Returns the number of frames stored by this ECU (Only the frames the TCM reads) */
+        uint8_t get_num_frames() const {
+            return NUM_FRAMES;
+        }
+
+        /**
+         * Copies the arrival statistics of the frame in storage slot 'slot' to 'dest'. Safe to call from any task.
+         *
+         * Returns false if 'slot' is out of range.
+         */
+        bool get_frame_stats_at(uint8_t slot, FrameArrivalStats* dest) const {
+            if (slot >= NUM_FRAMES || dest == nullptr) {
+                return false;
+            }
+            STATS[slot].read(dest);
+            dest->stale_count = STALE[slot].count.load(std::memory_order_relaxed);
+            return true;
+        }
         
         /** Sets data in pointer to EWM_230
           * 
@@ -101,19 +151,32 @@ class ECU_EWM {
           * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
           */
         bool get_EWM_230(uint64_t now, uint64_t max_expire_time, EWM_230* dest) const {
-            if (LAST_FRAME_TIMES[0] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
+            EcuFrame f;
+            uint32_t seq = FRAMES[0].read(&f); // Data and timestamp are always from the same frame
+            if (f.timestamp == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
                 return false;
-            } else if (now - LAST_FRAME_TIMES[0] > max_expire_time) { // CAN Frame has not refreshed in valid interval
+            } else if (now > f.timestamp && now - f.timestamp > max_expire_time) { // CAN Frame has not refreshed in valid interval
+                mark_frame_stale(&STALE[0], seq);
                 return false;
             } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[0];
+                dest->raw = f.data;
                 return true;
             }
         }
             
 	private:
-		uint64_t FRAME_DATA[1];
-		uint64_t LAST_FRAME_TIMES[1];
+		typedef struct {
+			uint64_t data;
+			uint64_t timestamp;
+		} EcuFrame;
+		// Written by the CAN Rx task, read by any other task
+		Seqlock<EcuFrame> FRAMES[1];
+		// Arrival statistics. Only touched by the CAN Rx task, which publishes them to STATS
+		FrameArrivalStats RX_STATS[1] = {};
+		Seqlock<FrameArrivalStats> STATS[1];
+		// Staleness, counted by the getters from any task
+		mutable FrameStaleCounter STALE[1] = {};
+		static const uint8_t NUM_FRAMES = 1;
 };
 #endif // __ECU_EWM_H_
 
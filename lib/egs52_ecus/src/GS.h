@@ -14,6 +14,13 @@
 #define __ECU_GS_H_
 
 #include <stdint.h>
+#include "seqlock.h"
+#include "ecu_frame_stats.h"
+#include "ecu_frame_check.h"
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+    #error "Generated CAN frame accessors assume a little endian CPU"
+#endif
     
 #define GS_218_CAN_ID 0x0218
 #define GS_338_CAN_ID 0x0338
@@ -181,489 +188,382 @@ enum class GS_418h_WHST {
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of GS_218 */
 	uint32_t get_canid(){ return GS_218_CAN_ID; }
     /** Sets Motor moments Toggle 40ms + -10 */
-    void set_MTGL_EGS(bool value){ raw = (raw & 0x7fffffffffffffff) | ((uint64_t)value & 0x1) << 63; }
+    void set_MTGL_EGS(bool value){ bytes[0] = (bytes[0] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Motor moments Toggle 40ms + -10 */
-    bool get_MTGL_EGS() const { return (bool)(raw >> 63 & 0x1); }
+    bool get_MTGL_EGS() const { return (bool)(bytes[0] >> 7 & 0x1); }
         
     /** Sets Engine torque request min */
-    void set_MMIN_EGS(bool value){ raw = (raw & 0xbfffffffffffffff) | ((uint64_t)value & 0x1) << 62; }
+    void set_MMIN_EGS(bool value){ bytes[0] = (bytes[0] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Engine torque request min */
-    bool get_MMIN_EGS() const { return (bool)(raw >> 62 & 0x1); }
+    bool get_MMIN_EGS() const { return (bool)(bytes[0] >> 6 & 0x1); }
         
     /** Sets Engine torque request max */
-    void set_MMAX_EGS(bool value){ raw = (raw & 0xdfffffffffffffff) | ((uint64_t)value & 0x1) << 61; }
+    void set_MMAX_EGS(bool value){ bytes[0] = (bytes[0] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Engine torque request max */
-    bool get_MMAX_EGS() const { return (bool)(raw >> 61 & 0x1); }
+    bool get_MMAX_EGS() const { return (bool)(bytes[0] >> 5 & 0x1); }
         
     /** Sets Ford. Engine torque. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_M_EGS(uint16_t value){ raw = (raw & 0xe000ffffffffffff) | ((uint64_t)value & 0x1fff) << 48; }
+    void set_M_EGS(uint16_t value){ raw = (raw & 0xffffffffffff00e0) | __builtin_bswap64(((uint64_t)value & 0x1fff) << 48); }
 
     /** Gets Ford. Engine torque. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_M_EGS() const { return (uint16_t)(raw >> 48 & 0x1fff); }
+    uint16_t get_M_EGS() const { return (uint16_t)(__builtin_bswap64(raw) >> 48 & 0x1fff); }
         
     /** Sets Goal Gang */
-    void set_GZC(GS_218h_GZC value){ raw = (raw & 0xffff0fffffffffff) | ((uint64_t)value & 0xf) << 44; }
+    void set_GZC(GS_218h_GZC value){ bytes[2] = (bytes[2] & 0x0f) | ((uint8_t)value & 0xf) << 4; }
 
     /** Gets Goal Gang */
-    GS_218h_GZC get_GZC() const { return (GS_218h_GZC)(raw >> 44 & 0xf); }
+    GS_218h_GZC get_GZC() const { return (GS_218h_GZC)(bytes[2] >> 4 & 0xf); }
         
     /** Sets actual gear */
-    void set_GIC(GS_218h_GIC value){ raw = (raw & 0xfffff0ffffffffff) | ((uint64_t)value & 0xf) << 40; }
+    void set_GIC(GS_218h_GIC value){ bytes[2] = (bytes[2] & 0xf0) | ((uint8_t)value & 0xf) << 0; }
 
     /** Gets actual gear */
-    GS_218h_GIC get_GIC() const { return (GS_218h_GIC)(raw >> 40 & 0xf); }
+    GS_218h_GIC get_GIC() const { return (GS_218h_GIC)(bytes[2] >> 0 & 0xf); }
         
     /** Sets Best. (Transducer overbridge.-) clutch "slip" */
-    void set_K_S_B(bool value){ raw = (raw & 0xffffff7fffffffff) | ((uint64_t)value & 0x1) << 39; }
+    void set_K_S_B(bool value){ bytes[3] = (bytes[3] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Best. (Transducer overbridge.-) clutch "slip" */
-    bool get_K_S_B() const { return (bool)(raw >> 39 & 0x1); }
+    bool get_K_S_B() const { return (bool)(bytes[3] >> 7 & 0x1); }
         
     /** Sets Best. (Transducer overbridders.-) clutch "open" */
-    void set_K_O_B(bool value){ raw = (raw & 0xffffffbfffffffff) | ((uint64_t)value & 0x1) << 38; }
+    void set_K_O_B(bool value){ bytes[3] = (bytes[3] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Best. (Transducer overbridders.-) clutch "open" */
-    bool get_K_O_B() const { return (bool)(raw >> 38 & 0x1); }
+    bool get_K_O_B() const { return (bool)(bytes[3] >> 6 & 0x1); }
         
     /** Sets Best. (Transducer overbridge.-) clutch "closed" */
-    void set_K_G_B(bool value){ raw = (raw & 0xffffffdfffffffff) | ((uint64_t)value & 0x1) << 37; }
+    void set_K_G_B(bool value){ bytes[3] = (bytes[3] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Best. (Transducer overbridge.-) clutch "closed" */
-    bool get_K_G_B() const { return (bool)(raw >> 37 & 0x1); }
+    bool get_K_G_B() const { return (bool)(bytes[3] >> 5 & 0x1); }
         
     /** Sets terrain */
-    void set_G_G(bool value){ raw = (raw & 0xffffffefffffffff) | ((uint64_t)value & 0x1) << 36; }
+    void set_G_G(bool value){ bytes[3] = (bytes[3] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets terrain */
-    bool get_G_G() const { return (bool)(raw >> 36 & 0x1); }
+    bool get_G_G() const { return (bool)(bytes[3] >> 4 & 0x1); }
         
     /** Sets Basic switch program O.K. */
-    void set_GSP_OK(bool value){ raw = (raw & 0xfffffff7ffffffff) | ((uint64_t)value & 0x1) << 35; }
+    void set_GSP_OK(bool value){ bytes[3] = (bytes[3] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Basic switch program O.K. */
-    bool get_GSP_OK() const { return (bool)(raw >> 35 & 0x1); }
+    bool get_GSP_OK() const { return (bool)(bytes[3] >> 3 & 0x1); }
         
     /** Sets driving resistance high */
-    void set_FW_HOCH(bool value){ raw = (raw & 0xfffffffbffffffff) | ((uint64_t)value & 0x1) << 34; }
+    void set_FW_HOCH(bool value){ bytes[3] = (bytes[3] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets driving resistance high */
-    bool get_FW_HOCH() const { return (bool)(raw >> 34 & 0x1); }
+    bool get_FW_HOCH() const { return (bool)(bytes[3] >> 2 & 0x1); }
         
     /** Sets circuit */
-    void set_SCHALT(bool value){ raw = (raw & 0xfffffffdffffffff) | ((uint64_t)value & 0x1) << 33; }
+    void set_SCHALT(bool value){ bytes[3] = (bytes[3] & 0xfd) | ((uint8_t)value & 0x1) << 1; }
 
     /** Gets circuit */
-    bool get_SCHALT() const { return (bool)(raw >> 33 & 0x1); }
+    bool get_SCHALT() const { return (bool)(bytes[3] >> 1 & 0x1); }
         
     /** Sets hand switching mode */
-    void set_HSM(bool value){ raw = (raw & 0xfffffffeffffffff) | ((uint64_t)value & 0x1) << 32; }
+    void set_HSM(bool value){ bytes[3] = (bytes[3] & 0xfe) | ((uint8_t)value & 0x1) << 0; }
 
     /** Gets hand switching mode */
-    bool get_HSM() const { return (bool)(raw >> 32 & 0x1); }
+    bool get_HSM() const { return (bool)(bytes[3] >> 0 & 0x1); }
         
     /** Sets gear ok */
-    void set_GET_OK(bool value){ raw = (raw & 0xffffffff7fffffff) | ((uint64_t)value & 0x1) << 31; }
+    void set_GET_OK(bool value){ bytes[4] = (bytes[4] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets gear ok */
-    bool get_GET_OK() const { return (bool)(raw >> 31 & 0x1); }
+    bool get_GET_OK() const { return (bool)(bytes[4] >> 7 & 0x1); }
         
     /** Sets Ball start */
-    void set_KS(bool value){ raw = (raw & 0xffffffffbfffffff) | ((uint64_t)value & 0x1) << 30; }
+    void set_KS(bool value){ bytes[4] = (bytes[4] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Ball start */
-    bool get_KS() const { return (bool)(raw >> 30 & 0x1); }
+    bool get_KS() const { return (bool)(bytes[4] >> 6 & 0x1); }
         
     /** Sets reasonable release */
-    void set_ALF(bool value){ raw = (raw & 0xffffffffdfffffff) | ((uint64_t)value & 0x1) << 29; }
+    void set_ALF(bool value){ bytes[4] = (bytes[4] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets reasonable release */
-    bool get_ALF() const { return (bool)(raw >> 29 & 0x1); }
+    bool get_ALF() const { return (bool)(bytes[4] >> 5 & 0x1); }
         
     /** Sets GS in the emergency */
-    void set_GS_NOTL(bool value){ raw = (raw & 0xffffffffefffffff) | ((uint64_t)value & 0x1) << 28; }
+    void set_GS_NOTL(bool value){ bytes[4] = (bytes[4] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets GS in the emergency */
-    bool get_GS_NOTL() const { return (bool)(raw >> 28 & 0x1); }
+    bool get_GS_NOTL() const { return (bool)(bytes[4] >> 4 & 0x1); }
         
     /** Sets Overtemperature gearbox */
-    void set_UEHITZ_GET(bool value){ raw = (raw & 0xfffffffff7ffffff) | ((uint64_t)value & 0x1) << 27; }
+    void set_UEHITZ_GET(bool value){ bytes[4] = (bytes[4] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Overtemperature gearbox */
-    bool get_UEHITZ_GET() const { return (bool)(raw >> 27 & 0x1); }
+    bool get_UEHITZ_GET() const { return (bool)(bytes[4] >> 3 & 0x1); }
         
     /** Sets Kickdown */
-    void set_KD(bool value){ raw = (raw & 0xfffffffffbffffff) | ((uint64_t)value & 0x1) << 26; }
+    void set_KD(bool value){ bytes[4] = (bytes[4] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets Kickdown */
-    bool get_KD() const { return (bool)(raw >> 26 & 0x1); }
+    bool get_KD() const { return (bool)(bytes[4] >> 2 & 0x1); }
         
     /** Sets Driving program for AAD */
-    void set_FPC_AAD(GS_218h_FPC_AAD value){ raw = (raw & 0xfffffffffcffffff) | ((uint64_t)value & 0x3) << 24; }
+    void set_FPC_AAD(GS_218h_FPC_AAD value){ bytes[4] = (bytes[4] & 0xfc) | ((uint8_t)value & 0x3) << 0; }
 
     /** Gets Driving program for AAD */
-    GS_218h_FPC_AAD get_FPC_AAD() const { return (GS_218h_FPC_AAD)(raw >> 24 & 0x3); }
+    GS_218h_FPC_AAD get_FPC_AAD() const { return (GS_218h_FPC_AAD)(bytes[4] >> 0 & 0x3); }
         
     /** Sets Engine torque Request Parity (just parity) */
-    void set_MPAR_EGS(bool value){ raw = (raw & 0xffffffffff7fffff) | ((uint64_t)value & 0x1) << 23; }
+    void set_MPAR_EGS(bool value){ bytes[5] = (bytes[5] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Engine torque Request Parity (just parity) */
-    bool get_MPAR_EGS() const { return (bool)(raw >> 23 & 0x1); }
+    bool get_MPAR_EGS() const { return (bool)(bytes[5] >> 7 & 0x1); }
         
     /** Sets engagement mode / drive torque control */
-    void set_DYN1_EGS(bool value){ raw = (raw & 0xffffffffffbfffff) | ((uint64_t)value & 0x1) << 22; }
+    void set_DYN1_EGS(bool value){ bytes[5] = (bytes[5] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets engagement mode / drive torque control */
-    bool get_DYN1_EGS() const { return (bool)(raw >> 22 & 0x1); }
+    bool get_DYN1_EGS() const { return (bool)(bytes[5] >> 6 & 0x1); }
         
     /** Sets engagement mode / drive torque control */
-    void set_DYN0_AMR_EGS(bool value){ raw = (raw & 0xffffffffffdfffff) | ((uint64_t)value & 0x1) << 21; }
+    void set_DYN0_AMR_EGS(bool value){ bytes[5] = (bytes[5] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets engagement mode / drive torque control */
-    bool get_DYN0_AMR_EGS() const { return (bool)(raw >> 21 & 0x1); }
+    bool get_DYN0_AMR_EGS() const { return (bool)(bytes[5] >> 5 & 0x1); }
         
     /** Sets Convertible bridging clutch load-free */
-    void set_K_LSTFR(bool value){ raw = (raw & 0xfffffffffffbffff) | ((uint64_t)value & 0x1) << 18; }
+    void set_K_LSTFR(bool value){ bytes[5] = (bytes[5] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets Convertible bridging clutch load-free */
-    bool get_K_LSTFR() const { return (bool)(raw >> 18 & 0x1); }
+    bool get_K_LSTFR() const { return (bool)(bytes[5] >> 2 & 0x1); }
         
     /** Sets MOT_NAUS-ConfirmMbit */
-    void set_MOT_NAUS_CNF(bool value){ raw = (raw & 0xfffffffffffdffff) | ((uint64_t)value & 0x1) << 17; }
+    void set_MOT_NAUS_CNF(bool value){ bytes[5] = (bytes[5] & 0xfd) | ((uint8_t)value & 0x1) << 1; }
 
     /** Gets MOT_NAUS-ConfirmMbit */
-    bool get_MOT_NAUS_CNF() const { return (bool)(raw >> 17 & 0x1); }
+    bool get_MOT_NAUS_CNF() const { return (bool)(bytes[5] >> 1 & 0x1); }
         
     /** Sets Engine Emergency Switch Off */
-    void set_MOT_NAUS(bool value){ raw = (raw & 0xfffffffffffeffff) | ((uint64_t)value & 0x1) << 16; }
+    void set_MOT_NAUS(bool value){ bytes[5] = (bytes[5] & 0xfe) | ((uint8_t)value & 0x1) << 0; }
 
     /** Gets Engine Emergency Switch Off */
-    bool get_MOT_NAUS() const { return (bool)(raw >> 16 & 0x1); }
+    bool get_MOT_NAUS() const { return (bool)(bytes[5] >> 0 & 0x1); }
         
     /** Sets Kriech torque (FFH at EGS, CVT) or Calid / CVN. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_MKRIECH(uint8_t value){ raw = (raw & 0xffffffffffff00ff) | ((uint64_t)value & 0xff) << 8; }
+    void set_MKRIECH(uint8_t value){ bytes[6] = (bytes[6] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Kriech torque (FFH at EGS, CVT) or Calid / CVN. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_MKRIECH() const { return (uint8_t)(raw >> 8 & 0xff); }
+    uint8_t get_MKRIECH() const { return (uint8_t)(bytes[6] >> 0 & 0xff); }
         
     /** Sets Status Error Check */
-    void set_FEHLPRF_ST(GS_218h_FEHLPRF_ST value){ raw = (raw & 0xffffffffffffff3f) | ((uint64_t)value & 0x3) << 6; }
+    void set_FEHLPRF_ST(GS_218h_FEHLPRF_ST value){ bytes[7] = (bytes[7] & 0x3f) | ((uint8_t)value & 0x3) << 6; }
 
     /** Gets Status Error Check */
-    GS_218h_FEHLPRF_ST get_FEHLPRF_ST() const { return (GS_218h_FEHLPRF_ST)(raw >> 6 & 0x3); }
+    GS_218h_FEHLPRF_ST get_FEHLPRF_ST() const { return (GS_218h_FEHLPRF_ST)(bytes[7] >> 6 & 0x3); }
         
     /** Sets CALID / CVN transmission active */
-    void set_CALID_CVN_AKT(bool value){ raw = (raw & 0xffffffffffffffdf) | ((uint64_t)value & 0x1) << 5; }
+    void set_CALID_CVN_AKT(bool value){ bytes[7] = (bytes[7] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets CALID / CVN transmission active */
-    bool get_CALID_CVN_AKT() const { return (bool)(raw >> 5 & 0x1); }
+    bool get_CALID_CVN_AKT() const { return (bool)(bytes[7] >> 5 & 0x1); }
         
     /** Sets error number or counter for calid / CVN transmission. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_FEHLER(uint8_t value){ raw = (raw & 0xffffffffffffffe0) | ((uint64_t)value & 0x1f) << 0; }
+    void set_FEHLER(uint8_t value){ bytes[7] = (bytes[7] & 0xe0) | ((uint8_t)value & 0x1f) << 0; }
 
     /** Gets error number or counter for calid / CVN transmission. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_FEHLER() const { return (uint8_t)(raw >> 0 & 0x1f); }
+    uint8_t get_FEHLER() const { return (uint8_t)(bytes[7] >> 0 & 0x1f); }
         
 } GS_218;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of GS_338 */
 	uint32_t get_canid(){ return GS_338_CAN_ID; }
     /** Sets Transmission output speed (only 463/461, other FFFFH). Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_NAB(uint16_t value){ raw = (raw & 0x0000ffffffffffff) | ((uint64_t)value & 0xffff) << 48; }
+    void set_NAB(uint16_t value){ raw = (raw & 0xffffffffffff0000) | __builtin_bswap64(((uint64_t)value & 0xffff) << 48); }
 
     /** Gets Transmission output speed (only 463/461, other FFFFH). Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_NAB() const { return (uint16_t)(raw >> 48 & 0xffff); }
+    uint16_t get_NAB() const { return (uint16_t)(__builtin_bswap64(raw) >> 48 & 0xffff); }
         
     /** Sets Turbine speed (EGS52-NAG, VGS-NAG2). Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_NTURBINE(uint16_t value){ raw = (raw & 0xffffffffffff0000) | ((uint64_t)value & 0xffff) << 0; }
+    void set_NTURBINE(uint16_t value){ raw = (raw & 0x0000ffffffffffff) | __builtin_bswap64(((uint64_t)value & 0xffff) << 0); }
 
     /** Gets Turbine speed (EGS52-NAG, VGS-NAG2). Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_NTURBINE() const { return (uint16_t)(raw >> 0 & 0xffff); }
+    uint16_t get_NTURBINE() const { return (uint16_t)(__builtin_bswap64(raw) >> 0 & 0xffff); }
         
 } GS_338;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of GS_418 */
 	uint32_t get_canid(){ return GS_418_CAN_ID; }
     /** Sets drive */
-    void set_FSC(char value){ raw = (raw & 0x00ffffffffffffff) | ((uint64_t)value & 0xff) << 56; }
+    void set_FSC(char value){ bytes[0] = (bytes[0] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets drive */
-    char get_FSC() const { return (char)(raw >> 56 & 0xff); }
+    char get_FSC() const { return (char)(bytes[0] >> 0 & 0xff); }
         
     /** Sets Driving program */
-    void set_FPC(GS_418h_FPC value){ raw = (raw & 0xff00ffffffffffff) | ((uint64_t)value & 0xff) << 48; }
+    void set_FPC(GS_418h_FPC value){ bytes[1] = (bytes[1] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Driving program */
-    GS_418h_FPC get_FPC() const { return (GS_418h_FPC)(raw >> 48 & 0xff); }
+    GS_418h_FPC get_FPC() const { return (GS_418h_FPC)(bytes[1] >> 0 & 0xff); }
         
     /** Sets Gear oil temperature. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_T_GET(uint8_t value){ raw = (raw & 0xffff00ffffffffff) | ((uint64_t)value & 0xff) << 40; }
+    void set_T_GET(uint8_t value){ bytes[2] = (bytes[2] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Gear oil temperature. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_T_GET() const { return (uint8_t)(raw >> 40 & 0xff); }
+    uint8_t get_T_GET() const { return (uint8_t)(bytes[2] >> 0 & 0xff); }
         
     /** Sets four-wheel drive */
-    void set_ALLRAD(bool value){ raw = (raw & 0xffffff7fffffffff) | ((uint64_t)value & 0x1) << 39; }
+    void set_ALLRAD(bool value){ bytes[3] = (bytes[3] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets four-wheel drive */
-    bool get_ALLRAD() const { return (bool)(raw >> 39 & 0x1); }
+    bool get_ALLRAD() const { return (bool)(bytes[3] >> 7 & 0x1); }
         
     /** Sets Front drive [1], rear drive [0] */
-    void set_FRONT(bool value){ raw = (raw & 0xffffffbfffffffff) | ((uint64_t)value & 0x1) << 38; }
+    void set_FRONT(bool value){ bytes[3] = (bytes[3] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Front drive [1], rear drive [0] */
-    bool get_FRONT() const { return (bool)(raw >> 38 & 0x1); }
+    bool get_FRONT() const { return (bool)(bytes[3] >> 6 & 0x1); }
         
     /** Sets circuit */
-    void set_SCHALT(bool value){ raw = (raw & 0xffffffdfffffffff) | ((uint64_t)value & 0x1) << 37; }
+    void set_SCHALT(bool value){ bytes[3] = (bytes[3] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets circuit */
-    bool get_SCHALT() const { return (bool)(raw >> 37 & 0x1); }
+    bool get_SCHALT() const { return (bool)(bytes[3] >> 5 & 0x1); }
         
     /** Sets Stepless transmission [1], stage gear [0] */
-    void set_CVT(bool value){ raw = (raw & 0xffffffefffffffff) | ((uint64_t)value & 0x1) << 36; }
+    void set_CVT(bool value){ bytes[3] = (bytes[3] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets Stepless transmission [1], stage gear [0] */
-    bool get_CVT() const { return (bool)(raw >> 36 & 0x1); }
+    bool get_CVT() const { return (bool)(bytes[3] >> 4 & 0x1); }
         
     /** Sets Gear mechanics variant */
-    void set_MECH(GS_418h_MECH value){ raw = (raw & 0xfffffff3ffffffff) | ((uint64_t)value & 0x3) << 34; }
+    void set_MECH(GS_418h_MECH value){ bytes[3] = (bytes[3] & 0xf3) | ((uint8_t)value & 0x3) << 2; }
 
     /** Gets Gear mechanics variant */
-    GS_418h_MECH get_MECH() const { return (GS_418h_MECH)(raw >> 34 & 0x3); }
+    GS_418h_MECH get_MECH() const { return (GS_418h_MECH)(bytes[3] >> 2 & 0x3); }
         
     /** Sets Create brake when switching on */
-    void set_ESV_BRE(bool value){ raw = (raw & 0xfffffffdffffffff) | ((uint64_t)value & 0x1) << 33; }
+    void set_ESV_BRE(bool value){ bytes[3] = (bytes[3] & 0xfd) | ((uint8_t)value & 0x1) << 1; }
 
     /** Gets Create brake when switching on */
-    bool get_ESV_BRE() const { return (bool)(raw >> 33 & 0x1); }
+    bool get_ESV_BRE() const { return (bool)(bytes[3] >> 1 & 0x1); }
         
     /** Sets Kickdown */
-    void set_KD(bool value){ raw = (raw & 0xfffffffeffffffff) | ((uint64_t)value & 0x1) << 32; }
+    void set_KD(bool value){ bytes[3] = (bytes[3] & 0xfe) | ((uint8_t)value & 0x1) << 0; }
 
     /** Gets Kickdown */
-    bool get_KD() const { return (bool)(raw >> 32 & 0x1); }
+    bool get_KD() const { return (bool)(bytes[3] >> 0 & 0x1); }
         
     /** Sets target gear */
-    void set_GZC(GS_418h_GZC value){ raw = (raw & 0xffffffff0fffffff) | ((uint64_t)value & 0xf) << 28; }
+    void set_GZC(GS_418h_GZC value){ bytes[4] = (bytes[4] & 0x0f) | ((uint8_t)value & 0xf) << 4; }
 
     /** Gets target gear */
-    GS_418h_GZC get_GZC() const { return (GS_418h_GZC)(raw >> 28 & 0xf); }
+    GS_418h_GZC get_GZC() const { return (GS_418h_GZC)(bytes[4] >> 4 & 0xf); }
         
     /** Sets actual gear */
-    void set_GIC(GS_418h_GIC value){ raw = (raw & 0xfffffffff0ffffff) | ((uint64_t)value & 0xf) << 24; }
+    void set_GIC(GS_418h_GIC value){ bytes[4] = (bytes[4] & 0xf0) | ((uint8_t)value & 0xf) << 0; }
 
     /** Gets actual gear */
-    GS_418h_GIC get_GIC() const { return (GS_418h_GIC)(raw >> 24 & 0xf); }
+    GS_418h_GIC get_GIC() const { return (GS_418h_GIC)(bytes[4] >> 0 & 0xf); }
         
     /** Sets Loss moment (FFH at KSG). Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_M_VERL(uint8_t value){ raw = (raw & 0xffffffffff00ffff) | ((uint64_t)value & 0xff) << 16; }
+    void set_M_VERL(uint8_t value){ bytes[5] = (bytes[5] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Loss moment (FFH at KSG). Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_M_VERL() const { return (uint8_t)(raw >> 16 & 0xff); }
+    uint8_t get_M_VERL() const { return (uint8_t)(bytes[5] >> 0 & 0xff); }
         
     /** Sets Factor wheel torque parity (straight parity) */
-    void set_FMRADPAR(bool value){ raw = (raw & 0xffffffffffff7fff) | ((uint64_t)value & 0x1) << 15; }
+    void set_FMRADPAR(bool value){ bytes[6] = (bytes[6] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Factor wheel torque parity (straight parity) */
-    bool get_FMRADPAR() const { return (bool)(raw >> 15 & 0x1); }
+    bool get_FMRADPAR() const { return (bool)(bytes[6] >> 7 & 0x1); }
         
     /** Sets Factor wheel torque Toggle 40ms + -10 */
-    void set_FMRADTGL(bool value){ raw = (raw & 0xffffffffffffbfff) | ((uint64_t)value & 0x1) << 14; }
+    void set_FMRADTGL(bool value){ bytes[6] = (bytes[6] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Factor wheel torque Toggle 40ms + -10 */
-    bool get_FMRADTGL() const { return (bool)(raw >> 14 & 0x1); }
+    bool get_FMRADTGL() const { return (bool)(bytes[6] >> 6 & 0x1); }
         
     /** Sets gear selector lever position (NAG, KSG, CVT) */
-    void set_WHST(GS_418h_WHST value){ raw = (raw & 0xffffffffffffc7ff) | ((uint64_t)value & 0x7) << 11; }
+    void set_WHST(GS_418h_WHST value){ bytes[6] = (bytes[6] & 0xc7) | ((uint8_t)value & 0x7) << 3; }
 
     /** Gets gear selector lever position (NAG, KSG, CVT) */
-    GS_418h_WHST get_WHST() const { return (GS_418h_WHST)(raw >> 11 & 0x7); }
+    GS_418h_WHST get_WHST() const { return (GS_418h_WHST)(bytes[6] >> 3 & 0x7); }
         
     /** Sets Factor wheel torque (7ffh at KSG). Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_FMRAD(uint16_t value){ raw = (raw & 0xfffffffffffff800) | ((uint64_t)value & 0x7ff) << 0; }
+    void set_FMRAD(uint16_t value){ raw = (raw & 0x00f8ffffffffffff) | __builtin_bswap64(((uint64_t)value & 0x7ff) << 0); }
 
     /** Gets Factor wheel torque (7ffh at KSG). Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_FMRAD() const { return (uint16_t)(raw >> 0 & 0x7ff); }
+    uint16_t get_FMRAD() const { return (uint16_t)(__builtin_bswap64(raw) >> 0 & 0x7ff); }
         
 } GS_418;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of GS_CUSTOM_558 */
 	uint32_t get_canid(){ return GS_CUSTOM_558_CAN_ID; }
     /** Sets Duty cycle of modulating pressure solenoid. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_MPC_DUTY(uint8_t value){ raw = (raw & 0x00ffffffffffffff) | ((uint64_t)value & 0xff) << 56; }
+    void set_MPC_DUTY(uint8_t value){ bytes[0] = (bytes[0] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Duty cycle of modulating pressure solenoid. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_MPC_DUTY() const { return (uint8_t)(raw >> 56 & 0xff); }
+    uint8_t get_MPC_DUTY() const { return (uint8_t)(bytes[0] >> 0 & 0xff); }
         
     /** Sets Duty cycle of shift pressure solenoid. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_SPC_DUTY(uint8_t value){ raw = (raw & 0xff00ffffffffffff) | ((uint64_t)value & 0xff) << 48; }
+    void set_SPC_DUTY(uint8_t value){ bytes[1] = (bytes[1] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Duty cycle of shift pressure solenoid. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_SPC_DUTY() const { return (uint8_t)(raw >> 48 & 0xff); }
+    uint8_t get_SPC_DUTY() const { return (uint8_t)(bytes[1] >> 0 & 0xff); }
         
     /** Sets Duty cycle of torque convert solenoid. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_TCC_DUTY(uint8_t value){ raw = (raw & 0xffff00ffffffffff) | ((uint64_t)value & 0xff) << 40; }
+    void set_TCC_DUTY(uint8_t value){ bytes[2] = (bytes[2] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Duty cycle of torque convert solenoid. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_TCC_DUTY() const { return (uint8_t)(raw >> 40 & 0xff); }
+    uint8_t get_TCC_DUTY() const { return (uint8_t)(bytes[2] >> 0 & 0xff); }
         
     /** Sets Desired RPM slip of torque converter clutch. Conversion formula (To raw from real): y=(x-0.0)/1.00 (Unit: rpm) */
-    void set_TCC_SLIP(uint16_t value){ raw = (raw & 0xffffffff0000ffff) | ((uint64_t)value & 0xffff) << 16; }
+    void set_TCC_SLIP(uint16_t value){ raw = (raw & 0xffff0000ffffffff) | __builtin_bswap64(((uint64_t)value & 0xffff) << 16); }
 
     /** Gets Desired RPM slip of torque converter clutch. Conversion formula (To real from raw): y=(1.00x)+0.0 (Unit: rpm) */
-    uint16_t get_TCC_SLIP() const { return (uint16_t)(raw >> 16 & 0xffff); }
+    uint16_t get_TCC_SLIP() const { return (uint16_t)(__builtin_bswap64(raw) >> 16 & 0xffff); }
         
     /** Sets AI certainty of upshift. Conversion formula (To raw from real): y=(x-0.0)/1.00 (Unit: %) */
-    void set_AI_UP(uint8_t value){ raw = (raw & 0xffffffffffff00ff) | ((uint64_t)value & 0xff) << 8; }
+    void set_AI_UP(uint8_t value){ bytes[6] = (bytes[6] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets AI certainty of upshift. Conversion formula (To real from raw): y=(1.00x)+0.0 (Unit: %) */
-    uint8_t get_AI_UP() const { return (uint8_t)(raw >> 8 & 0xff); }
+    uint8_t get_AI_UP() const { return (uint8_t)(bytes[6] >> 0 & 0xff); }
         
     /** Sets AI certainty of downshift. Conversion formula (To raw from real): y=(x-0.0)/1.00 (Unit: %) */
-    void set_AI_DN(uint8_t value){ raw = (raw & 0xffffffffffff00ff) | ((uint64_t)value & 0xff) << 8; }
+    void set_AI_DN(uint8_t value){ bytes[6] = (bytes[6] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets AI certainty of downshift. Conversion formula (To real from raw): y=(1.00x)+0.0 (Unit: %) */
-    uint8_t get_AI_DN() const { return (uint8_t)(raw >> 8 & 0xff); }
+    uint8_t get_AI_DN() const { return (uint8_t)(bytes[6] >> 0 & 0xff); }
         
 } GS_CUSTOM_558;
 
 
 
-class ECU_GS {
-	public:
-        /**
-         * @brief Imports the CAN frame given the CAN ID, CAN Contents, and current timestamp
-         *
-         * Returns true if the frame was imported successfully, and false if import failed (Due to non-matching CAN ID).
-         *
-         * NOTE: The endianness of the value cannot be guaranteed. It is up to the caller to correct the byte order!
-         */
-        bool import_frames(uint64_t value, uint32_t can_id, uint64_t timestamp_now) {
-            switch(can_id) {
-                case GS_218_CAN_ID:
-                    LAST_FRAME_TIMES[0] = timestamp_now;
-                    FRAME_DATA[0] = value;
-                    return true;
-                case GS_338_CAN_ID:
-                    LAST_FRAME_TIMES[1] = timestamp_now;
-                    FRAME_DATA[1] = value;
-                    return true;
-                case GS_418_CAN_ID:
-                    LAST_FRAME_TIMES[2] = timestamp_now;
-                    FRAME_DATA[2] = value;
-                    return true;
-                case GS_CUSTOM_558_CAN_ID:
-                    LAST_FRAME_TIMES[3] = timestamp_now;
-                    FRAME_DATA[3] = value;
-                    return true;
-                default:
-                    return false;
-            }
-        }
-        
-        /** Sets data in pointer to GS_218
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_GS_218(uint64_t now, uint64_t max_expire_time, GS_218* dest) const {
-            if (LAST_FRAME_TIMES[0] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[0] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[0];
-                return true;
-            }
-        }
-            
-        /** Sets data in pointer to GS_338
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_GS_338(uint64_t now, uint64_t max_expire_time, GS_338* dest) const {
-            if (LAST_FRAME_TIMES[1] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[1] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[1];
-                return true;
-            }
-        }
-            
-        /** Sets data in pointer to GS_418
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_GS_418(uint64_t now, uint64_t max_expire_time, GS_418* dest) const {
-            if (LAST_FRAME_TIMES[2] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[2] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[2];
-                return true;
-            }
-        }
-            
-        /** Sets data in pointer to GS_CUSTOM_558
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_GS_CUSTOM_558(uint64_t now, uint64_t max_expire_time, GS_CUSTOM_558* dest) const {
-            if (LAST_FRAME_TIMES[3] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[3] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[3];
-                return true;
-            }
-        }
-            
-	private:
-		uint64_t FRAME_DATA[4];
-		uint64_t LAST_FRAME_TIMES[4];
-};
+// No frames of ECU 'GS' are read by the TCM, so it has no storage class
 #endif // __ECU_GS_H_
 
 #endif // EGS52_MODE
\ No newline at end of file
@@ -14,6 +14,13 @@
 #define __ECU_KOMBI_H_
 
 #include <stdint.h>
+#include "seqlock.h"
+#include "ecu_frame_stats.h"
+#include "ecu_frame_check.h"
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+    #error "Generated CAN frame accessors assume a little endian CPU"
+#endif
     
 #define KOMBI_408_CAN_ID 0x0408
 #define KOMBI_412_CAN_ID 0x0412
@@ -69,269 +76,206 @@ enum class KOMBI_412h_PRW_ANF {
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of KOMBI_408 */
 	uint32_t get_canid(){ return KOMBI_408_CAN_ID; }
     /** Sets Tank level. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_TANK_FS(uint8_t value){ raw = (raw & 0x00ffffffffffffff) | ((uint64_t)value & 0xff) << 56; }
+    void set_TANK_FS(uint8_t value){ bytes[0] = (bytes[0] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Tank level. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_TANK_FS() const { return (uint8_t)(raw >> 56 & 0xff); }
+    uint8_t get_TANK_FS() const { return (uint8_t)(bytes[0] >> 0 & 0xff); }
         
     /** Sets driver's door */
-    void set_TF_AUF(bool value){ raw = (raw & 0xff7fffffffffffff) | ((uint64_t)value & 0x1) << 55; }
+    void set_TF_AUF(bool value){ bytes[1] = (bytes[1] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets driver's door */
-    bool get_TF_AUF() const { return (bool)(raw >> 55 & 0x1); }
+    bool get_TF_AUF() const { return (bool)(bytes[1] >> 7 & 0x1); }
         
     /** Sets Speed Limit / Tempose Display Not possible */
-    void set_V_DSPL_AUS(bool value){ raw = (raw & 0xffbfffffffffffff) | ((uint64_t)value & 0x1) << 54; }
+    void set_V_DSPL_AUS(bool value){ bytes[1] = (bytes[1] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Speed Limit / Tempose Display Not possible */
-    bool get_V_DSPL_AUS() const { return (bool)(raw >> 54 & 0x1); }
+    bool get_V_DSPL_AUS() const { return (bool)(bytes[1] >> 6 & 0x1); }
         
     /** Sets Tacho oak */
-    void set_TACHO_SYM(bool value){ raw = (raw & 0xffdfffffffffffff) | ((uint64_t)value & 0x1) << 53; }
+    void set_TACHO_SYM(bool value){ bytes[1] = (bytes[1] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Tacho oak */
-    bool get_TACHO_SYM() const { return (bool)(raw >> 53 & 0x1); }
+    bool get_TACHO_SYM() const { return (bool)(bytes[1] >> 5 & 0x1); }
         
     /** Sets MPH instead of km / h (variable speed bends) */
-    void set_V_MPH(bool value){ raw = (raw & 0xffefffffffffffff) | ((uint64_t)value & 0x1) << 52; }
+    void set_V_MPH(bool value){ bytes[1] = (bytes[1] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets MPH instead of km / h (variable speed bends) */
-    bool get_V_MPH() const { return (bool)(raw >> 52 & 0x1); }
+    bool get_V_MPH() const { return (bool)(bytes[1] >> 4 & 0x1); }
         
     /** Sets Air conditioning available */
-    void set_KLA_VH(bool value){ raw = (raw & 0xfff7ffffffffffff) | ((uint64_t)value & 0x1) << 51; }
+    void set_KLA_VH(bool value){ bytes[1] = (bytes[1] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Air conditioning available */
-    bool get_KLA_VH() const { return (bool)(raw >> 51 & 0x1); }
+    bool get_KLA_VH() const { return (bool)(bytes[1] >> 3 & 0x1); }
         
     /** Sets pre-glow control lamp defective */
-    void set_VGL_KL_DEF(bool value){ raw = (raw & 0xfffbffffffffffff) | ((uint64_t)value & 0x1) << 50; }
+    void set_VGL_KL_DEF(bool value){ bytes[1] = (bytes[1] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets pre-glow control lamp defective */
-    bool get_VGL_KL_DEF() const { return (bool)(raw >> 50 & 0x1); }
+    bool get_VGL_KL_DEF() const { return (bool)(bytes[1] >> 2 & 0x1); }
         
     /** Sets Tank level minimum */
-    void set_TFSM(bool value){ raw = (raw & 0xfffdffffffffffff) | ((uint64_t)value & 0x1) << 49; }
+    void set_TFSM(bool value){ bytes[1] = (bytes[1] & 0xfd) | ((uint8_t)value & 0x1) << 1; }
 
     /** Gets Tank level minimum */
-    bool get_TFSM() const { return (bool)(raw >> 49 & 0x1); }
+    bool get_TFSM() const { return (bool)(bytes[1] >> 1 & 0x1); }
         
     /** Sets Clamp 61 decoupled */
-    void set_KL_61E(bool value){ raw = (raw & 0xfffeffffffffffff) | ((uint64_t)value & 0x1) << 48; }
+    void set_KL_61E(bool value){ bytes[1] = (bytes[1] & 0xfe) | ((uint8_t)value & 0x1) << 0; }
 
     /** Gets Clamp 61 decoupled */
-    bool get_KL_61E() const { return (bool)(raw >> 48 & 0x1); }
+    bool get_KL_61E() const { return (bool)(bytes[1] >> 0 & 0x1); }
         
     /** Sets Outdoor air temperature raw value. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_T_AUSSEN(uint8_t value){ raw = (raw & 0xffff00ffffffffff) | ((uint64_t)value & 0xff) << 40; }
+    void set_T_AUSSEN(uint8_t value){ bytes[2] = (bytes[2] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Outdoor air temperature raw value. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_T_AUSSEN() const { return (uint8_t)(raw >> 40 & 0xff); }
+    uint8_t get_T_AUSSEN() const { return (uint8_t)(bytes[2] >> 0 & 0xff); }
         
     /** Sets Terminal 58 dimmed. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_KL_58D(uint8_t value){ raw = (raw & 0xffffff00ffffffff) | ((uint64_t)value & 0xff) << 32; }
+    void set_KL_58D(uint8_t value){ bytes[3] = (bytes[3] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Terminal 58 dimmed. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_KL_58D() const { return (uint8_t)(raw >> 32 & 0xff); }
+    uint8_t get_KL_58D() const { return (uint8_t)(bytes[3] >> 0 & 0xff); }
         
     /** Sets Motor setting time (will be sent from Kl.15). Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_MAZ(uint8_t value){ raw = (raw & 0xffffffff00ffffff) | ((uint64_t)value & 0xff) << 24; }
+    void set_MAZ(uint8_t value){ bytes[4] = (bytes[4] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Motor setting time (will be sent from Kl.15). Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_MAZ() const { return (uint8_t)(raw >> 24 & 0xff); }
+    uint8_t get_MAZ() const { return (uint8_t)(bytes[4] >> 0 & 0xff); }
         
     /** Sets mileage. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_KM16(uint16_t value){ raw = (raw & 0xffffffffff0000ff) | ((uint64_t)value & 0xffff) << 8; }
+    void set_KM16(uint16_t value){ raw = (raw & 0xff0000ffffffffff) | __builtin_bswap64(((uint64_t)value & 0xffff) << 8); }
 
     /** Gets mileage. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_KM16() const { return (uint16_t)(raw >> 8 & 0xffff); }
+    uint16_t get_KM16() const { return (uint16_t)(__builtin_bswap64(raw) >> 8 & 0xffff); }
         
     /** Sets Winter Tire Top Speed Bit 3 */
-    void set_WRC3(bool value){ raw = (raw & 0xffffffffffffff7f) | ((uint64_t)value & 0x1) << 7; }
+    void set_WRC3(bool value){ bytes[7] = (bytes[7] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Winter Tire Top Speed Bit 3 */
-    bool get_WRC3() const { return (bool)(raw >> 7 & 0x1); }
+    bool get_WRC3() const { return (bool)(bytes[7] >> 7 & 0x1); }
         
     /** Sets Speed Limit / Tempomat Display Active */
-    void set_V_DSPL_AKT(bool value){ raw = (raw & 0xffffffffffffffbf) | ((uint64_t)value & 0x1) << 6; }
+    void set_V_DSPL_AKT(bool value){ bytes[7] = (bytes[7] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Speed Limit / Tempomat Display Active */
-    bool get_V_DSPL_AKT() const { return (bool)(raw >> 6 & 0x1); }
+    bool get_V_DSPL_AKT() const { return (bool)(bytes[7] >> 6 & 0x1); }
         
     /** Sets Segment tacho available */
-    void set_SGT_VH(bool value){ raw = (raw & 0xffffffffffffffdf) | ((uint64_t)value & 0x1) << 5; }
+    void set_SGT_VH(bool value){ bytes[7] = (bytes[7] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Segment tacho available */
-    bool get_SGT_VH() const { return (bool)(raw >> 5 & 0x1); }
+    bool get_SGT_VH() const { return (bool)(bytes[7] >> 5 & 0x1); }
         
     /** Sets Release Heaters */
-    void set_ZH_FREIG(bool value){ raw = (raw & 0xffffffffffffffef) | ((uint64_t)value & 0x1) << 4; }
+    void set_ZH_FREIG(bool value){ bytes[7] = (bytes[7] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets Release Heaters */
-    bool get_ZH_FREIG() const { return (bool)(raw >> 4 & 0x1); }
+    bool get_ZH_FREIG() const { return (bool)(bytes[7] >> 4 & 0x1); }
         
     /** Sets Switch on Roll Test Mode ESP */
-    void set_RT_EIN(bool value){ raw = (raw & 0xfffffffffffffff7) | ((uint64_t)value & 0x1) << 3; }
+    void set_RT_EIN(bool value){ bytes[7] = (bytes[7] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Switch on Roll Test Mode ESP */
-    bool get_RT_EIN() const { return (bool)(raw >> 3 & 0x1); }
+    bool get_RT_EIN() const { return (bool)(bytes[7] >> 3 & 0x1); }
         
     /** Sets Winter tire maximum speed with 4 bits */
-    void set_WRC(KOMBI_408h_WRC value){ raw = (raw & 0xfffffffffffffff8) | ((uint64_t)value & 0x7) << 0; }
+    void set_WRC(KOMBI_408h_WRC value){ bytes[7] = (bytes[7] & 0xf8) | ((uint8_t)value & 0x7) << 0; }
 
     /** Gets Winter tire maximum speed with 4 bits */
-    KOMBI_408h_WRC get_WRC() const { return (KOMBI_408h_WRC)(raw >> 0 & 0x7); }
+    KOMBI_408h_WRC get_WRC() const { return (KOMBI_408h_WRC)(bytes[7] >> 0 & 0x7); }
         
 } KOMBI_408;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of KOMBI_412 */
 	uint32_t get_canid(){ return KOMBI_412_CAN_ID; }
     /** Sets Acoustic warning out */
-    void set_AKU_WARN_AUS(bool value){ raw = (raw & 0x7fffffffffffffff) | ((uint64_t)value & 0x1) << 63; }
+    void set_AKU_WARN_AUS(bool value){ bytes[0] = (bytes[0] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Acoustic warning out */
-    bool get_AKU_WARN_AUS() const { return (bool)(raw >> 63 & 0x1); }
+    bool get_AKU_WARN_AUS() const { return (bool)(bytes[0] >> 7 & 0x1); }
         
     /** Sets Optical warning out */
-    void set_OPT_WARN_AUS(bool value){ raw = (raw & 0xbfffffffffffffff) | ((uint64_t)value & 0x1) << 62; }
+    void set_OPT_WARN_AUS(bool value){ bytes[0] = (bytes[0] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Optical warning out */
-    bool get_OPT_WARN_AUS() const { return (bool)(raw >> 62 & 0x1); }
+    bool get_OPT_WARN_AUS() const { return (bool)(bytes[0] >> 6 & 0x1); }
         
     /** Sets Status Eco Warning */
-    void set_ECO_WARN_ST(bool value){ raw = (raw & 0xf7ffffffffffffff) | ((uint64_t)value & 0x1) << 59; }
+    void set_ECO_WARN_ST(bool value){ bytes[0] = (bytes[0] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Status Eco Warning */
-    bool get_ECO_WARN_ST() const { return (bool)(raw >> 59 & 0x1); }
+    bool get_ECO_WARN_ST() const { return (bool)(bytes[0] >> 3 & 0x1); }
         
     /** Sets distance unit */
-    void set_ABST_S(bool value){ raw = (raw & 0xff7fffffffffffff) | ((uint64_t)value & 0x1) << 55; }
+    void set_ABST_S(bool value){ bytes[1] = (bytes[1] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets distance unit */
-    bool get_ABST_S() const { return (bool)(raw >> 55 & 0x1); }
+    bool get_ABST_S() const { return (bool)(bytes[1] >> 7 & 0x1); }
         
     /** Sets set distance */
-    void set_IST_ABST(KOMBI_412h_IST_ABST value){ raw = (raw & 0xff8fffffffffffff) | ((uint64_t)value & 0x7) << 52; }
+    void set_IST_ABST(KOMBI_412h_IST_ABST value){ bytes[1] = (bytes[1] & 0x8f) | ((uint8_t)value & 0x7) << 4; }
 
     /** Gets set distance */
-    KOMBI_412h_IST_ABST get_IST_ABST() const { return (KOMBI_412h_IST_ABST)(raw >> 52 & 0x7); }
+    KOMBI_412h_IST_ABST get_IST_ABST() const { return (KOMBI_412h_IST_ABST)(bytes[1] >> 4 & 0x7); }
         
     /** Sets Speed displayed. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_V_ANZ(uint16_t value){ raw = (raw & 0xfff000ffffffffff) | ((uint64_t)value & 0xfff) << 40; }
+    void set_V_ANZ(uint16_t value){ raw = (raw & 0xffffffffff00f0ff) | __builtin_bswap64(((uint64_t)value & 0xfff) << 40); }
 
     /** Gets Speed displayed. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_V_ANZ() const { return (uint16_t)(raw >> 40 & 0xfff); }
+    uint16_t get_V_ANZ() const { return (uint16_t)(__builtin_bswap64(raw) >> 40 & 0xfff); }
         
     /** Sets wheel direction of rotation to V_ANZ */
-    void set_DRTGANZ(KOMBI_412h_DRTGANZ value){ raw = (raw & 0xffffff3fffffffff) | ((uint64_t)value & 0x3) << 38; }
+    void set_DRTGANZ(KOMBI_412h_DRTGANZ value){ bytes[3] = (bytes[3] & 0x3f) | ((uint8_t)value & 0x3) << 6; }
 
     /** Gets wheel direction of rotation to V_ANZ */
-    KOMBI_412h_DRTGANZ get_DRTGANZ() const { return (KOMBI_412h_DRTGANZ)(raw >> 38 & 0x3); }
+    KOMBI_412h_DRTGANZ get_DRTGANZ() const { return (KOMBI_412h_DRTGANZ)(bytes[3] >> 6 & 0x3); }
         
     /** Sets wheel speed calculated from V_ANZ. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_DANZ(uint16_t value){ raw = (raw & 0xffffffc000ffffff) | ((uint64_t)value & 0x3fff) << 24; }
+    void set_DANZ(uint16_t value){ raw = (raw & 0xffffff00c0ffffff) | __builtin_bswap64(((uint64_t)value & 0x3fff) << 24); }
 
     /** Gets wheel speed calculated from V_ANZ. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_DANZ() const { return (uint16_t)(raw >> 24 & 0x3fff); }
+    uint16_t get_DANZ() const { return (uint16_t)(__builtin_bswap64(raw) >> 24 & 0x3fff); }
         
     /** Sets Activation ECO in the combined menu */
-    void set_ECO_AKT(bool value){ raw = (raw & 0xfffffffffff7ffff) | ((uint64_t)value & 0x1) << 19; }
+    void set_ECO_AKT(bool value){ bytes[5] = (bytes[5] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Activation ECO in the combined menu */
-    bool get_ECO_AKT() const { return (bool)(raw >> 19 & 0x1); }
+    bool get_ECO_AKT() const { return (bool)(bytes[5] >> 3 & 0x1); }
         
     /** Sets Request PlatRollwarner */
-    void set_PRW_ANF(KOMBI_412h_PRW_ANF value){ raw = (raw & 0xfffffffffffcffff) | ((uint64_t)value & 0x3) << 16; }
+    void set_PRW_ANF(KOMBI_412h_PRW_ANF value){ bytes[5] = (bytes[5] & 0xfc) | ((uint8_t)value & 0x3) << 0; }
 
     /** Gets Request PlatRollwarner */
-    KOMBI_412h_PRW_ANF get_PRW_ANF() const { return (KOMBI_412h_PRW_ANF)(raw >> 16 & 0x3); }
+    KOMBI_412h_PRW_ANF get_PRW_ANF() const { return (KOMBI_412h_PRW_ANF)(bytes[5] >> 0 & 0x3); }
         
     /** Sets Motor setting time. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_MAZ_NEU(uint16_t value){ raw = (raw & 0xfffffffffffff000) | ((uint64_t)value & 0xfff) << 0; }
+    void set_MAZ_NEU(uint16_t value){ raw = (raw & 0x00f0ffffffffffff) | __builtin_bswap64(((uint64_t)value & 0xfff) << 0); }
 
     /** Gets Motor setting time. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_MAZ_NEU() const { return (uint16_t)(raw >> 0 & 0xfff); }
+    uint16_t get_MAZ_NEU() const { return (uint16_t)(__builtin_bswap64(raw) >> 0 & 0xfff); }
         
 } KOMBI_412;
 
 
 
-class ECU_KOMBI {
-	public:
-        /**
-         * @brief Imports the CAN frame given the CAN ID, CAN Contents, and current timestamp
-         *
-         * Returns true if the frame was imported successfully, and false if import failed (Due to non-matching CAN ID).
-         *
-         * NOTE: The endianness of the value cannot be guaranteed. It is up to the caller to correct the byte order!
-         */
-        bool import_frames(uint64_t value, uint32_t can_id, uint64_t timestamp_now) {
-            switch(can_id) {
-                case KOMBI_408_CAN_ID:
-                    LAST_FRAME_TIMES[0] = timestamp_now;
-                    FRAME_DATA[0] = value;
-                    return true;
-                case KOMBI_412_CAN_ID:
-                    LAST_FRAME_TIMES[1] = timestamp_now;
-                    FRAME_DATA[1] = value;
-                    return true;
-                default:
-                    return false;
-            }
-        }
-        
-        /** Sets data in pointer to KOMBI_408
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_KOMBI_408(uint64_t now, uint64_t max_expire_time, KOMBI_408* dest) const {
-            if (LAST_FRAME_TIMES[0] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[0] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[0];
-                return true;
-            }
-        }
-            
-        /** Sets data in pointer to KOMBI_412
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_KOMBI_412(uint64_t now, uint64_t max_expire_time, KOMBI_412* dest) const {
-            if (LAST_FRAME_TIMES[1] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[1] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[1];
-                return true;
-            }
-        }
-            
-	private:
-		uint64_t FRAME_DATA[2];
-		uint64_t LAST_FRAME_TIMES[2];
-};
+// No frames of ECU 'KOMBI' are read by the TCM, so it has no storage class
 #endif // __ECU_KOMBI_H_
 
 #endif // EGS52_MODE
\ No newline at end of file
@@ -14,6 +14,13 @@
 #define __ECU_MRM_H_
 
 #include <stdint.h>
+#include "seqlock.h"
+#include "ecu_frame_stats.h"
+#include "ecu_frame_check.h"
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+    #error "Generated CAN frame accessors assume a little endian CPU"
+#endif
     
 #define LRW_236_CAN_ID 0x0236
 #define MRM_238_CAN_ID 0x0238
@@ -37,221 +44,158 @@ enum class LRW_236h_LRWS_ST {
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of LRW_236 */
 	uint32_t get_canid(){ return LRW_236_CAN_ID; }
     /** Sets Steering wheel angle. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_LRW(uint16_t value){ raw = (raw & 0xc000ffffffffffff) | ((uint64_t)value & 0x3fff) << 48; }
+    void set_LRW(uint16_t value){ raw = (raw & 0xffffffffffff00c0) | __builtin_bswap64(((uint64_t)value & 0x3fff) << 48); }
 
     /** Gets Steering wheel angle. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_LRW() const { return (uint16_t)(raw >> 48 & 0x3fff); }
+    uint16_t get_LRW() const { return (uint16_t)(__builtin_bswap64(raw) >> 48 & 0x3fff); }
         
     /** Sets steering wheel angular velocity. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_VLRW(uint16_t value){ raw = (raw & 0xffffc000ffffffff) | ((uint64_t)value & 0x3fff) << 32; }
+    void set_VLRW(uint16_t value){ raw = (raw & 0xffffffff00c0ffff) | __builtin_bswap64(((uint64_t)value & 0x3fff) << 32); }
 
     /** Gets steering wheel angular velocity. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_VLRW() const { return (uint16_t)(raw >> 32 & 0x3fff); }
+    uint16_t get_VLRW() const { return (uint16_t)(__builtin_bswap64(raw) >> 32 & 0x3fff); }
         
     /** Sets Message counter. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_BZ236h(uint8_t value){ raw = (raw & 0xffffffff0fffffff) | ((uint64_t)value & 0xf) << 28; }
+    void set_BZ236h(uint8_t value){ bytes[4] = (bytes[4] & 0x0f) | ((uint8_t)value & 0xf) << 4; }
 
     /** Gets Message counter. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_BZ236h() const { return (uint8_t)(raw >> 28 & 0xf); }
+    uint8_t get_BZ236h() const { return (uint8_t)(bytes[4] >> 4 & 0xf); }
         
     /** Sets Identification steering wheel angle sensor */
-    void set_LRWS_ID(LRW_236h_LRWS_ID value){ raw = (raw & 0xfffffffff3ffffff) | ((uint64_t)value & 0x3) << 26; }
+    void set_LRWS_ID(LRW_236h_LRWS_ID value){ bytes[4] = (bytes[4] & 0xf3) | ((uint8_t)value & 0x3) << 2; }
 
     /** Gets Identification steering wheel angle sensor */
-    LRW_236h_LRWS_ID get_LRWS_ID() const { return (LRW_236h_LRWS_ID)(raw >> 26 & 0x3); }
+    LRW_236h_LRWS_ID get_LRWS_ID() const { return (LRW_236h_LRWS_ID)(bytes[4] >> 2 & 0x3); }
         
     /** Sets Status steering wheel angle sensor */
-    void set_LRWS_ST(LRW_236h_LRWS_ST value){ raw = (raw & 0xfffffffffcffffff) | ((uint64_t)value & 0x3) << 24; }
+    void set_LRWS_ST(LRW_236h_LRWS_ST value){ bytes[4] = (bytes[4] & 0xfc) | ((uint8_t)value & 0x3) << 0; }
 
     /** Gets Status steering wheel angle sensor */
-    LRW_236h_LRWS_ST get_LRWS_ST() const { return (LRW_236h_LRWS_ST)(raw >> 24 & 0x3); }
+    LRW_236h_LRWS_ST get_LRWS_ST() const { return (LRW_236h_LRWS_ST)(bytes[4] >> 0 & 0x3); }
         
     /** Sets CRC checksum byte 1 - 7 to SAE J1850. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_CRC236h(uint8_t value){ raw = (raw & 0xffffffffffffff00) | ((uint64_t)value & 0xff) << 0; }
+    void set_CRC236h(uint8_t value){ bytes[7] = (bytes[7] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets CRC checksum byte 1 - 7 to SAE J1850. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_CRC236h() const { return (uint8_t)(raw >> 0 & 0xff); }
+    uint8_t get_CRC236h() const { return (uint8_t)(bytes[7] >> 0 & 0xff); }
         
 } LRW_236;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of MRM_238 */
 	uint32_t get_canid(){ return MRM_238_CAN_ID; }
     /** Sets Tempomat selector lever unplausible */
-    void set_WH_UP(bool value){ raw = (raw & 0xdfffffffffffffff) | ((uint64_t)value & 0x1) << 61; }
+    void set_WH_UP(bool value){ bytes[0] = (bytes[0] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Tempomat selector lever unplausible */
-    bool get_WH_UP() const { return (bool)(raw >> 61 & 0x1); }
+    bool get_WH_UP() const { return (bool)(bytes[0] >> 5 & 0x1); }
         
     /** Sets Operation variable speed limitation */
-    void set_VMAX_AKT(bool value){ raw = (raw & 0xefffffffffffffff) | ((uint64_t)value & 0x1) << 60; }
+    void set_VMAX_AKT(bool value){ bytes[0] = (bytes[0] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets Operation variable speed limitation */
-    bool get_VMAX_AKT() const { return (bool)(raw >> 60 & 0x1); }
+    bool get_VMAX_AKT() const { return (bool)(bytes[0] >> 4 & 0x1); }
         
     /** Sets Tempomatwatch Lever: "Setting and delaying Levo0" */
-    void set_S_MINUS_B(bool value){ raw = (raw & 0xf7ffffffffffffff) | ((uint64_t)value & 0x1) << 59; }
+    void set_S_MINUS_B(bool value){ bytes[0] = (bytes[0] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Tempomatwatch Lever: "Setting and delaying Levo0" */
-    bool get_S_MINUS_B() const { return (bool)(raw >> 59 & 0x1); }
+    bool get_S_MINUS_B() const { return (bool)(bytes[0] >> 3 & 0x1); }
         
     /** Sets Tempomat selector lever: "Setting and Accelerating Level0" */
-    void set_S_PLUS_B(bool value){ raw = (raw & 0xfbffffffffffffff) | ((uint64_t)value & 0x1) << 58; }
+    void set_S_PLUS_B(bool value){ bytes[0] = (bytes[0] & 0xfb) | ((uint8_t)value & 0x1) << 2; }
 
     /** Gets Tempomat selector lever: "Setting and Accelerating Level0" */
-    bool get_S_PLUS_B() const { return (bool)(raw >> 58 & 0x1); }
+    bool get_S_PLUS_B() const { return (bool)(bytes[0] >> 2 & 0x1); }
         
     /** Sets Cruise control lever: "Recovery" */
-    void set_WA(bool value){ raw = (raw & 0xfdffffffffffffff) | ((uint64_t)value & 0x1) << 57; }
+    void set_WA(bool value){ bytes[0] = (bytes[0] & 0xfd) | ((uint8_t)value & 0x1) << 1; }
 
     /** Gets Cruise control lever: "Recovery" */
-    bool get_WA() const { return (bool)(raw >> 57 & 0x1); }
+    bool get_WA() const { return (bool)(bytes[0] >> 1 & 0x1); }
         
     /** Sets Tempomat selector lever: "Switch off" */
-    void set_AUS(bool value){ raw = (raw & 0xfeffffffffffffff) | ((uint64_t)value & 0x1) << 56; }
+    void set_AUS(bool value){ bytes[0] = (bytes[0] & 0xfe) | ((uint8_t)value & 0x1) << 0; }
 
     /** Gets Tempomat selector lever: "Switch off" */
-    bool get_AUS() const { return (bool)(raw >> 56 & 0x1); }
+    bool get_AUS() const { return (bool)(bytes[0] >> 0 & 0x1); }
         
     /** Sets directional flashing right */
-    void set_BLI_RE(bool value){ raw = (raw & 0xff7fffffffffffff) | ((uint64_t)value & 0x1) << 55; }
+    void set_BLI_RE(bool value){ bytes[1] = (bytes[1] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets directional flashing right */
-    bool get_BLI_RE() const { return (bool)(raw >> 55 & 0x1); }
+    bool get_BLI_RE() const { return (bool)(bytes[1] >> 7 & 0x1); }
         
     /** Sets direction flash left */
-    void set_BLI_LI(bool value){ raw = (raw & 0xffbfffffffffffff) | ((uint64_t)value & 0x1) << 54; }
+    void set_BLI_LI(bool value){ bytes[1] = (bytes[1] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets direction flash left */
-    bool get_BLI_LI() const { return (bool)(raw >> 54 & 0x1); }
+    bool get_BLI_LI() const { return (bool)(bytes[1] >> 6 & 0x1); }
         
     /** Sets Tempomat selector lever Parity (straight parity) */
-    void set_WH_PA(bool value){ raw = (raw & 0xffefffffffffffff) | ((uint64_t)value & 0x1) << 52; }
+    void set_WH_PA(bool value){ bytes[1] = (bytes[1] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets Tempomat selector lever Parity (straight parity) */
-    bool get_WH_PA() const { return (bool)(raw >> 52 & 0x1); }
+    bool get_WH_PA() const { return (bool)(bytes[1] >> 4 & 0x1); }
         
     /** Sets Message counter. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_BZ238h(uint8_t value){ raw = (raw & 0xfff0ffffffffffff) | ((uint64_t)value & 0xf) << 48; }
+    void set_BZ238h(uint8_t value){ bytes[1] = (bytes[1] & 0xf0) | ((uint8_t)value & 0xf) << 0; }
 
     /** Gets Message counter. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_BZ238h() const { return (uint8_t)(raw >> 48 & 0xf); }
+    uint8_t get_BZ238h() const { return (uint8_t)(bytes[1] >> 0 & 0xf); }
         
     /** Sets Steering angle parity (straight parity) */
-    void set_LW_PA(bool value){ raw = (raw & 0xffff7fffffffffff) | ((uint64_t)value & 0x1) << 47; }
+    void set_LW_PA(bool value){ bytes[2] = (bytes[2] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Steering angle parity (straight parity) */
-    bool get_LW_PA() const { return (bool)(raw >> 47 & 0x1); }
+    bool get_LW_PA() const { return (bool)(bytes[2] >> 7 & 0x1); }
         
     /** Sets Steering angle sensor: overflow */
-    void set_LW_OV(bool value){ raw = (raw & 0xffffbfffffffffff) | ((uint64_t)value & 0x1) << 46; }
+    void set_LW_OV(bool value){ bytes[2] = (bytes[2] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Steering angle sensor: overflow */
-    bool get_LW_OV() const { return (bool)(raw >> 46 & 0x1); }
+    bool get_LW_OV() const { return (bool)(bytes[2] >> 6 & 0x1); }
         
     /** Sets Steering angle sensor: Code error */
-    void set_LW_CF(bool value){ raw = (raw & 0xffffdfffffffffff) | ((uint64_t)value & 0x1) << 45; }
+    void set_LW_CF(bool value){ bytes[2] = (bytes[2] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Steering angle sensor: Code error */
-    bool get_LW_CF() const { return (bool)(raw >> 45 & 0x1); }
+    bool get_LW_CF() const { return (bool)(bytes[2] >> 5 & 0x1); }
         
     /** Sets Steering angle sensor: not initialized */
-    void set_LW_INI(bool value){ raw = (raw & 0xffffefffffffffff) | ((uint64_t)value & 0x1) << 44; }
+    void set_LW_INI(bool value){ bytes[2] = (bytes[2] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets Steering angle sensor: not initialized */
-    bool get_LW_INI() const { return (bool)(raw >> 44 & 0x1); }
+    bool get_LW_INI() const { return (bool)(bytes[2] >> 4 & 0x1); }
         
     /** Sets Steering angle sign */
-    void set_LW_VZ(bool value){ raw = (raw & 0xfffff7ffffffffff) | ((uint64_t)value & 0x1) << 43; }
+    void set_LW_VZ(bool value){ bytes[2] = (bytes[2] & 0xf7) | ((uint8_t)value & 0x1) << 3; }
 
     /** Gets Steering angle sign */
-    bool get_LW_VZ() const { return (bool)(raw >> 43 & 0x1); }
+    bool get_LW_VZ() const { return (bool)(bytes[2] >> 3 & 0x1); }
         
     /** Sets steering angle. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_LW(uint16_t value){ raw = (raw & 0xfffff800ffffffff) | ((uint64_t)value & 0x7ff) << 32; }
+    void set_LW(uint16_t value){ raw = (raw & 0xffffffff00f8ffff) | __builtin_bswap64(((uint64_t)value & 0x7ff) << 32); }
 
     /** Gets steering angle. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint16_t get_LW() const { return (uint16_t)(raw >> 32 & 0x7ff); }
+    uint16_t get_LW() const { return (uint16_t)(__builtin_bswap64(raw) >> 32 & 0x7ff); }
         
 } MRM_238;
 
 
 
-class ECU_MRM {
-	public:
-        /**
-         * @brief Imports the CAN frame given the CAN ID, CAN Contents, and current timestamp
-         *
-         * Returns true if the frame was imported successfully, and false if import failed (Due to non-matching CAN ID).
-         *
-         * NOTE: The endianness of the value cannot be guaranteed. It is up to the caller to correct the byte order!
-         */
-        bool import_frames(uint64_t value, uint32_t can_id, uint64_t timestamp_now) {
-            switch(can_id) {
-                case LRW_236_CAN_ID:
-                    LAST_FRAME_TIMES[0] = timestamp_now;
-                    FRAME_DATA[0] = value;
-                    return true;
-                case MRM_238_CAN_ID:
-                    LAST_FRAME_TIMES[1] = timestamp_now;
-                    FRAME_DATA[1] = value;
-                    return true;
-                default:
-                    return false;
-            }
-        }
-        
-        /** Sets data in pointer to LRW_236
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_LRW_236(uint64_t now, uint64_t max_expire_time, LRW_236* dest) const {
-            if (LAST_FRAME_TIMES[0] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[0] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[0];
-                return true;
-            }
-        }
-            
-        /** Sets data in pointer to MRM_238
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_MRM_238(uint64_t now, uint64_t max_expire_time, MRM_238* dest) const {
-            if (LAST_FRAME_TIMES[1] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[1] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[1];
-                return true;
-            }
-        }
-            
-	private:
-		uint64_t FRAME_DATA[2];
-		uint64_t LAST_FRAME_TIMES[2];
-};
+// No frames of ECU 'MRM' are read by the TCM, so it has no storage class
 #endif // __ECU_MRM_H_
 
 #endif // EGS52_MODE
\ No newline at end of file
@@ -14,6 +14,13 @@
 #define __ECU_ANY_ECU_H_
 
 #include <stdint.h>
+#include "seqlock.h"
+#include "ecu_frame_stats.h"
+#include "ecu_frame_check.h"
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+    #error "Generated CAN frame accessors assume a little endian CPU"
+#endif
     
 #define SG_A1_CAN_ID 0x02F7
 #define ISM_DISP_RQ_CAN_ID 0x02F5
@@ -283,487 +290,336 @@ enum class NM_SSP_Nw_Id {
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of SG_A1 */
 	uint32_t get_canid(){ return SG_A1_CAN_ID; }
     /** Sets Starter / Generator Output DC Current / DC Current. Conversion formula (To raw from real): y=(x+3276.60009765625)/0.10 (Unit: A) */
-    void set_SG_OutDC_Curr(uint16_t value){ raw = (raw & 0x0000ffffffffffff) | ((uint64_t)value & 0xffff) << 48; }
+    void set_SG_OutDC_Curr(uint16_t value){ raw = (raw & 0xffffffffffff0000) | __builtin_bswap64(((uint64_t)value & 0xffff) << 48); }
 
     /** Gets Starter / Generator Output DC Current / DC Current. Conversion formula (To real from raw): y=(0.10x)-3276.60009765625 (Unit: A) */
-    uint16_t get_SG_OutDC_Curr() const { return (uint16_t)(raw >> 48 & 0xffff); }
+    uint16_t get_SG_OutDC_Curr() const { return (uint16_t)(__builtin_bswap64(raw) >> 48 & 0xffff); }
         
     /** Sets Starter / Generator Output DC Voltage / DC Voltage. Conversion formula (To raw from real): y=(x-0.0)/0.10 (Unit: V) */
-    void set_SG_OutDC_Volt(uint16_t value){ raw = (raw & 0xffff0000ffffffff) | ((uint64_t)value & 0xffff) << 32; }
+    void set_SG_OutDC_Volt(uint16_t value){ raw = (raw & 0xffffffff0000ffff) | __builtin_bswap64(((uint64_t)value & 0xffff) << 32); }
 
     /** Gets Starter / Generator Output DC Voltage / DC Voltage. Conversion formula (To real from raw): y=(0.10x)+0.0 (Unit: V) */
-    uint16_t get_SG_OutDC_Volt() const { return (uint16_t)(raw >> 32 & 0xffff); }
+    uint16_t get_SG_OutDC_Volt() const { return (uint16_t)(__builtin_bswap64(raw) >> 32 & 0xffff); }
         
     /** Sets Electric Machine # 1 Diagnostics State / Diagnostic Status E-Machine 1 */
-    void set_EM1_Diag_Stat(SG_A1_EM1_Diag_Stat value){ raw = (raw & 0xffffffffffff00ff) | ((uint64_t)value & 0xff) << 8; }
+    void set_EM1_Diag_Stat(SG_A1_EM1_Diag_Stat value){ bytes[6] = (bytes[6] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Electric Machine # 1 Diagnostics State / Diagnostic Status E-Machine 1 */
-    SG_A1_EM1_Diag_Stat get_EM1_Diag_Stat() const { return (SG_A1_EM1_Diag_Stat)(raw >> 8 & 0xff); }
+    SG_A1_EM1_Diag_Stat get_EM1_Diag_Stat() const { return (SG_A1_EM1_Diag_Stat)(bytes[6] >> 0 & 0xff); }
         
     /** Sets Error Check State / Status Error Check */
-    void set_SG_ErrChk_Stat(SG_A1_SG_ErrChk_Stat value){ raw = (raw & 0xffffffffffffff3f) | ((uint64_t)value & 0x3) << 6; }
+    void set_SG_ErrChk_Stat(SG_A1_SG_ErrChk_Stat value){ bytes[7] = (bytes[7] & 0x3f) | ((uint8_t)value & 0x3) << 6; }
 
     /** Gets Error Check State / Status Error Check */
-    SG_A1_SG_ErrChk_Stat get_SG_ErrChk_Stat() const { return (SG_A1_SG_ErrChk_Stat)(raw >> 6 & 0x3); }
+    SG_A1_SG_ErrChk_Stat get_SG_ErrChk_Stat() const { return (SG_A1_SG_ErrChk_Stat)(bytes[7] >> 6 & 0x3); }
         
     /** Sets Electric Machine # 1 Enhanced Cooling Request / Request Advanced Cooling of the E-Machine 1 */
-    void set_EM1_EnhCool_Rq(bool value){ raw = (raw & 0xffffffffffffffdf) | ((uint64_t)value & 0x1) << 5; }
+    void set_EM1_EnhCool_Rq(bool value){ bytes[7] = (bytes[7] & 0xdf) | ((uint8_t)value & 0x1) << 5; }
 
     /** Gets Electric Machine # 1 Enhanced Cooling Request / Request Advanced Cooling of the E-Machine 1 */
-    bool get_EM1_EnhCool_Rq() const { return (bool)(raw >> 5 & 0x1); }
+    bool get_EM1_EnhCool_Rq() const { return (bool)(bytes[7] >> 5 & 0x1); }
         
     /** Sets Error Number / Error Number. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_EM1_ErrNum(uint8_t value){ raw = (raw & 0xffffffffffffffe0) | ((uint64_t)value & 0x1f) << 0; }
+    void set_EM1_ErrNum(uint8_t value){ bytes[7] = (bytes[7] & 0xe0) | ((uint8_t)value & 0x1f) << 0; }
 
     /** Gets Error Number / Error Number. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_EM1_ErrNum() const { return (uint8_t)(raw >> 0 & 0x1f); }
+    uint8_t get_EM1_ErrNum() const { return (uint8_t)(bytes[7] >> 0 & 0x1f); }
         
 } SG_A1;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of ISM_DISP_RQ */
 	uint32_t get_canid(){ return ISM_DISP_RQ_CAN_ID; }
     /** Sets Transmission Driving Position Display Request / Request Display Gearbox */
-    void set_TxDrvPosn_Disp_Rq_ISM(ISM_DISP_RQ_TxDrvPosn_Disp_Rq_ISM value){ raw = (raw & 0x00ffffffffffffff) | ((uint64_t)value & 0xff) << 56; }
+    void set_TxDrvPosn_Disp_Rq_ISM(ISM_DISP_RQ_TxDrvPosn_Disp_Rq_ISM value){ bytes[0] = (bytes[0] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Transmission Driving Position Display Request / Request Display Gearbox */
-    ISM_DISP_RQ_TxDrvPosn_Disp_Rq_ISM get_TxDrvPosn_Disp_Rq_ISM() const { return (ISM_DISP_RQ_TxDrvPosn_Disp_Rq_ISM)(raw >> 56 & 0xff); }
+    ISM_DISP_RQ_TxDrvPosn_Disp_Rq_ISM get_TxDrvPosn_Disp_Rq_ISM() const { return (ISM_DISP_RQ_TxDrvPosn_Disp_Rq_ISM)(bytes[0] >> 0 & 0xff); }
         
     /** Sets Shift by Wire Beep Request / Request Shift by Wire Warnington */
-    void set_SBW_Beep_Rq_ISM(bool value){ raw = (raw & 0xffff7fffffffffff) | ((uint64_t)value & 0x1) << 47; }
+    void set_SBW_Beep_Rq_ISM(bool value){ bytes[2] = (bytes[2] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Shift by Wire Beep Request / Request Shift by Wire Warnington */
-    bool get_SBW_Beep_Rq_ISM() const { return (bool)(raw >> 47 & 0x1); }
+    bool get_SBW_Beep_Rq_ISM() const { return (bool)(bytes[2] >> 7 & 0x1); }
         
     /** Sets Shift by Wire Message Display Request / Request Shift by Wire Show message */
-    void set_SBW_Msg_Disp_Rq_ISM(ISM_DISP_RQ_SBW_Msg_Disp_Rq_ISM value){ raw = (raw & 0xfffff8ffffffffff) | ((uint64_t)value & 0x7) << 40; }
+    void set_SBW_Msg_Disp_Rq_ISM(ISM_DISP_RQ_SBW_Msg_Disp_Rq_ISM value){ bytes[2] = (bytes[2] & 0xf8) | ((uint8_t)value & 0x7) << 0; }
 
     /** Gets Shift by Wire Message Display Request / Request Shift by Wire Show message */
-    ISM_DISP_RQ_SBW_Msg_Disp_Rq_ISM get_SBW_Msg_Disp_Rq_ISM() const { return (ISM_DISP_RQ_SBW_Msg_Disp_Rq_ISM)(raw >> 40 & 0x7); }
+    ISM_DISP_RQ_SBW_Msg_Disp_Rq_ISM get_SBW_Msg_Disp_Rq_ISM() const { return (ISM_DISP_RQ_SBW_Msg_Disp_Rq_ISM)(bytes[2] >> 0 & 0x7); }
         
     /** Sets Transmission Selector Lever Motion Lock 2 Display Request / Request Transmission Lock Lock 2 Display */
-    void set_TSL_MtnLk2_Disp_Rq_ISM(ISM_DISP_RQ_TSL_MtnLk2_Disp_Rq_ISM value){ raw = (raw & 0xffffff0fffffffff) | ((uint64_t)value & 0xf) << 36; }
+    void set_TSL_MtnLk2_Disp_Rq_ISM(ISM_DISP_RQ_TSL_MtnLk2_Disp_Rq_ISM value){ bytes[3] = (bytes[3] & 0x0f) | ((uint8_t)value & 0xf) << 4; }
 
     /** Gets Transmission Selector Lever Motion Lock 2 Display Request / Request Transmission Lock Lock 2 Display */
-    ISM_DISP_RQ_TSL_MtnLk2_Disp_Rq_ISM get_TSL_MtnLk2_Disp_Rq_ISM() const { return (ISM_DISP_RQ_TSL_MtnLk2_Disp_Rq_ISM)(raw >> 36 & 0xf); }
+    ISM_DISP_RQ_TSL_MtnLk2_Disp_Rq_ISM get_TSL_MtnLk2_Disp_Rq_ISM() const { return (ISM_DISP_RQ_TSL_MtnLk2_Disp_Rq_ISM)(bytes[3] >> 4 & 0xf); }
         
     /** Sets Transmission Selector Lever Motion Lock 1 Display Request / Request Transmission Lock Lock 1 Display */
-    void set_TSL_MtnLk1_Disp_Rq_ISM(ISM_DISP_RQ_TSL_MtnLk1_Disp_Rq_ISM value){ raw = (raw & 0xfffffff0ffffffff) | ((uint64_t)value & 0xf) << 32; }
+    void set_TSL_MtnLk1_Disp_Rq_ISM(ISM_DISP_RQ_TSL_MtnLk1_Disp_Rq_ISM value){ bytes[3] = (bytes[3] & 0xf0) | ((uint8_t)value & 0xf) << 0; }
 
     /** Gets Transmission Selector Lever Motion Lock 1 Display Request / Request Transmission Lock Lock 1 Display */
-    ISM_DISP_RQ_TSL_MtnLk1_Disp_Rq_ISM get_TSL_MtnLk1_Disp_Rq_ISM() const { return (ISM_DISP_RQ_TSL_MtnLk1_Disp_Rq_ISM)(raw >> 32 & 0xf); }
+    ISM_DISP_RQ_TSL_MtnLk1_Disp_Rq_ISM get_TSL_MtnLk1_Disp_Rq_ISM() const { return (ISM_DISP_RQ_TSL_MtnLk1_Disp_Rq_ISM)(bytes[3] >> 0 & 0xf); }
         
     /** Sets Transmission Selector Lever Motion Lock 4 Display Request / Request Transmission Lock Lock 4 Display */
-    void set_TSL_MtnLk4_Disp_Rq_ISM(ISM_DISP_RQ_TSL_MtnLk4_Disp_Rq_ISM value){ raw = (raw & 0xffffffff0fffffff) | ((uint64_t)value & 0xf) << 28; }
+    void set_TSL_MtnLk4_Disp_Rq_ISM(ISM_DISP_RQ_TSL_MtnLk4_Disp_Rq_ISM value){ bytes[4] = (bytes[4] & 0x0f) | ((uint8_t)value & 0xf) << 4; }
 
     /** Gets Transmission Selector Lever Motion Lock 4 Display Request / Request Transmission Lock Lock 4 Display */
-    ISM_DISP_RQ_TSL_MtnLk4_Disp_Rq_ISM get_TSL_MtnLk4_Disp_Rq_ISM() const { return (ISM_DISP_RQ_TSL_MtnLk4_Disp_Rq_ISM)(raw >> 28 & 0xf); }
+    ISM_DISP_RQ_TSL_MtnLk4_Disp_Rq_ISM get_TSL_MtnLk4_Disp_Rq_ISM() const { return (ISM_DISP_RQ_TSL_MtnLk4_Disp_Rq_ISM)(bytes[4] >> 4 & 0xf); }
         
     /** Sets Transmission Selector Lever Motion Lock 3 Display Request / Request Transmission Lock Lock 3 Display */
-    void set_TSL_MtnLk3_Disp_Rq_ISM(ISM_DISP_RQ_TSL_MtnLk3_Disp_Rq_ISM value){ raw = (raw & 0xfffffffff0ffffff) | ((uint64_t)value & 0xf) << 24; }
+    void set_TSL_MtnLk3_Disp_Rq_ISM(ISM_DISP_RQ_TSL_MtnLk3_Disp_Rq_ISM value){ bytes[4] = (bytes[4] & 0xf0) | ((uint8_t)value & 0xf) << 0; }
 
     /** Gets Transmission Selector Lever Motion Lock 3 Display Request / Request Transmission Lock Lock 3 Display */
-    ISM_DISP_RQ_TSL_MtnLk3_Disp_Rq_ISM get_TSL_MtnLk3_Disp_Rq_ISM() const { return (ISM_DISP_RQ_TSL_MtnLk3_Disp_Rq_ISM)(raw >> 24 & 0xf); }
+    ISM_DISP_RQ_TSL_MtnLk3_Disp_Rq_ISM get_TSL_MtnLk3_Disp_Rq_ISM() const { return (ISM_DISP_RQ_TSL_MtnLk3_Disp_Rq_ISM)(bytes[4] >> 0 & 0xf); }
         
 } ISM_DISP_RQ;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of SSP_RS_SSP */
 	uint32_t get_canid(){ return SSP_RS_SSP_CAN_ID; }
     /** Sets Actual Current Duty Cycle / Actual Electricity (duty cycle). Conversion formula (To raw from real): y=(x-0.0)/0.50 (Unit: %) */
-    void set_CurrDtyCyc_Actl(uint8_t value){ raw = (raw & 0x00ffffffffffffff) | ((uint64_t)value & 0xff) << 56; }
+    void set_CurrDtyCyc_Actl(uint8_t value){ bytes[0] = (bytes[0] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Actual Current Duty Cycle / Actual Electricity (duty cycle). Conversion formula (To real from raw): y=(0.50x)+0.0 (Unit: %) */
-    uint8_t get_CurrDtyCyc_Actl() const { return (uint8_t)(raw >> 56 & 0xff); }
+    uint8_t get_CurrDtyCyc_Actl() const { return (uint8_t)(bytes[0] >> 0 & 0xff); }
         
     /** Sets SSP Diagnostics State / SSP Diagnostic Status */
-    void set_SSP_Diag_Stat(SSP_RS_SSP_SSP_Diag_Stat value){ raw = (raw & 0xff00ffffffffffff) | ((uint64_t)value & 0xff) << 48; }
+    void set_SSP_Diag_Stat(SSP_RS_SSP_SSP_Diag_Stat value){ bytes[1] = (bytes[1] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets SSP Diagnostics State / SSP Diagnostic Status */
-    SSP_RS_SSP_SSP_Diag_Stat get_SSP_Diag_Stat() const { return (SSP_RS_SSP_SSP_Diag_Stat)(raw >> 48 & 0xff); }
+    SSP_RS_SSP_SSP_Diag_Stat get_SSP_Diag_Stat() const { return (SSP_RS_SSP_SSP_Diag_Stat)(bytes[1] >> 0 & 0xff); }
         
     /** Sets ACTUAL RPM SSP / Current SSP speed. Conversion formula (To raw from real): y=(x-0.0)/1.00 (Unit: rpm) */
-    void set_SSP_RPM(uint16_t value){ raw = (raw & 0xffffffc000ffffff) | ((uint64_t)value & 0x3fff) << 24; }
+    void set_SSP_RPM(uint16_t value){ raw = (raw & 0xffffff00c0ffffff) | __builtin_bswap64(((uint64_t)value & 0x3fff) << 24); }
 
     /** Gets ACTUAL RPM SSP / Current SSP speed. Conversion formula (To real from raw): y=(1.00x)+0.0 (Unit: rpm) */
-    uint16_t get_SSP_RPM() const { return (uint16_t)(raw >> 24 & 0x3fff); }
+    uint16_t get_SSP_RPM() const { return (uint16_t)(__builtin_bswap64(raw) >> 24 & 0x3fff); }
         
     /** Sets Message Counter / Message Counter. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_MC_SSP_RS_SSP(uint8_t value){ raw = (raw & 0xffffffffffff0fff) | ((uint64_t)value & 0xf) << 12; }
+    void set_MC_SSP_RS_SSP(uint8_t value){ bytes[6] = (bytes[6] & 0x0f) | ((uint8_t)value & 0xf) << 4; }
 
     /** Gets Message Counter / Message Counter. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_MC_SSP_RS_SSP() const { return (uint8_t)(raw >> 12 & 0xf); }
+    uint8_t get_MC_SSP_RS_SSP() const { return (uint8_t)(bytes[6] >> 4 & 0xf); }
         
     /** Sets CRC Checksum Byte 1 to 7 Accordinging to SAE J1850 / CRC Checksum Byte 1 - 7 to SAE J1850. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_CRC_SSP_RS_SSP(uint8_t value){ raw = (raw & 0xffffffffffffff00) | ((uint64_t)value & 0xff) << 0; }
+    void set_CRC_SSP_RS_SSP(uint8_t value){ bytes[7] = (bytes[7] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets CRC Checksum Byte 1 to 7 Accordinging to SAE J1850 / CRC Checksum Byte 1 - 7 to SAE J1850. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_CRC_SSP_RS_SSP() const { return (uint8_t)(raw >> 0 & 0xff); }
+    uint8_t get_CRC_SSP_RS_SSP() const { return (uint8_t)(bytes[7] >> 0 & 0xff); }
         
 } SSP_RS_SSP;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of NM_FSCM2 */
 	uint32_t get_canid(){ return NM_FSCM2_CAN_ID; }
     /** Sets Network Management Mode / Network Management Mode */
-    void set_NM_Mode(NM_FSCM2_NM_Mode value){ raw = (raw & 0x00ffffffffffffff) | ((uint64_t)value & 0xff) << 56; }
+    void set_NM_Mode(NM_FSCM2_NM_Mode value){ bytes[0] = (bytes[0] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Management Mode / Network Management Mode */
-    NM_FSCM2_NM_Mode get_NM_Mode() const { return (NM_FSCM2_NM_Mode)(raw >> 56 & 0xff); }
+    NM_FSCM2_NM_Mode get_NM_Mode() const { return (NM_FSCM2_NM_Mode)(bytes[0] >> 0 & 0xff); }
         
     /** Sets Network Management Logical Successor / Network Management Logical Successor. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_NM_Successor(uint8_t value){ raw = (raw & 0xff00ffffffffffff) | ((uint64_t)value & 0xff) << 48; }
+    void set_NM_Successor(uint8_t value){ bytes[1] = (bytes[1] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Management Logical Successor / Network Management Logical Successor. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_NM_Successor() const { return (uint8_t)(raw >> 48 & 0xff); }
+    uint8_t get_NM_Successor() const { return (uint8_t)(bytes[1] >> 0 & 0xff); }
         
     /** Sets Network Management Sleep Indication / Network Management Sleep Indication */
-    void set_NM_Sleep_Ind(bool value){ raw = (raw & 0xffff7fffffffffff) | ((uint64_t)value & 0x1) << 47; }
+    void set_NM_Sleep_Ind(bool value){ bytes[2] = (bytes[2] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Network Management Sleep Indication / Network Management Sleep Indication */
-    bool get_NM_Sleep_Ind() const { return (bool)(raw >> 47 & 0x1); }
+    bool get_NM_Sleep_Ind() const { return (bool)(bytes[2] >> 7 & 0x1); }
         
     /** Sets Network Management Sleep Acknowledge / Network Management Sleep Acknowledge */
-    void set_NM_Sleep_Ack(bool value){ raw = (raw & 0xffffbfffffffffff) | ((uint64_t)value & 0x1) << 46; }
+    void set_NM_Sleep_Ack(bool value){ bytes[2] = (bytes[2] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Network Management Sleep Acknowledge / Network Management Sleep Acknowledge */
-    bool get_NM_Sleep_Ack() const { return (bool)(raw >> 46 & 0x1); }
+    bool get_NM_Sleep_Ack() const { return (bool)(bytes[2] >> 6 & 0x1); }
         
     /** Sets Network Management UserData Launch Type / Network Management UserData Sendart */
-    void set_NM_Ud_Launch(NM_FSCM2_NM_Ud_Launch value){ raw = (raw & 0xffffc0ffffffffff) | ((uint64_t)value & 0x3f) << 40; }
+    void set_NM_Ud_Launch(NM_FSCM2_NM_Ud_Launch value){ bytes[2] = (bytes[2] & 0xc0) | ((uint8_t)value & 0x3f) << 0; }
 
     /** Gets Network Management UserData Launch Type / Network Management UserData Sendart */
-    NM_FSCM2_NM_Ud_Launch get_NM_Ud_Launch() const { return (NM_FSCM2_NM_Ud_Launch)(raw >> 40 & 0x3f); }
+    NM_FSCM2_NM_Ud_Launch get_NM_Ud_Launch() const { return (NM_FSCM2_NM_Ud_Launch)(bytes[2] >> 0 & 0x3f); }
         
     /** Sets Network Management UserData Service No./netzmanagement UserData service */
-    void set_NM_Ud_Srv(NM_FSCM2_NM_Ud_Srv value){ raw = (raw & 0xffffff00ffffffff) | ((uint64_t)value & 0xff) << 32; }
+    void set_NM_Ud_Srv(NM_FSCM2_NM_Ud_Srv value){ bytes[3] = (bytes[3] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Management UserData Service No./netzmanagement UserData service */
-    NM_FSCM2_NM_Ud_Srv get_NM_Ud_Srv() const { return (NM_FSCM2_NM_Ud_Srv)(raw >> 32 & 0xff); }
+    NM_FSCM2_NM_Ud_Srv get_NM_Ud_Srv() const { return (NM_FSCM2_NM_Ud_Srv)(bytes[3] >> 0 & 0xff); }
         
     /** Sets Wakeup Reason / Wake-up */
-    void set_WakeupRsn_FSCM2(NM_FSCM2_WakeupRsn_FSCM2 value){ raw = (raw & 0xffffffff00ffffff) | ((uint64_t)value & 0xff) << 24; }
+    void set_WakeupRsn_FSCM2(NM_FSCM2_WakeupRsn_FSCM2 value){ bytes[4] = (bytes[4] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Wakeup Reason / Wake-up */
-    NM_FSCM2_WakeupRsn_FSCM2 get_WakeupRsn_FSCM2() const { return (NM_FSCM2_WakeupRsn_FSCM2)(raw >> 24 & 0xff); }
+    NM_FSCM2_WakeupRsn_FSCM2 get_WakeupRsn_FSCM2() const { return (NM_FSCM2_WakeupRsn_FSCM2)(bytes[4] >> 0 & 0xff); }
         
     /** Sets Counter for Module Wakeup States During Network Sleep / Counter for ECUs Internal Wachzustäustände during bus rest. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_WakeupCnt(uint8_t value){ raw = (raw & 0xffffffffff00ffff) | ((uint64_t)value & 0xff) << 16; }
+    void set_WakeupCnt(uint8_t value){ bytes[5] = (bytes[5] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Counter for Module Wakeup States During Network Sleep / Counter for ECUs Internal Wachzustäustände during bus rest. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_WakeupCnt() const { return (uint8_t)(raw >> 16 & 0xff); }
+    uint8_t get_WakeupCnt() const { return (uint8_t)(bytes[5] >> 0 & 0xff); }
         
     /** Sets Network Identification No./netzwerk-id */
-    void set_Nw_Id(NM_FSCM2_Nw_Id value){ raw = (raw & 0xffffffffffffff00) | ((uint64_t)value & 0xff) << 0; }
+    void set_Nw_Id(NM_FSCM2_Nw_Id value){ bytes[7] = (bytes[7] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Identification No./netzwerk-id */
-    NM_FSCM2_Nw_Id get_Nw_Id() const { return (NM_FSCM2_Nw_Id)(raw >> 0 & 0xff); }
+    NM_FSCM2_Nw_Id get_Nw_Id() const { return (NM_FSCM2_Nw_Id)(bytes[7] >> 0 & 0xff); }
         
 } NM_FSCM2;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of NM_ISM */
 	uint32_t get_canid(){ return NM_ISM_CAN_ID; }
     /** Sets Network Management Mode / Network Management Mode */
-    void set_NM_Mode(NM_ISM_NM_Mode value){ raw = (raw & 0x00ffffffffffffff) | ((uint64_t)value & 0xff) << 56; }
+    void set_NM_Mode(NM_ISM_NM_Mode value){ bytes[0] = (bytes[0] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Management Mode / Network Management Mode */
-    NM_ISM_NM_Mode get_NM_Mode() const { return (NM_ISM_NM_Mode)(raw >> 56 & 0xff); }
+    NM_ISM_NM_Mode get_NM_Mode() const { return (NM_ISM_NM_Mode)(bytes[0] >> 0 & 0xff); }
         
     /** Sets Network Management Logical Successor / Network Management Logical Successor. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_NM_Successor(uint8_t value){ raw = (raw & 0xff00ffffffffffff) | ((uint64_t)value & 0xff) << 48; }
+    void set_NM_Successor(uint8_t value){ bytes[1] = (bytes[1] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Management Logical Successor / Network Management Logical Successor. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_NM_Successor() const { return (uint8_t)(raw >> 48 & 0xff); }
+    uint8_t get_NM_Successor() const { return (uint8_t)(bytes[1] >> 0 & 0xff); }
         
     /** Sets Network Management Sleep Indication / Network Management Sleep Indication */
-    void set_NM_Sleep_Ind(bool value){ raw = (raw & 0xffff7fffffffffff) | ((uint64_t)value & 0x1) << 47; }
+    void set_NM_Sleep_Ind(bool value){ bytes[2] = (bytes[2] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Network Management Sleep Indication / Network Management Sleep Indication */
-    bool get_NM_Sleep_Ind() const { return (bool)(raw >> 47 & 0x1); }
+    bool get_NM_Sleep_Ind() const { return (bool)(bytes[2] >> 7 & 0x1); }
         
     /** Sets Network Management Sleep Acknowledge / Network Management Sleep Acknowledge */
-    void set_NM_Sleep_Ack(bool value){ raw = (raw & 0xffffbfffffffffff) | ((uint64_t)value & 0x1) << 46; }
+    void set_NM_Sleep_Ack(bool value){ bytes[2] = (bytes[2] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Network Management Sleep Acknowledge / Network Management Sleep Acknowledge */
-    bool get_NM_Sleep_Ack() const { return (bool)(raw >> 46 & 0x1); }
+    bool get_NM_Sleep_Ack() const { return (bool)(bytes[2] >> 6 & 0x1); }
         
     /** Sets Network Management UserData Launch Type / Network Management UserData Sendart */
-    void set_NM_Ud_Launch(NM_ISM_NM_Ud_Launch value){ raw = (raw & 0xffffc0ffffffffff) | ((uint64_t)value & 0x3f) << 40; }
+    void set_NM_Ud_Launch(NM_ISM_NM_Ud_Launch value){ bytes[2] = (bytes[2] & 0xc0) | ((uint8_t)value & 0x3f) << 0; }
 
     /** Gets Network Management UserData Launch Type / Network Management UserData Sendart */
-    NM_ISM_NM_Ud_Launch get_NM_Ud_Launch() const { return (NM_ISM_NM_Ud_Launch)(raw >> 40 & 0x3f); }
+    NM_ISM_NM_Ud_Launch get_NM_Ud_Launch() const { return (NM_ISM_NM_Ud_Launch)(bytes[2] >> 0 & 0x3f); }
         
     /** Sets Network Management UserData Service No./netzmanagement UserData service */
-    void set_NM_Ud_Srv(NM_ISM_NM_Ud_Srv value){ raw = (raw & 0xffffff00ffffffff) | ((uint64_t)value & 0xff) << 32; }
+    void set_NM_Ud_Srv(NM_ISM_NM_Ud_Srv value){ bytes[3] = (bytes[3] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Management UserData Service No./netzmanagement UserData service */
-    NM_ISM_NM_Ud_Srv get_NM_Ud_Srv() const { return (NM_ISM_NM_Ud_Srv)(raw >> 32 & 0xff); }
+    NM_ISM_NM_Ud_Srv get_NM_Ud_Srv() const { return (NM_ISM_NM_Ud_Srv)(bytes[3] >> 0 & 0xff); }
         
     /** Sets Wakeup Reason / Wake-up */
-    void set_WakeupRsn_ISM(NM_ISM_WakeupRsn_ISM value){ raw = (raw & 0xffffffff00ffffff) | ((uint64_t)value & 0xff) << 24; }
+    void set_WakeupRsn_ISM(NM_ISM_WakeupRsn_ISM value){ bytes[4] = (bytes[4] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Wakeup Reason / Wake-up */
-    NM_ISM_WakeupRsn_ISM get_WakeupRsn_ISM() const { return (NM_ISM_WakeupRsn_ISM)(raw >> 24 & 0xff); }
+    NM_ISM_WakeupRsn_ISM get_WakeupRsn_ISM() const { return (NM_ISM_WakeupRsn_ISM)(bytes[4] >> 0 & 0xff); }
         
     /** Sets Counter for Module Wakeup States During Network Sleep / Counter for ECUs Internal Wachzustäustände during bus rest. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_WakeupCnt(uint8_t value){ raw = (raw & 0xffffffffff00ffff) | ((uint64_t)value & 0xff) << 16; }
+    void set_WakeupCnt(uint8_t value){ bytes[5] = (bytes[5] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Counter for Module Wakeup States During Network Sleep / Counter for ECUs Internal Wachzustäustände during bus rest. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_WakeupCnt() const { return (uint8_t)(raw >> 16 & 0xff); }
+    uint8_t get_WakeupCnt() const { return (uint8_t)(bytes[5] >> 0 & 0xff); }
         
     /** Sets Network Identification No./netzwerk-id */
-    void set_Nw_Id(NM_ISM_Nw_Id value){ raw = (raw & 0xffffffffffffff00) | ((uint64_t)value & 0xff) << 0; }
+    void set_Nw_Id(NM_ISM_Nw_Id value){ bytes[7] = (bytes[7] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Identification No./netzwerk-id */
-    NM_ISM_Nw_Id get_Nw_Id() const { return (NM_ISM_Nw_Id)(raw >> 0 & 0xff); }
+    NM_ISM_Nw_Id get_Nw_Id() const { return (NM_ISM_Nw_Id)(bytes[7] >> 0 & 0xff); }
         
 } NM_ISM;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of NM_SSP */
 	uint32_t get_canid(){ return NM_SSP_CAN_ID; }
     /** Sets Network Management Mode / Network Management Mode */
-    void set_NM_Mode(NM_SSP_NM_Mode value){ raw = (raw & 0x00ffffffffffffff) | ((uint64_t)value & 0xff) << 56; }
+    void set_NM_Mode(NM_SSP_NM_Mode value){ bytes[0] = (bytes[0] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Management Mode / Network Management Mode */
-    NM_SSP_NM_Mode get_NM_Mode() const { return (NM_SSP_NM_Mode)(raw >> 56 & 0xff); }
+    NM_SSP_NM_Mode get_NM_Mode() const { return (NM_SSP_NM_Mode)(bytes[0] >> 0 & 0xff); }
         
     /** Sets Network Management Logical Successor / Network Management Logical Successor. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_NM_Successor(uint8_t value){ raw = (raw & 0xff00ffffffffffff) | ((uint64_t)value & 0xff) << 48; }
+    void set_NM_Successor(uint8_t value){ bytes[1] = (bytes[1] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Management Logical Successor / Network Management Logical Successor. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_NM_Successor() const { return (uint8_t)(raw >> 48 & 0xff); }
+    uint8_t get_NM_Successor() const { return (uint8_t)(bytes[1] >> 0 & 0xff); }
         
     /** Sets Network Management Sleep Indication / Network Management Sleep Indication */
-    void set_NM_Sleep_Ind(bool value){ raw = (raw & 0xffff7fffffffffff) | ((uint64_t)value & 0x1) << 47; }
+    void set_NM_Sleep_Ind(bool value){ bytes[2] = (bytes[2] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Network Management Sleep Indication / Network Management Sleep Indication */
-    bool get_NM_Sleep_Ind() const { return (bool)(raw >> 47 & 0x1); }
+    bool get_NM_Sleep_Ind() const { return (bool)(bytes[2] >> 7 & 0x1); }
         
     /** Sets Network Management Sleep Acknowledge / Network Management Sleep Acknowledge */
-    void set_NM_Sleep_Ack(bool value){ raw = (raw & 0xffffbfffffffffff) | ((uint64_t)value & 0x1) << 46; }
+    void set_NM_Sleep_Ack(bool value){ bytes[2] = (bytes[2] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Network Management Sleep Acknowledge / Network Management Sleep Acknowledge */
-    bool get_NM_Sleep_Ack() const { return (bool)(raw >> 46 & 0x1); }
+    bool get_NM_Sleep_Ack() const { return (bool)(bytes[2] >> 6 & 0x1); }
         
     /** Sets Network Management UserData Launch Type / Network Management UserData Sendart */
-    void set_NM_Ud_Launch(NM_SSP_NM_Ud_Launch value){ raw = (raw & 0xffffc0ffffffffff) | ((uint64_t)value & 0x3f) << 40; }
+    void set_NM_Ud_Launch(NM_SSP_NM_Ud_Launch value){ bytes[2] = (bytes[2] & 0xc0) | ((uint8_t)value & 0x3f) << 0; }
 
     /** Gets Network Management UserData Launch Type / Network Management UserData Sendart */
-    NM_SSP_NM_Ud_Launch get_NM_Ud_Launch() const { return (NM_SSP_NM_Ud_Launch)(raw >> 40 & 0x3f); }
+    NM_SSP_NM_Ud_Launch get_NM_Ud_Launch() const { return (NM_SSP_NM_Ud_Launch)(bytes[2] >> 0 & 0x3f); }
         
     /** Sets Network Management UserData Service No./netzmanagement UserData service */
-    void set_NM_Ud_Srv(NM_SSP_NM_Ud_Srv value){ raw = (raw & 0xffffff00ffffffff) | ((uint64_t)value & 0xff) << 32; }
+    void set_NM_Ud_Srv(NM_SSP_NM_Ud_Srv value){ bytes[3] = (bytes[3] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Management UserData Service No./netzmanagement UserData service */
-    NM_SSP_NM_Ud_Srv get_NM_Ud_Srv() const { return (NM_SSP_NM_Ud_Srv)(raw >> 32 & 0xff); }
+    NM_SSP_NM_Ud_Srv get_NM_Ud_Srv() const { return (NM_SSP_NM_Ud_Srv)(bytes[3] >> 0 & 0xff); }
         
     /** Sets Wakeup Reason / Wake-up */
-    void set_WakeupRsn_SSP(NM_SSP_WakeupRsn_SSP value){ raw = (raw & 0xffffffff00ffffff) | ((uint64_t)value & 0xff) << 24; }
+    void set_WakeupRsn_SSP(NM_SSP_WakeupRsn_SSP value){ bytes[4] = (bytes[4] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Wakeup Reason / Wake-up */
-    NM_SSP_WakeupRsn_SSP get_WakeupRsn_SSP() const { return (NM_SSP_WakeupRsn_SSP)(raw >> 24 & 0xff); }
+    NM_SSP_WakeupRsn_SSP get_WakeupRsn_SSP() const { return (NM_SSP_WakeupRsn_SSP)(bytes[4] >> 0 & 0xff); }
         
     /** Sets Counter for Module Wakeup States During Network Sleep / Counter for ECUs Internal Wachzustäustände during bus rest. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_WakeupCnt(uint8_t value){ raw = (raw & 0xffffffffff00ffff) | ((uint64_t)value & 0xff) << 16; }
+    void set_WakeupCnt(uint8_t value){ bytes[5] = (bytes[5] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Counter for Module Wakeup States During Network Sleep / Counter for ECUs Internal Wachzustäustände during bus rest. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_WakeupCnt() const { return (uint8_t)(raw >> 16 & 0xff); }
+    uint8_t get_WakeupCnt() const { return (uint8_t)(bytes[5] >> 0 & 0xff); }
         
     /** Sets Network Identification No./netzwerk-id */
-    void set_Nw_Id(NM_SSP_Nw_Id value){ raw = (raw & 0xffffffffffffff00) | ((uint64_t)value & 0xff) << 0; }
+    void set_Nw_Id(NM_SSP_Nw_Id value){ bytes[7] = (bytes[7] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Identification No./netzwerk-id */
-    NM_SSP_Nw_Id get_Nw_Id() const { return (NM_SSP_Nw_Id)(raw >> 0 & 0xff); }
+    NM_SSP_Nw_Id get_Nw_Id() const { return (NM_SSP_Nw_Id)(bytes[7] >> 0 & 0xff); }
         
 } NM_SSP;
 
 
 
-class ECU_ANY_ECU {
-	public:
-        /**
-         * @brief Imports the CAN frame given the CAN ID, CAN Contents, and current timestamp
-         *
-         * Returns true if the frame was imported successfully, and false if import failed (Due to non-matching CAN ID).
-         *
-         * NOTE: The endianness of the value cannot be guaranteed. It is up to the caller to correct the byte order!
-         */
-        bool import_frames(uint64_t value, uint32_t can_id, uint64_t timestamp_now) {
-            switch(can_id) {
-                case SG_A1_CAN_ID:
-                    LAST_FRAME_TIMES[0] = timestamp_now;
-                    FRAME_DATA[0] = value;
-                    return true;
-                case ISM_DISP_RQ_CAN_ID:
-                    LAST_FRAME_TIMES[1] = timestamp_now;
-                    FRAME_DATA[1] = value;
-                    return true;
-                case SSP_RS_SSP_CAN_ID:
-                    LAST_FRAME_TIMES[2] = timestamp_now;
-                    FRAME_DATA[2] = value;
-                    return true;
-                case NM_FSCM2_CAN_ID:
-                    LAST_FRAME_TIMES[3] = timestamp_now;
-                    FRAME_DATA[3] = value;
-                    return true;
-                case NM_ISM_CAN_ID:
-                    LAST_FRAME_TIMES[4] = timestamp_now;
-                    FRAME_DATA[4] = value;
-                    return true;
-                case NM_SSP_CAN_ID:
-                    LAST_FRAME_TIMES[5] = timestamp_now;
-                    FRAME_DATA[5] = value;
-                    return true;
-                default:
-                    return false;
-            }
-        }
-        
-        /** Sets data in pointer to SG_A1
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_SG_A1(uint64_t now, uint64_t max_expire_time, SG_A1* dest) const {
-            if (LAST_FRAME_TIMES[0] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[0] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[0];
-                return true;
-            }
-        }
-            
-        /** Sets data in pointer to ISM_DISP_RQ
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_ISM_DISP_RQ(uint64_t now, uint64_t max_expire_time, ISM_DISP_RQ* dest) const {
-            if (LAST_FRAME_TIMES[1] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[1] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[1];
-                return true;
-            }
-        }
-            
-        /** Sets data in pointer to SSP_RS_SSP
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_SSP_RS_SSP(uint64_t now, uint64_t max_expire_time, SSP_RS_SSP* dest) const {
-            if (LAST_FRAME_TIMES[2] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[2] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[2];
-                return true;
-            }
-        }
-            
-        /** Sets data in pointer to NM_FSCM2
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_NM_FSCM2(uint64_t now, uint64_t max_expire_time, NM_FSCM2* dest) const {
-            if (LAST_FRAME_TIMES[3] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[3] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[3];
-                return true;
-            }
-        }
-            
-        /** Sets data in pointer to NM_ISM
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_NM_ISM(uint64_t now, uint64_t max_expire_time, NM_ISM* dest) const {
-            if (LAST_FRAME_TIMES[4] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[4] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[4];
-                return true;
-            }
-        }
-            
-        /** Sets data in pointer to NM_SSP
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_NM_SSP(uint64_t now, uint64_t max_expire_time, NM_SSP* dest) const {
-            if (LAST_FRAME_TIMES[5] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[5] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[5];
-                return true;
-            }
-        }
-            
-	private:
-		uint64_t FRAME_DATA[6];
-		uint64_t LAST_FRAME_TIMES[6];
-};
+// No frames of ECU 'ANY_ECU' are read by the TCM, so it has no storage class
 #endif // __ECU_ANY_ECU_H_
 
 #endif // EGS53_MODE
\ No newline at end of file
@@ -0,0 +1,84 @@
+
+/**
+* AUTOGENERATED BY convert.py
+* DO NOT EDIT THIS FILE!
+*
+* IF MODIFICATIONS NEED TO BE MADE, MODIFY can_data.txt!
+*
+* CAN ID to ECU storage dispatch table
+*/
+
+#ifdef EGS53_MODE
+
+#ifndef __ECU_DISPATCH_H_
+#define __ECU_DISPATCH_H_
+
+#include <stdint.h>
+
+/** ECUs which own frames on the CANBUS */
+enum class EcuId : uint8_t {
+	ECM = 0,
+	TCM = 1,
+	FSCM = 2,
+	TSLM = 3,
+	ANY_ECU = 4,
+	NONE = 0xFF, // Unused table entry
+};
+
+typedef struct {
+	uint32_t can_id;
+	EcuId ecu;
+	uint8_t slot; // Storage slot of the frame within the ECU_XXX class (See ECU_XXX::import_frame_at)
+} EcuDispatchEntry;
+
+#define ECU_DISPATCH_TABLE_SIZE 11
+
+/**
+ * Perfect hash table of every CAN ID the TCM reads in this build mode.
+ * The entry for a CAN ID is located at ECU_DISPATCH_TABLE[can_id % ECU_DISPATCH_TABLE_SIZE]
+ */
+static const EcuDispatchEntry ECU_DISPATCH_TABLE[ECU_DISPATCH_TABLE_SIZE] = {
+	{ 0x030D, EcuId::ECM, 0 }, // ECM_A1
+	{ 0x014B, EcuId::ECM, 3 }, // ENG_RS2_PT
+	{ 0x0000, EcuId::NONE, 0 },
+	{ 0x0000, EcuId::NONE, 0 },
+	{ 0x0000, EcuId::NONE, 0 },
+	{ 0x0073, EcuId::TSLM, 0 }, // SBW_RS_ISM
+	{ 0x0000, EcuId::NONE, 0 },
+	{ 0x017D, EcuId::ECM, 4 }, // TX_RQ_ECM
+	{ 0x0105, EcuId::ECM, 2 }, // ENG_RS3_PT
+	{ 0x0203, EcuId::ECM, 5 }, // WHL_STAT2
+	{ 0x006D, EcuId::ECM, 1 }, // SBW_RQ_SCCM
+};
+
+/**
+ * @brief Looks up the ECU and storage slot that own a CAN ID, in constant time.
+ *
+ * Returns nullptr if the CAN ID is not read by the TCM in this build mode
+ */
+static inline const EcuDispatchEntry* ecu_dispatch_lookup(uint32_t can_id) {
+    const EcuDispatchEntry* e = &ECU_DISPATCH_TABLE[can_id % ECU_DISPATCH_TABLE_SIZE];
+    if (e->ecu == EcuId::NONE || e->can_id != can_id) {
+        return nullptr;
+    }
+    return e;
+}
+
+/**
+ * CAN IDs the HAL actually reads off the bus (Sorted). Used to program the
+ * acceptance filter of the CAN controller, so other frames never reach the CPU
+ */
+#define ECU_RX_ID_COUNT 7
+static const uint32_t ECU_RX_IDS[ECU_RX_ID_COUNT] = {
+	0x006D, // SBW_RQ_SCCM
+	0x0073, // SBW_RS_ISM
+	0x0105, // ENG_RS3_PT
+	0x014B, // ENG_RS2_PT
+	0x017D, // TX_RQ_ECM
+	0x0203, // WHL_STAT2
+	0x030D, // ECM_A1
+};
+
+#endif // __ECU_DISPATCH_H_
+
+#endif // EGS53_MODE
\ No newline at end of file
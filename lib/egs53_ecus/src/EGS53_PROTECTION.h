@@ -0,0 +1,137 @@
+
+/**
+* AUTOGENERATED BY convert.py
+* DO NOT EDIT THIS FILE!
+*
+* IF MODIFICATIONS NEED TO BE MADE, MODIFY can_data.txt!
+*
+* Message counter and CRC (SAE J1850) protection of CAN frames
+*/
+
+#ifdef EGS53_MODE
+
+#ifndef __ECU_PROTECTION_H_
+#define __ECU_PROTECTION_H_
+
+#include <stdint.h>
+
+#define CRC8_J1850_INIT 0xFF
+#define CRC8_J1850_XOR_OUT 0xFF
+
+/** CRC8 of every byte value with the SAE J1850 polynomial (0x1D). Indexed by (crc ^ data byte) */
+static const uint8_t CRC8_J1850_TABLE[256] = {
+	0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB,
+	0xCD, 0xD0, 0xF7, 0xEA, 0xB9, 0xA4, 0x83, 0x9E, 0x25, 0x38, 0x1F, 0x02, 0x51, 0x4C, 0x6B, 0x76,
+	0x87, 0x9A, 0xBD, 0xA0, 0xF3, 0xEE, 0xC9, 0xD4, 0x6F, 0x72, 0x55, 0x48, 0x1B, 0x06, 0x21, 0x3C,
+	0x4A, 0x57, 0x70, 0x6D, 0x3E, 0x23, 0x04, 0x19, 0xA2, 0xBF, 0x98, 0x85, 0xD6, 0xCB, 0xEC, 0xF1,
+	0x13, 0x0E, 0x29, 0x34, 0x67, 0x7A, 0x5D, 0x40, 0xFB, 0xE6, 0xC1, 0xDC, 0x8F, 0x92, 0xB5, 0xA8,
+	0xDE, 0xC3, 0xE4, 0xF9, 0xAA, 0xB7, 0x90, 0x8D, 0x36, 0x2B, 0x0C, 0x11, 0x42, 0x5F, 0x78, 0x65,
+	0x94, 0x89, 0xAE, 0xB3, 0xE0, 0xFD, 0xDA, 0xC7, 0x7C, 0x61, 0x46, 0x5B, 0x08, 0x15, 0x32, 0x2F,
+	0x59, 0x44, 0x63, 0x7E, 0x2D, 0x30, 0x17, 0x0A, 0xB1, 0xAC, 0x8B, 0x96, 0xC5, 0xD8, 0xFF, 0xE2,
+	0x26, 0x3B, 0x1C, 0x01, 0x52, 0x4F, 0x68, 0x75, 0xCE, 0xD3, 0xF4, 0xE9, 0xBA, 0xA7, 0x80, 0x9D,
+	0xEB, 0xF6, 0xD1, 0xCC, 0x9F, 0x82, 0xA5, 0xB8, 0x03, 0x1E, 0x39, 0x24, 0x77, 0x6A, 0x4D, 0x50,
+	0xA1, 0xBC, 0x9B, 0x86, 0xD5, 0xC8, 0xEF, 0xF2, 0x49, 0x54, 0x73, 0x6E, 0x3D, 0x20, 0x07, 0x1A,
+	0x6C, 0x71, 0x56, 0x4B, 0x18, 0x05, 0x22, 0x3F, 0x84, 0x99, 0xBE, 0xA3, 0xF0, 0xED, 0xCA, 0xD7,
+	0x35, 0x28, 0x0F, 0x12, 0x41, 0x5C, 0x7B, 0x66, 0xDD, 0xC0, 0xE7, 0xFA, 0xA9, 0xB4, 0x93, 0x8E,
+	0xF8, 0xE5, 0xC2, 0xDF, 0x8C, 0x91, 0xB6, 0xAB, 0x10, 0x0D, 0x2A, 0x37, 0x64, 0x79, 0x5E, 0x43,
+	0xB2, 0xAF, 0x88, 0x95, 0xC6, 0xDB, 0xFC, 0xE1, 0x5A, 0x47, 0x60, 0x7D, 0x2E, 0x33, 0x14, 0x09,
+	0x7F, 0x62, 0x45, 0x58, 0x0B, 0x16, 0x31, 0x2C, 0x97, 0x8A, 0xAD, 0xB0, 0xE3, 0xFE, 0xD9, 0xC4,
+};
+
+typedef struct {
+	uint32_t can_id;
+	uint8_t crc_byte; // Payload byte holding the CRC, which covers every byte before it (0xFF if the frame has no CRC)
+	uint8_t counter_byte; // Payload byte holding the message counter (0xFF if the frame has no counter)
+	uint8_t counter_shift; // Position of the counter within its byte
+	uint8_t counter_mask; // Mask of the counter (After shifting). The counter wraps around after this value
+} FrameProtection;
+
+#define FRAME_PROTECTION_COUNT 21
+
+/** Protection of every frame with a message counter or CRC (Sorted by CAN ID) */
+static const FrameProtection FRAME_PROTECTION[FRAME_PROTECTION_COUNT] = {
+	{ 0x0001, 0x07, 0x06, 4, 0x0F }, // EIS_A1
+	{ 0x0003, 0x07, 0x06, 4, 0x0F }, // STW_ANGL_STAT
+	{ 0x0005, 0x07, 0x06, 4, 0x0F }, // BRK_STAT
+	{ 0x005F, 0x07, 0x06, 4, 0x0F }, // BRK_STAT2
+	{ 0x006D, 0x03, 0x02, 4, 0x0F }, // SBW_RQ_SCCM
+	{ 0x0073, 0x07, 0x06, 4, 0x0F }, // SBW_RS_ISM
+	{ 0x00DD, 0x07, 0x06, 4, 0x0F }, // EPKB_STAT
+	{ 0x00F1, 0x07, 0x06, 4, 0x0F }, // ENG_RQ1_TCM
+	{ 0x00F3, 0x07, 0x06, 4, 0x0F }, // ENG_RQ2_TCM
+	{ 0x00F4, 0x07, 0x06, 4, 0x0F }, // ENG_RQ3_TCM
+	{ 0x00F9, 0x07, 0x06, 4, 0x0F }, // HVAC_RS1
+	{ 0x0104, 0x07, 0x06, 4, 0x0F }, // TX_RQ_SBC
+	{ 0x0105, 0x07, 0x06, 4, 0x0F }, // ENG_RS3_PT
+	{ 0x014B, 0x07, 0x06, 4, 0x0F }, // ENG_RS2_PT
+	{ 0x017D, 0x07, 0x06, 4, 0x0F }, // TX_RQ_ECM
+	{ 0x01BD, 0x07, 0x06, 4, 0x0F }, // SBW_RS_TCM
+	{ 0x01CD, 0x07, 0x06, 4, 0x0F }, // ENG_RS1_PT
+	{ 0x0201, 0x07, 0x06, 4, 0x0F }, // WHL_STAT1
+	{ 0x0207, 0x07, 0xFF, 0, 0x00 }, // CVI
+	{ 0x0245, 0xFF, 0x06, 4, 0x0F }, // VEH_DYN_STAT
+	{ 0x0381, 0x07, 0x06, 4, 0x0F }, // SSP_RS_SSP
+};
+
+/**
+ * @brief Looks up the protection of a CAN ID.
+ *
+ * Returns nullptr if the frame has no message counter or CRC. HALs should look this up once per frame they
+ * send, rather than on every transmission
+ */
+static inline const FrameProtection* frame_protection_lookup(uint32_t can_id) {
+    uint8_t lo = 0;
+    uint8_t hi = FRAME_PROTECTION_COUNT;
+    while (lo < hi) {
+        uint8_t mid = (lo + hi) / 2;
+        if (FRAME_PROTECTION[mid].can_id < can_id) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == FRAME_PROTECTION_COUNT || FRAME_PROTECTION[lo].can_id != can_id) {
+        return nullptr;
+    }
+    return &FRAME_PROTECTION[lo];
+}
+
+/** Calculates the CRC of 'data' (The payload of the frame protected by 'p') */
+static inline uint8_t frame_calc_crc(const FrameProtection* p, const uint8_t* data) {
+    uint8_t crc = CRC8_J1850_INIT;
+    for (uint8_t i = 0; i < p->crc_byte; i++) {
+        crc = CRC8_J1850_TABLE[crc ^ data[i]];
+    }
+    return crc ^ CRC8_J1850_XOR_OUT;
+}
+
+/**
+ * @brief Writes message counter 'counter' into 'data', and then the CRC.
+ *
+ * Every other signal of the frame must already be set, as they are covered by the CRC
+ */
+static inline void frame_protect(const FrameProtection* p, uint8_t* data, uint8_t counter) {
+    if (p->counter_byte != 0xFF) {
+        data[p->counter_byte] = (data[p->counter_byte] & ~(p->counter_mask << p->counter_shift)) | (counter & p->counter_mask) << p->counter_shift;
+    }
+    if (p->crc_byte != 0xFF) {
+        data[p->crc_byte] = frame_calc_crc(p, data);
+    }
+}
+
+/** Gets the message counter from 'data' (0 if the frame has no counter) */
+static inline uint8_t frame_get_counter(const FrameProtection* p, const uint8_t* data) {
+    if (p->counter_byte == 0xFF) {
+        return 0;
+    }
+    return data[p->counter_byte] >> p->counter_shift & p->counter_mask;
+}
+
+/** Returns true if the CRC in 'data' is correct (Or the frame has no CRC) */
+static inline bool frame_check_crc(const FrameProtection* p, const uint8_t* data) {
+    return p->crc_byte == 0xFF || data[p->crc_byte] == frame_calc_crc(p, data);
+}
+
+#endif // __ECU_PROTECTION_H_
+
+#endif // EGS53_MODE
\ No newline at end of file
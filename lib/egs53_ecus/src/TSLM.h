@@ -14,6 +14,13 @@
 #define __ECU_TSLM_H_
 
 #include <stdint.h>
+#include "seqlock.h"
+#include "ecu_frame_stats.h"
+#include "ecu_frame_check.h"
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+    #error "Generated CAN frame accessors assume a little endian CPU"
+#endif
     
 #define SBW_RS_ISM_CAN_ID 0x0073
 #define NM_TSLM_CAN_ID 0x042F
@@ -79,104 +86,104 @@ enum class NM_TSLM_Nw_Id {
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of SBW_RS_ISM */
 	uint32_t get_canid(){ return SBW_RS_ISM_CAN_ID; }
     /** Sets Transmission Driving Program Switch State / Status Driving program */
-    void set_TxDrvProgSw_Psd_V3(bool value){ raw = (raw & 0xbfffffffffffffff) | ((uint64_t)value & 0x1) << 62; }
+    void set_TxDrvProgSw_Psd_V3(bool value){ bytes[0] = (bytes[0] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Transmission Driving Program Switch State / Status Driving program */
-    bool get_TxDrvProgSw_Psd_V3() const { return (bool)(raw >> 62 & 0x1); }
+    bool get_TxDrvProgSw_Psd_V3() const { return (bool)(bytes[0] >> 6 & 0x1); }
         
     /** Sets Transmission Selector Lever Motion Lock Active / Gear Select Lock Active */
-    void set_TSL_MtnLk_Actv(bool value){ raw = (raw & 0xefffffffffffffff) | ((uint64_t)value & 0x1) << 60; }
+    void set_TSL_MtnLk_Actv(bool value){ bytes[0] = (bytes[0] & 0xef) | ((uint8_t)value & 0x1) << 4; }
 
     /** Gets Transmission Selector Lever Motion Lock Active / Gear Select Lock Active */
-    bool get_TSL_MtnLk_Actv() const { return (bool)(raw >> 60 & 0x1); }
+    bool get_TSL_MtnLk_Actv() const { return (bool)(bytes[0] >> 4 & 0x1); }
         
     /** Sets Transmission Selector Lever Position / Transmission Logging */
-    void set_TSL_Posn_ISM(SBW_RS_ISM_TSL_Posn_ISM value){ raw = (raw & 0xf0ffffffffffffff) | ((uint64_t)value & 0xf) << 56; }
+    void set_TSL_Posn_ISM(SBW_RS_ISM_TSL_Posn_ISM value){ bytes[0] = (bytes[0] & 0xf0) | ((uint8_t)value & 0xf) << 0; }
 
     /** Gets Transmission Selector Lever Position / Transmission Logging */
-    SBW_RS_ISM_TSL_Posn_ISM get_TSL_Posn_ISM() const { return (SBW_RS_ISM_TSL_Posn_ISM)(raw >> 56 & 0xf); }
+    SBW_RS_ISM_TSL_Posn_ISM get_TSL_Posn_ISM() const { return (SBW_RS_ISM_TSL_Posn_ISM)(bytes[0] >> 0 & 0xf); }
         
     /** Sets Message Counter / Message Counter. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_MC_SBW_RS_ISM(uint8_t value){ raw = (raw & 0xffffffffffff0fff) | ((uint64_t)value & 0xf) << 12; }
+    void set_MC_SBW_RS_ISM(uint8_t value){ bytes[6] = (bytes[6] & 0x0f) | ((uint8_t)value & 0xf) << 4; }
 
     /** Gets Message Counter / Message Counter. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_MC_SBW_RS_ISM() const { return (uint8_t)(raw >> 12 & 0xf); }
+    uint8_t get_MC_SBW_RS_ISM() const { return (uint8_t)(bytes[6] >> 4 & 0xf); }
         
     /** Sets CRC Checksum Byte 1 to 7 Accordinging to SAE J1850 / CRC Checksum Byte 1 - 7 to SAE J1850. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_CRC_SBW_RS_ISM(uint8_t value){ raw = (raw & 0xffffffffffffff00) | ((uint64_t)value & 0xff) << 0; }
+    void set_CRC_SBW_RS_ISM(uint8_t value){ bytes[7] = (bytes[7] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets CRC Checksum Byte 1 to 7 Accordinging to SAE J1850 / CRC Checksum Byte 1 - 7 to SAE J1850. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_CRC_SBW_RS_ISM() const { return (uint8_t)(raw >> 0 & 0xff); }
+    uint8_t get_CRC_SBW_RS_ISM() const { return (uint8_t)(bytes[7] >> 0 & 0xff); }
         
 } SBW_RS_ISM;
 
 
 
 typedef union {
-	uint64_t raw;
+	uint64_t raw; // Payload in wire order (bytes[0] is the first byte on the bus)
 	uint8_t bytes[8];
 
 	/** Gets CAN ID of NM_TSLM */
 	uint32_t get_canid(){ return NM_TSLM_CAN_ID; }
     /** Sets Network Management Mode / Network Management Mode */
-    void set_NM_Mode(NM_TSLM_NM_Mode value){ raw = (raw & 0x00ffffffffffffff) | ((uint64_t)value & 0xff) << 56; }
+    void set_NM_Mode(NM_TSLM_NM_Mode value){ bytes[0] = (bytes[0] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Management Mode / Network Management Mode */
-    NM_TSLM_NM_Mode get_NM_Mode() const { return (NM_TSLM_NM_Mode)(raw >> 56 & 0xff); }
+    NM_TSLM_NM_Mode get_NM_Mode() const { return (NM_TSLM_NM_Mode)(bytes[0] >> 0 & 0xff); }
         
     /** Sets Network Management Logical Successor / Network Management Logical Successor. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_NM_Successor(uint8_t value){ raw = (raw & 0xff00ffffffffffff) | ((uint64_t)value & 0xff) << 48; }
+    void set_NM_Successor(uint8_t value){ bytes[1] = (bytes[1] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Management Logical Successor / Network Management Logical Successor. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_NM_Successor() const { return (uint8_t)(raw >> 48 & 0xff); }
+    uint8_t get_NM_Successor() const { return (uint8_t)(bytes[1] >> 0 & 0xff); }
         
     /** Sets Network Management Sleep Indication / Network Management Sleep Indication */
-    void set_NM_Sleep_Ind(bool value){ raw = (raw & 0xffff7fffffffffff) | ((uint64_t)value & 0x1) << 47; }
+    void set_NM_Sleep_Ind(bool value){ bytes[2] = (bytes[2] & 0x7f) | ((uint8_t)value & 0x1) << 7; }
 
     /** Gets Network Management Sleep Indication / Network Management Sleep Indication */
-    bool get_NM_Sleep_Ind() const { return (bool)(raw >> 47 & 0x1); }
+    bool get_NM_Sleep_Ind() const { return (bool)(bytes[2] >> 7 & 0x1); }
         
     /** Sets Network Management Sleep Acknowledge / Network Management Sleep Acknowledge */
-    void set_NM_Sleep_Ack(bool value){ raw = (raw & 0xffffbfffffffffff) | ((uint64_t)value & 0x1) << 46; }
+    void set_NM_Sleep_Ack(bool value){ bytes[2] = (bytes[2] & 0xbf) | ((uint8_t)value & 0x1) << 6; }
 
     /** Gets Network Management Sleep Acknowledge / Network Management Sleep Acknowledge */
-    bool get_NM_Sleep_Ack() const { return (bool)(raw >> 46 & 0x1); }
+    bool get_NM_Sleep_Ack() const { return (bool)(bytes[2] >> 6 & 0x1); }
         
     /** Sets Network Management UserData Launch Type / Network Management UserData Sendart */
-    void set_NM_Ud_Launch(NM_TSLM_NM_Ud_Launch value){ raw = (raw & 0xffffc0ffffffffff) | ((uint64_t)value & 0x3f) << 40; }
+    void set_NM_Ud_Launch(NM_TSLM_NM_Ud_Launch value){ bytes[2] = (bytes[2] & 0xc0) | ((uint8_t)value & 0x3f) << 0; }
 
     /** Gets Network Management UserData Launch Type / Network Management UserData Sendart */
-    NM_TSLM_NM_Ud_Launch get_NM_Ud_Launch() const { return (NM_TSLM_NM_Ud_Launch)(raw >> 40 & 0x3f); }
+    NM_TSLM_NM_Ud_Launch get_NM_Ud_Launch() const { return (NM_TSLM_NM_Ud_Launch)(bytes[2] >> 0 & 0x3f); }
         
     /** Sets Network Management UserData Service No./netzmanagement UserData service */
-    void set_NM_Ud_Srv(NM_TSLM_NM_Ud_Srv value){ raw = (raw & 0xffffff00ffffffff) | ((uint64_t)value & 0xff) << 32; }
+    void set_NM_Ud_Srv(NM_TSLM_NM_Ud_Srv value){ bytes[3] = (bytes[3] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Management UserData Service No./netzmanagement UserData service */
-    NM_TSLM_NM_Ud_Srv get_NM_Ud_Srv() const { return (NM_TSLM_NM_Ud_Srv)(raw >> 32 & 0xff); }
+    NM_TSLM_NM_Ud_Srv get_NM_Ud_Srv() const { return (NM_TSLM_NM_Ud_Srv)(bytes[3] >> 0 & 0xff); }
         
     /** Sets Wakeup Reason / Wake-up */
-    void set_WakeupRsn_TSLM(NM_TSLM_WakeupRsn_TSLM value){ raw = (raw & 0xffffffff00ffffff) | ((uint64_t)value & 0xff) << 24; }
+    void set_WakeupRsn_TSLM(NM_TSLM_WakeupRsn_TSLM value){ bytes[4] = (bytes[4] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Wakeup Reason / Wake-up */
-    NM_TSLM_WakeupRsn_TSLM get_WakeupRsn_TSLM() const { return (NM_TSLM_WakeupRsn_TSLM)(raw >> 24 & 0xff); }
+    NM_TSLM_WakeupRsn_TSLM get_WakeupRsn_TSLM() const { return (NM_TSLM_WakeupRsn_TSLM)(bytes[4] >> 0 & 0xff); }
         
     /** Sets Counter for Module Wakeup States During Network Sleep / Counter for ECUs Internal Wachzustäustände during bus rest. Conversion formula (To raw from real): y=(x-0.0)/1.00 */
-    void set_WakeupCnt(uint8_t value){ raw = (raw & 0xffffffffff00ffff) | ((uint64_t)value & 0xff) << 16; }
+    void set_WakeupCnt(uint8_t value){ bytes[5] = (bytes[5] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Counter for Module Wakeup States During Network Sleep / Counter for ECUs Internal Wachzustäustände during bus rest. Conversion formula (To real from raw): y=(1.00x)+0.0 */
-    uint8_t get_WakeupCnt() const { return (uint8_t)(raw >> 16 & 0xff); }
+    uint8_t get_WakeupCnt() const { return (uint8_t)(bytes[5] >> 0 & 0xff); }
         
     /** Sets Network Identification No./netzwerk-id */
-    void set_Nw_Id(NM_TSLM_Nw_Id value){ raw = (raw & 0xffffffffffffff00) | ((uint64_t)value & 0xff) << 0; }
+    void set_Nw_Id(NM_TSLM_Nw_Id value){ bytes[7] = (bytes[7] & 0x00) | ((uint8_t)value & 0xff) << 0; }
 
     /** Gets Network Identification No./netzwerk-id */
-    NM_TSLM_Nw_Id get_Nw_Id() const { return (NM_TSLM_Nw_Id)(raw >> 0 & 0xff); }
+    NM_TSLM_Nw_Id get_Nw_Id() const { return (NM_TSLM_Nw_Id)(bytes[7] >> 0 & 0xff); }
         
 } NM_TSLM;
 
@@ -187,24 +194,68 @@ class ECU_TSLM {
         /**
          * @brief Imports the CAN frame given the CAN ID, CAN Contents, and current timestamp
          *
-         * Returns true if the frame was imported successfully, and false if import failed (Due to non-matching CAN ID).
+         * Returns true if the frame was imported successfully, and false if import failed (Due to non-matching CAN ID,
+         * or the frame failing validation).
          *
-         * NOTE: The endianness of the value cannot be guaranteed. It is up to the caller to correct the byte order!
+         * 'value' is the CAN payload in wire order, as copied straight out of the CAN controller's data buffer
          */
         bool import_frames(uint64_t value, uint32_t can_id, uint64_t timestamp_now) {
             switch(can_id) {
                 case SBW_RS_ISM_CAN_ID:
-                    LAST_FRAME_TIMES[0] = timestamp_now;
-                    FRAME_DATA[0] = value;
-                    return true;
-                case NM_TSLM_CAN_ID:
-                    LAST_FRAME_TIMES[1] = timestamp_now;
-                    FRAME_DATA[1] = value;
-                    return true;
+                    return import_frame_at(0, value, timestamp_now) == FrameCheckResult::Ok;
                 default:
                     return false;
             }
         }
+
+        /**
+         * @brief Imports the CAN frame directly into storage slot 'slot', as returned by the
+         * generated RX dispatch table. This skips the CAN ID switch entirely.
+         *
+         * A frame that fails validation of its message counter, toggle or parity signals is not stored
+         * (And is counted in its arrival statistics), and the reason is returned.
+         *
+         * 'value' is the CAN payload in wire order, as copied straight out of the CAN controller's data buffer
+         */
+        FrameCheckResult import_frame_at(uint8_t slot, uint64_t value, uint64_t timestamp_now) {
+            FrameCheckResult res = check_frame_at(slot, value, timestamp_now);
+            if (res != FrameCheckResult::Ok) {
+                reject_frame_at(slot);
+                return res;
+            }
+            FRAMES[slot].write(EcuFrame { .data = value, .timestamp = timestamp_now });
+            update_arrival_stats(&RX_STATS[slot], timestamp_now);
+            STATS[slot].write(RX_STATS[slot]);
+            return FrameCheckResult::Ok;
+        }
+
+        /**
+         * Counts a frame in storage slot 'slot' that failed a check made outside this class (Such as a CRC).
+         * Only call from the CAN Rx task
+         */
+        void reject_frame_at(uint8_t slot) {
+            RX_STATS[slot].rejected_count++;
+            STATS[slot].write(RX_STATS[slot]);
+        }
+
+        /** Returns the number of frames stored by this ECU (Only the frames the TCM reads) */
+        uint8_t get_num_frames() const {
+            return NUM_FRAMES;
+        }
+
+        /**
+         * Copies the arrival statistics of the frame in storage slot 'slot' to 'dest'. Safe to call from any task.
+         *
+         * Returns false if 'slot' is out of range.
+         */
+        bool get_frame_stats_at(uint8_t slot, FrameArrivalStats* dest) const {
+            if (slot >= NUM_FRAMES || dest == nullptr) {
+                return false;
+            }
+            STATS[slot].read(dest);
+            dest->stale_count = STALE[slot].count.load(std::memory_order_relaxed);
+            return true;
+        }
         
         /** Sets data in pointer to SBW_RS_ISM
           * 
@@ -214,37 +265,47 @@ class ECU_TSLM {
           * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
           */
         bool get_SBW_RS_ISM(uint64_t now, uint64_t max_expire_time, SBW_RS_ISM* dest) const {
-            if (LAST_FRAME_TIMES[0] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
+            EcuFrame f;
+            uint32_t seq = FRAMES[0].read(&f); // Data and timestamp are always from the same frame
+            if (f.timestamp == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
                 return false;
-            } else if (now - LAST_FRAME_TIMES[0] > max_expire_time) { // CAN Frame has not refreshed in valid interval
+            } else if (now > f.timestamp && now - f.timestamp > max_expire_time) { // CAN Frame has not refreshed in valid interval
+                mark_frame_stale(&STALE[0], seq);
                 return false;
             } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[0];
+                dest->raw = f.data;
                 return true;
             }
         }
             
-        /** Sets data in pointer to NM_TSLM
-          * 
-          * If this function returns false, then the CAN Frame is invalid or has not been seen
-          * on the CANBUS network yet. Meaning it's data cannot be used.
-          *
-          * If the function returns true, then the pointer to 'dest' has been updated with the new CAN data
-          */
-        bool get_NM_TSLM(uint64_t now, uint64_t max_expire_time, NM_TSLM* dest) const {
-            if (LAST_FRAME_TIMES[1] == 0 || dest == nullptr) { // CAN Frame has not been seen on bus yet / NULL pointer
-                return false;
-            } else if (now - LAST_FRAME_TIMES[1] > max_expire_time) { // CAN Frame has not refreshed in valid interval
-                return false;
-            } else { // CAN Frame is valid! return it
-                dest->raw = FRAME_DATA[1];
-                return true;
+	private:
+        /**
+         * Checks the message counter, toggle and parity signals of a frame for storage slot 'slot'.
+         * Only call from the CAN Rx task
+         */
+        FrameCheckResult check_frame_at(uint8_t slot, uint64_t value, uint64_t timestamp_now) {
+            switch(slot) {
+                case 0: // SBW_RS_ISM
+                    return frame_sequence_check(&CHECKS[0], value, 0x00F0000000000000ULL, 0x0000000000000000ULL, timestamp_now);
+                default:
+                    return FrameCheckResult::Ok;
             }
         }
-            
-	private:
-		uint64_t FRAME_DATA[2];
-		uint64_t LAST_FRAME_TIMES[2];
+
+		typedef struct {
+			uint64_t data;
+			uint64_t timestamp;
+		} EcuFrame;
+		// Written by the CAN Rx task, read by any other task
+		Seqlock<EcuFrame> FRAMES[1];
+		// Arrival statistics. Only touched by the CAN Rx task, which publishes them to STATS
+		FrameArrivalStats RX_STATS[1] = {};
+		Seqlock<FrameArrivalStats> STATS[1];
+		// Staleness, counted by the getters from any task
+		mutable FrameStaleCounter STALE[1] = {};
+		// Message counter / toggle state of the frames that have them. Only touched by the CAN Rx task
+		FrameCheckState CHECKS[1] = {};
+		static const uint8_t NUM_FRAMES = 1;
 };
 #endif // __ECU_TSLM_H_
 
@@ -1,6 +1,6 @@
 #!/bin/bash
 
 # Do EGS52 headers
-python convert.py egs52_ecus/can_data.txt egs52_ecus/src/ EGS52_MODE
+python convert.py egs52_ecus/can_data.txt egs52_ecus/src/ EGS52_MODE egs52_ecus/consumed_frames.txt
 # Do EGS53 headers
-python convert.py egs53_ecus/can_data.txt egs53_ecus/src/ EGS53_MODE
\ No newline at end of file
+python convert.py egs53_ecus/can_data.txt egs53_ecus/src/ EGS53_MODE egs53_ecus/consumed_frames.txt
\ No newline at end of file
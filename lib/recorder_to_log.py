@@ -0,0 +1,86 @@
+#
+# Converts a CAN recorder capture into a log that normal CAN tools can open
+#
+# The capture is read out of the TCM over KWP2000 (0x35 RequestUpload, 0x36 TransferData until
+# all the bytes are in, then 0x37 RequestTransferExit), and saved as a binary file.
+# See src/canbus/can_recorder.h for the format.
+#
+# This program takes 2 arguments:
+# 1. Input capture file
+# 2. Output log file. Ending in .asc writes a Vector ASC log, anything else writes a candump log
+# 3. Optional - Interface name to use in the candump log (Default can0)
+
+import struct
+import sys
+
+HEADER_FORMAT = "<IBBHQII"
+ENTRY_FORMAT = "<iHBB8s"
+RECORDER_MAGIC = 0x5232354E
+RECORDER_VERSION = 1
+RECORDER_TX_FLAG = 0x8000
+
+TRIGGERS = ["None", "Fault", "Implausible gear ratio", "Overspeed", "Manual"]
+
+if len(sys.argv) < 3:
+    print("Usage: recorder_to_log.py <capture.bin> <output.log|output.asc> [interface]")
+    sys.exit(1)
+
+data = open(sys.argv[1], 'rb').read()
+output_file = sys.argv[2]
+iface = "can0"
+if len(sys.argv) > 3:
+    iface = sys.argv[3]
+
+header_size = struct.calcsize(HEADER_FORMAT)
+if len(data) < header_size:
+    print("Capture is too short!")
+    sys.exit(1)
+
+(magic, version, trigger, entry_size, trigger_time, rx_count, tx_count) = struct.unpack_from(HEADER_FORMAT, data, 0)
+if magic != RECORDER_MAGIC:
+    print("Not a CAN recorder capture (Magic is {:08X})".format(magic))
+    sys.exit(1)
+if version != RECORDER_VERSION or entry_size != struct.calcsize(ENTRY_FORMAT):
+    print("Unsupported capture version {} (Entry size {})".format(version, entry_size))
+    sys.exit(1)
+if len(data) < header_size + (rx_count + tx_count) * entry_size:
+    print("Capture is truncated!")
+    sys.exit(1)
+
+frames = []
+for i in range(0, rx_count + tx_count):
+    (time_offset, can_id, dlc, _, payload) = struct.unpack_from(ENTRY_FORMAT, data, header_size + i * entry_size)
+    frames.append((trigger_time + time_offset, can_id & ~RECORDER_TX_FLAG, can_id & RECORDER_TX_FLAG != 0, payload[:dlc]))
+# Rx and Tx are stored separately, so merge them back into bus order
+frames.sort(key=lambda f: f[0])
+
+trigger_name = TRIGGERS[trigger] if trigger < len(TRIGGERS) else "Unknown"
+print("Trigger: {} at {:.6f}s, {} Rx frames, {} Tx frames".format(trigger_name, trigger_time / 1000000.0, rx_count, tx_count))
+
+with open(output_file, 'w') as out:
+    if output_file.lower().endswith(".asc"):
+        start = frames[0][0] if len(frames) > 0 else trigger_time
+        out.write("date Thu Jan 1 00:00:00.000 am 1970\n")
+        out.write("base hex  timestamps absolute\n")
+        out.write("no internal events logged\n")
+        out.write("// Trigger: {} at {:.6f}\n".format(trigger_name, (trigger_time - start) / 1000000.0))
+        out.write("Begin Triggerblock\n")
+        for (time, can_id, is_tx, payload) in frames:
+            out.write("{:11.6f} 1  {:<15X} {}   d {} {}\n".format(
+                (time - start) / 1000000.0,
+                can_id,
+                "Tx" if is_tx else "Rx",
+                len(payload),
+                " ".join("{:02X}".format(b) for b in payload)
+            ))
+        out.write("End TriggerBlock\n")
+    else:
+        # candump -l format. Timestamps are time since the TCM booted
+        for (time, can_id, is_tx, payload) in frames:
+            out.write("({}.{:06d}) {} {:03X}#{}\n".format(
+                time // 1000000,
+                time % 1000000,
+                iface,
+                can_id,
+                "".join("{:02X}".format(b) for b in payload)
+            ))
@@ -0,0 +1,132 @@
+#include "can_bus_monitor.h"
+#include <inttypes.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+
+// Error counter value at which the controller goes error passive
+#define CAN_ERROR_PASSIVE_LIMIT 128
+
+CanBusMonitor::~CanBusMonitor() {
+    this->stop();
+}
+
+void CanBusMonitor::stop() {
+    if (this->task != nullptr) {
+        vTaskDelete(this->task);
+        this->task = nullptr;
+    }
+}
+
+bool CanBusMonitor::start(const char* task_name, const char* log_tag) {
+    if (this->task != nullptr) {
+        return true;
+    }
+    this->log_tag = log_tag;
+    esp_err_t res = twai_reconfigure_alerts(CAN_MONITOR_ALERTS, nullptr);
+    if (res != ESP_OK) {
+        ESP_LOGE(this->log_tag, "Could not enable TWAI alerts: %s", esp_err_to_name(res));
+        return false;
+    }
+    ESP_LOGI(this->log_tag, "Starting CAN bus monitor task");
+    if (xTaskCreate(this->start_task_loop, task_name, 4096, this, 5, &this->task) != pdPASS) {
+        ESP_LOGE(this->log_tag, "CAN bus monitor task creation failed!");
+        return false;
+    }
+    return true;
+}
+
+[[noreturn]]
+void CanBusMonitor::task_loop() {
+    uint32_t alerts;
+    while (true) {
+        // Whilst recovering, come back in time to initiate recovery again if it has not worked
+        alerts = 0;
+        if (twai_read_alerts(&alerts, pdMS_TO_TICKS(this->in_recovery ? CAN_RECOVERY_RETRY_MS : CAN_MONITOR_SAMPLE_MS)) != ESP_OK) {
+            alerts = 0;
+        }
+        this->update(alerts, esp_timer_get_time());
+    }
+}
+
+void CanBusMonitor::update(uint32_t alerts, uint64_t now) {
+    if (alerts & TWAI_ALERT_ABOVE_ERR_WARN) {
+        this->current.error_warning_count++;
+    }
+    if (alerts & TWAI_ALERT_ERR_PASS) {
+        this->current.error_passive_count++;
+    }
+    twai_status_info_t status;
+    if (twai_get_status_info(&status) != ESP_OK) {
+        return;
+    }
+    this->current.tx_error_counter = status.tx_error_counter;
+    this->current.rx_error_counter = status.rx_error_counter;
+    this->current.bus_error_count = status.bus_error_count;
+    this->current.tx_failed_count = status.tx_failed_count;
+    this->current.rx_missed_count = status.rx_missed_count;
+    this->current.rx_overrun_count = status.rx_overrun_count;
+    this->current.arb_lost_count = status.arb_lost_count;
+    switch (status.state) {
+        case TWAI_STATE_BUS_OFF:
+            if (!this->in_recovery) {
+                this->in_recovery = true;
+                this->bus_off_time = now;
+                this->recovery_start_time = 0;
+                this->current.bus_off_count++;
+                ESP_LOGW(this->log_tag, "CAN bus off (TEC %" PRIu32 ", REC %" PRIu32 "), recovering", status.tx_error_counter, status.rx_error_counter);
+            }
+            this->current.state = CanBusState::BusOff;
+            if (this->recovery_start_time == 0 || now - this->recovery_start_time >= CAN_RECOVERY_RETRY_MS * 1000) {
+                if (this->recovery_start_time != 0) {
+                    this->current.recovery_retry_count++;
+                }
+                this->recovery_start_time = now;
+                if (twai_initiate_recovery() == ESP_OK) {
+                    this->current.state = CanBusState::Recovering;
+                }
+            }
+            break;
+        case TWAI_STATE_RECOVERING:
+            // Nothing to do but wait. A controller that never sees the bus go recessive stays here
+            this->current.state = CanBusState::Recovering;
+            break;
+        case TWAI_STATE_STOPPED:
+            // Recovery leaves the driver stopped, so start it again straight away
+            if (this->in_recovery && twai_start() == ESP_OK) {
+                this->on_recovered(esp_timer_get_time());
+            } else {
+                this->current.state = CanBusState::Stopped;
+            }
+            break;
+        case TWAI_STATE_RUNNING:
+        default:
+            if (this->in_recovery) {
+                this->on_recovered(now);
+            }
+            if (status.tx_error_counter >= CAN_ERROR_PASSIVE_LIMIT || status.rx_error_counter >= CAN_ERROR_PASSIVE_LIMIT) {
+                this->current.state = CanBusState::ErrorPassive;
+            } else {
+                this->current.state = CanBusState::ErrorActive;
+            }
+            break;
+    }
+    this->stats.write(this->current);
+}
+
+void CanBusMonitor::on_recovered(uint64_t now) {
+    uint64_t duration = now - this->bus_off_time;
+    uint32_t duration_us = duration > UINT32_MAX ? UINT32_MAX : (uint32_t)duration;
+    uint8_t bucket = 0;
+    while (bucket < CAN_RECOVERY_HISTOGRAM_BUCKETS-1 && duration_us > (1000u << bucket)) {
+        bucket++;
+    }
+    this->current.recovery_histogram[bucket]++;
+    this->current.recovery_count++;
+    this->current.last_recovery_us = duration_us;
+    if (duration_us > this->current.max_recovery_us) {
+        this->current.max_recovery_us = duration_us;
+    }
+    this->current.state = CanBusState::ErrorActive;
+    this->in_recovery = false;
+    ESP_LOGW(this->log_tag, "CAN bus recovered after %" PRIu32 " us", duration_us);
+}
@@ -0,0 +1,71 @@
+/**
+ * CAN controller error state monitor and bus off recovery
+ *
+ * A controller that goes bus off (Usually after a burst of errors, such as the voltage dip whilst cranking)
+ * stays off the bus until it is told to recover, so without this the TCM would go silent on CAN until reboot.
+ *
+ * The monitor task sleeps on the TWAI alerts, so it reacts to bus off as soon as the ISR sees it. It then
+ * initiates recovery, and starts the driver again the moment the controller has seen the 128 occurrences of
+ * 11 recessive bits it needs (About 3ms at 500kbps), so the Tx task's frames go out again from its next tick.
+ * If the controller is still bus off CAN_RECOVERY_RETRY_MS after recovery was initiated, it is initiated again.
+ *
+ * Between alerts the error counters are sampled every CAN_MONITOR_SAMPLE_MS.
+ */
+
+#ifndef __CAN_BUS_MONITOR_H_
+#define __CAN_BUS_MONITOR_H_
+
+#include <stdint.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "driver/twai.h"
+#include "seqlock.h"
+#include "can_hal.h"
+
+// TWAI alerts the monitor wakes up on (Enabled by start())
+#define CAN_MONITOR_ALERTS (TWAI_ALERT_BUS_OFF | TWAI_ALERT_BUS_RECOVERED | TWAI_ALERT_ERR_PASS | TWAI_ALERT_ABOVE_ERR_WARN | TWAI_ALERT_BUS_ERROR)
+// How often the error counters are sampled when no alert comes in
+#define CAN_MONITOR_SAMPLE_MS 100
+// Recovery is initiated again if the controller is still bus off this long after the last attempt
+#define CAN_RECOVERY_RETRY_MS 50
+
+class CanBusMonitor {
+    public:
+        ~CanBusMonitor();
+
+        // Starts the monitor task. 'log_tag' is used for its log messages
+        bool start(const char* task_name, const char* log_tag);
+
+        // Stops the monitor task. Must be called before the TWAI driver is uninstalled
+        void stop();
+
+        // Gets the last sampled error state, and the recovery statistics. Safe to call from any task
+        CanBusStats get_stats() const {
+            CanBusStats s;
+            this->stats.read(&s);
+            return s;
+        }
+    private:
+        [[noreturn]]
+        void task_loop();
+        static void start_task_loop(void* _this) {
+            static_cast<CanBusMonitor*>(_this)->task_loop();
+        }
+        // Handles the alerts raised since the last call, and samples the controller
+        void update(uint32_t alerts, uint64_t now);
+        // Driver is running again, 'now' - 'bus_off_time' after going bus off
+        void on_recovered(uint64_t now);
+
+        const char* log_tag = "CAN_MON";
+        TaskHandle_t task = nullptr;
+        // Working copy of the statistics (Only touched by the monitor task)
+        CanBusStats current = {};
+        Seqlock<CanBusStats> stats;
+        // Bus off, and the driver is not running again yet
+        bool in_recovery = false;
+        uint64_t bus_off_time = 0;
+        // Time recovery was last initiated (0 if it has not been yet)
+        uint64_t recovery_start_time = 0;
+};
+
+#endif // __CAN_BUS_MONITOR_H_
@@ -1,10 +1,15 @@
 #include "can_egs52.h"
+#include "can_filter.h"
 #include "driver/twai.h"
 #include "pins.h"
+#include "can_recorder.h"
+#include <string.h>
 
 Egs52Can::Egs52Can(const char* name, uint8_t tx_time_ms)
-    : AbstractCan(name, tx_time_ms)
+    : AbstractCan(name, tx_time_ms),
+      diag_isotp(DiagIsoTpInfo { .tx_canid = 0x7E9, .rx_canid = 0x7E1, .bs = EGS52_DIAG_BS, .st_min = EGS52_DIAG_ST_MIN })
 {
+    this->tx_lock = portMUX_INITIALIZER_UNLOCKED;
     // Firstly try to init CAN
     ESP_LOGI("EGS52_CAN", "CAN constructor called");
     twai_general_config_t gen_config = TWAI_GENERAL_CONFIG_DEFAULT(PIN_CAN_TX, PIN_CAN_RX, TWAI_MODE_NORMAL);
@@ -12,7 +17,24 @@ Egs52Can::Egs52Can(const char* name, uint8_t tx_time_ms)
     gen_config.rx_queue_len = 10;
     gen_config.tx_queue_len = 6;
     twai_timing_config_t timing_config = TWAI_TIMING_CONFIG_500KBITS();
-    twai_filter_config_t filter_config = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+    // Only let through the frames we actually read. Anything else that gets through the filter
+    // is dropped in software by the Rx task
+    // Frames read from other ECUs, plus diagnostic requests (Kept sorted)
+    uint32_t rx_ids[ECU_RX_ID_COUNT+1];
+    uint8_t num_rx_ids = 0;
+    bool diag_added = false;
+    for (uint8_t i = 0; i < ECU_RX_ID_COUNT; i++) {
+        if (!diag_added && this->diag_isotp.get_rx_canid() < ECU_RX_IDS[i]) {
+            rx_ids[num_rx_ids++] = this->diag_isotp.get_rx_canid();
+            diag_added = true;
+        }
+        rx_ids[num_rx_ids++] = ECU_RX_IDS[i];
+    }
+    if (!diag_added) {
+        rx_ids[num_rx_ids++] = this->diag_isotp.get_rx_canid();
+    }
+    twai_filter_config_t filter_config = calc_acceptance_filter(rx_ids, num_rx_ids);
+    ESP_LOGI("EGS52_CAN", "Acceptance filter lets through %u CAN IDs for %u consumed frames", count_accepted_ids(&filter_config), num_rx_ids);
 
     esp_err_t res;
     res = twai_driver_install(&gen_config, &timing_config, &filter_config);
@@ -29,11 +51,18 @@ Egs52Can::Egs52Can(const char* name, uint8_t tx_time_ms)
     this->set_target_gear(GearboxGear::SignalNotAvaliable);
     this->set_actual_gear(GearboxGear::SignalNotAvaliable);
     this->set_shifter_position(ShifterPosition::SignalNotAvaliable);
+    // Tasks are not started yet, so no need for tx_lock
     this->gs218.set_GIC(GS_218h_GIC::G_SNV);
     gs218.set_CALID_CVN_AKT(true);
 
     // Set profile to N/A for now
     this->set_drive_profile(GearboxProfile::Underscore);
+
+    // Tx schedule of EGS52. Frames due on the same tick are sent in this order
+    this->tx_schedule.add_frame(GS_338_CAN_ID, tx_time_ms, 0);
+    this->tx_schedule.add_frame(GS_218_CAN_ID, tx_time_ms, 0);
+    this->tx_schedule.add_frame(GS_418_CAN_ID, tx_time_ms, 0);
+    this->tx_schedule.add_frame(GS_CUSTOM_558_CAN_ID, tx_time_ms, 0);
     // Set no message
     this->set_display_msg(GearboxMessage::None);
 
@@ -50,8 +79,8 @@ Egs52Can::Egs52Can(const char* name, uint8_t tx_time_ms)
 
 
     // Convers setting NAB, a couple unknown but static values,
-    // and Input RPM to 0 
-    gs338.raw = 0xFFFF1FFF00FF0000;
+    // and Input RPM to 0 (Wire order FF FF 1F FF 00 FF 00 00)
+    gs338.raw = 0x0000FF00FF1FFFFF;
     this->can_init_ok = true;
 }
 
@@ -59,6 +88,10 @@ bool Egs52Can::begin_tasks() {
     if (!this->can_init_ok) { // Cannot init tasks if CAN is dead!
         return false;
     }
+    // Drains the driver's Rx queue into the ring the Rx task decodes from
+    if (!this->rx_ring.start("EGS52_CAN_DRAIN", "EGS52_CAN")) {
+        return false;
+    }
     // Prevent starting again
     if (this->rx_task == nullptr) {
         ESP_LOGI("EGS52_CAN", "Starting CAN Rx task");
@@ -74,6 +107,9 @@ bool Egs52Can::begin_tasks() {
             return false;
         }
     }
+    if (!this->bus_monitor.start("EGS52_CAN_MON", "EGS52_CAN")) {
+        return false;
+    }
     return true; // Ready!
 }
 
@@ -85,6 +121,8 @@ Egs52Can::~Egs52Can()
     if (this->tx_task != nullptr) {
         vTaskDelete(this->tx_task);
     }
+    this->bus_monitor.stop();
+    this->rx_ring.stop();
     // Delete CAN
     if (this->can_init_ok) {
         twai_stop();
@@ -106,29 +144,82 @@ WheelData Egs52Can::get_front_left_wheel(uint64_t now, uint64_t expire_time_ms)
     };
 }
 
+WheelData Egs52Can::decode_rear_right_wheel(const BS_200* bs200) {
+    WheelDirection d = WheelDirection::SignalNotAvaliable;
+    switch(bs200->get_DRTGVR()) {
+        case BS_200h_DRTGVR::FWD:
+            d = WheelDirection::Forward;
+            break;
+        case BS_200h_DRTGVR::REV:
+            d = WheelDirection::Reverse;
+            break;
+        case BS_200h_DRTGVR::PASSIVE:
+            d = WheelDirection::Stationary;
+            break;
+        case BS_200h_DRTGVR::SNV:
+        default:
+            break;
+    }
+
+    return WheelData {
+        .double_rpm = bs200->get_DVR(),
+        .current_dir = d
+    };
+}
+
+WheelData Egs52Can::decode_rear_left_wheel(const BS_200* bs200) {
+    WheelDirection d = WheelDirection::SignalNotAvaliable;
+    switch(bs200->get_DRTGVL()) {
+        case BS_200h_DRTGVL::FWD:
+            d = WheelDirection::Forward;
+            break;
+        case BS_200h_DRTGVL::REV:
+            d = WheelDirection::Reverse;
+            break;
+        case BS_200h_DRTGVL::PASSIVE:
+            d = WheelDirection::Stationary;
+            break;
+        case BS_200h_DRTGVL::SNV:
+        default:
+            break;
+    }
+
+    return WheelData {
+        .double_rpm = bs200->get_DVL(),
+        .current_dir = d
+    };
+}
+
+ShifterPosition Egs52Can::decode_shifter_position(const EWM_230* ewm230) {
+    switch (ewm230->get_WHC()) {
+        case EWM_230h_WHC::D:
+            return ShifterPosition::D;
+        case EWM_230h_WHC::N:
+            return ShifterPosition::N;
+        case EWM_230h_WHC::R:
+            return ShifterPosition::R;
+        case EWM_230h_WHC::P:
+            return ShifterPosition::P;
+        case EWM_230h_WHC::PLUS:
+            return ShifterPosition::PLUS;
+        case EWM_230h_WHC::MINUS:
+            return ShifterPosition::MINUS;
+        case EWM_230h_WHC::N_ZW_D:
+            return ShifterPosition::N_D;
+        case EWM_230h_WHC::R_ZW_N:
+            return ShifterPosition::R_N;
+        case EWM_230h_WHC::P_ZW_R:
+            return ShifterPosition::P_R;
+        case EWM_230h_WHC::SNV:
+        default:
+            return ShifterPosition::SignalNotAvaliable;
+    }
+}
+
 WheelData Egs52Can::get_rear_right_wheel(uint64_t now, uint64_t expire_time_ms) {
     BS_200 bs200;
     if (this->esp_ecu.get_BS_200(now, expire_time_ms*1000, &bs200)) {
-        WheelDirection d = WheelDirection::SignalNotAvaliable;
-        switch(bs200.get_DRTGVR()) {
-            case BS_200h_DRTGVR::FWD:
-                d = WheelDirection::Forward;
-                break;
-            case BS_200h_DRTGVR::REV:
-                d = WheelDirection::Reverse;
-                break;
-            case BS_200h_DRTGVR::PASSIVE:
-                d = WheelDirection::Stationary;
-                break;
-            case BS_200h_DRTGVR::SNV:
-            default:
-                break;
-        }
-
-        return WheelData {
-            .double_rpm = bs200.get_DVR(),
-            .current_dir = d
-        };
+        return decode_rear_right_wheel(&bs200);
     } else {
         return WheelData {
             .double_rpm = 0,
@@ -140,26 +231,7 @@ WheelData Egs52Can::get_rear_right_wheel(uint64_t now, uint64_t expire_time_ms)
 WheelData Egs52Can::get_rear_left_wheel(uint64_t now, uint64_t expire_time_ms) {
     BS_200 bs200;
     if (this->esp_ecu.get_BS_200(now, expire_time_ms*1000, &bs200)) {
-        WheelDirection d = WheelDirection::SignalNotAvaliable;
-        switch(bs200.get_DRTGVL()) {
-            case BS_200h_DRTGVL::FWD:
-                d = WheelDirection::Forward;
-                break;
-            case BS_200h_DRTGVL::REV:
-                d = WheelDirection::Reverse;
-                break;
-            case BS_200h_DRTGVL::PASSIVE:
-                d = WheelDirection::Stationary;
-                break;
-            case BS_200h_DRTGVL::SNV:
-            default:
-                break;
-        }
-
-        return WheelData {
-            .double_rpm = bs200.get_DVL(),
-            .current_dir = d
-        };
+        return decode_rear_left_wheel(&bs200);
     } else {
         return WheelData {
             .double_rpm = 0,
@@ -171,29 +243,7 @@ WheelData Egs52Can::get_rear_left_wheel(uint64_t now, uint64_t expire_time_ms) {
 ShifterPosition Egs52Can::get_shifter_position_ewm(uint64_t now, uint64_t expire_time_ms) {
     EWM_230 dest;
     if (this->ewm_ecu.get_EWM_230(now, 1000 * expire_time_ms, &dest)) {
-        switch (dest.get_WHC()) {
-            case EWM_230h_WHC::D:
-                return ShifterPosition::D;
-            case EWM_230h_WHC::N:
-                return ShifterPosition::N;
-            case EWM_230h_WHC::R:
-                return ShifterPosition::R;
-            case EWM_230h_WHC::P:
-                return ShifterPosition::P;
-            case EWM_230h_WHC::PLUS:
-                return ShifterPosition::PLUS;
-            case EWM_230h_WHC::MINUS:
-                return ShifterPosition::MINUS;
-            case EWM_230h_WHC::N_ZW_D:
-                return ShifterPosition::N_D;
-            case EWM_230h_WHC::R_ZW_N:
-                return ShifterPosition::R_N;
-            case EWM_230h_WHC::P_ZW_R:
-                return ShifterPosition::P_R;
-            case EWM_230h_WHC::SNV:
-            default:
-                return ShifterPosition::SignalNotAvaliable;
-        }
+        return decode_shifter_position(&dest);
     } else {
         return ShifterPosition::SignalNotAvaliable;
     }
@@ -297,7 +347,92 @@ bool Egs52Can::get_profile_btn_press(uint64_t now, uint64_t expire_time_ms) {
     }
 }
 
+void Egs52Can::get_vehicle_snapshot(uint64_t now, const VehicleSnapshotExpiry* expiry, VehicleSnapshot* dest) {
+    BS_200 bs200;
+    EWM_230 ewm230;
+    MS_210 ms210;
+    MS_308 ms308;
+    MS_608 ms608;
+    dest->timestamp = now;
+    dest->valid = 0;
+    dest->rear_left_wheel = WheelData { .double_rpm = 0, .current_dir = WheelDirection::SignalNotAvaliable };
+    dest->rear_right_wheel = WheelData { .double_rpm = 0, .current_dir = WheelDirection::SignalNotAvaliable };
+    dest->engine_rpm = 0;
+    dest->shifter_position = ShifterPosition::SignalNotAvaliable;
+    dest->pedal = 0;
+    dest->engine_coolant_temp = 0;
+    // Both rear wheels come from the same BS_200 frame
+    if (this->esp_ecu.get_BS_200(now, 1000*expiry->wheels_ms, &bs200)) {
+        dest->rear_left_wheel = decode_rear_left_wheel(&bs200);
+        dest->rear_right_wheel = decode_rear_right_wheel(&bs200);
+        if (dest->rear_left_wheel.current_dir != WheelDirection::SignalNotAvaliable) {
+            dest->valid |= SNAPSHOT_REAR_LEFT_WHEEL;
+        }
+        if (dest->rear_right_wheel.current_dir != WheelDirection::SignalNotAvaliable) {
+            dest->valid |= SNAPSHOT_REAR_RIGHT_WHEEL;
+        }
+    }
+    if (this->ewm_ecu.get_EWM_230(now, 1000*expiry->shifter_position_ms, &ewm230)) {
+        dest->shifter_position = decode_shifter_position(&ewm230);
+        if (dest->shifter_position != ShifterPosition::SignalNotAvaliable) {
+            dest->valid |= SNAPSHOT_SHIFTER_POSITION;
+        }
+    }
+    if (this->ecu_ms.get_MS_308(now, 1000*expiry->engine_rpm_ms, &ms308)) {
+        dest->engine_rpm = ms308.get_NMOT();
+        dest->valid |= SNAPSHOT_ENGINE_RPM;
+    }
+    if (this->ecu_ms.get_MS_210(now, 1000*expiry->pedal_ms, &ms210)) {
+        dest->pedal = ms210.get_PW();
+        dest->valid |= SNAPSHOT_PEDAL;
+    }
+    if (this->ecu_ms.get_MS_608(now, 1000*expiry->engine_coolant_temp_ms, &ms608)) {
+        dest->engine_coolant_temp = (int16_t)ms608.get_T_MOT()-40;
+        dest->valid |= SNAPSHOT_ENGINE_COOLANT_TEMP;
+    }
+}
+
+CanRxStats Egs52Can::get_rx_stats() {
+    return this->rx_ring.get_stats();
+}
+
+uint8_t Egs52Can::get_num_rx_frames() {
+    return ECU_RX_ID_COUNT;
+}
+
+uint8_t Egs52Can::get_num_tx_frames() {
+    return this->tx_schedule.get_num_frames();
+}
+
+bool Egs52Can::get_tx_frame_stats(uint8_t idx, uint32_t* can_id, TxFrameStats* dest) {
+    return this->tx_schedule.get_frame_stats(idx, can_id, dest);
+}
+
+bool Egs52Can::get_rx_frame_stats(uint8_t idx, uint32_t* can_id, FrameArrivalStats* dest) {
+    if (idx >= ECU_RX_ID_COUNT) {
+        return false;
+    }
+    const EcuDispatchEntry* e = ecu_dispatch_lookup(ECU_RX_IDS[idx]);
+    if (e == nullptr) {
+        return false;
+    }
+    *can_id = e->can_id;
+    switch (e->ecu) {
+        case EcuId::MS:
+            return this->ecu_ms.get_frame_stats_at(e->slot, dest);
+        case EcuId::ESP_SBC:
+            return this->esp_ecu.get_frame_stats_at(e->slot, dest);
+        case EcuId::EWM:
+            return this->ewm_ecu.get_frame_stats_at(e->slot, dest);
+        case EcuId::ANY_ECU:
+            return this->misc_ecu.get_frame_stats_at(e->slot, dest);
+        default:
+            return false;
+    }
+}
+
 void Egs52Can::set_clutch_status(ClutchStatus status) {
+    portENTER_CRITICAL(&this->tx_lock);
     switch(status) {
         case ClutchStatus::Open:
             gs218.set_K_G_B(false);
@@ -317,137 +452,11 @@ void Egs52Can::set_clutch_status(ClutchStatus status) {
         default:
             break;
     }
-}
-
-void Egs52Can::set_actual_gear(GearboxGear actual) {
-    switch (actual) {
-        case GearboxGear::Park:
-            this->gs418.set_GIC(GS_418h_GIC::G_P);
-            this->gs218.set_GIC(GS_218h_GIC::G_P);
-            break;
-        case GearboxGear::Reverse_First:
-            this->gs418.set_GIC(GS_418h_GIC::G_R);
-            this->gs218.set_GIC(GS_218h_GIC::G_R);
-            break;
-        case GearboxGear::Reverse_Second:
-            this->gs418.set_GIC(GS_418h_GIC::G_R2);
-            this->gs218.set_GIC(GS_218h_GIC::G_R2);
-            break;
-        case GearboxGear::Neutral:
-            this->gs418.set_GIC(GS_418h_GIC::G_N);
-            this->gs218.set_GIC(GS_218h_GIC::G_N);
-            break;
-        case GearboxGear::First:
-            this->gs418.set_GIC(GS_418h_GIC::G_D1);
-            this->gs218.set_GIC(GS_218h_GIC::G_D1);
-            break;
-        case GearboxGear::Second:
-            this->gs418.set_GIC(GS_418h_GIC::G_D2);
-            this->gs218.set_GIC(GS_218h_GIC::G_D2);
-            break;
-        case GearboxGear::Third:
-            this->gs418.set_GIC(GS_418h_GIC::G_D3);
-            this->gs218.set_GIC(GS_218h_GIC::G_D3);
-            break;
-        case GearboxGear::Fourth:
-            this->gs418.set_GIC(GS_418h_GIC::G_D4);
-            this->gs218.set_GIC(GS_218h_GIC::G_D4);
-            break;
-        case GearboxGear::Fifth:
-            this->gs418.set_GIC(GS_418h_GIC::G_D5);
-            this->gs218.set_GIC(GS_218h_GIC::G_D5);
-            break;
-        case GearboxGear::Sixth:
-            this->gs418.set_GIC(GS_418h_GIC::G_D6);
-            this->gs218.set_GIC(GS_218h_GIC::G_D6);
-            break;
-        case GearboxGear::Seventh:
-            this->gs418.set_GIC(GS_418h_GIC::G_D7);
-            this->gs218.set_GIC(GS_218h_GIC::G_D7);
-            break;
-        case GearboxGear::SignalNotAvaliable:
-        default:
-            this->gs418.set_GIC(GS_418h_GIC::G_SNV);
-            this->gs218.set_GIC(GS_218h_GIC::G_SNV);
-            break;
-    }
-}
-
-void Egs52Can::set_target_gear(GearboxGear target) {
-    switch (target) {
-        case GearboxGear::Park:
-            this->gs418.set_GZC(GS_418h_GZC::G_P);
-            this->gs218.set_GZC(GS_218h_GZC::G_P);
-            break;
-        case GearboxGear::Reverse_First:
-            this->gs418.set_GZC(GS_418h_GZC::G_R);
-            this->gs218.set_GZC(GS_218h_GZC::G_R);
-            break;
-        case GearboxGear::Reverse_Second:
-            this->gs418.set_GZC(GS_418h_GZC::G_R2);
-            this->gs218.set_GZC(GS_218h_GZC::G_R2);
-            break;
-        case GearboxGear::Neutral:
-            this->gs418.set_GZC(GS_418h_GZC::G_N);
-            this->gs218.set_GZC(GS_218h_GZC::G_N);
-            break;
-        case GearboxGear::First:
-            this->gs418.set_GZC(GS_418h_GZC::G_D1);
-            this->gs218.set_GZC(GS_218h_GZC::G_D1);
-            break;
-        case GearboxGear::Second:
-            this->gs418.set_GZC(GS_418h_GZC::G_D2);
-            this->gs218.set_GZC(GS_218h_GZC::G_D2);
-            break;
-        case GearboxGear::Third:
-            this->gs418.set_GZC(GS_418h_GZC::G_D3);
-            this->gs218.set_GZC(GS_218h_GZC::G_D3);
-            break;
-        case GearboxGear::Fourth:
-            this->gs418.set_GZC(GS_418h_GZC::G_D4);
-            this->gs218.set_GZC(GS_218h_GZC::G_D4);
-            break;
-        case GearboxGear::Fifth:
-            this->gs418.set_GZC(GS_418h_GZC::G_D5);
-            this->gs218.set_GZC(GS_218h_GZC::G_D5);
-            break;
-        case GearboxGear::Sixth:
-            this->gs418.set_GZC(GS_418h_GZC::G_D6);
-            this->gs218.set_GZC(GS_218h_GZC::G_D6);
-            break;
-        case GearboxGear::Seventh:
-            this->gs418.set_GZC(GS_418h_GZC::G_D7);
-            this->gs218.set_GZC(GS_218h_GZC::G_D7);
-            break;
-        case GearboxGear::SignalNotAvaliable:
-        default:
-            this->gs418.set_GZC(GS_418h_GZC::G_SNV);
-            this->gs218.set_GZC(GS_218h_GZC::G_SNV);
-            break;
-    }
-}
-
-void Egs52Can::set_safe_start(bool can_start) {
-    this->gs218.set_ALF(can_start);
-}
-
-void Egs52Can::set_gearbox_temperature(uint16_t temp) {
-    this->gs418.set_T_GET((temp+50) & 0xFF);
-}
-
-void Egs52Can::set_input_shaft_speed(uint16_t rpm) {
-    gs338.set_NTURBINE(rpm);
-}
-
-void Egs52Can::set_is_all_wheel_drive(bool is_4wd) {
-    this->gs418.set_ALLRAD(is_4wd);
-}
-
-void Egs52Can::set_wheel_torque(uint16_t t) {
-
+    portEXIT_CRITICAL(&this->tx_lock);
 }
 
 void Egs52Can::set_shifter_position(ShifterPosition pos) {
+    portENTER_CRITICAL(&this->tx_lock);
     switch (pos) {
         case ShifterPosition::P:
             gs418.set_WHST(GS_418h_WHST::P);
@@ -471,37 +480,11 @@ void Egs52Can::set_shifter_position(ShifterPosition pos) {
             gs418.set_WHST(GS_418h_WHST::SNV);
             break;
     }
-}
-
-void Egs52Can::set_gearbox_ok(bool is_ok) {
-    gs218.set_GET_OK(is_ok); // Gearbox OK
-    gs218.set_GSP_OK(is_ok); // Gearbox profile OK
-    gs218.set_GS_NOTL(!is_ok); // Emergency mode activated
-}
-
-void Egs52Can::set_torque_request(TorqueRequest request) {
-    switch(request) {
-        case TorqueRequest::Maximum:
-            gs218.set_MMIN_EGS(false);
-            gs218.set_MMAX_EGS(true);
-            break;
-        case TorqueRequest::Minimum:
-            gs218.set_MMIN_EGS(true);
-            gs218.set_MMAX_EGS(false);
-            break;
-        case TorqueRequest::None:
-        default:
-            gs218.set_MMIN_EGS(false);
-            gs218.set_MMAX_EGS(false);
-            break;
-    }
-}
-
-void Egs52Can::set_requested_torque(uint16_t torque_nm) {
-    gs218.set_M_EGS(torque_nm);
+    portEXIT_CRITICAL(&this->tx_lock);
 }
 
 void Egs52Can::set_error_check_status(SystemStatusCheck ssc) {
+    portENTER_CRITICAL(&this->tx_lock);
     switch(ssc) {
         case SystemStatusCheck::Error:
             gs218.set_FEHLPRF_ST(GS_218h_FEHLPRF_ST::ERROR);
@@ -515,18 +498,12 @@ void Egs52Can::set_error_check_status(SystemStatusCheck ssc) {
         default:
             break;
     }
+    portEXIT_CRITICAL(&this->tx_lock);
 }
 
 
-void Egs52Can::set_turbine_torque_loss(uint16_t loss_nm) {
-    
-}
-
-void Egs52Can::set_display_gear(char g) {
-    this->gs418.set_FSC(g);
-}
-
 void Egs52Can::set_drive_profile(GearboxProfile p) {
+    portENTER_CRITICAL(&this->tx_lock);
     this->curr_profile_bit = p;
     switch (p) {
         case GearboxProfile::Agility:
@@ -554,10 +531,17 @@ void Egs52Can::set_drive_profile(GearboxProfile p) {
             break;
     }
     // Update display message as well
-    this->set_display_msg(this->curr_message);
+    this->apply_display_msg(this->curr_message);
+    portEXIT_CRITICAL(&this->tx_lock);
 }
 
 void Egs52Can::set_display_msg(GearboxMessage msg) {
+    portENTER_CRITICAL(&this->tx_lock);
+    this->apply_display_msg(msg);
+    portEXIT_CRITICAL(&this->tx_lock);
+}
+
+void Egs52Can::apply_display_msg(GearboxMessage msg) {
     this->curr_message = msg;
     if (this->curr_profile_bit == GearboxProfile::Agility) {
         switch (msg) {
@@ -767,112 +751,124 @@ inline bool calc_torque_parity(uint16_t s) {
     return (p & 1) == 1;
 }
 
-inline void to_bytes(uint64_t src, uint8_t* dst) {
-    for(uint8_t i = 0; i < 8; i++) {
-        dst[7-i] = src & 0xFF;
-        src >>= 8;
+bool Egs52Can::build_tx_frame(uint8_t idx, bool on_schedule, uint8_t* dest) {
+    // Copy current CAN frame values to here so we don't
+    // accidentally modify parity calculations
+    portENTER_CRITICAL(&this->tx_lock);
+    GS_338 gs_338tx = {gs338.raw};
+    GS_218 gs_218tx = {gs218.raw};
+    GS_418 gs_418tx = {gs418.raw};
+    GS_CUSTOM_558 gs_558tx = {gs558.raw};
+    portEXIT_CRITICAL(&this->tx_lock);
+    switch (this->tx_schedule.get_can_id(idx)) {
+        case GS_338_CAN_ID:
+            memcpy(dest, gs_338tx.bytes, 8);
+            return true;
+        case GS_218_CAN_ID:
+            // Toggle bits need to be toggled every 2 frames sent on schedule (40ms).
+            // Out of cycle frames repeat the toggle of the last scheduled frame
+            if (on_schedule) {
+                this->gs218_toggle = (this->gs218_cycles >> 1) & 1;
+                this->gs218_cycles++;
+            }
+            gs_218tx.set_MTGL_EGS(this->gs218_toggle);
+            gs_218tx.set_MPAR_EGS(calc_torque_parity(gs_218tx.bytes[0] << 8 | gs_218tx.bytes[1]));
+            // Now set CVN Counter (Increases every frame)
+            gs_218tx.set_FEHLER(this->cvn_counter);
+            this->cvn_counter++;
+            memcpy(dest, gs_218tx.bytes, 8);
+            return true;
+        case GS_418_CAN_ID:
+            if (on_schedule) {
+                this->gs418_toggle = (this->gs418_cycles >> 1) & 1;
+                this->gs418_cycles++;
+            }
+            gs_418tx.set_FMRADTGL(this->gs418_toggle);
+            gs_418tx.set_FMRADPAR(calc_torque_parity(gs_418tx.bytes[6] << 8 | gs_418tx.bytes[7]));
+            memcpy(dest, gs_418tx.bytes, 8);
+            return true;
+        case GS_CUSTOM_558_CAN_ID:
+            memcpy(dest, gs_558tx.bytes, 8);
+            return true;
+        default:
+            return false;
     }
 }
 
 [[noreturn]]
 void Egs52Can::tx_task_loop() {
-    uint64_t start_time;
-    uint32_t taken;
-    twai_message_t tx;
-    tx.data_length_code = 8; // Always
-    GS_338 gs_338tx;
-    GS_218 gs_218tx;
-    GS_418 gs_418tx;
-    GS_CUSTOM_558 gs_558tx;
-    uint8_t cvn_counter = 0;
-    bool toggle = false;
-    bool time_to_toggle = false;
+    uint32_t diag_wait_us = UINT32_MAX;
+    if (!this->tx_schedule.start(xTaskGetCurrentTaskHandle())) {
+        ESP_LOGE("EGS52_CAN", "Could not start Tx schedule!");
+    }
     while(true) {
-        // Copy current CAN frame values to here so we don't
-        // accidentally modify parity calculations
-        gs_338tx = {gs338.raw};
-        gs_218tx = {gs218.raw};
-        gs_418tx = {gs418.raw};
-        gs_558tx = {gs558.raw};
-
-        // Firstly we have to deal with toggled bits!
-        // As toggle bits need to be toggled every 40ms,
-        // and egs52 Tx interval is 20ms,
-        // we can achieve this with 2 booleans
-        gs_218tx.set_MTGL_EGS(toggle);
-        gs_418tx.set_FMRADTGL(toggle);
-        // Now do parity calculations
-        gs_218tx.set_MPAR_EGS(calc_torque_parity(gs_218tx.raw >> 48));
-        gs_418tx.set_FMRADPAR(calc_torque_parity(gs_418tx.raw & 0xFFFF));
-        if (time_to_toggle) {
-            toggle = !toggle;
-        }
-        time_to_toggle = !time_to_toggle;
-        
-        // Now set CVN Counter (Increases every frame)
-        gs_218tx.set_FEHLER(cvn_counter);
-        cvn_counter++;
-
-        // Now send CAN Data!
-
+        this->tx_schedule.wait_for_tick(diag_wait_us);
         /**
-         * TX order of EGS52:
+         * TX order of EGS52 (When due on the same tick):
          * GS_338
          * GS_218
          * GS_418
          * GS_CUSTOM_558 ;)
          */
-        start_time = esp_timer_get_time() / 1000;
-        tx.identifier = GS_338_CAN_ID;
-        to_bytes(gs_338tx.raw, tx.data);
-        twai_transmit(&tx, 5);
-        tx.identifier = GS_218_CAN_ID;
-        to_bytes(gs_218tx.raw, tx.data);
-        twai_transmit(&tx, 5);
-        tx.identifier = GS_418_CAN_ID;
-        to_bytes(gs_418tx.raw, tx.data);
-        twai_transmit(&tx, 5);
-        tx.identifier = GS_CUSTOM_558_CAN_ID;
-        to_bytes(gs_558tx.raw, tx.data);
-        twai_transmit(&tx, 5);
-        // Todo handle additional ISOTP communication
-        taken = (esp_timer_get_time() / 1000) - start_time;
-        if (taken < this->tx_time_ms) {
-            vTaskDelay(this->tx_time_ms-taken / portTICK_PERIOD_MS);
-        }
+        this->tx_schedule.send_frames(Egs52Can::build_tx_frame_cb, this);
+        // Diagnostics fill the gaps between scheduled frames
+        this->diag_isotp.process_request(this->diag_server);
+        diag_wait_us = this->diag_isotp.send_frames(&this->tx_schedule);
     }
 }
 
 [[noreturn]]
 void Egs52Can::rx_task_loop() {
-    twai_message_t rx;
-    twai_status_info_t can_status;
+    CanRxFrame rx;
     uint64_t now;
     uint64_t tmp;
-    uint8_t i;
     while(true) {
-        twai_get_status_info(&can_status);
-        uint8_t f_count  = can_status.msgs_to_rx;
-        if (f_count == 0) {
-            vTaskDelay(4 / portTICK_PERIOD_MS); // Wait for buffer to have at least 1 frame
-        } else { // We have frames, read them
-            now = esp_timer_get_time();
-            for(uint8_t x = 0; x < f_count; x++) { // Read all frames
-                if (twai_receive(&rx, pdMS_TO_TICKS(2)) == ESP_OK && rx.data_length_code != 0 && rx.flags == 0) {
-                    tmp = 0;
-                    for(i = 0; i < rx.data_length_code; i++) {
-                        tmp |= (uint64_t)rx.data[i] << (8*(7-i));
-                    }
-                    if(this->ecu_ms.import_frames(tmp, rx.identifier, now)) {
-                    } else if (this->esp_ecu.import_frames(tmp, rx.identifier, now)) {
-                    } else if (this->ewm_ecu.import_frames(tmp, rx.identifier, now)) {
-                    } else if (this->misc_ecu.import_frames(tmp, rx.identifier, now)) {
-                    } else {} // TODO handle ISOTP endpoints
-                } else {
-                    vTaskDelay(2 / portTICK_PERIOD_MS);
+        // Block until the drain task has put a frame in the ring. This puts the task
+        // to sleep when the bus is quiet, and wakes it up as soon as a frame lands
+        if (!this->rx_ring.pop(&rx, portMAX_DELAY)) {
+            continue;
+        }
+        // Frame age is from when it came out of the driver, not from when we got to it
+        now = rx.timestamp;
+                can_recorder.record_rx(rx.identifier, rx.data_length_code, rx.data, now);
+        if (rx.data_length_code != 0 && rx.flags == 0) {
+            // Generated frames are stored in wire order, so the payload is copied as is
+            tmp = 0;
+            memcpy(&tmp, rx.data, rx.data_length_code > 8 ? 8 : rx.data_length_code);
+            // One table lookup tells us which ECU (and which of its slots) the frame belongs to
+            const EcuDispatchEntry* dest = ecu_dispatch_lookup(rx.identifier);
+            if (dest != nullptr) {
+                // The generated import checks the message counter, toggle and parity signals of the frame
+                FrameCheckResult res;
+                switch (dest->ecu) {
+                    case EcuId::MS:
+                        res = this->ecu_ms.import_frame_at(dest->slot, tmp, now);
+                        break;
+                    case EcuId::ESP_SBC:
+                        res = this->esp_ecu.import_frame_at(dest->slot, tmp, now);
+                        break;
+                    case EcuId::EWM:
+                        res = this->ewm_ecu.import_frame_at(dest->slot, tmp, now);
+                        break;
+                    case EcuId::ANY_ECU:
+                        res = this->misc_ecu.import_frame_at(dest->slot, tmp, now);
+                        break;
+                    default: // Known frame, but from an ECU we don't store data for
+                        this->rx_ring.count_dropped();
+                        continue;
+                }
+                if (res != FrameCheckResult::Ok) {
+                    this->rx_ring.count_rejected();
                 }
+            } else if (rx.identifier == this->diag_isotp.get_rx_canid()) {
+                this->diag_isotp.on_frame_received(rx.data, rx.data_length_code, now);
+                // Tx task sends flow control / handles the request
+                this->tx_schedule.wake();
+            } else {
+                this->rx_ring.count_dropped();
             }
-            vTaskDelay(1 / portTICK_PERIOD_MS); // Reset watchdog here
+        } else {
+            this->rx_ring.count_dropped();
         }
     }
 }
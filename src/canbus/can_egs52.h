@@ -2,16 +2,32 @@
 #define __EGS52_CAN_H_
 
 #include "can_hal.h"
+#include "can_tx_scheduler.h"
+#include "can_bus_monitor.h"
+#include "can_rx_ring.h"
+#include "iso_tp.h"
 
 #define EGS52_MODE
 
+// Block size and STmin we ask the tester to use when it sends us multi frame requests
+#define EGS52_DIAG_BS 8
+#define EGS52_DIAG_ST_MIN 0
+
 #include "ANY_ECU.h"
 #include "ESP_SBC.h"
 #include "EWM.h"
 #include "GS.h"
 #include "MS.h"
+#include "EGS52_DISPATCH.h"
 
-class Egs52Can: public AbstractCan {
+/**
+ * The setters the gearbox controller calls every tick are defined here, so that
+ * calls through EgsCanHal (See egs_can_hal.h) can be inlined into the controller.
+ *
+ * The Tx frames are updated by the setters (From several tasks) whilst the Tx task builds frames from them,
+ * so both only touch them whilst holding tx_lock
+ */
+class Egs52Can final: public AbstractCan {
     public:
         explicit Egs52Can(const char* name, uint8_t tx_time_ms);
         bool begin_tasks() override;
@@ -57,41 +73,138 @@ class Egs52Can: public AbstractCan {
         bool get_is_starting(uint64_t now, uint64_t expire_time_ms) override;
         // 
         bool get_profile_btn_press(uint64_t now, uint64_t expire_time_ms) override;
+        // Fills 'dest' with everything the gearbox controller needs for one tick
+        void get_vehicle_snapshot(uint64_t now, const VehicleSnapshotExpiry* expiry, VehicleSnapshot* dest) override;
+        // Gets statistics about received CAN frames
+        CanRxStats get_rx_stats() override;
+        // Gets the number of CAN frames the HAL reads from other ECUs
+        uint8_t get_num_rx_frames() override;
+        // Gets the CAN ID and arrival statistics of read frame 'idx' (0 to get_num_rx_frames()-1)
+        bool get_rx_frame_stats(uint8_t idx, uint32_t* can_id, FrameArrivalStats* dest) override;
+        // Gets the number of CAN frames the HAL sends
+        uint8_t get_num_tx_frames() override;
+        // Gets the CAN ID and Tx schedule statistics of sent frame 'idx' (0 to get_num_tx_frames()-1)
+        bool get_tx_frame_stats(uint8_t idx, uint32_t* can_id, TxFrameStats* dest) override;
+        // Gets the error state of the CAN controller, and bus off recovery statistics
+        CanBusStats get_bus_stats() override {
+            return this->bus_monitor.get_stats();
+        }
 
         /**
          * Setters
          */
 
+        // Sets the server that handles requests received on the diagnostic CAN IDs
+        void set_diag_server(DiagServer* server) override {
+            this->diag_server = server;
+        }
         // Set the gearbox clutch position on CAN
         void set_clutch_status(ClutchStatus status) override;
         // Set the actual gear of the gearbox
-        void set_actual_gear(GearboxGear actual) override;
+        void set_actual_gear(GearboxGear actual) override {
+            uint8_t code = gear_to_gs_code(actual);
+            portENTER_CRITICAL(&this->tx_lock);
+            uint64_t prev_218 = this->gs218.raw;
+            uint64_t prev_418 = this->gs418.raw;
+            this->gs418.set_GIC((GS_418h_GIC)code);
+            this->gs218.set_GIC((GS_218h_GIC)code);
+            bool changed_218 = this->gs218.raw != prev_218;
+            bool changed_418 = this->gs418.raw != prev_418;
+            portEXIT_CRITICAL(&this->tx_lock);
+            if (changed_218) {
+                this->tx_schedule.request_urgent(GS_218_CAN_ID);
+            }
+            if (changed_418) {
+                this->tx_schedule.request_urgent(GS_418_CAN_ID);
+            }
+        }
         // Set the target gear of the gearbox
-        void set_target_gear(GearboxGear target) override;
+        void set_target_gear(GearboxGear target) override {
+            uint8_t code = gear_to_gs_code(target);
+            portENTER_CRITICAL(&this->tx_lock);
+            uint64_t prev_218 = this->gs218.raw;
+            uint64_t prev_418 = this->gs418.raw;
+            this->gs418.set_GZC((GS_418h_GZC)code);
+            this->gs218.set_GZC((GS_218h_GZC)code);
+            bool changed_218 = this->gs218.raw != prev_218;
+            bool changed_418 = this->gs418.raw != prev_418;
+            portEXIT_CRITICAL(&this->tx_lock);
+            if (changed_218) {
+                this->tx_schedule.request_urgent(GS_218_CAN_ID);
+            }
+            if (changed_418) {
+                this->tx_schedule.request_urgent(GS_418_CAN_ID);
+            }
+        }
         // Sets the status bit indicating the car is safe to start
-        void set_safe_start(bool can_start) override;
+        void set_safe_start(bool can_start) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            this->gs218.set_ALF(can_start);
+            portEXIT_CRITICAL(&this->tx_lock);
+        }
         // Sets the gerabox ATF temperature. Offset by +50C
-        void set_gearbox_temperature(uint16_t temp) override;
+        void set_gearbox_temperature(uint16_t temp) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            this->gs418.set_T_GET((temp+50) & 0xFF);
+            portEXIT_CRITICAL(&this->tx_lock);
+        }
         // Sets the RPM of the input shaft of the gearbox on CAN
-        void set_input_shaft_speed(uint16_t rpm) override;
+        void set_input_shaft_speed(uint16_t rpm) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            this->gs338.set_NTURBINE(rpm);
+            portEXIT_CRITICAL(&this->tx_lock);
+        }
         // Sets 4WD activated toggle bit
-        void set_is_all_wheel_drive(bool is_4wd) override;
+        void set_is_all_wheel_drive(bool is_4wd) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            this->gs418.set_ALLRAD(is_4wd);
+            portEXIT_CRITICAL(&this->tx_lock);
+        }
         // Sets wheel torque
-        void set_wheel_torque(uint16_t t) override;
+        void set_wheel_torque(uint16_t t) override {}
         // Sets shifter position message
         void set_shifter_position(ShifterPosition pos) override;
         // Sets gearbox is OK
-        void set_gearbox_ok(bool is_ok) override;
+        void set_gearbox_ok(bool is_ok) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            this->gs218.set_GET_OK(is_ok); // Gearbox OK
+            this->gs218.set_GSP_OK(is_ok); // Gearbox profile OK
+            this->gs218.set_GS_NOTL(!is_ok); // Emergency mode activated
+            portEXIT_CRITICAL(&this->tx_lock);
+        }
         // Sets torque request toggle
-        void set_torque_request(TorqueRequest request) override;
+        void set_torque_request(TorqueRequest request) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            uint64_t prev_218 = this->gs218.raw;
+            this->gs218.set_MMIN_EGS(request == TorqueRequest::Minimum);
+            this->gs218.set_MMAX_EGS(request == TorqueRequest::Maximum);
+            bool changed = this->gs218.raw != prev_218;
+            portEXIT_CRITICAL(&this->tx_lock);
+            if (changed) {
+                this->tx_schedule.request_urgent(GS_218_CAN_ID);
+            }
+        }
         // Sets requested engine torque
-        void set_requested_torque(uint16_t torque_nm) override;
+        void set_requested_torque(uint16_t torque_nm) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            uint64_t prev_218 = this->gs218.raw;
+            this->gs218.set_M_EGS(torque_nm);
+            bool changed = this->gs218.raw != prev_218;
+            portEXIT_CRITICAL(&this->tx_lock);
+            if (changed) {
+                this->tx_schedule.request_urgent(GS_218_CAN_ID);
+            }
+        }
         // Sets the status of system error check
         void set_error_check_status(SystemStatusCheck ssc) override;
         // Sets torque loss of torque converter
-        void set_turbine_torque_loss(uint16_t loss_nm) override;
+        void set_turbine_torque_loss(uint16_t loss_nm) override {}
         // Sets display profile
-        void set_display_gear(char g) override;
+        void set_display_gear(char g) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            this->gs418.set_FSC(g);
+            portEXIT_CRITICAL(&this->tx_lock);
+        }
         // Sets drive profile
         void set_drive_profile(GearboxProfile p) override;
         // Sets display message
@@ -109,12 +222,64 @@ class Egs52Can: public AbstractCan {
         GS_418 gs418 = {0};
         GS_338 gs338 = {0};
         GS_CUSTOM_558 gs558 = {0};
+        // Held whilst reading or writing the Tx frames above, and the profile and message they show
+        portMUX_TYPE tx_lock;
+        // Shows 'msg' in the display message of GS_418, for the current profile. Caller holds tx_lock
+        void apply_display_msg(GearboxMessage msg);
+        // Tx deadlines of the frames above
+        CanTxScheduler tx_schedule;
+        // Error state of the CAN controller, and bus off recovery
+        CanBusMonitor bus_monitor;
+        // Frames received by the driver, waiting for the Rx task to decode them
+        CanRxRing rx_ring;
+        // KWP2000 diagnostics (ISO-TP on 0x7E1 / 0x7E9)
+        IsoTp diag_isotp;
+        DiagServer* diag_server = nullptr;
+        // Tx counter and toggle state (Only written by the Tx task)
+        uint8_t cvn_counter = 0;
+        uint32_t gs218_cycles = 0;
+        uint32_t gs418_cycles = 0;
+        bool gs218_toggle = false;
+        bool gs418_toggle = false;
+        // Builds the Tx payload of frame 'idx' of the schedule into 'dest'. 'on_schedule' is false for out of cycle frames
+        bool build_tx_frame(uint8_t idx, bool on_schedule, uint8_t* dest);
+        static bool build_tx_frame_cb(void* _this, uint8_t idx, bool on_schedule, uint8_t* dest) {
+            return static_cast<Egs52Can*>(_this)->build_tx_frame(idx, on_schedule, dest);
+        }
         // ECU Data to Rx to
-        ECU_ESP_SBC esp_ecu = ECU_ESP_SBC();
-        ECU_ANY_ECU misc_ecu = ECU_ANY_ECU();
-        ECU_EWM ewm_ecu = ECU_EWM();
-        ECU_MS ecu_ms = ECU_MS();
+        ECU_ESP_SBC esp_ecu;
+        ECU_ANY_ECU misc_ecu;
+        ECU_EWM ewm_ecu;
+        ECU_MS ecu_ms;
         bool can_init_ok = false;
+        // Decoders shared by the getters and get_vehicle_snapshot()
+        static WheelData decode_rear_left_wheel(const BS_200* bs200);
+        static WheelData decode_rear_right_wheel(const BS_200* bs200);
+        static ShifterPosition decode_shifter_position(const EWM_230* ewm230);
+        // Gear code used by the GIC and GZC signals of GS_218 and GS_418
+        static uint8_t gear_to_gs_code(GearboxGear g) {
+            switch (g) {
+                case GearboxGear::First:
+                case GearboxGear::Second:
+                case GearboxGear::Third:
+                case GearboxGear::Fourth:
+                case GearboxGear::Fifth:
+                case GearboxGear::Sixth:
+                case GearboxGear::Seventh:
+                    return (uint8_t)g; // G_D1 - G_D7
+                case GearboxGear::Park:
+                    return (uint8_t)GS_218h_GIC::G_P;
+                case GearboxGear::Neutral:
+                    return (uint8_t)GS_218h_GIC::G_N;
+                case GearboxGear::Reverse_First:
+                    return (uint8_t)GS_218h_GIC::G_R;
+                case GearboxGear::Reverse_Second:
+                    return (uint8_t)GS_218h_GIC::G_R2;
+                case GearboxGear::SignalNotAvaliable:
+                default:
+                    return (uint8_t)GS_218h_GIC::G_SNV;
+            }
+        }
 };
 
 
@@ -0,0 +1,697 @@
+#include "can_egs53.h"
+#include "can_filter.h"
+#include "driver/twai.h"
+#include "pins.h"
+#include "can_recorder.h"
+#include <string.h>
+
+Egs53Can::Egs53Can(const char* name, uint8_t tx_time_ms)
+    : AbstractCan(name, tx_time_ms),
+      diag_isotp(DiagIsoTpInfo { .tx_canid = 0x7E9, .rx_canid = 0x7E1, .bs = EGS53_DIAG_BS, .st_min = EGS53_DIAG_ST_MIN })
+{
+    this->tx_lock = portMUX_INITIALIZER_UNLOCKED;
+    // Firstly try to init CAN
+    ESP_LOGI("EGS53_CAN", "CAN constructor called");
+    twai_general_config_t gen_config = TWAI_GENERAL_CONFIG_DEFAULT(PIN_CAN_TX, PIN_CAN_RX, TWAI_MODE_NORMAL);
+    gen_config.intr_flags = ESP_INTR_FLAG_IRAM; // Set TWAI interrupt to IRAM (Enabled in menuconfig)!
+    gen_config.rx_queue_len = 10;
+    gen_config.tx_queue_len = MAX_TX_FRAMES; // Every scheduled frame can be due on the same tick
+    twai_timing_config_t timing_config = TWAI_TIMING_CONFIG_500KBITS();
+    // Only let through the frames we actually read. Anything else that gets through the filter
+    // is dropped in software by the Rx task
+    // Frames read from other ECUs, plus diagnostic requests (Kept sorted)
+    uint32_t rx_ids[ECU_RX_ID_COUNT+1];
+    uint8_t num_rx_ids = 0;
+    bool diag_added = false;
+    for (uint8_t i = 0; i < ECU_RX_ID_COUNT; i++) {
+        if (!diag_added && this->diag_isotp.get_rx_canid() < ECU_RX_IDS[i]) {
+            rx_ids[num_rx_ids++] = this->diag_isotp.get_rx_canid();
+            diag_added = true;
+        }
+        rx_ids[num_rx_ids++] = ECU_RX_IDS[i];
+    }
+    if (!diag_added) {
+        rx_ids[num_rx_ids++] = this->diag_isotp.get_rx_canid();
+    }
+    twai_filter_config_t filter_config = calc_acceptance_filter(rx_ids, num_rx_ids);
+    ESP_LOGI("EGS53_CAN", "Acceptance filter lets through %u CAN IDs for %u consumed frames", count_accepted_ids(&filter_config), num_rx_ids);
+
+    esp_err_t res;
+    res = twai_driver_install(&gen_config, &timing_config, &filter_config);
+    if (res != ESP_OK) {
+        ESP_LOGE("EGS53_CAN", "TWAI_DRIVER_INSTALL FAILED!: %s", esp_err_to_name(res));
+    }
+    res = twai_start();
+    if (res != ESP_OK) {
+        ESP_LOGE("EGS53_CAN", "TWAI_START FAILED!: %s", esp_err_to_name(res));
+    }
+    // CAN is OK!
+
+    // Set default values
+    this->set_target_gear(GearboxGear::SignalNotAvaliable);
+    this->set_actual_gear(GearboxGear::SignalNotAvaliable);
+    this->set_shifter_position(ShifterPosition::SignalNotAvaliable);
+    this->set_error_check_status(SystemStatusCheck::Waiting);
+    // Tasks are not started yet, so no need for tx_lock
+    this->tcm_a2.set_TCM_CALID_CVN_Actv(true);
+    this->sbw_rs.set_SBW_MsgTxmtId(SBW_RS_TCM_SBW_MsgTxmtId::EGS52); // Same message layout as EGS52
+    this->sbw_rs.set_TxSelVlvPosn(SBW_RS_TCM_TxSelVlvPosn::SNA);
+    this->sbw_rs.set_TSL_Posn_Rq(SBW_RS_TCM_TSL_Posn_Rq::IDLE);
+    this->tcm_disp_rq.set_Gr_Target_Disp_Rq(TCM_DISP_RQ_Gr_Target_Disp_Rq::BLANK);
+
+    // Set profile to N/A for now
+    this->set_drive_profile(GearboxProfile::Underscore);
+
+    // Tx schedule of EGS53. The torque interface and shift by wire frames go out every cycle,
+    // status and display frames at a fifth of the rate. Both are offset by half a cycle, so
+    // they don't pile onto the same tick as the every cycle frames.
+    // Frames due on the same tick are sent in this order
+    this->add_tx_frame(ENG_RQ1_TCM_CAN_ID, tx_time_ms, 0);
+    this->add_tx_frame(ENG_RQ2_TCM_CAN_ID, tx_time_ms, 0);
+    this->add_tx_frame(ENG_RQ3_TCM_CAN_ID, tx_time_ms, 0);
+    this->add_tx_frame(SBW_RS_TCM_CAN_ID, tx_time_ms, 0);
+    this->add_tx_frame(TCM_A2_CAN_ID, tx_time_ms, tx_time_ms/2);
+    this->add_tx_frame(TCM_A1_CAN_ID, tx_time_ms*5, tx_time_ms/2);
+    this->add_tx_frame(TCM_DISP_RQ_CAN_ID, tx_time_ms*5, tx_time_ms*5/2);
+    // Set no message
+    this->set_display_msg(GearboxMessage::None);
+
+// Set permanent configuration frame
+#ifdef FOUR_MATIC
+    this->eng_rq2.set_VehDrvStyle(ENG_RQ2_TCM_VehDrvStyle::ALL);
+#else
+    this->eng_rq2.set_VehDrvStyle(ENG_RQ2_TCM_VehDrvStyle::REAR);
+#endif
+    this->eng_rq2.set_TxStyle(ENG_RQ2_TCM_TxStyle::SAT); // Not CVT gearbox
+    this->eng_rq2.set_TxMechStyle(ENG_RQ2_TCM_TxMechStyle::SMALL); // Small 722.6 for now! (TODO Handle 580)
+    this->eng_rq2.set_TxShiftStyle(ENG_RQ2_TCM_TxShiftStyle::SBW);
+    this->can_init_ok = true;
+}
+
+void Egs53Can::add_tx_frame(uint32_t can_id, uint16_t period_ms, uint16_t offset_ms) {
+    uint8_t idx = this->tx_schedule.get_num_frames();
+    if (!this->tx_schedule.add_frame(can_id, period_ms, offset_ms)) {
+        ESP_LOGE("EGS53_CAN", "Could not add 0x%03X to the Tx schedule!", can_id);
+        return;
+    }
+    this->tx_protection[idx] = frame_protection_lookup(can_id);
+}
+
+bool Egs53Can::begin_tasks() {
+    if (!this->can_init_ok) { // Cannot init tasks if CAN is dead!
+        return false;
+    }
+    // Drains the driver's Rx queue into the ring the Rx task decodes from
+    if (!this->rx_ring.start("EGS53_CAN_DRAIN", "EGS53_CAN")) {
+        return false;
+    }
+    // Prevent starting again
+    if (this->rx_task == nullptr) {
+        ESP_LOGI("EGS53_CAN", "Starting CAN Rx task");
+        if (xTaskCreate(this->start_rx_task_loop, "EGS53_CAN_RX", 8192, this, 5, this->rx_task) != pdPASS) {
+            ESP_LOGE("EGS53_CAN", "CAN Rx task creation failed!");
+            return false;
+        }
+    }
+    if (this->tx_task == nullptr) {
+        ESP_LOGI("EGS53_CAN", "Starting CAN Tx task");
+        if (xTaskCreate(this->start_tx_task_loop, "EGS53_CAN_TX", 8192, this, 5, this->tx_task) != pdPASS) {
+            ESP_LOGE("EGS53_CAN", "CAN Tx task creation failed!");
+            return false;
+        }
+    }
+    if (!this->bus_monitor.start("EGS53_CAN_MON", "EGS53_CAN")) {
+        return false;
+    }
+    return true; // Ready!
+}
+
+Egs53Can::~Egs53Can()
+{
+    if (this->rx_task != nullptr) {
+        vTaskDelete(this->rx_task);
+    }
+    if (this->tx_task != nullptr) {
+        vTaskDelete(this->tx_task);
+    }
+    this->bus_monitor.stop();
+    this->rx_ring.stop();
+    // Delete CAN
+    if (this->can_init_ok) {
+        twai_stop();
+        twai_driver_uninstall();
+    }
+}
+
+WheelData Egs53Can::decode_wheel(uint8_t dir, uint16_t double_rpm) {
+    WheelDirection d = WheelDirection::SignalNotAvaliable;
+    switch((WHL_STAT2_WhlDir_RR_Stat)dir) {
+        case WHL_STAT2_WhlDir_RR_Stat::FORWARD:
+            d = WheelDirection::Forward;
+            break;
+        case WHL_STAT2_WhlDir_RR_Stat::BACKWARD:
+            d = WheelDirection::Reverse;
+            break;
+        case WHL_STAT2_WhlDir_RR_Stat::VOID:
+            d = WheelDirection::Stationary;
+            break;
+        case WHL_STAT2_WhlDir_RR_Stat::SNA:
+        default:
+            break;
+    }
+    // WhlRPM_XX is already 0.5 RPM per bit
+    return WheelData {
+        .double_rpm = double_rpm,
+        .current_dir = d
+    };
+}
+
+ShifterPosition Egs53Can::decode_shifter_position(const SBW_RS_ISM* sbw) {
+    switch (sbw->get_TSL_Posn_ISM()) {
+        case SBW_RS_ISM_TSL_Posn_ISM::D:
+            return ShifterPosition::D;
+        case SBW_RS_ISM_TSL_Posn_ISM::N:
+            return ShifterPosition::N;
+        case SBW_RS_ISM_TSL_Posn_ISM::R:
+            return ShifterPosition::R;
+        case SBW_RS_ISM_TSL_Posn_ISM::P:
+            return ShifterPosition::P;
+        case SBW_RS_ISM_TSL_Posn_ISM::PLUS:
+            return ShifterPosition::PLUS;
+        case SBW_RS_ISM_TSL_Posn_ISM::MINUS:
+            return ShifterPosition::MINUS;
+        case SBW_RS_ISM_TSL_Posn_ISM::N_ZW_D:
+            return ShifterPosition::N_D;
+        case SBW_RS_ISM_TSL_Posn_ISM::R_ZW_N:
+            return ShifterPosition::R_N;
+        case SBW_RS_ISM_TSL_Posn_ISM::P_ZW_R:
+            return ShifterPosition::P_R;
+        case SBW_RS_ISM_TSL_Posn_ISM::SNA:
+        default:
+            return ShifterPosition::SignalNotAvaliable;
+    }
+}
+
+WheelData Egs53Can::get_front_right_wheel(uint64_t now, uint64_t expire_time_ms) {
+    WHL_STAT2 whl;
+    if (this->ecm_ecu.get_WHL_STAT2(now, expire_time_ms*1000, &whl)) {
+        return decode_wheel((uint8_t)whl.get_WhlDir_FR_Stat(), whl.get_WhlRPM_FR());
+    } else {
+        return WheelData {
+            .double_rpm = 0,
+            .current_dir = WheelDirection::SignalNotAvaliable
+        };
+    }
+}
+
+WheelData Egs53Can::get_front_left_wheel(uint64_t now, uint64_t expire_time_ms) {
+    WHL_STAT2 whl;
+    if (this->ecm_ecu.get_WHL_STAT2(now, expire_time_ms*1000, &whl)) {
+        return decode_wheel((uint8_t)whl.get_WhlDir_FL_Stat(), whl.get_WhlRPM_FL());
+    } else {
+        return WheelData {
+            .double_rpm = 0,
+            .current_dir = WheelDirection::SignalNotAvaliable
+        };
+    }
+}
+
+WheelData Egs53Can::get_rear_right_wheel(uint64_t now, uint64_t expire_time_ms) {
+    WHL_STAT2 whl;
+    if (this->ecm_ecu.get_WHL_STAT2(now, expire_time_ms*1000, &whl)) {
+        return decode_wheel((uint8_t)whl.get_WhlDir_RR_Stat(), whl.get_WhlRPM_RR());
+    } else {
+        return WheelData {
+            .double_rpm = 0,
+            .current_dir = WheelDirection::SignalNotAvaliable
+        };
+    }
+}
+
+WheelData Egs53Can::get_rear_left_wheel(uint64_t now, uint64_t expire_time_ms) {
+    WHL_STAT2 whl;
+    if (this->ecm_ecu.get_WHL_STAT2(now, expire_time_ms*1000, &whl)) {
+        return decode_wheel((uint8_t)whl.get_WhlDir_RL_Stat(), whl.get_WhlRPM_RL());
+    } else {
+        return WheelData {
+            .double_rpm = 0,
+            .current_dir = WheelDirection::SignalNotAvaliable
+        };
+    }
+}
+
+ShifterPosition Egs53Can::get_shifter_position_ewm(uint64_t now, uint64_t expire_time_ms) {
+    SBW_RS_ISM sbw;
+    if (this->tslm_ecu.get_SBW_RS_ISM(now, 1000 * expire_time_ms, &sbw)) {
+        return decode_shifter_position(&sbw);
+    } else {
+        return ShifterPosition::SignalNotAvaliable;
+    }
+}
+
+EngineType Egs53Can::get_engine_type(uint64_t now, uint64_t expire_time_ms) { // TODO
+    return EngineType::Unknown;
+}
+
+bool Egs53Can::get_engine_is_limp(uint64_t now, uint64_t expire_time_ms) {
+    TX_RQ_ECM tx_rq;
+    if (this->ecm_ecu.get_TX_RQ_ECM(now, 1000*expire_time_ms, &tx_rq)) {
+        return tx_rq.get_ECM_LHOM();
+    } else {
+        return false;
+    }
+}
+
+bool Egs53Can::get_kickdown(uint64_t now, uint64_t expire_time_ms) {
+    ENG_RS3_PT rs3;
+    if (this->ecm_ecu.get_ENG_RS3_PT(now, 1000*expire_time_ms, &rs3)) {
+        return rs3.get_KickDnSw_Psd();
+    } else {
+        return false;
+    }
+}
+
+uint8_t Egs53Can::get_pedal_value(uint64_t now, uint64_t expire_time_ms) {
+    ENG_RS3_PT rs3;
+    if (this->ecm_ecu.get_ENG_RS3_PT(now, 1000*expire_time_ms, &rs3)) {
+        return rs3.get_AccelPdlPosn(); // 0.4% per bit
+    } else {
+        return 0xFF;
+    }
+}
+
+// Engine torque signals are 0.25Nm per bit, offset by -500Nm. Negative torque reads as 0
+static uint16_t decode_engine_torque(uint16_t raw) {
+    int torque = (int)raw/4 - 500;
+    return torque < 0 ? 0 : torque;
+}
+
+uint16_t Egs53Can::get_static_engine_torque(uint64_t now, uint64_t expire_time_ms) {
+    ENG_RS2_PT rs2;
+    if (this->ecm_ecu.get_ENG_RS2_PT(now, 1000*expire_time_ms, &rs2)) {
+        return decode_engine_torque(rs2.get_EngTrqStatic());
+    } else {
+        return 0;
+    }
+}
+
+uint16_t Egs53Can::get_maximum_engine_torque(uint64_t now, uint64_t expire_time_ms) {
+    ENG_RS2_PT rs2;
+    if (this->ecm_ecu.get_ENG_RS2_PT(now, 1000*expire_time_ms, &rs2)) {
+        return decode_engine_torque(rs2.get_EngTrqMaxETC());
+    } else {
+        return 0;
+    }
+}
+
+uint16_t Egs53Can::get_minimum_engine_torque(uint64_t now, uint64_t expire_time_ms) {
+    ENG_RS2_PT rs2;
+    if (this->ecm_ecu.get_ENG_RS2_PT(now, 1000*expire_time_ms, &rs2)) {
+        return decode_engine_torque(rs2.get_EngTrqMinTTC());
+    } else {
+        return 0;
+    }
+}
+
+PaddlePosition Egs53Can::get_paddle_position(uint64_t now, uint64_t expire_time_ms) {
+    SBW_RQ_SCCM sccm;
+    if (this->ecm_ecu.get_SBW_RQ_SCCM(now, expire_time_ms*1000, &sccm)) {
+        switch (sccm.get_StW_Sw_Stat3()) {
+            case SBW_RQ_SCCM_StW_Sw_Stat3::PLUS:
+                return PaddlePosition::Plus;
+            case SBW_RQ_SCCM_StW_Sw_Stat3::MINUS:
+                return PaddlePosition::Minus;
+            case SBW_RQ_SCCM_StW_Sw_Stat3::PLUS_MINUS:
+                return PaddlePosition::PlusAndMinus;
+            default:
+                return PaddlePosition::None;
+        }
+    } else {
+        return PaddlePosition::None;
+    }
+}
+
+uint16_t Egs53Can::get_engine_coolant_temp(uint64_t now, uint64_t expire_time_ms) {
+    ECM_A1 ecm_a1;
+    if (this->ecm_ecu.get_ECM_A1(now, expire_time_ms*1000, &ecm_a1)) {
+        return ecm_a1.get_EngCoolTemp()-40;
+    } else {
+        return UINT16_MAX;
+    }
+}
+
+uint16_t Egs53Can::get_engine_oil_temp(uint64_t now, uint64_t expire_time_ms) {
+    ECM_A1 ecm_a1;
+    if (this->ecm_ecu.get_ECM_A1(now, expire_time_ms*1000, &ecm_a1)) {
+        return ecm_a1.get_EngOilTemp()-40;
+    } else {
+        return UINT16_MAX;
+    }
+}
+
+uint16_t Egs53Can::get_engine_rpm(uint64_t now, uint64_t expire_time_ms) {
+    ENG_RS3_PT rs3;
+    if (this->ecm_ecu.get_ENG_RS3_PT(now, 1000*expire_time_ms, &rs3)) {
+        return rs3.get_EngRPM();
+    } else {
+        return UINT16_MAX;
+    }
+}
+
+bool Egs53Can::get_is_starting(uint64_t now, uint64_t expire_time_ms) {
+    ENG_RS3_PT rs3;
+    if (this->ecm_ecu.get_ENG_RS3_PT(now, 1000*expire_time_ms, &rs3)) {
+        return rs3.get_EngRun_Stat() == ENG_RS3_PT_EngRun_Stat::START;
+    } else {
+        return false;
+    }
+}
+
+bool Egs53Can::get_profile_btn_press(uint64_t now, uint64_t expire_time_ms) {
+    SBW_RS_ISM sbw;
+    if (this->tslm_ecu.get_SBW_RS_ISM(now, 1000*expire_time_ms, &sbw)) {
+        return sbw.get_TxDrvProgSw_Psd_V3();
+    } else {
+        return false;
+    }
+}
+
+void Egs53Can::get_vehicle_snapshot(uint64_t now, const VehicleSnapshotExpiry* expiry, VehicleSnapshot* dest) {
+    WHL_STAT2 whl;
+    SBW_RS_ISM sbw;
+    ENG_RS3_PT rs3;
+    ECM_A1 ecm_a1;
+    dest->timestamp = now;
+    dest->valid = 0;
+    dest->rear_left_wheel = WheelData { .double_rpm = 0, .current_dir = WheelDirection::SignalNotAvaliable };
+    dest->rear_right_wheel = WheelData { .double_rpm = 0, .current_dir = WheelDirection::SignalNotAvaliable };
+    dest->engine_rpm = 0;
+    dest->shifter_position = ShifterPosition::SignalNotAvaliable;
+    dest->pedal = 0;
+    dest->engine_coolant_temp = 0;
+    // Both rear wheels come from the same WHL_STAT2 frame
+    if (this->ecm_ecu.get_WHL_STAT2(now, 1000*expiry->wheels_ms, &whl)) {
+        dest->rear_left_wheel = decode_wheel((uint8_t)whl.get_WhlDir_RL_Stat(), whl.get_WhlRPM_RL());
+        dest->rear_right_wheel = decode_wheel((uint8_t)whl.get_WhlDir_RR_Stat(), whl.get_WhlRPM_RR());
+        if (dest->rear_left_wheel.current_dir != WheelDirection::SignalNotAvaliable) {
+            dest->valid |= SNAPSHOT_REAR_LEFT_WHEEL;
+        }
+        if (dest->rear_right_wheel.current_dir != WheelDirection::SignalNotAvaliable) {
+            dest->valid |= SNAPSHOT_REAR_RIGHT_WHEEL;
+        }
+    }
+    if (this->tslm_ecu.get_SBW_RS_ISM(now, 1000*expiry->shifter_position_ms, &sbw)) {
+        dest->shifter_position = decode_shifter_position(&sbw);
+        if (dest->shifter_position != ShifterPosition::SignalNotAvaliable) {
+            dest->valid |= SNAPSHOT_SHIFTER_POSITION;
+        }
+    }
+    // Engine RPM and pedal both come from ENG_RS3_PT, but expire at different ages
+    if (this->ecm_ecu.get_ENG_RS3_PT(now, 1000*expiry->engine_rpm_ms, &rs3)) {
+        dest->engine_rpm = rs3.get_EngRPM();
+        dest->valid |= SNAPSHOT_ENGINE_RPM;
+    }
+    if (this->ecm_ecu.get_ENG_RS3_PT(now, 1000*expiry->pedal_ms, &rs3)) {
+        dest->pedal = rs3.get_AccelPdlPosn();
+        dest->valid |= SNAPSHOT_PEDAL;
+    }
+    if (this->ecm_ecu.get_ECM_A1(now, 1000*expiry->engine_coolant_temp_ms, &ecm_a1)) {
+        dest->engine_coolant_temp = (int16_t)ecm_a1.get_EngCoolTemp()-40;
+        dest->valid |= SNAPSHOT_ENGINE_COOLANT_TEMP;
+    }
+}
+
+CanRxStats Egs53Can::get_rx_stats() {
+    return this->rx_ring.get_stats();
+}
+
+uint8_t Egs53Can::get_num_rx_frames() {
+    return ECU_RX_ID_COUNT;
+}
+
+uint8_t Egs53Can::get_num_tx_frames() {
+    return this->tx_schedule.get_num_frames();
+}
+
+bool Egs53Can::get_tx_frame_stats(uint8_t idx, uint32_t* can_id, TxFrameStats* dest) {
+    return this->tx_schedule.get_frame_stats(idx, can_id, dest);
+}
+
+bool Egs53Can::get_rx_frame_stats(uint8_t idx, uint32_t* can_id, FrameArrivalStats* dest) {
+    if (idx >= ECU_RX_ID_COUNT) {
+        return false;
+    }
+    const EcuDispatchEntry* e = ecu_dispatch_lookup(ECU_RX_IDS[idx]);
+    if (e == nullptr) {
+        return false;
+    }
+    *can_id = e->can_id;
+    switch (e->ecu) {
+        case EcuId::ECM:
+            return this->ecm_ecu.get_frame_stats_at(e->slot, dest);
+        case EcuId::TSLM:
+            return this->tslm_ecu.get_frame_stats_at(e->slot, dest);
+        default:
+            return false;
+    }
+}
+
+void Egs53Can::set_clutch_status(ClutchStatus status) {
+    portENTER_CRITICAL(&this->tx_lock);
+    switch(status) {
+        case ClutchStatus::Open:
+            this->tcm_a1.set_Clutch_Stat(TCM_A1_Clutch_Stat::DISENGG);
+            break;
+        case ClutchStatus::Slipping:
+            this->tcm_a1.set_Clutch_Stat(TCM_A1_Clutch_Stat::SLIP);
+            break;
+        case ClutchStatus::Closed:
+            this->tcm_a1.set_Clutch_Stat(TCM_A1_Clutch_Stat::ENGG);
+            break;
+        default:
+            break;
+    }
+    portEXIT_CRITICAL(&this->tx_lock);
+}
+
+void Egs53Can::set_shifter_position(ShifterPosition pos) {
+    portENTER_CRITICAL(&this->tx_lock);
+    switch (pos) {
+        case ShifterPosition::P:
+            this->tcm_a1.set_TSL_Posn_TCM(TCM_A1_TSL_Posn_TCM::P);
+            break;
+        case ShifterPosition::P_R:
+        case ShifterPosition::R:
+            this->tcm_a1.set_TSL_Posn_TCM(TCM_A1_TSL_Posn_TCM::R);
+            break;
+        case ShifterPosition::R_N:
+        case ShifterPosition::N:
+            this->tcm_a1.set_TSL_Posn_TCM(TCM_A1_TSL_Posn_TCM::N);
+            break;
+        case ShifterPosition::N_D:
+        case ShifterPosition::D:
+        case ShifterPosition::PLUS:
+        case ShifterPosition::MINUS:
+            this->tcm_a1.set_TSL_Posn_TCM(TCM_A1_TSL_Posn_TCM::D);
+            break;
+        case ShifterPosition::SignalNotAvaliable:
+        default:
+            this->tcm_a1.set_TSL_Posn_TCM(TCM_A1_TSL_Posn_TCM::SNA);
+            break;
+    }
+    portEXIT_CRITICAL(&this->tx_lock);
+}
+
+void Egs53Can::set_error_check_status(SystemStatusCheck ssc) {
+    portENTER_CRITICAL(&this->tx_lock);
+    switch(ssc) {
+        case SystemStatusCheck::Error:
+            this->tcm_a2.set_TCM_ErrChk_Stat(TCM_A2_TCM_ErrChk_Stat::ERROR);
+            break;
+        case SystemStatusCheck::Waiting:
+            this->tcm_a2.set_TCM_ErrChk_Stat(TCM_A2_TCM_ErrChk_Stat::WAIT);
+            break;
+        case SystemStatusCheck::OK:
+            this->tcm_a2.set_TCM_ErrChk_Stat(TCM_A2_TCM_ErrChk_Stat::OK);
+            break;
+        default:
+            break;
+    }
+    portEXIT_CRITICAL(&this->tx_lock);
+}
+
+void Egs53Can::set_drive_profile(GearboxProfile p) {
+    portENTER_CRITICAL(&this->tx_lock);
+    this->tcm_a1.set_TxDrvProgMan_Actv(p == GearboxProfile::Manual);
+    switch (p) {
+        case GearboxProfile::Agility:
+            this->tcm_disp_rq.set_TxDrvProg_Disp_Rq_TCM(TCM_DISP_RQ_TxDrvProg_Disp_Rq_TCM::A);
+            this->tcm_a1.set_VehDrvProg_TCM_V2(TCM_A1_VehDrvProg_TCM_V2::SPORT);
+            break;
+        case GearboxProfile::Comfort:
+            this->tcm_disp_rq.set_TxDrvProg_Disp_Rq_TCM(TCM_DISP_RQ_TxDrvProg_Disp_Rq_TCM::C);
+            this->tcm_a1.set_VehDrvProg_TCM_V2(TCM_A1_VehDrvProg_TCM_V2::COMFORT);
+            break;
+        case GearboxProfile::Winter:
+            this->tcm_disp_rq.set_TxDrvProg_Disp_Rq_TCM(TCM_DISP_RQ_TxDrvProg_Disp_Rq_TCM::W);
+            this->tcm_a1.set_VehDrvProg_TCM_V2(TCM_A1_VehDrvProg_TCM_V2::COMFORT);
+            break;
+        case GearboxProfile::Failure:
+            this->tcm_disp_rq.set_TxDrvProg_Disp_Rq_TCM(TCM_DISP_RQ_TxDrvProg_Disp_Rq_TCM::F);
+            this->tcm_a1.set_VehDrvProg_TCM_V2(TCM_A1_VehDrvProg_TCM_V2::SNA);
+            break;
+        case GearboxProfile::Standard:
+            this->tcm_disp_rq.set_TxDrvProg_Disp_Rq_TCM(TCM_DISP_RQ_TxDrvProg_Disp_Rq_TCM::S);
+            this->tcm_a1.set_VehDrvProg_TCM_V2(TCM_A1_VehDrvProg_TCM_V2::SPORT);
+            break;
+        case GearboxProfile::Manual:
+            this->tcm_disp_rq.set_TxDrvProg_Disp_Rq_TCM(TCM_DISP_RQ_TxDrvProg_Disp_Rq_TCM::M);
+            this->tcm_a1.set_VehDrvProg_TCM_V2(TCM_A1_VehDrvProg_TCM_V2::SPORT);
+            break;
+        case GearboxProfile::Underscore:
+            this->tcm_disp_rq.set_TxDrvProg_Disp_Rq_TCM(TCM_DISP_RQ_TxDrvProg_Disp_Rq_TCM::BLANK);
+            this->tcm_a1.set_VehDrvProg_TCM_V2(TCM_A1_VehDrvProg_TCM_V2::SNA);
+            break;
+        default:
+            break;
+    }
+    portEXIT_CRITICAL(&this->tx_lock);
+}
+
+void Egs53Can::set_display_msg(GearboxMessage msg) {
+    // Only the shift recommendation has a signal of its own on EGS53. The SBW_Msg_Disp_Rq_TCM
+    // messages are numbered rather than named, so the other messages are not shown yet
+    portENTER_CRITICAL(&this->tx_lock);
+    switch (msg) {
+        case GearboxMessage::Upshift:
+            this->tcm_disp_rq.set_TxShiftRcmmnd_Disp_Rq_TCM(TCM_DISP_RQ_TxShiftRcmmnd_Disp_Rq_TCM::UP);
+            break;
+        case GearboxMessage::Downshift:
+            this->tcm_disp_rq.set_TxShiftRcmmnd_Disp_Rq_TCM(TCM_DISP_RQ_TxShiftRcmmnd_Disp_Rq_TCM::DOWN);
+            break;
+        default:
+            this->tcm_disp_rq.set_TxShiftRcmmnd_Disp_Rq_TCM(TCM_DISP_RQ_TxShiftRcmmnd_Disp_Rq_TCM::IDLE);
+            break;
+    }
+    portEXIT_CRITICAL(&this->tx_lock);
+}
+
+bool Egs53Can::build_tx_frame(uint8_t idx, bool on_schedule, uint8_t* dest) {
+    // Copy the current CAN frame values, so the setters can keep
+    // changing them whilst the counter and CRC are worked out
+    bool found = true;
+    portENTER_CRITICAL(&this->tx_lock);
+    switch (this->tx_schedule.get_can_id(idx)) {
+        case TCM_A1_CAN_ID:
+            memcpy(dest, &this->tcm_a1.raw, 8);
+            break;
+        case TCM_A2_CAN_ID:
+            memcpy(dest, &this->tcm_a2.raw, 8);
+            break;
+        case ENG_RQ1_TCM_CAN_ID:
+            memcpy(dest, &this->eng_rq1.raw, 8);
+            break;
+        case ENG_RQ2_TCM_CAN_ID:
+            memcpy(dest, &this->eng_rq2.raw, 8);
+            break;
+        case ENG_RQ3_TCM_CAN_ID:
+            memcpy(dest, &this->eng_rq3.raw, 8);
+            break;
+        case SBW_RS_TCM_CAN_ID:
+            memcpy(dest, &this->sbw_rs.raw, 8);
+            break;
+        case TCM_DISP_RQ_CAN_ID:
+            memcpy(dest, &this->tcm_disp_rq.raw, 8);
+            break;
+        default:
+            found = false;
+            break;
+    }
+    portEXIT_CRITICAL(&this->tx_lock);
+    if (!found) {
+        return false;
+    }
+    // Message counter increases with every frame sent (On schedule or not), and the CRC covers it
+    const FrameProtection* p = this->tx_protection[idx];
+    if (p != nullptr) {
+        frame_protect(p, dest, this->tx_counters[idx]);
+        this->tx_counters[idx]++;
+    }
+    return true;
+}
+
+[[noreturn]]
+void Egs53Can::tx_task_loop() {
+    uint32_t diag_wait_us = UINT32_MAX;
+    if (!this->tx_schedule.start(xTaskGetCurrentTaskHandle())) {
+        ESP_LOGE("EGS53_CAN", "Could not start Tx schedule!");
+    }
+    while(true) {
+        this->tx_schedule.wait_for_tick(diag_wait_us);
+        this->tx_schedule.send_frames(Egs53Can::build_tx_frame_cb, this);
+        // Diagnostics fill the gaps between scheduled frames
+        this->diag_isotp.process_request(this->diag_server);
+        diag_wait_us = this->diag_isotp.send_frames(&this->tx_schedule);
+    }
+}
+
+[[noreturn]]
+void Egs53Can::rx_task_loop() {
+    CanRxFrame rx;
+    uint64_t now;
+    uint64_t tmp;
+    while(true) {
+        // Block until the drain task has put a frame in the ring. This puts the task
+        // to sleep when the bus is quiet, and wakes it up as soon as a frame lands
+        if (!this->rx_ring.pop(&rx, portMAX_DELAY)) {
+            continue;
+        }
+        // Frame age is from when it came out of the driver, not from when we got to it
+        now = rx.timestamp;
+                can_recorder.record_rx(rx.identifier, rx.data_length_code, rx.data, now);
+        if (rx.data_length_code != 0 && rx.flags == 0) {
+            // One table lookup tells us which ECU (and which of its slots) the frame belongs to
+            const EcuDispatchEntry* dest = ecu_dispatch_lookup(rx.identifier);
+            if (dest != nullptr) {
+                // A frame with a bad CRC is rejected, so the getters keep serving the last good one
+                const FrameProtection* p = frame_protection_lookup(rx.identifier);
+                bool crc_ok = p == nullptr || p->crc_byte == 0xFF || (rx.data_length_code > p->crc_byte && frame_check_crc(p, rx.data));
+                // Generated frames are stored in wire order, so the payload is copied as is
+                tmp = 0;
+                memcpy(&tmp, rx.data, rx.data_length_code > 8 ? 8 : rx.data_length_code);
+                // The generated import also checks the message counter
+                FrameCheckResult res = FrameCheckResult::Ok;
+                switch (dest->ecu) {
+                    case EcuId::ECM:
+                        if (crc_ok) {
+                            res = this->ecm_ecu.import_frame_at(dest->slot, tmp, now);
+                        } else {
+                            this->ecm_ecu.reject_frame_at(dest->slot);
+                        }
+                        break;
+                    case EcuId::TSLM:
+                        if (crc_ok) {
+                            res = this->tslm_ecu.import_frame_at(dest->slot, tmp, now);
+                        } else {
+                            this->tslm_ecu.reject_frame_at(dest->slot);
+                        }
+                        break;
+                    default: // Known frame, but from an ECU we don't store data for
+                        this->rx_ring.count_dropped();
+                        continue;
+                }
+                if (!crc_ok || res != FrameCheckResult::Ok) {
+                    this->rx_ring.count_rejected();
+                }
+            } else if (rx.identifier == this->diag_isotp.get_rx_canid()) {
+                this->diag_isotp.on_frame_received(rx.data, rx.data_length_code, now);
+                // Tx task sends flow control / handles the request
+                this->tx_schedule.wake();
+            } else {
+                this->rx_ring.count_dropped();
+            }
+        } else {
+            this->rx_ring.count_dropped();
+        }
+    }
+}
@@ -0,0 +1,280 @@
+#ifndef __EGS53_CAN_H_
+#define __EGS53_CAN_H_
+
+#include "can_hal.h"
+#include "can_tx_scheduler.h"
+#include "can_bus_monitor.h"
+#include "can_rx_ring.h"
+#include "iso_tp.h"
+
+#define EGS53_MODE
+
+// Block size and STmin we ask the tester to use when it sends us multi frame requests
+#define EGS53_DIAG_BS 8
+#define EGS53_DIAG_ST_MIN 0
+
+#include "ECM.h"
+#include "TCM.h"
+#include "TSLM.h"
+#include "EGS53_DISPATCH.h"
+#include "EGS53_PROTECTION.h"
+
+/**
+ * CAN layer of EGS53 (2008+ vehicles).
+ *
+ * Most frames on the EGS53 powertrain bus carry a message counter and a SAE J1850 CRC.
+ * These are filled in / checked through the tables generated into EGS53_PROTECTION.h,
+ * so protecting a frame costs one table lookup per payload byte.
+ *
+ * The setters the gearbox controller calls every tick are defined here, so that
+ * calls through EgsCanHal (See egs_can_hal.h) can be inlined into the controller.
+ *
+ * The Tx frames are updated by the setters (From several tasks) whilst the Tx task builds frames from them,
+ * so both only touch them whilst holding tx_lock
+ */
+class Egs53Can final: public AbstractCan {
+    public:
+        explicit Egs53Can(const char* name, uint8_t tx_time_ms);
+        bool begin_tasks() override;
+        ~Egs53Can();
+
+        /**
+         * Getters
+         */
+
+        // Get the front right wheel data
+        WheelData get_front_right_wheel(uint64_t now, uint64_t expire_time_ms) override;
+        // Get the front left wheel data
+        WheelData get_front_left_wheel(uint64_t now, uint64_t expire_time_ms) override;
+        // Get the rear right wheel data
+        WheelData get_rear_right_wheel(uint64_t now, uint64_t expire_time_ms) override;
+        // Get the rear left wheel data
+        WheelData get_rear_left_wheel(uint64_t now, uint64_t expire_time_ms) override;
+        // Gets shifter position from the ISM (Shift by wire)
+        ShifterPosition get_shifter_position_ewm(uint64_t now, uint64_t expire_time_ms) override;
+        // Gets engine type
+        EngineType get_engine_type(uint64_t now, uint64_t expire_time_ms) override;
+        // Returns true if engine is in limp mode
+        bool get_engine_is_limp(uint64_t now, uint64_t expire_time_ms) override;
+        // Returns true if pedal is kickdown
+        bool get_kickdown(uint64_t now, uint64_t expire_time_ms) override;
+        // Returns the pedal percentage. Range 0-250
+        uint8_t get_pedal_value(uint64_t now, uint64_t expire_time_ms) override;
+        // Gets the current 'static' torque produced by the engine
+        uint16_t get_static_engine_torque(uint64_t now, uint64_t expire_time_ms) override;
+        // Gets the maximum engine torque allowed at this moment by the engine map
+        uint16_t get_maximum_engine_torque(uint64_t now, uint64_t expire_time_ms) override;
+        // Gets the minimum engine torque allowed at this moment by the engine map
+        uint16_t get_minimum_engine_torque(uint64_t now, uint64_t expire_time_ms) override;
+        // Gets the flappy paddle position
+        PaddlePosition get_paddle_position(uint64_t now, uint64_t expire_time_ms) override;
+        // Gets engine coolant temperature
+        uint16_t get_engine_coolant_temp(uint64_t now, uint64_t expire_time_ms) override;
+        // Gets engine oil temperature
+        uint16_t get_engine_oil_temp(uint64_t now, uint64_t expire_time_ms) override;
+        // Gets engine RPM
+        uint16_t get_engine_rpm(uint64_t now, uint64_t expire_time_ms) override;
+        // Returns true if engine is cranking
+        bool get_is_starting(uint64_t now, uint64_t expire_time_ms) override;
+        // Returns true if the drive program button on the ISM is pressed
+        bool get_profile_btn_press(uint64_t now, uint64_t expire_time_ms) override;
+        // Fills 'dest' with everything the gearbox controller needs for one tick
+        void get_vehicle_snapshot(uint64_t now, const VehicleSnapshotExpiry* expiry, VehicleSnapshot* dest) override;
+        // Gets statistics about received CAN frames
+        CanRxStats get_rx_stats() override;
+        // Gets the number of CAN frames the HAL reads from other ECUs
+        uint8_t get_num_rx_frames() override;
+        // Gets the CAN ID and arrival statistics of read frame 'idx' (0 to get_num_rx_frames()-1)
+        bool get_rx_frame_stats(uint8_t idx, uint32_t* can_id, FrameArrivalStats* dest) override;
+        // Gets the number of CAN frames the HAL sends
+        uint8_t get_num_tx_frames() override;
+        // Gets the CAN ID and Tx schedule statistics of sent frame 'idx' (0 to get_num_tx_frames()-1)
+        bool get_tx_frame_stats(uint8_t idx, uint32_t* can_id, TxFrameStats* dest) override;
+        // Gets the error state of the CAN controller, and bus off recovery statistics
+        CanBusStats get_bus_stats() override {
+            return this->bus_monitor.get_stats();
+        }
+
+        /**
+         * Setters
+         */
+
+        // Sets the server that handles requests received on the diagnostic CAN IDs
+        void set_diag_server(DiagServer* server) override {
+            this->diag_server = server;
+        }
+        // Set the gearbox clutch position on CAN
+        void set_clutch_status(ClutchStatus status) override;
+        // Set the actual gear of the gearbox
+        void set_actual_gear(GearboxGear actual) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            uint64_t prev = this->eng_rq2.raw;
+            this->eng_rq2.set_Gr((ENG_RQ2_TCM_Gr)gear_to_tcm_code(actual));
+            bool changed = this->eng_rq2.raw != prev;
+            portEXIT_CRITICAL(&this->tx_lock);
+            if (changed) {
+                this->tx_schedule.request_urgent(ENG_RQ2_TCM_CAN_ID);
+            }
+        }
+        // Set the target gear of the gearbox
+        void set_target_gear(GearboxGear target) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            uint64_t prev = this->eng_rq2.raw;
+            this->eng_rq2.set_Gr_Target((ENG_RQ2_TCM_Gr_Target)gear_to_tcm_code(target));
+            bool changed = this->eng_rq2.raw != prev;
+            portEXIT_CRITICAL(&this->tx_lock);
+            if (changed) {
+                this->tx_schedule.request_urgent(ENG_RQ2_TCM_CAN_ID);
+            }
+        }
+        // Sets the status bit indicating the car is safe to start
+        void set_safe_start(bool can_start) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            this->sbw_rs.set_StartLkSw(can_start);
+            portEXIT_CRITICAL(&this->tx_lock);
+        }
+        // Sets the gerabox ATF temperature. Offset by +50C
+        void set_gearbox_temperature(uint16_t temp) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            this->tcm_a1.set_TxOilTemp((temp+50) & 0xFF);
+            portEXIT_CRITICAL(&this->tx_lock);
+        }
+        // Sets the RPM of the input shaft of the gearbox on CAN
+        void set_input_shaft_speed(uint16_t rpm) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            this->tcm_a2.set_TxTurbineRPM(rpm);
+            portEXIT_CRITICAL(&this->tx_lock);
+        }
+        // Sets 4WD activated toggle bit
+        void set_is_all_wheel_drive(bool is_4wd) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            this->eng_rq2.set_VehDrvStyle(is_4wd ? ENG_RQ2_TCM_VehDrvStyle::ALL : ENG_RQ2_TCM_VehDrvStyle::REAR);
+            portEXIT_CRITICAL(&this->tx_lock);
+        }
+        // Sets wheel torque
+        void set_wheel_torque(uint16_t t) override {}
+        // Sets shifter position message
+        void set_shifter_position(ShifterPosition pos) override;
+        // Sets gearbox is OK
+        void set_gearbox_ok(bool is_ok) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            this->tcm_a1.set_BasShftProg_Ok(is_ok); // Gearbox program OK
+            this->tcm_a1.set_TCM_LHOM(!is_ok); // Emergency mode activated
+            portEXIT_CRITICAL(&this->tx_lock);
+        }
+        // Sets torque request toggle
+        void set_torque_request(TorqueRequest request) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            uint64_t prev = this->eng_rq1.raw;
+            this->eng_rq1.set_EngTrqMin_Rq_TCM(request == TorqueRequest::Minimum);
+            this->eng_rq1.set_EngTrqMax_Rq_TCM(request == TorqueRequest::Maximum);
+            bool changed = this->eng_rq1.raw != prev;
+            portEXIT_CRITICAL(&this->tx_lock);
+            if (changed) {
+                this->tx_schedule.request_urgent(ENG_RQ1_TCM_CAN_ID);
+            }
+        }
+        // Sets requested engine torque
+        void set_requested_torque(uint16_t torque_nm) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            uint64_t prev = this->eng_rq1.raw;
+            // 0.25Nm per bit, offset by -500Nm
+            this->eng_rq1.set_EngTrq_Rq_TCM((torque_nm+500)*4);
+            bool changed = this->eng_rq1.raw != prev;
+            portEXIT_CRITICAL(&this->tx_lock);
+            if (changed) {
+                this->tx_schedule.request_urgent(ENG_RQ1_TCM_CAN_ID);
+            }
+        }
+        // Sets the status of system error check
+        void set_error_check_status(SystemStatusCheck ssc) override;
+        // Sets torque loss of torque converter
+        void set_turbine_torque_loss(uint16_t loss_nm) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            // 0.25Nm per bit, so anything over 63.75Nm is capped
+            this->eng_rq2.set_TxTrqLoss(loss_nm >= 0x40 ? 0xFF : loss_nm*4);
+            portEXIT_CRITICAL(&this->tx_lock);
+        }
+        // Sets display profile
+        void set_display_gear(char g) override {
+            portENTER_CRITICAL(&this->tx_lock);
+            // Raw values of the display request are the ASCII characters shown
+            this->tcm_disp_rq.set_TxDrvPosn_Disp_Rq_TCM((TCM_DISP_RQ_TxDrvPosn_Disp_Rq_TCM)g);
+            portEXIT_CRITICAL(&this->tx_lock);
+        }
+        // Sets drive profile
+        void set_drive_profile(GearboxProfile p) override;
+        // Sets display message
+        void set_display_msg(GearboxMessage msg) override;
+    protected:
+        [[noreturn]]
+        void tx_task_loop() override;
+        [[noreturn]]
+        void rx_task_loop() override;
+    private:
+        // CAN Frames to Tx
+        TCM_A1 tcm_a1 = {0};
+        TCM_A2 tcm_a2 = {0};
+        ENG_RQ1_TCM eng_rq1 = {0};
+        ENG_RQ2_TCM eng_rq2 = {0};
+        ENG_RQ3_TCM eng_rq3 = {0};
+        SBW_RS_TCM sbw_rs = {0};
+        TCM_DISP_RQ tcm_disp_rq = {0};
+        // Held whilst reading or writing the Tx frames above
+        portMUX_TYPE tx_lock;
+        // Tx deadlines of the frames above
+        CanTxScheduler tx_schedule;
+        // Error state of the CAN controller, and bus off recovery
+        CanBusMonitor bus_monitor;
+        // Frames received by the driver, waiting for the Rx task to decode them
+        CanRxRing rx_ring;
+        // Protection of each frame in the Tx schedule (nullptr if the frame has none), looked up once
+        // when the schedule is built, and the message counter each one is on (Only written by the Tx task)
+        const FrameProtection* tx_protection[MAX_TX_FRAMES] = {};
+        uint8_t tx_counters[MAX_TX_FRAMES] = {};
+        // Adds a frame to the Tx schedule, along with its protection
+        void add_tx_frame(uint32_t can_id, uint16_t period_ms, uint16_t offset_ms);
+        // KWP2000 diagnostics (ISO-TP on 0x7E1 / 0x7E9)
+        IsoTp diag_isotp;
+        DiagServer* diag_server = nullptr;
+        // Builds the Tx payload of frame 'idx' of the schedule into 'dest', message counter and CRC included
+        bool build_tx_frame(uint8_t idx, bool on_schedule, uint8_t* dest);
+        static bool build_tx_frame_cb(void* _this, uint8_t idx, bool on_schedule, uint8_t* dest) {
+            return static_cast<Egs53Can*>(_this)->build_tx_frame(idx, on_schedule, dest);
+        }
+        // ECU Data to Rx to
+        ECU_ECM ecm_ecu;
+        ECU_TSLM tslm_ecu;
+        bool can_init_ok = false;
+        // Decoders shared by the getters and get_vehicle_snapshot()
+        // 'dir' is the raw value of any WhlDir_XX_Stat signal of WHL_STAT2 (They share their values)
+        static WheelData decode_wheel(uint8_t dir, uint16_t double_rpm);
+        static ShifterPosition decode_shifter_position(const SBW_RS_ISM* sbw);
+        // Gear code used by the Gr and Gr_Target signals of ENG_RQ2_TCM
+        static uint8_t gear_to_tcm_code(GearboxGear g) {
+            switch (g) {
+                case GearboxGear::First:
+                case GearboxGear::Second:
+                case GearboxGear::Third:
+                case GearboxGear::Fourth:
+                case GearboxGear::Fifth:
+                case GearboxGear::Sixth:
+                case GearboxGear::Seventh:
+                    return (uint8_t)g; // D1 - D7
+                case GearboxGear::Park:
+                    return (uint8_t)ENG_RQ2_TCM_Gr::P;
+                case GearboxGear::Neutral:
+                    return (uint8_t)ENG_RQ2_TCM_Gr::N;
+                case GearboxGear::Reverse_First:
+                    return (uint8_t)ENG_RQ2_TCM_Gr::R;
+                case GearboxGear::Reverse_Second:
+                    return (uint8_t)ENG_RQ2_TCM_Gr::R2;
+                case GearboxGear::SignalNotAvaliable:
+                default:
+                    return (uint8_t)ENG_RQ2_TCM_Gr::SNA;
+            }
+        }
+};
+
+
+#endif // __EGS53_CAN_H_
@@ -0,0 +1,122 @@
+#include "can_filter.h"
+
+// Bits of the acceptance mask we never filter on (RTR bit and data bytes)
+#define SINGLE_FILTER_DONT_CARE 0x001FFFFF
+#define DUAL_FILTER_DONT_CARE 0x001F001F
+
+// Exhaustive search over every split of the IDs is 2^(count-1), cap it
+#define MAX_EXHAUSTIVE_IDS 16
+
+// A filter over 11 bit CAN IDs. Set bits in 'mask' are don't care bits
+typedef struct {
+    uint16_t code;
+    uint16_t mask;
+} IdFilter;
+
+static inline uint16_t popcount_11(uint16_t x) {
+    return __builtin_popcount(x & 0x7FF);
+}
+
+// Smallest filter that accepts every ID in 'ids' which has its bit set in 'sel'
+static IdFilter make_id_filter(const uint32_t* ids, uint8_t count, uint32_t sel) {
+    uint16_t all_and = 0x7FF;
+    uint16_t all_or = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        if (sel & (1UL << i)) {
+            all_and &= ids[i];
+            all_or |= ids[i];
+        }
+    }
+    return IdFilter {
+        .code = all_and,
+        .mask = (uint16_t)(all_or ^ all_and)
+    };
+}
+
+// Smallest filter that accepts every ID in ids[start..end)
+static IdFilter make_range_filter(const uint32_t* ids, uint8_t start, uint8_t end) {
+    uint16_t all_and = 0x7FF;
+    uint16_t all_or = 0;
+    for (uint8_t i = start; i < end; i++) {
+        all_and &= ids[i];
+        all_or |= ids[i];
+    }
+    return IdFilter {
+        .code = all_and,
+        .mask = (uint16_t)(all_or ^ all_and)
+    };
+}
+
+// Number of IDs accepted by either of the 2 filters
+static uint16_t dual_filter_cost(IdFilter a, IdFilter b) {
+    uint16_t total = (1 << popcount_11(a.mask)) + (1 << popcount_11(b.mask));
+    // Remove the IDs that both filters accept, so they are not counted twice
+    uint16_t must_match = ~(a.mask | b.mask) & 0x7FF;
+    if ((a.code & must_match) == (b.code & must_match)) {
+        total -= (1 << popcount_11(a.mask & b.mask));
+    }
+    return total;
+}
+
+twai_filter_config_t calc_acceptance_filter(const uint32_t* ids, uint8_t count) {
+    if (count == 0) {
+        return TWAI_FILTER_CONFIG_ACCEPT_ALL();
+    }
+    IdFilter single = make_range_filter(ids, 0, count);
+    uint16_t best_cost = 1 << popcount_11(single.mask);
+    twai_filter_config_t best = {
+        .acceptance_code = (uint32_t)single.code << 21,
+        .acceptance_mask = ((uint32_t)single.mask << 21) | SINGLE_FILTER_DONT_CARE,
+        .single_filter = true
+    };
+    if (count < 2) {
+        return best;
+    }
+    IdFilter a;
+    IdFilter b;
+    if (count <= MAX_EXHAUSTIVE_IDS) {
+        uint32_t all = (1UL << count) - 1;
+        // ID 0 always goes to filter 1, so each split is only tried once
+        for (uint32_t sel = 1; sel < (1UL << (count-1)); sel++) {
+            a = make_id_filter(ids, count, (sel << 1) ^ all);
+            b = make_id_filter(ids, count, sel << 1);
+            uint16_t cost = dual_filter_cost(a, b);
+            if (cost < best_cost) {
+                best_cost = cost;
+                best.acceptance_code = ((uint32_t)a.code << 21) | ((uint32_t)b.code << 5);
+                best.acceptance_mask = ((uint32_t)a.mask << 21) | ((uint32_t)b.mask << 5) | DUAL_FILTER_DONT_CARE;
+                best.single_filter = false;
+            }
+        }
+    } else {
+        // Too many IDs to try every split. IDs are sorted, so just try splitting the list in 2
+        for (uint8_t split = 1; split < count; split++) {
+            a = make_range_filter(ids, 0, split);
+            b = make_range_filter(ids, split, count);
+            uint16_t cost = dual_filter_cost(a, b);
+            if (cost < best_cost) {
+                best_cost = cost;
+                best.acceptance_code = ((uint32_t)a.code << 21) | ((uint32_t)b.code << 5);
+                best.acceptance_mask = ((uint32_t)a.mask << 21) | ((uint32_t)b.mask << 5) | DUAL_FILTER_DONT_CARE;
+                best.single_filter = false;
+            }
+        }
+    }
+    return best;
+}
+
+uint16_t count_accepted_ids(const twai_filter_config_t* filter) {
+    if (filter->single_filter) {
+        return 1 << popcount_11(filter->acceptance_mask >> 21);
+    } else {
+        IdFilter a = {
+            .code = (uint16_t)((filter->acceptance_code >> 21) & 0x7FF),
+            .mask = (uint16_t)((filter->acceptance_mask >> 21) & 0x7FF)
+        };
+        IdFilter b = {
+            .code = (uint16_t)((filter->acceptance_code >> 5) & 0x7FF),
+            .mask = (uint16_t)((filter->acceptance_mask >> 5) & 0x7FF)
+        };
+        return dual_filter_cost(a, b);
+    }
+}
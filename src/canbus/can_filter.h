@@ -0,0 +1,24 @@
+#ifndef __CAN_FILTER_H_
+#define __CAN_FILTER_H_
+
+#include <stdint.h>
+#include "driver/twai.h"
+
+/**
+ * Calculates the TWAI acceptance filter that lets through the fewest CAN IDs,
+ * whilst still accepting every standard (11 bit) CAN ID in 'ids'.
+ *
+ * Both single filter mode and dual filter mode (Every split of 'ids' across the 2 filters)
+ * are considered. The filter is never exact for more than 2 IDs, so the Rx path must still filter
+ * frames in software!
+ *
+ * If 'ids' is empty, an accept all filter is returned
+ */
+twai_filter_config_t calc_acceptance_filter(const uint32_t* ids, uint8_t count);
+
+/**
+ * Returns the number of standard CAN IDs that would be let through by 'filter'
+ */
+uint16_t count_accepted_ids(const twai_filter_config_t* filter);
+
+#endif // __CAN_FILTER_H_
@@ -1,3 +1,4 @@
 #include "can_hal.h"
+#include "egs_can_hal.h"
 
-AbstractCan* egs_can_hal = nullptr;
\ No newline at end of file
+EgsCanHal* egs_can_hal = nullptr;
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <esp_log.h>
+#include "ecu_frame_stats.h"
 
 enum class WheelDirection {
     Forward, // Wheel going forwards
@@ -30,6 +31,105 @@ struct DiagIsoTpInfo {
     uint8_t st_min;
 };
 
+/**
+ * Handles diagnostic requests received over ISO-TP
+ */
+class DiagServer {
+    public:
+        /**
+         * Processes a complete request of 'len' bytes. The response is written to 'resp'
+         * (Up to 'max_len' bytes), and its length is returned. Returning 0 sends no response
+         */
+        virtual uint16_t process_request(const uint8_t* req, uint16_t len, uint8_t* resp, uint16_t max_len) = 0;
+
+        /**
+         * Called whenever there is no request to process and no response being sent.
+         * Writes a response that is sent without a request (Periodic transmission) to 'resp',
+         * and returns its length. Returning 0 sends nothing
+         */
+        virtual uint16_t get_periodic_response(uint64_t now, uint8_t* resp, uint16_t max_len) {
+            return 0;
+        }
+};
+
+struct CanRxStats {
+    // Frames received from the CAN controller
+    uint32_t rx_count;
+    // Frames that got through the acceptance filter, but are not read by the TCM
+    uint32_t dropped_count;
+    // Frames read by the TCM that failed validation (Message counter, toggle, parity or CRC), so were thrown away
+    uint32_t rejected_count;
+    // Frames lost as the Rx queue of the CAN driver was full
+    uint32_t rx_queue_overflow_count;
+    // Frames lost as the Rx ring was full (Not counted in rx_count)
+    uint32_t ring_overflow_count;
+    // Most frames that have ever been waiting in the Rx ring, out of ring_size
+    uint32_t ring_high_water;
+    uint32_t ring_size;
+    // How long the last frame waited in the Rx ring before it was decoded (us)
+    uint32_t last_drain_latency_us;
+    // Longest any frame has waited in the Rx ring (us)
+    uint32_t max_drain_latency_us;
+};
+
+struct TxFrameStats {
+    // Frames sent on schedule
+    uint32_t tx_count;
+    // Frames sent out of cycle because their values changed
+    uint32_t urgent_count;
+    // Deadlines the frame was sent too late for (Or skipped entirely)
+    uint32_t missed_count;
+    // Frames the CAN driver failed to queue
+    uint32_t failed_count;
+    // How late the last frame was sent after its deadline (us)
+    uint32_t last_jitter;
+    // Worst lateness seen (us)
+    uint32_t max_jitter;
+};
+
+// Number of buckets in CanBusStats::recovery_histogram
+#define CAN_RECOVERY_HISTOGRAM_BUCKETS 8
+
+enum class CanBusState {
+    // Error counters below 128, taking part in the bus normally
+    ErrorActive,
+    // An error counter is 128 or more, so the controller may only flag errors passively
+    ErrorPassive,
+    // Transmit error counter went past 255, the controller has left the bus
+    BusOff,
+    // Waiting out the bus off recovery sequence (128 occurrences of 11 recessive bits)
+    Recovering,
+    // Driver is not running
+    Stopped
+};
+
+struct CanBusStats {
+    CanBusState state;
+    // Transmit and receive error counters, as last sampled
+    uint32_t tx_error_counter;
+    uint32_t rx_error_counter;
+    // Times the controller went bus off
+    uint32_t bus_off_count;
+    // Bus offs that were recovered from (The driver was running again)
+    uint32_t recovery_count;
+    // Times recovery had to be initiated again as the controller did not come back in time
+    uint32_t recovery_retry_count;
+    // Time from going bus off to the driver running again (us)
+    uint32_t last_recovery_us;
+    uint32_t max_recovery_us;
+    // Recoveries by duration. Bucket 'n' counts recoveries up to (1 << n) ms, the last bucket everything longer
+    uint32_t recovery_histogram[CAN_RECOVERY_HISTOGRAM_BUCKETS];
+    // Times an error counter went above the warning limit (96), and times the controller went error passive
+    uint32_t error_warning_count;
+    uint32_t error_passive_count;
+    // Counters kept by the CAN driver
+    uint32_t bus_error_count;
+    uint32_t tx_failed_count;
+    uint32_t rx_missed_count;
+    uint32_t rx_overrun_count;
+    uint32_t arb_lost_count;
+};
+
 enum class SystemStatusCheck {
     // Waiting for check to complete
     Waiting,
@@ -130,6 +230,52 @@ enum class GearboxMessage {
     VisitWorkshop
 };
 
+// Validity bits of VehicleSnapshot fields
+enum VehicleSnapshotField : uint8_t {
+    SNAPSHOT_REAR_LEFT_WHEEL = 1 << 0,
+    SNAPSHOT_REAR_RIGHT_WHEEL = 1 << 1,
+    SNAPSHOT_ENGINE_RPM = 1 << 2,
+    SNAPSHOT_SHIFTER_POSITION = 1 << 3,
+    SNAPSHOT_PEDAL = 1 << 4,
+    SNAPSHOT_ENGINE_COOLANT_TEMP = 1 << 5,
+};
+
+/**
+ * Vehicle state read off the CANBUS, captured at once for one controller tick.
+ * A field may only be used if its bit is set in 'valid'
+ */
+struct VehicleSnapshot {
+    // Time the snapshot was taken at
+    uint64_t timestamp;
+    // Bitmask of VehicleSnapshotField
+    uint8_t valid;
+    WheelData rear_left_wheel;
+    WheelData rear_right_wheel;
+    uint16_t engine_rpm;
+    ShifterPosition shifter_position;
+    // Accelerator pedal position (Raw value as sent by the engine ECU)
+    uint8_t pedal;
+    // Engine coolant temperature in C
+    int16_t engine_coolant_temp;
+
+    bool is_valid(VehicleSnapshotField f) const {
+        return (this->valid & f) != 0;
+    }
+};
+
+// How old (ms) the frame behind each VehicleSnapshot field may be, before the field is marked invalid
+struct VehicleSnapshotExpiry {
+    uint16_t wheels_ms;
+    uint16_t engine_rpm_ms;
+    uint16_t shifter_position_ms;
+    uint16_t pedal_ms;
+    uint16_t engine_coolant_temp_ms;
+};
+
+/**
+ * Runtime interface of the CAN HAL. Firmware code calls the HAL through the concrete
+ * class selected in egs_can_hal.h instead, so it does not pay for virtual dispatch
+ */
 class AbstractCan {
     public:
         explicit AbstractCan(const char* name, uint8_t tx_time_ms) {
@@ -181,11 +327,30 @@ class AbstractCan {
         // Returns true if engine is cranking
         virtual bool get_is_starting(uint64_t now, uint64_t expire_time_ms);
         virtual bool get_profile_btn_press(uint64_t now, uint64_t expire_time_ms);
+        /**
+         * Fills 'dest' with everything the gearbox controller needs for one tick. Each frame is read once
+         * per field expiry, and any field coming from a frame older than its expiry in 'expiry' is marked invalid
+         */
+        virtual void get_vehicle_snapshot(uint64_t now, const VehicleSnapshotExpiry* expiry, VehicleSnapshot* dest);
+        // Gets statistics about received CAN frames
+        virtual CanRxStats get_rx_stats();
+        // Gets the number of CAN frames the HAL reads from other ECUs
+        virtual uint8_t get_num_rx_frames();
+        // Gets the CAN ID and arrival statistics of read frame 'idx' (0 to get_num_rx_frames()-1)
+        virtual bool get_rx_frame_stats(uint8_t idx, uint32_t* can_id, FrameArrivalStats* dest);
+        // Gets the number of CAN frames the HAL sends
+        virtual uint8_t get_num_tx_frames();
+        // Gets the CAN ID and Tx schedule statistics of sent frame 'idx' (0 to get_num_tx_frames()-1)
+        virtual bool get_tx_frame_stats(uint8_t idx, uint32_t* can_id, TxFrameStats* dest);
+        // Gets the error state of the CAN controller, and bus off recovery statistics
+        virtual CanBusStats get_bus_stats();
 
         /**
          * Setters
          */
 
+        // Sets the server that handles requests received on the diagnostic CAN IDs
+        virtual void set_diag_server(DiagServer* server);
         // Set the gearbox clutch position on CAN
         virtual void set_clutch_status(ClutchStatus status);
         // Set the actual gear of the gearbox
@@ -240,6 +405,4 @@ class AbstractCan {
         const char* name;
 };
 
-extern AbstractCan* egs_can_hal;
-
 #endif
\ No newline at end of file
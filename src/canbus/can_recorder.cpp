@@ -0,0 +1,169 @@
+#include "can_recorder.h"
+#include <string.h>
+#include <inttypes.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+
+CanRecorder can_recorder;
+
+bool CanRecorder::alloc_ring(RecorderRing* ring, uint32_t size) {
+    ring->records = static_cast<RecorderRecord*>(heap_caps_malloc(size * sizeof(RecorderRecord), MALLOC_CAP_SPIRAM));
+    ring->mask = size - 1;
+    if (ring->records == nullptr) {
+        ESP_LOGE("CAN_REC", "Could not allocate %" PRIu32 " bytes of PSRAM for %" PRIu32 " frames (Is PSRAM enabled in sdkconfig?)",
+            (uint32_t)(size * sizeof(RecorderRecord)), size);
+        return false;
+    }
+    return true;
+}
+
+bool CanRecorder::init() {
+    if (this->rx.records != nullptr) {
+        return true; // Already done
+    }
+    if (!alloc_ring(&this->rx, RECORDER_RX_RECORDS) || !alloc_ring(&this->tx, RECORDER_TX_RECORDS)) {
+        ESP_LOGE("CAN_REC", "Could not allocate recorder in PSRAM, CAN frames will not be recorded");
+        // record() ignores both rings whilst Rx has no buffer
+        free(this->tx.records);
+        this->tx.records = nullptr;
+        free(this->rx.records);
+        this->rx.records = nullptr;
+        return false;
+    }
+    ESP_LOGI("CAN_REC", "Recording %u Rx and %u Tx frames to PSRAM", RECORDER_RX_RECORDS, RECORDER_TX_RECORDS);
+    return true;
+}
+
+void CanRecorder::record(RecorderRing* ring, uint32_t can_id, uint8_t dlc, const uint8_t* data, uint64_t now) {
+    if (ring->records == nullptr) {
+        return;
+    }
+    RecorderState s = this->state.load();
+    if (s == RecorderState::Frozen) {
+        return;
+    }
+    // Single producer, so nothing else can move head whilst we write the record.
+    // If the ring is frozen part way through, the reader leaves this slot out (See get_section())
+    uint32_t h = ring->head.load(std::memory_order_relaxed);
+    RecorderRecord* r = &ring->records[h & ring->mask];
+    r->timestamp = (uint32_t)now;
+    r->can_id = can_id;
+    r->dlc = dlc > 8 ? 8 : dlc;
+    r->reserved = 0;
+    memcpy(r->data, data, 8);
+    ring->head.store(h+1, std::memory_order_release);
+    if (s == RecorderState::Triggered && now > this->trigger_time && now - this->trigger_time > RECORDER_POST_TRIGGER_US) {
+        this->freeze();
+    }
+}
+
+void CanRecorder::trigger(RecorderTrigger reason) {
+    RecorderState expected = RecorderState::Recording;
+    if (!this->state.compare_exchange_strong(expected, RecorderState::Triggering)) {
+        return; // Already triggered
+    }
+    this->trigger_time = esp_timer_get_time();
+    this->trigger_reason = reason;
+    expected = RecorderState::Triggering;
+    // Fails if the recorder was frozen in the meantime, which is fine
+    this->state.compare_exchange_strong(expected, RecorderState::Triggered);
+    ESP_LOGW("CAN_REC", "Recorder triggered (Reason %d)", (int)reason);
+}
+
+void CanRecorder::freeze() {
+    this->state.store(RecorderState::Frozen);
+}
+
+CanRecorder::RecorderSection CanRecorder::get_section(const RecorderRing* ring) {
+    uint32_t head = ring->head.load(std::memory_order_acquire);
+    // The oldest slot of a full ring may be being overwritten by a producer that
+    // started before the freeze, so it is never read out
+    uint32_t count = head;
+    if (count > ring->mask) {
+        count = ring->mask;
+    }
+    return RecorderSection {
+        .records = ring->records,
+        .mask = ring->mask,
+        .first = head - count,
+        .count = ring->records == nullptr ? 0 : count
+    };
+}
+
+uint32_t CanRecorder::begin_readout() {
+    if (!this->is_frozen()) {
+        RecorderState expected = RecorderState::Recording;
+        if (this->state.compare_exchange_strong(expected, RecorderState::Triggering)) {
+            this->trigger_time = esp_timer_get_time();
+            this->trigger_reason = RecorderTrigger::Manual;
+        }
+        this->freeze();
+    }
+    this->readout_rx = get_section(&this->rx);
+    this->readout_tx = get_section(&this->tx);
+    this->readout_pos = 0;
+    this->readout_size = sizeof(RecorderHeader) + (this->readout_rx.count + this->readout_tx.count) * sizeof(RecorderEntry);
+    return this->readout_size;
+}
+
+uint16_t CanRecorder::read_block(uint8_t* dest, uint16_t max_len) {
+    uint16_t copied = 0;
+    uint16_t n;
+    uint32_t idx;
+    uint32_t off;
+    RecorderHeader header;
+    RecorderEntry entry;
+    const RecorderRecord* r;
+    while (copied < max_len && this->readout_pos < this->readout_size) {
+        if (this->readout_pos < sizeof(RecorderHeader)) {
+            header = RecorderHeader {
+                .magic = RECORDER_MAGIC,
+                .version = RECORDER_VERSION,
+                .trigger = this->trigger_reason,
+                .entry_size = sizeof(RecorderEntry),
+                .trigger_time = this->trigger_time,
+                .rx_count = this->readout_rx.count,
+                .tx_count = this->readout_tx.count
+            };
+            off = this->readout_pos;
+            n = sizeof(RecorderHeader) - off;
+            if (n > max_len - copied) {
+                n = max_len - copied;
+            }
+            memcpy(&dest[copied], (uint8_t*)&header + off, n);
+        } else {
+            idx = (this->readout_pos - sizeof(RecorderHeader)) / sizeof(RecorderEntry);
+            off = (this->readout_pos - sizeof(RecorderHeader)) % sizeof(RecorderEntry);
+            if (idx < this->readout_rx.count) {
+                r = &this->readout_rx.records[(this->readout_rx.first + idx) & this->readout_rx.mask];
+            } else {
+                idx -= this->readout_rx.count;
+                r = &this->readout_tx.records[(this->readout_tx.first + idx) & this->readout_tx.mask];
+            }
+            entry.time_offset = (int32_t)(r->timestamp - (uint32_t)this->trigger_time);
+            entry.can_id = r->can_id;
+            entry.dlc = r->dlc;
+            entry.reserved = 0;
+            memcpy(entry.data, r->data, 8);
+            n = sizeof(RecorderEntry) - off;
+            if (n > max_len - copied) {
+                n = max_len - copied;
+            }
+            memcpy(&dest[copied], (uint8_t*)&entry + off, n);
+        }
+        copied += n;
+        this->readout_pos += n;
+    }
+    return copied;
+}
+
+void CanRecorder::end_readout() {
+    this->rx.head.store(0);
+    this->tx.head.store(0);
+    this->trigger_reason = RecorderTrigger::None;
+    this->trigger_time = 0;
+    this->readout_size = 0;
+    this->readout_pos = 0;
+    this->state.store(RecorderState::Recording);
+}
@@ -0,0 +1,162 @@
+/**
+ * CAN flight recorder
+ *
+ * Records every frame received and sent by the CAN HAL into 2 ring buffers in PSRAM
+ * (One for Rx, one for Tx, each written only by its own task so no locking is needed).
+ *
+ * When something goes wrong, trigger() is called. Recording carries on for RECORDER_POST_TRIGGER_US,
+ * and then the rings are frozen, holding the history leading up to (And just after) the trigger
+ * until the capture is read out over diagnostics.
+ *
+ * Capture format (All little endian), as returned by read_block():
+ * RecorderHeader
+ * RecorderEntry * (rx_count + tx_count). Rx frames first then Tx frames, each oldest first
+ *
+ * lib/recorder_to_log.py converts a capture to candump / Vector ASC logs
+ */
+
+#ifndef __CAN_RECORDER_H_
+#define __CAN_RECORDER_H_
+
+#include <stdint.h>
+#include <atomic>
+
+// Ring sizes (Must be powers of 2). 16 bytes per frame, so 1MB for Rx and 512KB for Tx.
+// At the usual EGS52 bus load that keeps well over a minute of history
+#define RECORDER_RX_RECORDS 65536
+#define RECORDER_TX_RECORDS 32768
+// How long to keep recording after a trigger
+#define RECORDER_POST_TRIGGER_US 5000000
+
+#define RECORDER_MAGIC 0x5232354E // "N52R"
+#define RECORDER_VERSION 1
+
+// Bit set in RecorderEntry::can_id for frames we sent
+#define RECORDER_TX_FLAG 0x8000
+
+enum class RecorderTrigger : uint8_t {
+    None = 0,
+    // Startup self test failed
+    Fault = 1,
+    // Gear ratio does not match any gear whilst not shifting
+    ImplausibleRatio = 2,
+    // N2/N3 overspeed
+    Overspeed = 3,
+    // Frozen on request (Capture read out before a trigger)
+    Manual = 4,
+};
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint8_t version;
+    RecorderTrigger trigger;
+    uint16_t entry_size;
+    // Time of the trigger (us since boot)
+    uint64_t trigger_time;
+    uint32_t rx_count;
+    uint32_t tx_count;
+} RecorderHeader;
+
+// A frame as stored in the capture
+typedef struct __attribute__((packed)) {
+    // Time relative to the trigger (us)
+    int32_t time_offset;
+    // CAN ID (11 bit), with RECORDER_TX_FLAG set for frames we sent
+    uint16_t can_id;
+    uint8_t dlc;
+    uint8_t reserved;
+    uint8_t data[8];
+} RecorderEntry;
+
+class CanRecorder {
+    public:
+        // Allocates the rings in PSRAM. Returns false (And records nothing) if there is not enough
+        bool init();
+
+        // Rx task: Records a received frame
+        void record_rx(uint32_t can_id, uint8_t dlc, const uint8_t* data, uint64_t now) {
+            this->record(&this->rx, can_id, dlc, data, now);
+        }
+
+        // Tx task: Records a sent frame
+        void record_tx(uint32_t can_id, uint8_t dlc, const uint8_t* data, uint64_t now) {
+            this->record(&this->tx, can_id | RECORDER_TX_FLAG, dlc, data, now);
+        }
+
+        /**
+         * Triggers the recorder. Only the first trigger counts, until the
+         * capture has been read out (See end_readout())
+         */
+        void trigger(RecorderTrigger reason);
+
+        bool is_frozen() const {
+            return this->state.load() == RecorderState::Frozen;
+        }
+
+        /**
+         * Starts reading out the capture, freezing the recorder straight away if it is not frozen yet.
+         * Returns the size of the capture in bytes
+         */
+        uint32_t begin_readout();
+
+        // Copies up to 'max_len' bytes of the capture into 'dest', returning how many were copied
+        uint16_t read_block(uint8_t* dest, uint16_t max_len);
+
+        // Finishes reading out the capture, and starts recording again
+        void end_readout();
+    private:
+        enum class RecorderState : uint8_t {
+            // Recording, waiting for a trigger
+            Recording,
+            // trigger() is storing the trigger time
+            Triggering,
+            // Recording the post trigger history
+            Triggered,
+            // Not recording, capture is ready to read
+            Frozen
+        };
+
+        typedef struct {
+            uint32_t timestamp; // Lower 32 bits of the time in us
+            uint16_t can_id;
+            uint8_t dlc;
+            uint8_t reserved;
+            uint8_t data[8];
+        } RecorderRecord;
+
+        typedef struct {
+            RecorderRecord* records = nullptr;
+            uint32_t mask = 0;
+            // Number of frames ever written. Only the producer task writes this
+            std::atomic<uint32_t> head{0};
+        } RecorderRing;
+
+        // Part of a ring that is being read out
+        typedef struct {
+            const RecorderRecord* records;
+            uint32_t mask;
+            uint32_t first;
+            uint32_t count;
+        } RecorderSection;
+
+        void record(RecorderRing* ring, uint32_t can_id, uint8_t dlc, const uint8_t* data, uint64_t now);
+        void freeze();
+        static bool alloc_ring(RecorderRing* ring, uint32_t size);
+        static RecorderSection get_section(const RecorderRing* ring);
+
+        RecorderRing rx;
+        RecorderRing tx;
+        std::atomic<RecorderState> state{RecorderState::Recording};
+        RecorderTrigger trigger_reason = RecorderTrigger::None;
+        uint64_t trigger_time = 0;
+
+        // Readout position (In bytes) within the capture
+        uint32_t readout_pos = 0;
+        uint32_t readout_size = 0;
+        RecorderSection readout_rx;
+        RecorderSection readout_tx;
+};
+
+extern CanRecorder can_recorder;
+
+#endif // __CAN_RECORDER_H_
@@ -0,0 +1,124 @@
+#include "can_rx_ring.h"
+#include <stdlib.h>
+#include <string.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <esp_heap_caps.h>
+
+CanRxRing::~CanRxRing() {
+    this->stop();
+    free(this->frames);
+}
+
+void CanRxRing::stop() {
+    if (this->task != nullptr) {
+        vTaskDelete(this->task);
+        this->task = nullptr;
+    }
+}
+
+bool CanRxRing::alloc(uint32_t size, uint32_t caps) {
+    this->frames = static_cast<CanRxFrame*>(heap_caps_malloc(size * sizeof(CanRxFrame), caps));
+    this->mask = this->frames == nullptr ? 0 : size - 1;
+    return this->frames != nullptr;
+}
+
+bool CanRxRing::start(const char* task_name, const char* log_tag) {
+    if (this->task != nullptr) {
+        return true;
+    }
+    this->log_tag = log_tag;
+    if (this->frames == nullptr) {
+        if (this->alloc(CAN_RX_RING_FRAMES, MALLOC_CAP_SPIRAM)) {
+            ESP_LOGI(this->log_tag, "Buffering up to %u received frames in PSRAM", CAN_RX_RING_FRAMES);
+        } else if (this->alloc(CAN_RX_RING_FRAMES_INTERNAL, MALLOC_CAP_8BIT)) {
+            ESP_LOGW(this->log_tag, "Could not allocate Rx ring in PSRAM, buffering up to %u received frames in internal RAM", CAN_RX_RING_FRAMES_INTERNAL);
+        } else {
+            ESP_LOGE(this->log_tag, "Could not allocate Rx ring!");
+            return false;
+        }
+    }
+    // Above the Rx task, so the driver's queue is emptied even whilst decoding a burst
+    if (xTaskCreate(this->start_task_loop, task_name, 4096, this, 6, &this->task) != pdPASS) {
+        ESP_LOGE(this->log_tag, "CAN Rx drain task creation failed!");
+        return false;
+    }
+    return true;
+}
+
+[[noreturn]]
+void CanRxRing::task_loop() {
+    twai_message_t rx;
+    while (true) {
+        if (twai_receive(&rx, portMAX_DELAY) != ESP_OK) {
+            continue;
+        }
+        // Timestamp straight away, so the frame age seen by the getters is as close
+        // to the real arrival time as we can get it
+        uint64_t now = esp_timer_get_time();
+        uint32_t head = this->head.load(std::memory_order_relaxed);
+        uint32_t used = head - this->tail.load(std::memory_order_acquire);
+        if (used > this->mask) {
+            // Full. The Rx task is that far behind, so the newest frame is the one to lose
+            this->overflow_count++;
+            continue;
+        }
+        CanRxFrame* f = &this->frames[head & this->mask];
+        f->timestamp = now;
+        f->identifier = rx.identifier;
+        f->flags = (uint8_t)rx.flags;
+        f->data_length_code = rx.data_length_code;
+        memcpy(f->data, rx.data, sizeof(f->data));
+        this->head.store(head + 1, std::memory_order_release);
+        if (used + 1 > this->high_water) {
+            this->high_water = used + 1;
+        }
+        // The Rx task runs at a lower priority, so this does not switch to it straight away
+        TaskHandle_t consumer = this->consumer.load();
+        if (consumer != nullptr) {
+            xTaskNotifyGive(consumer);
+        }
+    }
+}
+
+bool CanRxRing::pop(CanRxFrame* dest, TickType_t ticks_to_wait) {
+    if (this->consumer.load() == nullptr) {
+        this->consumer.store(xTaskGetCurrentTaskHandle());
+    }
+    uint32_t tail = this->tail.load(std::memory_order_relaxed);
+    if (this->head.load(std::memory_order_acquire) == tail) {
+        ulTaskNotifyTake(pdTRUE, ticks_to_wait);
+        if (this->head.load(std::memory_order_acquire) == tail) {
+            return false;
+        }
+    }
+    *dest = this->frames[tail & this->mask];
+    this->tail.store(tail + 1, std::memory_order_release);
+    this->rx_count++;
+    // How long the frame sat in the ring before the Rx task got to it
+    uint64_t latency = esp_timer_get_time() - dest->timestamp;
+    this->last_latency_us = latency > UINT32_MAX ? UINT32_MAX : (uint32_t)latency;
+    if (this->last_latency_us > this->max_latency_us) {
+        this->max_latency_us = this->last_latency_us;
+    }
+    return true;
+}
+
+CanRxStats CanRxRing::get_stats() const {
+    twai_status_info_t can_status;
+    uint32_t overflows = 0;
+    if (twai_get_status_info(&can_status) == ESP_OK) {
+        overflows = can_status.rx_missed_count;
+    }
+    return CanRxStats {
+        .rx_count = this->rx_count,
+        .dropped_count = this->dropped_count,
+        .rejected_count = this->rejected_count,
+        .rx_queue_overflow_count = overflows,
+        .ring_overflow_count = this->overflow_count,
+        .ring_high_water = this->high_water,
+        .ring_size = this->mask == 0 ? 0 : this->mask + 1,
+        .last_drain_latency_us = this->last_latency_us,
+        .max_drain_latency_us = this->max_latency_us
+    };
+}
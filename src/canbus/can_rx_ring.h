@@ -0,0 +1,99 @@
+/**
+ * Second stage CAN receive buffer
+ *
+ * The Rx queue of the TWAI driver only holds a handful of frames, so a burst (Every ECU waking up at ignition on,
+ * or a diagnostic session) overflows it whenever the Rx task is busy decoding, or is held off by a higher priority task.
+ *
+ * The drain task does nothing but move frames from the driver's queue into a large ring in PSRAM, timestamping each one
+ * as it comes out of the driver. The Rx task of the HAL then decodes them from the ring at its own pace with pop().
+ * If PSRAM cannot be allocated, a smaller ring in internal RAM is used instead.
+ *
+ * The ring has a single producer (The drain task) and a single consumer (The Rx task), so no locking is needed.
+ */
+
+#ifndef __CAN_RX_RING_H_
+#define __CAN_RX_RING_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "driver/twai.h"
+#include "can_hal.h"
+
+// Ring sizes (Must be powers of 2). 24 bytes per frame, so 96KB in PSRAM. That is over half a second
+// of a completely full bus at 500kbps
+#define CAN_RX_RING_FRAMES 4096
+#define CAN_RX_RING_FRAMES_INTERNAL 256
+
+// A received frame, as stored in the ring (Same field names as twai_message_t)
+typedef struct {
+    // Time the frame came out of the driver's Rx queue (us)
+    uint64_t timestamp;
+    uint32_t identifier;
+    // Flags of twai_message_t (Only the low 8 bits are ever set)
+    uint8_t flags;
+    uint8_t data_length_code;
+    uint8_t reserved[2];
+    uint8_t data[8];
+} CanRxFrame;
+
+class CanRxRing {
+    public:
+        ~CanRxRing();
+
+        // Allocates the ring, and starts the drain task. 'log_tag' is used for its log messages
+        bool start(const char* task_name, const char* log_tag);
+
+        // Stops the drain task. Must be called before the TWAI driver is uninstalled
+        void stop();
+
+        /**
+         * Rx task: Takes the oldest frame out of the ring (Counting it as received), waiting up to
+         * 'ticks_to_wait' for one if it is empty. Returns false if there was no frame
+         */
+        bool pop(CanRxFrame* dest, TickType_t ticks_to_wait);
+
+        // Rx task: Counts a popped frame that the TCM does not read
+        void count_dropped() {
+            this->dropped_count++;
+        }
+
+        // Rx task: Counts a popped frame that failed validation
+        void count_rejected() {
+            this->rejected_count++;
+        }
+
+        // Gets the statistics of received frames, the driver's Rx queue included. Safe to call from any task
+        CanRxStats get_stats() const;
+    private:
+        [[noreturn]]
+        void task_loop();
+        static void start_task_loop(void* _this) {
+            static_cast<CanRxRing*>(_this)->task_loop();
+        }
+        bool alloc(uint32_t size, uint32_t caps);
+
+        const char* log_tag = "CAN_RX";
+        TaskHandle_t task = nullptr;
+        CanRxFrame* frames = nullptr;
+        uint32_t mask = 0;
+        // Number of frames ever written. Only the drain task writes this
+        std::atomic<uint32_t> head{0};
+        // Number of frames ever read. Only the Rx task writes this
+        std::atomic<uint32_t> tail{0};
+        // Task to wake up when a frame lands in an empty ring (Set by its first pop())
+        std::atomic<TaskHandle_t> consumer{nullptr};
+
+        // Updated by the drain task
+        volatile uint32_t overflow_count = 0;
+        volatile uint32_t high_water = 0;
+        // Updated by the Rx task
+        volatile uint32_t rx_count = 0;
+        volatile uint32_t dropped_count = 0;
+        volatile uint32_t rejected_count = 0;
+        volatile uint32_t last_latency_us = 0;
+        volatile uint32_t max_latency_us = 0;
+};
+
+#endif // __CAN_RX_RING_H_
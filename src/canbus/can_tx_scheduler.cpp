@@ -0,0 +1,254 @@
+#include "can_tx_scheduler.h"
+#include <esp_log.h>
+#include "driver/twai.h"
+#include "can_recorder.h"
+
+static uint16_t gcd(uint16_t a, uint16_t b) {
+    while (b != 0) {
+        uint16_t t = b;
+        b = a % b;
+        a = t;
+    }
+    return a;
+}
+
+bool CanTxScheduler::add_frame(uint32_t can_id, uint16_t period_ms, uint16_t offset_ms) {
+    if (this->num_frames >= MAX_TX_FRAMES || period_ms == 0 || this->timer != nullptr) {
+        return false;
+    }
+    this->frames[this->num_frames] = TxScheduleEntry {
+        .can_id = can_id,
+        .period_ticks = 0,
+        .next_tick = 0,
+        .last_sent = 0,
+        .stats = {}
+    };
+    this->periods_ms[this->num_frames] = period_ms;
+    this->offsets_ms[this->num_frames] = offset_ms % period_ms;
+    this->num_frames++;
+    return true;
+}
+
+bool CanTxScheduler::start(TaskHandle_t task) {
+    if (this->num_frames == 0) {
+        return false;
+    }
+    // Tick at the largest interval that still hits every period and offset
+    uint16_t tick_ms = this->periods_ms[0];
+    for (uint8_t i = 0; i < this->num_frames; i++) {
+        tick_ms = gcd(tick_ms, this->periods_ms[i]);
+        if (this->offsets_ms[i] != 0) {
+            tick_ms = gcd(tick_ms, this->offsets_ms[i]);
+        }
+    }
+    for (uint8_t i = 0; i < this->num_frames; i++) {
+        this->frames[i].period_ticks = this->periods_ms[i] / tick_ms;
+        this->frames[i].next_tick = this->offsets_ms[i] / tick_ms;
+    }
+    this->tick_period_us = (uint32_t)tick_ms * 1000;
+    this->tx_task = task;
+    esp_timer_create_args_t args = {};
+    args.callback = &CanTxScheduler::on_timer_tick;
+    args.arg = this;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "CAN_TX_SCHED";
+    if (esp_timer_create(&args, &this->timer) != ESP_OK) {
+        return false;
+    }
+    this->start_time = esp_timer_get_time();
+    this->current_tick = 0;
+    this->elapsed_ticks.store(0);
+    if (esp_timer_start_periodic(this->timer, this->tick_period_us) != ESP_OK) {
+        return false;
+    }
+    ESP_LOGI("CAN_TX_SCHED", "Tx schedule started with %u frames, tick %u ms", this->num_frames, tick_ms);
+    return true;
+}
+
+void CanTxScheduler::on_timer_tick(void* _this) {
+    CanTxScheduler* s = static_cast<CanTxScheduler*>(_this);
+    s->elapsed_ticks.fetch_add(1);
+    xTaskNotifyGive(s->tx_task);
+}
+
+void CanTxScheduler::wait_for_tick(uint32_t max_wait_us) {
+    // Tick 0 is due as soon as the schedule starts, so nothing to wait for
+    if (!this->first_tick_done) {
+        this->first_tick_done = true;
+        return;
+    }
+    if (this->elapsed_ticks.load() <= this->current_tick) {
+        uint32_t wait_us = this->urgent_wait_us(esp_timer_get_time());
+        if (max_wait_us < wait_us) {
+            wait_us = max_wait_us;
+        }
+        if (wait_us == UINT32_MAX) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        } else if (wait_us != 0) {
+            ulTaskNotifyTake(pdTRUE, (wait_us + (portTICK_PERIOD_MS*1000) - 1) / (portTICK_PERIOD_MS*1000));
+        }
+    }
+    // If we have fallen behind, jump straight to the latest tick. Frames due on the skipped ticks
+    // are sent late, and on_frame_sent() counts the deadlines they missed
+    this->current_tick = this->elapsed_ticks.load();
+}
+
+void CanTxScheduler::wake() {
+    if (this->timer != nullptr) {
+        xTaskNotifyGive(this->tx_task);
+    }
+}
+
+uint32_t CanTxScheduler::get_time_to_next_deadline(uint64_t now) const {
+    uint32_t min_time = UINT32_MAX;
+    uint64_t deadline;
+    for (uint8_t i = 0; i < this->num_frames; i++) {
+        deadline = this->get_deadline(i);
+        if (deadline <= now) {
+            return 0;
+        } else if (deadline - now < min_time) {
+            min_time = (uint32_t)(deadline - now);
+        }
+    }
+    return min_time;
+}
+
+bool CanTxScheduler::is_due(uint8_t idx) const {
+    return (int32_t)(this->current_tick - this->frames[idx].next_tick) >= 0;
+}
+
+uint64_t CanTxScheduler::get_deadline(uint8_t idx) const {
+    return this->start_time + (uint64_t)this->frames[idx].next_tick * this->tick_period_us;
+}
+
+void CanTxScheduler::request_urgent(uint32_t can_id) {
+    for (uint8_t i = 0; i < this->num_frames; i++) {
+        if (this->frames[i].can_id == can_id) {
+            this->urgent_pending.fetch_or(1UL << i);
+            // Only wake the Tx task once the schedule is running
+            if (this->timer != nullptr) {
+                xTaskNotifyGive(this->tx_task);
+            }
+            return;
+        }
+    }
+}
+
+uint64_t CanTxScheduler::urgent_send_time(uint8_t idx, uint64_t now) const {
+    uint64_t allowed_at = this->frames[idx].last_sent + TX_URGENT_MIN_SPACING_US;
+    return now > allowed_at ? now : allowed_at;
+}
+
+bool CanTxScheduler::urgent_worth_sending(uint8_t idx, uint64_t send_time) const {
+    return send_time + TX_URGENT_MIN_SPACING_US <= this->get_deadline(idx);
+}
+
+uint32_t CanTxScheduler::urgent_wait_us(uint64_t now) {
+    uint32_t pending = this->urgent_pending.load();
+    uint32_t wait = UINT32_MAX;
+    uint64_t send_time;
+    for (uint8_t i = 0; i < this->num_frames; i++) {
+        if (pending & (1UL << i)) {
+            send_time = this->urgent_send_time(i, now);
+            if (!this->urgent_worth_sending(i, send_time)) {
+                // The scheduled transmission will carry the new value just as soon
+                this->urgent_pending.fetch_and(~(1UL << i));
+            } else if (send_time == now) {
+                return 0;
+            } else if (send_time - now < wait) {
+                wait = (uint32_t)(send_time - now);
+            }
+        }
+    }
+    return wait;
+}
+
+bool CanTxScheduler::take_urgent(uint8_t idx, uint64_t now) {
+    uint32_t mask = 1UL << idx;
+    if (!(this->urgent_pending.load() & mask)) {
+        return false;
+    }
+    if (this->urgent_send_time(idx, now) > now) {
+        // Too soon after the last one, keep the request for later
+        return false;
+    }
+    this->urgent_pending.fetch_and(~mask);
+    // Not worth it if the frame is going out on schedule shortly
+    return this->urgent_worth_sending(idx, now);
+}
+
+void CanTxScheduler::send_frames(TxFrameBuilder build, void* ctx) {
+    twai_message_t tx = {};
+    tx.data_length_code = 8; // Always
+    bool ok;
+    uint64_t now;
+    for (uint8_t i = 0; i < this->num_frames; i++) {
+        tx.identifier = this->frames[i].can_id;
+        if (this->is_due(i)) {
+            if (build(ctx, i, true, tx.data)) {
+                ok = twai_transmit(&tx, 5) == ESP_OK;
+                now = esp_timer_get_time();
+                this->on_frame_sent(i, now, ok);
+                if (ok) {
+                    can_recorder.record_tx(tx.identifier, tx.data_length_code, tx.data, now);
+                }
+            }
+        } else {
+            now = esp_timer_get_time();
+            if (this->take_urgent(i, now) && build(ctx, i, false, tx.data)) {
+                ok = twai_transmit(&tx, 5) == ESP_OK;
+                now = esp_timer_get_time();
+                this->on_urgent_sent(i, now, ok);
+                if (ok) {
+                    can_recorder.record_tx(tx.identifier, tx.data_length_code, tx.data, now);
+                }
+            }
+        }
+    }
+}
+
+void CanTxScheduler::on_urgent_sent(uint8_t idx, uint64_t now, bool ok) {
+    TxScheduleEntry* f = &this->frames[idx];
+    if (ok) {
+        f->stats.urgent_count++;
+        f->last_sent = now;
+    } else {
+        f->stats.failed_count++;
+    }
+}
+
+void CanTxScheduler::on_frame_sent(uint8_t idx, uint64_t now, bool ok) {
+    TxScheduleEntry* f = &this->frames[idx];
+    uint64_t deadline = this->get_deadline(idx);
+    // The scheduled frame carries the latest values, so any pending out of cycle request is done
+    this->urgent_pending.fetch_and(~(1UL << idx));
+    f->last_sent = now;
+    uint32_t late = now > deadline ? (uint32_t)(now - deadline) : 0;
+    if (ok) {
+        f->stats.tx_count++;
+    } else {
+        f->stats.failed_count++;
+    }
+    f->stats.last_jitter = late;
+    if (late > f->stats.max_jitter) {
+        f->stats.max_jitter = late;
+    }
+    if (late > TX_DEADLINE_TOLERANCE_US) {
+        f->stats.missed_count++;
+    }
+    f->next_tick += f->period_ticks;
+    // Skip any cycles we have completely missed, rather than sending a burst to catch up
+    while ((int32_t)(this->current_tick - f->next_tick) >= 0) {
+        f->next_tick += f->period_ticks;
+        f->stats.missed_count++;
+    }
+}
+
+bool CanTxScheduler::get_frame_stats(uint8_t idx, uint32_t* can_id, TxFrameStats* dest) const {
+    if (idx >= this->num_frames) {
+        return false;
+    }
+    *can_id = this->frames[idx].can_id;
+    *dest = this->frames[idx].stats;
+    return true;
+}
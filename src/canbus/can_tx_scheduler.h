@@ -0,0 +1,144 @@
+/**
+ * Multi-rate CAN Tx scheduler
+ *
+ * Every frame has its own period and phase offset. Deadlines are absolute (Driven by a periodic
+ * esp_timer), so the Tx cadence does not drift no matter how long the Tx task takes to send frames.
+ */
+
+#ifndef __CAN_TX_SCHEDULER_H_
+#define __CAN_TX_SCHEDULER_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_timer.h>
+#include "can_hal.h"
+
+#define MAX_TX_FRAMES 8
+// A frame sent later than this after its deadline counts as a missed deadline
+#define TX_DEADLINE_TOLERANCE_US 1000
+// Minimum time between two transmissions of the same frame when sending out of cycle
+#define TX_URGENT_MIN_SPACING_US 5000
+// Worst case time a standard 8 byte frame takes on the bus at 500kbps (With stuff bits)
+#define CAN_FRAME_TIME_US 270
+// Most diagnostic frames that may sit in the TWAI Tx queue at once (Leaving room for scheduled frames)
+#define DIAG_MAX_QUEUED_FRAMES 4
+
+typedef struct {
+    uint32_t can_id;
+    // Period in ticks of the scheduler
+    uint32_t period_ticks;
+    // Scheduler tick the frame is next due on
+    uint32_t next_tick;
+    // Time the frame was last sent (Either on schedule or out of cycle)
+    uint64_t last_sent;
+    TxFrameStats stats;
+} TxScheduleEntry;
+
+/**
+ * Builds the payload of frame 'idx' of the schedule into 'dest' (8 bytes), just before it is sent.
+ * 'on_schedule' is false for out of cycle frames. Returns false if the frame should not be sent
+ */
+typedef bool (*TxFrameBuilder)(void* ctx, uint8_t idx, bool on_schedule, uint8_t* dest);
+
+class CanTxScheduler {
+    public:
+        /**
+         * Adds a frame to the schedule. It will be sent every 'period_ms', starting 'offset_ms'
+         * after the schedule starts. Frames due on the same tick are sent in the order they were added.
+         *
+         * Must be called before start(). Returns false if the schedule is full
+         */
+        bool add_frame(uint32_t can_id, uint16_t period_ms, uint16_t offset_ms);
+
+        /**
+         * Starts the schedule. 'task' is the Tx task, which gets notified on each tick of the scheduler
+         */
+        bool start(TaskHandle_t task);
+
+        /**
+         * Blocks the Tx task until the next tick of the schedule, an out of cycle transmission
+         * is allowed to go out, wake() is called, or 'max_wait_us' has passed.
+         * Callers must cope with returning early, and check what is due each time
+         */
+        void wait_for_tick(uint32_t max_wait_us = UINT32_MAX);
+
+        // Wakes the Tx task from wait_for_tick(), to send frames that are not on the schedule. Safe to call from any task
+        void wake();
+
+        // Time until the earliest scheduled frame is due (0 if one is due already)
+        uint32_t get_time_to_next_deadline(uint64_t now) const;
+
+        // Returns true if frame 'idx' is due on the current tick
+        bool is_due(uint8_t idx) const;
+
+        /**
+         * Requests that the frame with 'can_id' is sent out of cycle as soon as possible,
+         * so a receiver does not have to wait for its next deadline to see a new value.
+         * Safe to call from any task
+         */
+        void request_urgent(uint32_t can_id);
+
+        /**
+         * Returns true if frame 'idx' should be sent out of cycle now, and clears the request.
+         *
+         * A request is held back until TX_URGENT_MIN_SPACING_US has passed since the frame was
+         * last sent, and is dropped if the frame is due on schedule within that time anyway
+         */
+        bool take_urgent(uint8_t idx, uint64_t now);
+
+        /**
+         * Tx task: Sends every frame due on the current tick, and every out of cycle frame that may go out now,
+         * in the order the frames were added. 'build' is called with 'ctx' to fill in each frame
+         */
+        void send_frames(TxFrameBuilder build, void* ctx);
+
+        // Records that frame 'idx' has been sent out of cycle at 'now'
+        void on_urgent_sent(uint8_t idx, uint64_t now, bool ok);
+
+        /**
+         * Records that frame 'idx' has been sent at 'now' (Or failed to be sent, if 'ok' is false),
+         * and moves its deadline on by one period
+         */
+        void on_frame_sent(uint8_t idx, uint64_t now, bool ok);
+
+        uint8_t get_num_frames() const {
+            return this->num_frames;
+        }
+
+        uint32_t get_can_id(uint8_t idx) const {
+            return this->frames[idx].can_id;
+        }
+
+        // Gets the CAN ID and Tx statistics of frame 'idx'
+        bool get_frame_stats(uint8_t idx, uint32_t* can_id, TxFrameStats* dest) const;
+    private:
+        static void on_timer_tick(void* _this);
+        // Time until the earliest pending out of cycle transmission may go out (0 if now, UINT32_MAX if none)
+        uint32_t urgent_wait_us(uint64_t now);
+        // Earliest time frame 'idx' may go out of cycle, given it is 'now'
+        uint64_t urgent_send_time(uint8_t idx, uint64_t now) const;
+        // Returns true if sending frame 'idx' out of cycle at 'send_time' is worth it (Not due on schedule shortly after)
+        bool urgent_worth_sending(uint8_t idx, uint64_t send_time) const;
+        uint64_t get_deadline(uint8_t idx) const;
+
+        TxScheduleEntry frames[MAX_TX_FRAMES];
+        // Offset of each frame in ms (Converted to ticks on start)
+        uint16_t offsets_ms[MAX_TX_FRAMES];
+        uint16_t periods_ms[MAX_TX_FRAMES];
+        uint8_t num_frames = 0;
+        uint32_t tick_period_us = 0;
+        uint64_t start_time = 0;
+        // Tick the Tx task is currently processing
+        uint32_t current_tick = 0;
+        bool first_tick_done = false;
+        // Ticks that have elapsed according to the timer
+        std::atomic<uint32_t> elapsed_ticks{0};
+        // Bitmask of frames waiting to be sent out of cycle
+        std::atomic<uint32_t> urgent_pending{0};
+        TaskHandle_t tx_task = nullptr;
+        esp_timer_handle_t timer = nullptr;
+};
+
+#endif // __CAN_TX_SCHEDULER_H_
@@ -0,0 +1,23 @@
+/**
+ * Selects the CAN HAL for this build mode at compile time.
+ *
+ * egs_can_hal points at the concrete (final) HAL class rather than AbstractCan, so calls made
+ * through it are direct, and the setters defined in the HAL header can be inlined. Code that
+ * needs to swap the HAL at runtime can still use it through AbstractCan
+ */
+
+#ifndef __EGS_CAN_HAL_H_
+#define __EGS_CAN_HAL_H_
+
+// EGS52 is built by default. Add -DEGS53_MODE to build_flags to build for EGS53
+#ifdef EGS53_MODE
+#include "can_egs53.h"
+typedef Egs53Can EgsCanHal;
+#else
+#include "can_egs52.h"
+typedef Egs52Can EgsCanHal;
+#endif
+
+extern EgsCanHal* egs_can_hal;
+
+#endif // __EGS_CAN_HAL_H_
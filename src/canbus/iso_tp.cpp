@@ -0,0 +1,339 @@
+#include "iso_tp.h"
+#include <string.h>
+#include <esp_timer.h>
+#include "driver/twai.h"
+#include "can_recorder.h"
+
+// Protocol control information (Upper nibble of byte 0)
+#define PCI_SINGLE_FRAME 0x0
+#define PCI_FIRST_FRAME 0x1
+#define PCI_CONSECUTIVE_FRAME 0x2
+#define PCI_FLOW_CONTROL 0x3
+
+// Flow status of a flow control frame
+#define FC_CONTINUE_TO_SEND 0x0
+#define FC_WAIT 0x1
+#define FC_OVERFLOW 0x2
+
+IsoTp::IsoTp(DiagIsoTpInfo info) {
+    this->info = info;
+    this->lock = portMUX_INITIALIZER_UNLOCKED;
+}
+
+uint32_t IsoTp::st_min_to_us(uint8_t st_min) {
+    if (st_min <= 0x7F) { // 0-127ms
+        return (uint32_t)st_min * 1000;
+    } else if (st_min >= 0xF1 && st_min <= 0xF9) { // 100-900us
+        return (uint32_t)(st_min - 0xF0) * 100;
+    } else { // Reserved, so use the longest valid value
+        return 127000;
+    }
+}
+
+void IsoTp::abort_rx() {
+    this->rx_state = IsoTpRxState::Idle;
+    this->stats.aborted++;
+}
+
+void IsoTp::abort_tx() {
+    this->tx_state = IsoTpTxState::Idle;
+    this->stats.aborted++;
+}
+
+void IsoTp::on_frame_received(const uint8_t* data, uint8_t dlc, uint64_t now) {
+    if (dlc == 0) {
+        return;
+    }
+    if (dlc > 8) {
+        dlc = 8;
+    }
+    uint16_t len;
+    uint16_t n;
+    portENTER_CRITICAL(&this->lock);
+    switch (data[0] >> 4) {
+        case PCI_SINGLE_FRAME:
+            len = data[0] & 0x0F;
+            // Ignore new requests whilst the last one is still being processed
+            if (len != 0 && len < dlc && this->rx_state != IsoTpRxState::Complete) {
+                memcpy(this->rx_buffer, &data[1], len);
+                this->rx_len = len;
+                this->rx_state = IsoTpRxState::Complete;
+                this->stats.rx_messages++;
+            }
+            break;
+        case PCI_FIRST_FRAME:
+            len = (uint16_t)(data[0] & 0x0F) << 8 | data[1];
+            if (dlc == 8 && len > 7 && this->rx_state != IsoTpRxState::Complete) {
+                memcpy(this->rx_buffer, &data[2], 6);
+                this->rx_len = len;
+                this->rx_pos = 6;
+                this->rx_seq = 1;
+                this->rx_last_time = now;
+                this->rx_state = IsoTpRxState::SendFlowControl;
+            }
+            break;
+        case PCI_CONSECUTIVE_FRAME:
+            if (this->rx_state != IsoTpRxState::WaitConsecutive) {
+                break;
+            }
+            if ((data[0] & 0x0F) != this->rx_seq) {
+                this->abort_rx();
+                break;
+            }
+            n = this->rx_len - this->rx_pos;
+            if (n > dlc-1) {
+                n = dlc-1;
+            }
+            memcpy(&this->rx_buffer[this->rx_pos], &data[1], n);
+            this->rx_pos += n;
+            this->rx_seq = (this->rx_seq + 1) & 0x0F;
+            this->rx_last_time = now;
+            if (this->rx_pos >= this->rx_len) {
+                this->rx_state = IsoTpRxState::Complete;
+                this->stats.rx_messages++;
+            } else if (this->info.bs != 0 && --this->rx_block_remaining == 0) {
+                // End of the block, tell the tester to carry on
+                this->rx_state = IsoTpRxState::SendFlowControl;
+            }
+            break;
+        case PCI_FLOW_CONTROL:
+            if (this->tx_state != IsoTpTxState::WaitFlowControl || dlc < 3) {
+                break;
+            }
+            switch (data[0] & 0x0F) {
+                case FC_CONTINUE_TO_SEND:
+                    this->tx_block_size = data[1];
+                    this->tx_block_remaining = data[1];
+                    this->tx_st_min_us = st_min_to_us(data[2]);
+                    // First consecutive frame of a block can go straight away
+                    this->tx_next_time = now;
+                    this->tx_state = IsoTpTxState::SendConsecutive;
+                    break;
+                case FC_WAIT:
+                    this->tx_last_time = now;
+                    break;
+                case FC_OVERFLOW:
+                default:
+                    this->abort_tx();
+                    break;
+            }
+            break;
+        default:
+            break;
+    }
+    portEXIT_CRITICAL(&this->lock);
+}
+
+bool IsoTp::get_tx_frame(uint64_t now, uint8_t* data) {
+    bool ready = false;
+    uint16_t n;
+    memset(data, 0x00, 8); // Padding
+    portENTER_CRITICAL(&this->lock);
+    if (this->rx_state == IsoTpRxState::SendFlowControl) {
+        // Flow control goes first, so the tester is never kept waiting
+        data[0] = PCI_FLOW_CONTROL << 4 | FC_CONTINUE_TO_SEND;
+        data[1] = this->info.bs;
+        data[2] = this->info.st_min;
+        this->pending_fc = true;
+        ready = true;
+    } else {
+        this->pending_fc = false;
+        switch (this->tx_state) {
+            case IsoTpTxState::SendSingle:
+                data[0] = PCI_SINGLE_FRAME << 4 | this->tx_len;
+                memcpy(&data[1], this->tx_buffer, this->tx_len);
+                ready = true;
+                break;
+            case IsoTpTxState::SendFirst:
+                data[0] = PCI_FIRST_FRAME << 4 | (this->tx_len >> 8);
+                data[1] = this->tx_len & 0xFF;
+                memcpy(&data[2], this->tx_buffer, 6);
+                ready = true;
+                break;
+            case IsoTpTxState::SendConsecutive:
+                if (now >= this->tx_next_time) {
+                    n = this->tx_len - this->tx_pos;
+                    if (n > 7) {
+                        n = 7;
+                    }
+                    data[0] = PCI_CONSECUTIVE_FRAME << 4 | this->tx_seq;
+                    memcpy(&data[1], &this->tx_buffer[this->tx_pos], n);
+                    ready = true;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    portEXIT_CRITICAL(&this->lock);
+    return ready;
+}
+
+void IsoTp::on_frame_sent(uint64_t now) {
+    uint16_t n;
+    portENTER_CRITICAL(&this->lock);
+    if (this->pending_fc) {
+        this->pending_fc = false;
+        if (this->rx_state == IsoTpRxState::SendFlowControl) {
+            this->rx_block_remaining = this->info.bs;
+            this->rx_last_time = now;
+            this->rx_state = IsoTpRxState::WaitConsecutive;
+        }
+    } else {
+        switch (this->tx_state) {
+            case IsoTpTxState::SendSingle:
+                this->tx_state = IsoTpTxState::Idle;
+                this->stats.tx_messages++;
+                break;
+            case IsoTpTxState::SendFirst:
+                this->tx_pos = 6;
+                this->tx_seq = 1;
+                this->tx_last_time = now;
+                this->tx_state = IsoTpTxState::WaitFlowControl;
+                break;
+            case IsoTpTxState::SendConsecutive:
+                n = this->tx_len - this->tx_pos;
+                this->tx_pos += n > 7 ? 7 : n;
+                this->tx_seq = (this->tx_seq + 1) & 0x0F;
+                this->tx_last_time = now;
+                this->tx_next_time = now + this->tx_st_min_us;
+                if (this->tx_pos >= this->tx_len) {
+                    this->tx_state = IsoTpTxState::Idle;
+                    this->stats.tx_messages++;
+                } else if (this->tx_block_size != 0 && --this->tx_block_remaining == 0) {
+                    this->tx_state = IsoTpTxState::WaitFlowControl;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    portEXIT_CRITICAL(&this->lock);
+}
+
+uint32_t IsoTp::get_tx_wait_us(uint64_t now) {
+    uint32_t wait = UINT32_MAX;
+    portENTER_CRITICAL(&this->lock);
+    if (this->rx_state == IsoTpRxState::WaitConsecutive && now - this->rx_last_time > ISO_TP_TIMEOUT_US) {
+        this->abort_rx(); // N_Cr
+    }
+    if (this->tx_state == IsoTpTxState::WaitFlowControl && now - this->tx_last_time > ISO_TP_TIMEOUT_US) {
+        this->abort_tx(); // N_Bs
+    }
+    if (this->rx_state == IsoTpRxState::SendFlowControl) {
+        wait = 0;
+    } else if (this->tx_state == IsoTpTxState::SendSingle || this->tx_state == IsoTpTxState::SendFirst) {
+        wait = 0;
+    } else if (this->tx_state == IsoTpTxState::SendConsecutive) {
+        wait = now >= this->tx_next_time ? 0 : (uint32_t)(this->tx_next_time - now);
+    }
+    portEXIT_CRITICAL(&this->lock);
+    return wait;
+}
+
+const uint8_t* IsoTp::get_request(uint16_t* len) const {
+    // The Rx task sets rx_state under the lock, after filling rx_buffer. Once the request is complete
+    // it leaves rx_buffer and rx_len alone until release_request(), so they can be read without the lock
+    portENTER_CRITICAL(&this->lock);
+    bool complete = this->rx_state == IsoTpRxState::Complete;
+    portEXIT_CRITICAL(&this->lock);
+    if (!complete) {
+        return nullptr;
+    }
+    *len = this->rx_len;
+    return this->rx_buffer;
+}
+
+void IsoTp::release_request() {
+    portENTER_CRITICAL(&this->lock);
+    if (this->rx_state == IsoTpRxState::Complete) {
+        this->rx_state = IsoTpRxState::Idle;
+    }
+    portEXIT_CRITICAL(&this->lock);
+}
+
+uint8_t* IsoTp::get_response_buffer() {
+    // The Rx task can set tx_state (Flow control overflow), so it is read under the lock too
+    portENTER_CRITICAL(&this->lock);
+    bool idle = this->tx_state == IsoTpTxState::Idle;
+    portEXIT_CRITICAL(&this->lock);
+    return idle ? this->tx_buffer : nullptr;
+}
+
+bool IsoTp::send_response(uint16_t len) {
+    if (len == 0 || len > ISO_TP_MAX_PAYLOAD) {
+        return false;
+    }
+    bool ok = false;
+    portENTER_CRITICAL(&this->lock);
+    if (this->tx_state == IsoTpTxState::Idle) {
+        this->tx_len = len;
+        this->tx_pos = 0;
+        this->tx_state = len <= 7 ? IsoTpTxState::SendSingle : IsoTpTxState::SendFirst;
+        ok = true;
+    }
+    portEXIT_CRITICAL(&this->lock);
+    return ok;
+}
+
+void IsoTp::process_request(DiagServer* server) {
+    uint16_t len;
+    uint8_t* resp = this->get_response_buffer();
+    if (resp == nullptr) {
+        return; // Last response is still going out, so leave any request until it is done
+    }
+    const uint8_t* req = this->get_request(&len);
+    uint16_t resp_len;
+    if (req == nullptr) {
+        if (server == nullptr) {
+            return;
+        }
+        resp_len = server->get_periodic_response(esp_timer_get_time(), resp, ISO_TP_MAX_PAYLOAD);
+        if (resp_len != 0) {
+            this->send_response(resp_len);
+        }
+        return;
+    }
+    if (server != nullptr) {
+        resp_len = server->process_request(req, len, resp, ISO_TP_MAX_PAYLOAD);
+    } else {
+        // Nothing to handle diagnostics, so reject every service (serviceNotSupported)
+        resp[0] = 0x7F;
+        resp[1] = req[0];
+        resp[2] = 0x11;
+        resp_len = 3;
+    }
+    this->release_request();
+    if (resp_len != 0) {
+        this->send_response(resp_len);
+    }
+}
+
+uint32_t IsoTp::send_frames(const CanTxScheduler* schedule) {
+    twai_message_t tx = {};
+    tx.identifier = this->info.tx_canid;
+    tx.data_length_code = 8; // Always padded
+    twai_status_info_t status;
+    uint64_t now;
+    uint32_t max_queued;
+    while (true) {
+        now = esp_timer_get_time();
+        if (!this->get_tx_frame(now, tx.data)) {
+            return this->get_tx_wait_us(now);
+        }
+        // Only queue as many frames as the bus can clear before the next scheduled frame is due,
+        // so diagnostic traffic never pushes the scheduled frames off their deadlines
+        max_queued = schedule->get_time_to_next_deadline(now) / CAN_FRAME_TIME_US;
+        if (max_queued > DIAG_MAX_QUEUED_FRAMES) {
+            max_queued = DIAG_MAX_QUEUED_FRAMES;
+        }
+        if (twai_get_status_info(&status) != ESP_OK || status.msgs_to_tx >= max_queued) {
+            return CAN_FRAME_TIME_US; // Come back once the queue has drained a bit
+        }
+        if (twai_transmit(&tx, 0) != ESP_OK) {
+            return CAN_FRAME_TIME_US;
+        }
+        this->on_frame_sent(now);
+        can_recorder.record_tx(tx.identifier, tx.data_length_code, tx.data, now);
+    }
+}
@@ -0,0 +1,161 @@
+/**
+ * ISO 15765-2 (ISO-TP) transport for the diagnostic CAN IDs
+ *
+ * This is a non blocking state machine. The CAN Rx task feeds it every frame received on the
+ * diagnostic Rx ID, and the CAN Tx task polls it for frames to send (Flow control frames for
+ * requests we are receiving, single / first / consecutive frames for responses we are sending).
+ * Neither task ever waits on it.
+ */
+
+#ifndef __ISO_TP_H_
+#define __ISO_TP_H_
+
+#include <stdint.h>
+#include <freertos/FreeRTOS.h>
+#include "can_hal.h"
+#include "can_tx_scheduler.h"
+
+// Largest payload that fits in a classic ISO-TP first frame
+#define ISO_TP_MAX_PAYLOAD 4095
+// N_Bs / N_Cr. How long we wait for a flow control frame or the next consecutive frame
+#define ISO_TP_TIMEOUT_US 1000000
+
+enum class IsoTpRxState {
+    // Waiting for a single or first frame
+    Idle,
+    // First frame (Or a full block) received, flow control frame needs sending
+    SendFlowControl,
+    // Waiting for consecutive frames
+    WaitConsecutive,
+    // Full request received, waiting for it to be taken
+    Complete
+};
+
+enum class IsoTpTxState {
+    // Nothing to send
+    Idle,
+    // Single frame to send
+    SendSingle,
+    // First frame to send
+    SendFirst,
+    // First frame (Or a full block) sent, waiting for the flow control frame
+    WaitFlowControl,
+    // Sending consecutive frames
+    SendConsecutive
+};
+
+struct IsoTpStats {
+    // Complete requests received
+    uint32_t rx_messages;
+    // Complete responses sent
+    uint32_t tx_messages;
+    // Transfers aborted (Timeout, bad sequence number, or receiver overflow)
+    uint32_t aborted;
+};
+
+class IsoTp {
+    public:
+        explicit IsoTp(DiagIsoTpInfo info);
+
+        uint32_t get_rx_canid() const {
+            return this->info.rx_canid;
+        }
+
+        uint32_t get_tx_canid() const {
+            return this->info.tx_canid;
+        }
+
+        /**
+         * Rx task: Handles a frame received on the diagnostic Rx CAN ID
+         */
+        void on_frame_received(const uint8_t* data, uint8_t dlc, uint64_t now);
+
+        /**
+         * Tx task: Copies the next frame to send to 'data' (Always 8 bytes), and returns true
+         * if it should go out now. The frame is only consumed once on_frame_sent() is called,
+         * so it can be retried if the CAN driver had no room for it
+         */
+        bool get_tx_frame(uint64_t now, uint8_t* data);
+
+        /**
+         * Tx task: Marks the frame from get_tx_frame() as sent at 'now'
+         */
+        void on_frame_sent(uint64_t now);
+
+        /**
+         * Tx task: Returns the time until get_tx_frame() may have a frame to send (0 if one is ready now,
+         * UINT32_MAX if nothing is going to be sent until another frame is received).
+         * Also aborts transfers that have timed out
+         */
+        uint32_t get_tx_wait_us(uint64_t now);
+
+        /**
+         * Returns the complete request that has been received, or nullptr if there isn't one.
+         * The buffer stays valid until release_request() is called
+         */
+        const uint8_t* get_request(uint16_t* len) const;
+
+        // Frees the request buffer, so the next request can be received
+        void release_request();
+
+        /**
+         * Returns the buffer to write a response into (ISO_TP_MAX_PAYLOAD bytes),
+         * or nullptr if the previous response is still being sent
+         */
+        uint8_t* get_response_buffer();
+
+        // Starts sending the first 'len' bytes of the response buffer
+        bool send_response(uint16_t len);
+
+        /**
+         * Tx task: Hands a complete request (Or a periodic response) to 'server', and starts sending its response.
+         * If 'server' is nullptr, every request is rejected
+         */
+        void process_request(DiagServer* server);
+
+        /**
+         * Tx task: Queues whatever frames can go out without delaying the frames of 'schedule'.
+         * Returns how long the Tx task can sleep before it needs to call this again
+         */
+        uint32_t send_frames(const CanTxScheduler* schedule);
+
+        IsoTpStats get_stats() const {
+            return this->stats;
+        }
+    private:
+        static uint32_t st_min_to_us(uint8_t st_min);
+        void abort_rx();
+        void abort_tx();
+
+        DiagIsoTpInfo info;
+        // Mutable, as get_request() takes it
+        mutable portMUX_TYPE lock;
+        IsoTpStats stats = {};
+
+        // Request being received (Written by the Rx task until the request is complete)
+        IsoTpRxState rx_state = IsoTpRxState::Idle;
+        uint16_t rx_len = 0;
+        uint16_t rx_pos = 0;
+        uint8_t rx_seq = 0;
+        uint8_t rx_block_remaining = 0;
+        uint64_t rx_last_time = 0;
+        uint8_t rx_buffer[ISO_TP_MAX_PAYLOAD];
+
+        // Response being sent (Written by the Tx task, except flow control which the Rx task handles)
+        IsoTpTxState tx_state = IsoTpTxState::Idle;
+        uint16_t tx_len = 0;
+        uint16_t tx_pos = 0;
+        uint8_t tx_seq = 0;
+        // Consecutive frames left in this block (0 means no limit)
+        uint8_t tx_block_remaining = 0;
+        uint8_t tx_block_size = 0;
+        uint32_t tx_st_min_us = 0;
+        uint64_t tx_last_time = 0;
+        // Earliest time the next consecutive frame may be sent (STmin)
+        uint64_t tx_next_time = 0;
+        uint8_t tx_buffer[ISO_TP_MAX_PAYLOAD];
+        // True if the frame returned by get_tx_frame() was a flow control frame
+        bool pending_fc = false;
+};
+
+#endif // __ISO_TP_H_
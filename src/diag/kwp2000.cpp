@@ -0,0 +1,206 @@
+#include "kwp2000.h"
+#include <esp_timer.h>
+#include "../sensors.h"
+#include "../solenoids/solenoids.h"
+#include "../canbus/can_recorder.h"
+
+static int32_t read_n2_rpm(const Gearbox* g) { return Sensors::read_n2_rpm(); }
+static int32_t read_n3_rpm(const Gearbox* g) { return Sensors::read_n3_rpm(); }
+static int32_t read_y3_current(const Gearbox* g) { return sol_y3->get_current_estimate(); }
+static int32_t read_y4_current(const Gearbox* g) { return sol_y4->get_current_estimate(); }
+static int32_t read_y5_current(const Gearbox* g) { return sol_y5->get_current_estimate(); }
+static int32_t read_mpc_current(const Gearbox* g) { return sol_mpc->get_current_estimate(); }
+static int32_t read_spc_current(const Gearbox* g) { return sol_spc->get_current_estimate(); }
+static int32_t read_tcc_current(const Gearbox* g) { return sol_tcc->get_current_estimate(); }
+static int32_t read_atf_temp(const Gearbox* g) { return g->get_atf_temp(); }
+static int32_t read_target_gear(const Gearbox* g) { return (int32_t)g->get_target_gear(); }
+static int32_t read_actual_gear(const Gearbox* g) { return (int32_t)g->get_actual_gear(); }
+static int32_t read_tcc_slip(const Gearbox* g) { return g->get_tcc_slip(); }
+
+Kwp2000Server::Kwp2000Server(const Gearbox* gearbox, const LiveDataField* fields, uint8_t num_fields) {
+    this->gearbox = gearbox;
+    if (num_fields > MAX_LIVE_DATA_FIELDS) {
+        num_fields = MAX_LIVE_DATA_FIELDS;
+    }
+    for (uint8_t i = 0; i < num_fields; i++) {
+        LiveDataSlot slot = { .read = nullptr, .size = 2, .offset = (uint8_t)this->live_data_len };
+        switch (fields[i]) {
+            case LiveDataField::N2Rpm:
+                slot.read = read_n2_rpm;
+                break;
+            case LiveDataField::N3Rpm:
+                slot.read = read_n3_rpm;
+                break;
+            case LiveDataField::Y3Current:
+                slot.read = read_y3_current;
+                break;
+            case LiveDataField::Y4Current:
+                slot.read = read_y4_current;
+                break;
+            case LiveDataField::Y5Current:
+                slot.read = read_y5_current;
+                break;
+            case LiveDataField::MpcCurrent:
+                slot.read = read_mpc_current;
+                break;
+            case LiveDataField::SpcCurrent:
+                slot.read = read_spc_current;
+                break;
+            case LiveDataField::TccCurrent:
+                slot.read = read_tcc_current;
+                break;
+            case LiveDataField::AtfTemp:
+                slot.read = read_atf_temp;
+                break;
+            case LiveDataField::TargetGear:
+                slot.read = read_target_gear;
+                slot.size = 1;
+                break;
+            case LiveDataField::ActualGear:
+                slot.read = read_actual_gear;
+                slot.size = 1;
+                break;
+            case LiveDataField::TccSlip:
+                slot.read = read_tcc_slip;
+                break;
+            default:
+                continue;
+        }
+        this->layout[this->num_slots++] = slot;
+        this->live_data_len += slot.size;
+    }
+}
+
+uint16_t Kwp2000Server::negative_response(uint8_t* resp, uint8_t sid, uint8_t nrc) {
+    resp[0] = KWP_NEGATIVE_RESPONSE;
+    resp[1] = sid;
+    resp[2] = nrc;
+    return 3;
+}
+
+uint16_t Kwp2000Server::build_live_data(uint8_t* resp, uint16_t max_len) {
+    if (this->live_data_len > max_len) {
+        return 0;
+    }
+    resp[0] = KWP_SID_READ_DATA_BY_LOCAL_ID + 0x40;
+    resp[1] = KWP_LID_LIVE_DATA;
+    int32_t v;
+    for (uint8_t i = 0; i < this->num_slots; i++) {
+        v = this->layout[i].read(this->gearbox);
+        if (this->layout[i].size == 2) {
+            resp[this->layout[i].offset] = (v >> 8) & 0xFF;
+            resp[this->layout[i].offset+1] = v & 0xFF;
+        } else {
+            resp[this->layout[i].offset] = v & 0xFF;
+        }
+    }
+    return this->live_data_len;
+}
+
+uint16_t Kwp2000Server::process_upload(const uint8_t* req, uint16_t len, uint8_t* resp, uint16_t max_len) {
+    uint32_t size;
+    uint16_t n;
+    switch (req[0]) {
+        case KWP_SID_REQUEST_UPLOAD:
+            // Only the recorder capture can be uploaded, so the memory address / size in the request are ignored
+            size = can_recorder.begin_readout();
+            this->upload_active = true;
+            resp[0] = KWP_SID_REQUEST_UPLOAD + 0x40;
+            resp[1] = (size >> 24) & 0xFF;
+            resp[2] = (size >> 16) & 0xFF;
+            resp[3] = (size >> 8) & 0xFF;
+            resp[4] = size & 0xFF;
+            return 5;
+        case KWP_SID_TRANSFER_DATA:
+            if (!this->upload_active) {
+                return negative_response(resp, req[0], KWP_NRC_CONDITIONS_NOT_CORRECT);
+            }
+            n = max_len - 1;
+            if (n > KWP_UPLOAD_BLOCK_LEN) {
+                n = KWP_UPLOAD_BLOCK_LEN;
+            }
+            resp[0] = KWP_SID_TRANSFER_DATA + 0x40;
+            return 1 + can_recorder.read_block(&resp[1], n);
+        case KWP_SID_REQUEST_TRANSFER_EXIT:
+            if (!this->upload_active) {
+                return negative_response(resp, req[0], KWP_NRC_CONDITIONS_NOT_CORRECT);
+            }
+            can_recorder.end_readout();
+            this->upload_active = false;
+            resp[0] = KWP_SID_REQUEST_TRANSFER_EXIT + 0x40;
+            return 1;
+        default:
+            return negative_response(resp, req[0], KWP_NRC_SERVICE_NOT_SUPPORTED);
+    }
+}
+
+void Kwp2000Server::end_session() {
+    this->period_us = 0;
+    if (this->upload_active) {
+        can_recorder.end_readout();
+        this->upload_active = false;
+    }
+}
+
+uint16_t Kwp2000Server::process_request(const uint8_t* req, uint16_t len, uint8_t* resp, uint16_t max_len) {
+    if (len == 0) {
+        return 0;
+    }
+    this->last_request_time = esp_timer_get_time();
+    switch (req[0]) {
+        case KWP_SID_TESTER_PRESENT:
+            resp[0] = KWP_SID_TESTER_PRESENT + 0x40;
+            return 1;
+        case KWP_SID_READ_DATA_BY_LOCAL_ID:
+            if (len < 2 || len > 3) {
+                return negative_response(resp, req[0], KWP_NRC_SUB_FUNCTION_NOT_SUPPORTED);
+            }
+            if (req[1] != KWP_LID_LIVE_DATA) {
+                return negative_response(resp, req[0], KWP_NRC_REQUEST_OUT_OF_RANGE);
+            }
+            switch (len == 3 ? req[2] : KWP_TX_MODE_SINGLE) {
+                case KWP_TX_MODE_SINGLE:
+                    return this->build_live_data(resp, max_len);
+                case KWP_TX_MODE_SLOW:
+                    this->period_us = 1000000;
+                    break;
+                case KWP_TX_MODE_MEDIUM:
+                    this->period_us = 100000;
+                    break;
+                case KWP_TX_MODE_FAST:
+                    this->period_us = 20000;
+                    break;
+                case KWP_TX_MODE_STOP:
+                    this->period_us = 0;
+                    resp[0] = KWP_SID_READ_DATA_BY_LOCAL_ID + 0x40;
+                    resp[1] = KWP_LID_LIVE_DATA;
+                    return 2;
+                default:
+                    return negative_response(resp, req[0], KWP_NRC_SUB_FUNCTION_NOT_SUPPORTED);
+            }
+            // First record goes out as the response, the rest follow every period
+            this->next_periodic_time = esp_timer_get_time() + this->period_us;
+            return this->build_live_data(resp, max_len);
+        case KWP_SID_REQUEST_UPLOAD:
+        case KWP_SID_TRANSFER_DATA:
+        case KWP_SID_REQUEST_TRANSFER_EXIT:
+            return this->process_upload(req, len, resp, max_len);
+        default:
+            return negative_response(resp, req[0], KWP_NRC_SERVICE_NOT_SUPPORTED);
+    }
+}
+
+uint16_t Kwp2000Server::get_periodic_response(uint64_t now, uint8_t* resp, uint16_t max_len) {
+    if ((this->period_us != 0 || this->upload_active) && now - this->last_request_time > KWP_S3_TIMEOUT_US) {
+        this->end_session();
+    }
+    if (this->period_us == 0 || now < this->next_periodic_time) {
+        return 0;
+    }
+    this->next_periodic_time += this->period_us;
+    if (this->next_periodic_time <= now) {
+        // Fell behind (Tester too slow to take the responses), so restart the period from now
+        this->next_periodic_time = now + this->period_us;
+    }
+    return this->build_live_data(resp, max_len);
+}
@@ -0,0 +1,111 @@
+/**
+ * KWP2000 diagnostic server
+ *
+ * Supported services:
+ * 0x21 - ReadDataByLocalIdentifier (With periodic transmission of live data)
+ * 0x35 - RequestUpload (CAN recorder capture. Positive response is 0x75 followed by the capture size, 4 bytes big endian)
+ * 0x36 - TransferData (Next block of the capture, empty once it has all been sent)
+ * 0x37 - RequestTransferExit (Capture done with, recorder starts recording again)
+ * 0x3E - TesterPresent
+ *
+ * Periodic transmission and uploads stop if the tester sends nothing (Not even TesterPresent) for KWP_S3_TIMEOUT_US
+ */
+
+#ifndef __KWP2000_H_
+#define __KWP2000_H_
+
+#include <stdint.h>
+#include "../canbus/can_hal.h"
+#include "../gearbox.h"
+
+// Service IDs
+#define KWP_SID_READ_DATA_BY_LOCAL_ID 0x21
+#define KWP_SID_REQUEST_UPLOAD 0x35
+#define KWP_SID_TRANSFER_DATA 0x36
+#define KWP_SID_REQUEST_TRANSFER_EXIT 0x37
+#define KWP_SID_TESTER_PRESENT 0x3E
+#define KWP_NEGATIVE_RESPONSE 0x7F
+
+// Negative response codes
+#define KWP_NRC_SERVICE_NOT_SUPPORTED 0x11
+#define KWP_NRC_SUB_FUNCTION_NOT_SUPPORTED 0x12
+#define KWP_NRC_CONDITIONS_NOT_CORRECT 0x22
+#define KWP_NRC_REQUEST_OUT_OF_RANGE 0x31
+
+// Local identifier of the live data record
+#define KWP_LID_LIVE_DATA 0x30
+
+// transmissionMode of ReadDataByLocalIdentifier
+#define KWP_TX_MODE_SINGLE 0x01
+#define KWP_TX_MODE_SLOW 0x02 // 1Hz
+#define KWP_TX_MODE_MEDIUM 0x03 // 10Hz
+#define KWP_TX_MODE_FAST 0x04 // 50Hz
+#define KWP_TX_MODE_STOP 0x05
+
+// S3 (Server). Time without a request after which the tester is assumed gone, and periodic transmission
+// / uploads it started are stopped
+#define KWP_S3_TIMEOUT_US 5000000
+
+// Most capture bytes sent per TransferData response (Whole recorder entries, and it fits an ISO-TP message)
+#define KWP_UPLOAD_BLOCK_LEN 4080
+
+// Most values that can be packed into the live data record
+#define MAX_LIVE_DATA_FIELDS 16
+
+// Values that can be put in the live data record. All are sent big endian
+enum class LiveDataField : uint8_t {
+    N2Rpm, // 2 bytes
+    N3Rpm, // 2 bytes
+    Y3Current, // 2 bytes (mA)
+    Y4Current, // 2 bytes (mA)
+    Y5Current, // 2 bytes (mA)
+    MpcCurrent, // 2 bytes (mA)
+    SpcCurrent, // 2 bytes (mA)
+    TccCurrent, // 2 bytes (mA)
+    AtfTemp, // 2 bytes (x10 C, signed)
+    TargetGear, // 1 byte (GearboxGear)
+    ActualGear, // 1 byte (GearboxGear)
+    TccSlip, // 2 bytes (RPM, signed)
+};
+
+class Kwp2000Server: public DiagServer {
+    public:
+        /**
+         * Creates the server. The live data record contains 'fields', in order. Its layout is
+         * worked out once here, so building a record is just reading each value into its slot
+         */
+        Kwp2000Server(const Gearbox* gearbox, const LiveDataField* fields, uint8_t num_fields);
+
+        uint16_t process_request(const uint8_t* req, uint16_t len, uint8_t* resp, uint16_t max_len) override;
+        uint16_t get_periodic_response(uint64_t now, uint8_t* resp, uint16_t max_len) override;
+    private:
+        typedef int32_t (*LiveDataReader)(const Gearbox* gearbox);
+        typedef struct {
+            LiveDataReader read;
+            uint8_t size;
+            uint8_t offset;
+        } LiveDataSlot;
+
+        // Writes the live data record response (0x61 0x30 ...) to 'resp'
+        uint16_t build_live_data(uint8_t* resp, uint16_t max_len);
+        // Handles RequestUpload / TransferData / RequestTransferExit for the CAN recorder capture
+        uint16_t process_upload(const uint8_t* req, uint16_t len, uint8_t* resp, uint16_t max_len);
+        static uint16_t negative_response(uint8_t* resp, uint8_t sid, uint8_t nrc);
+        // Stops periodic transmission and any upload (S3 timeout)
+        void end_session();
+
+        const Gearbox* gearbox;
+        LiveDataSlot layout[MAX_LIVE_DATA_FIELDS];
+        uint8_t num_slots = 0;
+        // Length of the live data record response, including the service ID and local ID
+        uint16_t live_data_len = 2;
+        // Periodic transmission (0 if stopped)
+        uint32_t period_us = 0;
+        uint64_t next_periodic_time = 0;
+        // True between RequestUpload and RequestTransferExit
+        bool upload_active = false;
+        // Time of the last request from the tester (For S3)
+        uint64_t last_request_time = 0;
+};
+
+#endif // __KWP2000_H_
@@ -1,5 +1,6 @@
 #include "gearbox.h"
 #include "scn.h"
+#include "canbus/can_recorder.h"
 
 
 const float diff_ratio_f = (float)DIFF_RATIO / 1000.0;
@@ -7,6 +8,15 @@ const float diff_ratio_f = (float)DIFF_RATIO / 1000.0;
 #define X_SIZE 12
 #define Y_SIZE 14
 
+// Oldest CAN data (ms) the controller works on. The pedal is 100ms, as it is used for torque converter lockup
+const VehicleSnapshotExpiry SNAPSHOT_EXPIRY = {
+    .wheels_ms = 250,
+    .engine_rpm_ms = 250,
+    .shifter_position_ms = 250,
+    .pedal_ms = 100,
+    .engine_coolant_temp_ms = 250
+};
+
 Gearbox::Gearbox() {
     this->current_profile = nullptr;
     egs_can_hal->set_drive_profile(GearboxProfile::Underscore); // Uninitialized
@@ -399,21 +409,24 @@ void Gearbox::controller_loop() {
     ESP_LOGI("GEARBOX", "GEARBOX START!");
     while(1) {
         uint64_t now = esp_timer_get_time();
-        bool can_read = this->calc_input_rpm(&rpm) && this->calc_output_rpm(&output_rpm, now);
+        // Read everything we need off the CANBUS once, so the whole tick works on the same data
+        egs_can_hal->get_vehicle_snapshot(now, &SNAPSHOT_EXPIRY, &this->snapshot);
+        bool can_read = this->calc_input_rpm(&rpm, now) && this->calc_output_rpm(&output_rpm, now);
         egs_can_hal->set_input_shaft_speed(rpm);
         if (can_read && output_rpm >= 100) {
             bool rev = !is_fwd_gear(this->target_gear);
             if (!this->calcGearFromRatio(rpm, output_rpm, rev)) {
                 //ESP_LOGE("GEARBOX", "GEAR RATIO IMPLAUSIBLE");
+                if (!this->shifting && this->target_gear == this->actual_gear) {
+                    can_recorder.trigger(RecorderTrigger::ImplausibleRatio);
+                }
             }
         }
-        eng_rpm = egs_can_hal->get_engine_rpm(now, 250);
-        if (eng_rpm == UINT16_MAX) {
-            eng_rpm = 0;
-        }
+        eng_rpm = this->snapshot.is_valid(SNAPSHOT_ENGINE_RPM) ? this->snapshot.engine_rpm : 0;
+        this->tcc_slip = (int16_t)(eng_rpm - rpm);
         if (Sensors::parking_lock_engaged(&lock_state)) {
             egs_can_hal->set_safe_start(lock_state);
-            ShifterPosition pos = egs_can_hal->get_shifter_position_ewm(now, 250);
+            ShifterPosition pos = this->snapshot.shifter_position;
             if (
                 pos == ShifterPosition::P || // Only obide by definitive positions for now, no intermittent once
                 pos == ShifterPosition::R ||
@@ -458,9 +471,8 @@ void Gearbox::controller_loop() {
                     }
                 }
                 if (can_read) {
-                    uint8_t p_tmp = egs_can_hal->get_pedal_value(now, 100);
-                    if (p_tmp != 0xFF) {
-                        pedal = p_tmp;
+                    if (this->snapshot.is_valid(SNAPSHOT_PEDAL)) {
+                        pedal = this->snapshot.pedal;
                     }
                     if (!Sensors::read_vbatt(&voltage)) {
                         voltage = 12000;
@@ -490,13 +502,13 @@ void Gearbox::controller_loop() {
             sol_y4->write_pwm(0);
             sol_y5->write_pwm(0);
         }
-        if (!Sensors::read_atf_temp(&atf_temp)) {
+        if (!Sensors::read_atf_temp(&atf_temp) && this->snapshot.is_valid(SNAPSHOT_ENGINE_COOLANT_TEMP)) {
             // Default to engine coolant
-            atf_temp = (egs_can_hal->get_engine_coolant_temp(now, 250))*10;
+            atf_temp = this->snapshot.engine_coolant_temp*10;
         }
         this->temp_raw = atf_temp;
         egs_can_hal->set_gearbox_temperature(atf_temp/10);
-        egs_can_hal->set_shifter_position(egs_can_hal->get_shifter_position_ewm(now, 250));
+        egs_can_hal->set_shifter_position(this->snapshot.shifter_position);
 
         egs_can_hal->set_target_gear(this->target_gear);
         egs_can_hal->set_actual_gear(this->actual_gear);
@@ -510,7 +522,7 @@ void Gearbox::controller_loop() {
     }
 }
 
-bool Gearbox::calc_input_rpm(uint32_t* dest) {
+bool Gearbox::calc_input_rpm(uint32_t* dest, uint64_t now) {
     uint32_t n2 = Sensors::read_n2_rpm();
     if (n2 < 50) { // Skip erroneous pulses
         n2 = 0;
@@ -519,6 +531,8 @@ bool Gearbox::calc_input_rpm(uint32_t* dest) {
     if (n3 < 50) { // Skip erroneous pulses
         n3 = 0;
     }
+    this->n2_estimator.update(n2, now);
+    this->n3_estimator.update(n3, now);
     // Compare N2 and N3 sensors based on our TARGET gear
     if (this->actual_gear == GearboxGear::Neutral || this->actual_gear == GearboxGear::Park) { 
         if (n3 < 100 && n2 != 0) {
@@ -535,6 +549,7 @@ bool Gearbox::calc_input_rpm(uint32_t* dest) {
             n2 *= 1.64;
             if (n2 > OVERSPEED_RPM) {
                 ESP_LOGE("CALC_INPUT_RPM", "N2 overspeed detected!");
+                can_recorder.trigger(RecorderTrigger::Overspeed);
                 return false;
             } else {
                 *dest = n2;
@@ -544,6 +559,7 @@ bool Gearbox::calc_input_rpm(uint32_t* dest) {
         case GearboxGear::Reverse_Second:
             if (n3 > OVERSPEED_RPM) {
                 ESP_LOGE("CALC_INPUT_RPM", "N3 overspeed detected!");
+                can_recorder.trigger(RecorderTrigger::Overspeed);
                 return false;
             } else {
                 *dest = n3;
@@ -553,6 +569,7 @@ bool Gearbox::calc_input_rpm(uint32_t* dest) {
             // Compare both!
             if (n2 > OVERSPEED_RPM || n3 > OVERSPEED_RPM) {
                 ESP_LOGE("CALC_INPUT_RPM", "N2 or N3 overspeed detected!");
+                can_recorder.trigger(RecorderTrigger::Overspeed);
                 return false;
             }
             // Rational check
@@ -575,8 +592,8 @@ bool Gearbox::calc_input_rpm(uint32_t* dest) {
 }
 
 bool Gearbox::calc_output_rpm(uint32_t* dest, uint64_t now) {
-    WheelData left = egs_can_hal->get_rear_left_wheel(now, 250);
-    WheelData right = egs_can_hal->get_rear_right_wheel(now, 250);
+    WheelData left = this->snapshot.rear_left_wheel;
+    WheelData right = this->snapshot.rear_right_wheel;
     //ESP_LOGI("WRPM","R:(%d %d) L:(%d %d)", (int)right.current_dir, right.double_rpm, (int)left.current_dir, left.double_rpm);
     float rpm = 0;
     if (left.current_dir == WheelDirection::SignalNotAvaliable && right.current_dir == WheelDirection::SignalNotAvaliable) {
@@ -594,6 +611,7 @@ bool Gearbox::calc_output_rpm(uint32_t* dest, uint64_t now) {
     rpm *= diff_ratio_f;
     rpm /= 2;
     *dest = rpm;
+    this->output_estimator.update(fabsf(rpm), now);
     return true;
 }
 
@@ -4,9 +4,10 @@
 #define __GEARBOX_H_
 
 #include <stdint.h>
-#include "canbus/can_hal.h"
+#include "canbus/egs_can_hal.h"
 #include "solenoids/solenoids.h"
 #include "sensors.h"
+#include "shaft_estimator.h"
 #include "profiles.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -19,6 +20,15 @@
 
 #define OVERSPEED_RPM 10000
 
+// Shaft speed estimators (See shaft_estimator.h). N2/N3 measure every tooth, so are trusted more than
+// the output shaft, which comes from the wheel speeds on CAN
+#define N2_N3_ESTIMATOR_ALPHA 0.6f
+#define N2_N3_ESTIMATOR_BETA 0.25f
+#define N2_N3_NOISE_RPM 15.0f
+#define OUTPUT_ESTIMATOR_ALPHA 0.5f
+#define OUTPUT_ESTIMATOR_BETA 0.15f
+#define OUTPUT_NOISE_RPM 30.0f
+
 //#define LARGE_NAG
 
 // https://en.wikipedia.org/wiki/Mercedes-Benz_5G-Tronic_transmission
@@ -65,6 +75,17 @@ public:
     bool start_controller();
     void inc_gear_request();
     void dec_gear_request();
+    // Live state, for diagnostics
+    GearboxGear get_target_gear() const { return this->target_gear; }
+    GearboxGear get_actual_gear() const { return this->actual_gear; }
+    // ATF temperature (x10 C)
+    int16_t get_atf_temp() const { return (int16_t)this->temp_raw; }
+    // Engine RPM - input shaft RPM
+    int16_t get_tcc_slip() const { return this->tcc_slip; }
+    // Speed, acceleration and confidence of each shaft, as of the last controller tick
+    ShaftEstimate get_n2_estimate(uint64_t now) const { return this->n2_estimator.get(now); }
+    ShaftEstimate get_n3_estimate(uint64_t now) const { return this->n3_estimator.get(now); }
+    ShaftEstimate get_output_estimate(uint64_t now) const { return this->output_estimator.get(now); }
 private:
 
     bool calcGearFromRatio(uint32_t input_rpm, uint32_t output_rpm, bool is_reverse);
@@ -74,7 +95,7 @@ private:
     GearboxGear target_gear = GearboxGear::SignalNotAvaliable;
     GearboxGear actual_gear = GearboxGear::SignalNotAvaliable;
     GearboxGear min_fwd_gear = GearboxGear::First;
-    bool calc_input_rpm(uint32_t* dest);
+    bool calc_input_rpm(uint32_t* dest, uint64_t now);
     bool calc_output_rpm(uint32_t* dest, uint64_t now);
     [[noreturn]]
     void controller_loop();
@@ -90,12 +111,19 @@ private:
         static_cast<Gearbox*>(_this)->controller_loop();
     }
     uint16_t temp_raw = 0;
+    // CAN data for the current controller tick. Only the controller task writes this
+    VehicleSnapshot snapshot;
     TaskHandle_t shift_task = nullptr;
     bool shifting = false;
     bool ask_upshift = false;
     bool ask_downshift = false;
     uint16_t tcc_perc = 0;
+    int16_t tcc_slip = 0;
     uint8_t est_gear_idx = 0;
+    // Updated by the controller task every time it reads the shaft
+    ShaftEstimator n2_estimator{N2_N3_ESTIMATOR_ALPHA, N2_N3_ESTIMATOR_BETA, N2_N3_NOISE_RPM};
+    ShaftEstimator n3_estimator{N2_N3_ESTIMATOR_ALPHA, N2_N3_ESTIMATOR_BETA, N2_N3_NOISE_RPM};
+    ShaftEstimator output_estimator{OUTPUT_ESTIMATOR_ALPHA, OUTPUT_ESTIMATOR_BETA, OUTPUT_NOISE_RPM};
 };
 
 typedef int PressureMap[13][11];
@@ -0,0 +1,54 @@
+#include "input_manager.h"
+#include "esp_timer.h"
+
+void input_manager(void* params) {
+    InputManagerConfig* cfg = (InputManagerConfig*)params;
+    Gearbox* gearbox = cfg->gearbox;
+    uint8_t profile_id = 0;
+    bool pressed = false;
+    PaddlePosition last_pos = PaddlePosition::None;
+    ShifterPosition slast_pos = ShifterPosition::SignalNotAvaliable;
+    while(1) {
+        uint64_t now = esp_timer_get_time();
+        bool down = egs_can_hal->get_profile_btn_press(now, 100);
+        if (down) {
+            pressed = true;
+        } else { // Released
+            if (pressed) {
+                pressed = false; // Released, do thing now
+                if (egs_can_hal->get_shifter_position_ewm(now, 100) == ShifterPosition::PLUS) {
+                    gearbox->inc_subprofile();
+                } else {
+                    profile_id++;
+                    if (profile_id == cfg->num_profiles) {
+                        profile_id = 0;
+                    }
+                    gearbox->set_profile(cfg->profiles[profile_id]);
+                }
+            }
+        }
+        PaddlePosition paddle = egs_can_hal->get_paddle_position(now, 100);
+        if (last_pos != paddle) { // Same position, ignore
+            if (last_pos != PaddlePosition::None) {
+                // Process last request of the user
+                if (last_pos == PaddlePosition::Plus) {
+                    gearbox->inc_gear_request();
+                } else if (last_pos == PaddlePosition::Minus) {
+                    gearbox->dec_gear_request();
+                }
+            }
+            last_pos = paddle;
+        }
+        ShifterPosition spos = egs_can_hal->get_shifter_position_ewm(now, 100);
+        if (spos != slast_pos) { // Same position, ignore
+            // Process last request of the user
+            if (slast_pos == ShifterPosition::PLUS) {
+                gearbox->inc_gear_request();
+            } else if (slast_pos == ShifterPosition::MINUS) {
+                gearbox->dec_gear_request();
+            }
+            slast_pos = spos;
+        }
+        vTaskDelay(20);
+    }
+}
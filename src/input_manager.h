@@ -0,0 +1,25 @@
+/**
+ * Input manager task
+ *
+ * Turns the drive program button, the steering wheel paddles and +/- on the
+ * selector lever into profile changes and gear requests for the gearbox controller
+ */
+
+#ifndef __INPUT_MANAGER_H_
+#define __INPUT_MANAGER_H_
+
+#include <stdint.h>
+#include "gearbox.h"
+#include "profiles.h"
+
+typedef struct {
+    Gearbox* gearbox;
+    // Profiles the drive program button cycles through (profiles[0] is the one the gearbox starts in)
+    AbstractProfile** profiles;
+    uint8_t num_profiles;
+} InputManagerConfig;
+
+// Task entry point. 'params' is an InputManagerConfig, which must outlive the task
+void input_manager(void* params);
+
+#endif // __INPUT_MANAGER_H_
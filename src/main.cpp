@@ -1,18 +1,39 @@
 #include "scn.h"
 #include "solenoids/solenoids.h"
 #include "esp_log.h"
+#include <inttypes.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <esp32/ulp.h>
 #include "speaker.h"
 #include "sensors.h"
-#include "canbus/can_egs52.h"
+#include "canbus/egs_can_hal.h"
+#include "canbus/can_recorder.h"
 #include "gearbox.h"
+#include "diag/kwp2000.h"
 #include "dtcs.h"
+#include "input_manager.h"
 
 #define NUM_PROFILES 5 // A, C, W, M, S
 
 Gearbox* gearbox;
+Kwp2000Server* diag_server;
+
+// Live data sent by KWP2000 ReadDataByLocalIdentifier (0x21 0x30)
+const LiveDataField LIVE_DATA_FIELDS[] = {
+    LiveDataField::N2Rpm,
+    LiveDataField::N3Rpm,
+    LiveDataField::Y3Current,
+    LiveDataField::Y4Current,
+    LiveDataField::Y5Current,
+    LiveDataField::MpcCurrent,
+    LiveDataField::SpcCurrent,
+    LiveDataField::TccCurrent,
+    LiveDataField::AtfTemp,
+    LiveDataField::TargetGear,
+    LiveDataField::ActualGear,
+    LiveDataField::TccSlip,
+};
 
 AgilityProfile* agility;
 ComfortProfile* comfort;
@@ -20,13 +41,17 @@ WinterProfile* winter;
 ManualProfile* manual;
 StandardProfile* standard;
 
-uint8_t profile_id = 0;
 AbstractProfile* profiles[NUM_PROFILES];
+InputManagerConfig input_config;
 
 SPEAKER_POST_CODE setup_tcm()
 {
+    can_recorder.init(); // Before the CAN tasks start, so we record from the first frame
 #ifdef EGS52_MODE
     egs_can_hal = new Egs52Can("EGS52", 20); // EGS52 CAN Abstraction layer
+#endif
+#ifdef EGS53_MODE
+    egs_can_hal = new Egs53Can("EGS53", 20); // EGS53 CAN Abstraction layer
 #endif
     if (!egs_can_hal->begin_tasks()) {
         return SPEAKER_POST_CODE::CAN_FAIL;
@@ -56,6 +81,8 @@ SPEAKER_POST_CODE setup_tcm()
         return SPEAKER_POST_CODE::CONTROLLER_FAIL;
     }
     gearbox->set_profile(profiles[0]);
+    diag_server = new Kwp2000Server(gearbox, LIVE_DATA_FIELDS, sizeof(LIVE_DATA_FIELDS)/sizeof(LiveDataField));
+    egs_can_hal->set_diag_server(diag_server);
     return SPEAKER_POST_CODE::INIT_OK;
 }
 
@@ -66,6 +93,7 @@ void err_beep_loop(void* a) {
         vTaskDelete(NULL);
     } else {
         // An error has occurred
+        can_recorder.trigger(RecorderTrigger::Fault);
         // Set gearbox to F mode
         egs_can_hal->set_drive_profile(GearboxProfile::Failure);
         egs_can_hal->set_display_msg(GearboxMessage::VisitWorkshop);
@@ -84,6 +112,12 @@ void printer(void*) {
     bool parking;
     uint32_t n2;
     uint32_t n3;
+    uint8_t loops = 0;
+    uint32_t can_id;
+    FrameArrivalStats frame_stats;
+    TxFrameStats tx_stats;
+    RpmIsrStats n2_isr;
+    RpmIsrStats n3_isr;
     //spkr.broadcast_error_code(DtcCode::P2005);
     //spkr.broadcast_error_code(DtcCode::P2564);
     while(1) {
@@ -109,56 +143,47 @@ void printer(void*) {
             n2, n3,
             taken
         );
-        vTaskDelay(1000);
-    }
-}
-
-void input_manager(void*) {
-    bool pressed = false;
-    PaddlePosition last_pos = PaddlePosition::None;
-    ShifterPosition slast_pos = ShifterPosition::SignalNotAvaliable;
-    while(1) {
-        uint64_t now = esp_timer_get_time();
-        bool down = egs_can_hal->get_profile_btn_press(now, 100);
-        if (down) {
-            pressed = true;
-        } else { // Released
-            if (pressed) {
-                pressed = false; // Released, do thing now
-                if (egs_can_hal->get_shifter_position_ewm(now, 100) == ShifterPosition::PLUS) {
-                    gearbox->inc_subprofile();
-                } else {
-                    profile_id++;
-                    if (profile_id == NUM_PROFILES) {
-                        profile_id = 0;
-                    }
-                    gearbox->set_profile(profiles[profile_id]);  
+        CanRxStats can_stats = egs_can_hal->get_rx_stats();
+        ESP_LOGI("MAIN", "CAN Rx: %" PRIu32 " frames, %" PRIu32 " dropped, %" PRIu32 " rejected, %" PRIu32 " Rx queue overflows", can_stats.rx_count, can_stats.dropped_count, can_stats.rejected_count, can_stats.rx_queue_overflow_count);
+        ESP_LOGI("MAIN", "CAN Rx ring: %" PRIu32 " overflows, high water %" PRIu32 "/%" PRIu32 ". Drain latency (us) last %" PRIu32 ", max %" PRIu32, can_stats.ring_overflow_count, can_stats.ring_high_water, can_stats.ring_size, can_stats.last_drain_latency_us, can_stats.max_drain_latency_us);
+        if (++loops == 10) { // Dump per frame arrival stats every 10 seconds
+            loops = 0;
+            Sensors::get_rpm_isr_stats(&n2_isr, &n3_isr);
+            ESP_LOGI("MAIN", "N2 ISR: %" PRIu32 " runs, CPU cycles last %" PRIu32 ", max %" PRIu32 ". N3 ISR: %" PRIu32 " runs, CPU cycles last %" PRIu32 ", max %" PRIu32,
+                n2_isr.count, n2_isr.last_cycles, n2_isr.max_cycles, n3_isr.count, n3_isr.last_cycles, n3_isr.max_cycles);
+            for (uint8_t i = 0; i < egs_can_hal->get_num_rx_frames(); i++) {
+                if (egs_can_hal->get_rx_frame_stats(i, &can_id, &frame_stats)) {
+                    ESP_LOGI(
+                        "MAIN",
+                        "CAN 0x%03" PRIX32 ": %" PRIu32 " frames, %" PRIu32 " rejected. Interval (us) last %" PRIu32 ", min %" PRIu32 ", max %" PRIu32 ", avg %" PRIu32 ". Stale %" PRIu32 " times",
+                        can_id,
+                        frame_stats.rx_count,
+                        frame_stats.rejected_count,
+                        frame_stats.last_interval,
+                        frame_stats.min_interval,
+                        frame_stats.max_interval,
+                        frame_stats.ewma_interval,
+                        frame_stats.stale_count
+                    );
                 }
             }
-        }
-        PaddlePosition paddle = egs_can_hal->get_paddle_position(now, 100);
-        if (last_pos != paddle) { // Same position, ignore
-            if (last_pos != PaddlePosition::None) {
-                // Process last request of the user
-                if (last_pos == PaddlePosition::Plus) {
-                    gearbox->inc_gear_request();
-                } else if (last_pos == PaddlePosition::Minus) {
-                    gearbox->dec_gear_request();
+            for (uint8_t i = 0; i < egs_can_hal->get_num_tx_frames(); i++) {
+                if (egs_can_hal->get_tx_frame_stats(i, &can_id, &tx_stats)) {
+                    ESP_LOGI(
+                        "MAIN",
+                        "CAN Tx 0x%03" PRIX32 ": %" PRIu32 " frames, %" PRIu32 " out of cycle, %" PRIu32 " failed. Deadlines missed %" PRIu32 ". Lateness (us) last %" PRIu32 ", max %" PRIu32,
+                        can_id,
+                        tx_stats.tx_count,
+                        tx_stats.urgent_count,
+                        tx_stats.failed_count,
+                        tx_stats.missed_count,
+                        tx_stats.last_jitter,
+                        tx_stats.max_jitter
+                    );
                 }
             }
-            last_pos = paddle;
         }
-        ShifterPosition spos = egs_can_hal->get_shifter_position_ewm(now, 100);
-        if (spos != slast_pos) { // Same position, ignore
-            // Process last request of the user
-            if (slast_pos == ShifterPosition::PLUS) {
-                gearbox->inc_gear_request();
-            } else if (slast_pos == ShifterPosition::MINUS) {
-                gearbox->dec_gear_request();
-            }
-            slast_pos = spos;
-        }
-        vTaskDelay(20);
+        vTaskDelay(1000);
     }
 }
 
@@ -191,7 +216,12 @@ extern "C" void app_main(void)
             vTaskDelay(1000);
         }
     } else { // INIT OK!
-        xTaskCreate(input_manager, "INPUT_MANAGER", 8192, nullptr, 5, nullptr);
+        input_config = InputManagerConfig {
+            .gearbox = gearbox,
+            .profiles = profiles,
+            .num_profiles = NUM_PROFILES
+        };
+        xTaskCreate(input_manager, "INPUT_MANAGER", 8192, &input_config, 5, nullptr);
         xTaskCreate(printer, "PRINTER", 4096, nullptr, 2, nullptr);
     }
 }
\ No newline at end of file
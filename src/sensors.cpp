@@ -6,12 +6,23 @@
 #include "freertos/task.h"
 #include "freertos/semphr.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "pins.h"
+#include "edge_speed.h"
+#include "seqlock.h"
+#include "xtensa/core-macros.h"
 
 #define PULSES_PER_REV 60 // N2 and N3 are 60 pulses per revolution
 #define SAMPLES_PER_REVOLUTION 8
 #define AVERAGE_SAMPLES 3
 
+// Timestamp every N2/N3 edge with a GPIO interrupt (See edge_speed.h), so speed updates every tooth.
+// Build with -DRPM_PCNT_CAPTURE (build_flags in platformio.ini) to go back to timestamping every
+// PULSES_PER_REV / SAMPLES_PER_REVOLUTION edges with PCNT
+#ifndef RPM_PCNT_CAPTURE
+#define RPM_EDGE_CAPTURE
+#endif
+
 #define LOG_TAG "SENSORS"
 
 #define CHECK_ESP_FUNC(x, msg, ...) \
@@ -21,6 +32,7 @@ if (res != ESP_OK) { \
     return false; \
 }   \
 
+#ifndef RPM_EDGE_CAPTURE
 const pcnt_unit_t PCNT_N2_RPM = PCNT_UNIT_0;
 const pcnt_unit_t PCNT_N3_RPM = PCNT_UNIT_1;
 
@@ -51,6 +63,7 @@ const pcnt_config_t pcnt_cfg_n3 {
     .channel = PCNT_CHANNEL_0
 };
 
+// Working state of a PCNT ISR (Only the ISR touches it)
 struct RpmSampleData {
     uint64_t samples[AVERAGE_SAMPLES];
     uint64_t total;
@@ -59,6 +72,13 @@ struct RpmSampleData {
     uint64_t last_time;
 };
 
+// What the PCNT ISR publishes for readers after every sample
+typedef struct {
+    uint64_t total;
+    uint64_t last_time;
+} RpmSample;
+#endif
+
 typedef struct {
     // Voltage in mV
     uint16_t v; 
@@ -99,8 +119,66 @@ const static temp_reading_t atf_temp_lookup[NUM_TEMP_POINTS] = {
 
 esp_adc_cal_characteristics_t adc2_cal = {};
 
-portMUX_TYPE n2_mux = portMUX_INITIALIZER_UNLOCKED;
-portMUX_TYPE n3_mux = portMUX_INITIALIZER_UNLOCKED;
+// ATF temperature (x10 C) of every raw ADC2 reading. The calibration curve is different on each chip,
+// so this is built at boot (From the curve and atf_temp_lookup), after which a conversion is just a load
+#define ATF_TEMP_TABLE_SIZE 4096
+static int16_t atf_temp_table[ATF_TEMP_TABLE_SIZE];
+
+// ADC2 sampler: Every ADC_SAMPLE_INTERVAL_MS, ATF and VBATT are each converted ADC_OVERSAMPLES times and averaged,
+// then low pass filtered (Each tick moves the filter 1/2^shift of the way to the new average)
+#define ADC_SAMPLE_INTERVAL_MS 10
+#define ADC_OVERSAMPLES 8
+#define ATF_FILTER_SHIFT 3 // About 80ms (ATF temperature changes slowly)
+#define VBATT_FILTER_SHIFT 1 // About 20ms (Follows cranking dips)
+// Readings older than this are not returned (Sampler has stopped, or every conversion is failing)
+#define ADC_MAX_AGE_US 100000
+// ATF pin reads at least this much with the parking lock engaged (Temperature cannot be read then)
+#define PARKING_LOCK_RAW 3900
+
+// Latest ADC2 readings. Only the sampler task writes these
+typedef struct {
+    // Time of the last good VBATT / ATF conversions (0 if there have been none)
+    uint64_t vbatt_time;
+    uint64_t atf_time;
+    uint16_t vbatt_mv;
+    bool parking_lock;
+    // ATF temperature (x10 C). Not valid whilst the parking lock is engaged
+    int atf_temp;
+} AdcReadings;
+
+Seqlock<AdcReadings> adc_readings;
+
+// Written only by the N2 / N3 ISR
+RpmIsrStats n2_isr_stats = {};
+RpmIsrStats n3_isr_stats = {};
+
+// Call at the end of an ISR that started at CPU cycle 'start'
+#define RECORD_ISR_TIME(STATS, START) \
+    uint32_t cycles = XTHAL_GET_CCOUNT() - START; \
+    (STATS)->count++; \
+    (STATS)->last_cycles = cycles; \
+    if (cycles > (STATS)->max_cycles) { \
+        (STATS)->max_cycles = cycles; \
+    } \
+
+#ifdef RPM_EDGE_CAPTURE
+EdgeRing n2_edges;
+EdgeRing n3_edges;
+
+static void IRAM_ATTR on_n2_edge(void* args) {
+    uint32_t start = XTHAL_GET_CCOUNT();
+    edge_ring_push(&n2_edges, esp_timer_get_time());
+    RECORD_ISR_TIME(&n2_isr_stats, start);
+}
+
+static void IRAM_ATTR on_n3_edge(void* args) {
+    uint32_t start = XTHAL_GET_CCOUNT();
+    edge_ring_push(&n3_edges, esp_timer_get_time());
+    RECORD_ISR_TIME(&n3_isr_stats, start);
+}
+#else
+Seqlock<RpmSample> n2_published;
+Seqlock<RpmSample> n3_published;
 
 RpmSampleData n2_samples = {
     .samples = {0},
@@ -118,8 +196,8 @@ RpmSampleData n3_samples = {
     .last_time = 0
 };
 
-#define WRITE_PULSES(MUX, SAMPLE) \
-    portENTER_CRITICAL(MUX); \
+// Each ISR is the only writer of its samples, so it never has to wait for a reader
+#define WRITE_PULSES(SAMPLE, PUBLISHED) \
     RpmSampleData* s = SAMPLE; \
     uint64_t now = esp_timer_get_time(); \
     s->total -= s->samples[s->sample_id]; \
@@ -128,14 +206,113 @@ RpmSampleData n3_samples = {
     s->sample_id = ((s->sample_id)+1) % AVERAGE_SAMPLES; \
     s->total += s->delta; \
     s->last_time = now; \
-    portEXIT_CRITICAL(MUX); \
+    (PUBLISHED)->write(RpmSample { .total = s->total, .last_time = s->last_time }); \
 
 static void IRAM_ATTR on_pcnt_overflow_n2(void* args) {
-    WRITE_PULSES(&n2_mux, &n2_samples);
+    uint32_t start = XTHAL_GET_CCOUNT();
+    WRITE_PULSES(&n2_samples, &n2_published);
+    RECORD_ISR_TIME(&n2_isr_stats, start);
 }
 
 static void IRAM_ATTR on_pcnt_overflow_n3(void* args) {
-    WRITE_PULSES(&n3_mux, &n3_samples);
+    uint32_t start = XTHAL_GET_CCOUNT();
+    WRITE_PULSES(&n3_samples, &n3_published);
+    RECORD_ISR_TIME(&n3_isr_stats, start);
+}
+#endif
+
+// Converts a raw ATF reading to temperature (x10 C) through the ADC calibration curve.
+// Only used to build atf_temp_table
+static int calc_atf_temp(uint32_t raw) {
+    uint32_t tmp = esp_adc_cal_raw_to_voltage(raw, &adc2_cal);
+    if (tmp < atf_temp_lookup[0].v) {
+        return atf_temp_lookup[0].temp;
+    } else if (tmp > atf_temp_lookup[NUM_TEMP_POINTS-1].v) {
+        return atf_temp_lookup[NUM_TEMP_POINTS-1].temp;
+    } else {
+        for (uint8_t i = 0; i < NUM_TEMP_POINTS-1; i++) {
+            // Found! Interpolate linearly to get a better estimate of ATF Temp
+            if (atf_temp_lookup[i].v <= tmp && atf_temp_lookup[i+1].v >= tmp) {
+                float dx = tmp - atf_temp_lookup[i].v;
+                float dy = atf_temp_lookup[i+1].v - atf_temp_lookup[i].v;
+                return atf_temp_lookup[i].temp + (atf_temp_lookup[i+1].temp-atf_temp_lookup[i].temp) * ((dx)/dy);
+            }
+        }
+        return atf_temp_lookup[NUM_TEMP_POINTS-1].temp;
+    }
+}
+
+// Averages ADC_OVERSAMPLES conversions of 'channel' into 'dest'. Returns false if they all failed
+static bool adc2_oversample(adc2_channel_t channel, uint32_t* dest) {
+    uint32_t total = 0;
+    uint8_t count = 0;
+    int raw;
+    for (uint8_t i = 0; i < ADC_OVERSAMPLES; i++) {
+        if (adc2_get_raw(channel, ADC2_WIDTH, &raw) == ESP_OK) {
+            total += raw;
+            count++;
+        }
+    }
+    if (count == 0) {
+        return false;
+    }
+    *dest = total / count;
+    return true;
+}
+
+// The only user of ADC2. Samples ATF and VBATT at a fixed rate, and publishes the filtered readings
+static void adc2_sampler(void*) {
+    AdcReadings readings = {};
+    // Filtered raw readings, scaled up by 2^shift so the filter does not lose the low bits
+    uint32_t atf_filtered = 0;
+    uint32_t vbatt_filtered = 0;
+    bool atf_ok = true;
+    bool vbatt_ok = true;
+    uint32_t raw;
+    TickType_t last_wake = xTaskGetTickCount();
+    while (true) {
+        uint64_t now = esp_timer_get_time();
+        if (adc2_oversample(ADC_CHANNEL_VBATT, &raw)) {
+            if (readings.vbatt_time == 0) {
+                vbatt_filtered = raw << VBATT_FILTER_SHIFT;
+            } else {
+                vbatt_filtered += raw - (vbatt_filtered >> VBATT_FILTER_SHIFT);
+            }
+            // Vin = Vout(R1+R2)/R2
+            readings.vbatt_mv = esp_adc_cal_raw_to_voltage(vbatt_filtered >> VBATT_FILTER_SHIFT, &adc2_cal)*5.54; // 5.54 = (100+22)/22
+            readings.vbatt_time = now;
+            vbatt_ok = true;
+        } else if (vbatt_ok) {
+            ESP_LOGW(LOG_TAG, "Failed to query VBATT");
+            vbatt_ok = false;
+        }
+        // Parking lock and temperature both come from the same conversions of the ATF pin
+        if (adc2_oversample(ADC_CHANNEL_ATF, &raw)) {
+            bool was_locked = readings.parking_lock;
+            readings.parking_lock = raw >= PARKING_LOCK_RAW;
+            if (!readings.parking_lock) {
+                // The pin reads nothing like the temperature whilst locked, so start the filter again after
+                if (readings.atf_time == 0 || was_locked) {
+                    atf_filtered = raw << ATF_FILTER_SHIFT;
+                } else {
+                    atf_filtered += raw - (atf_filtered >> ATF_FILTER_SHIFT);
+                }
+                readings.atf_temp = atf_temp_table[atf_filtered >> ATF_FILTER_SHIFT];
+            }
+            readings.atf_time = now;
+            atf_ok = true;
+        } else if (atf_ok) {
+            ESP_LOGW(LOG_TAG, "Failed to query ATF temp / parking lock");
+            atf_ok = false;
+        }
+        adc_readings.write(readings);
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(ADC_SAMPLE_INTERVAL_MS));
+    }
+}
+
+// True if an ADC2 reading taken at 'time' is recent enough to use
+static bool adc_reading_fresh(uint64_t time) {
+    return time != 0 && esp_timer_get_time() - time <= ADC_MAX_AGE_US;
 }
 
 bool Sensors::init_sensors(){
@@ -155,7 +332,23 @@ bool Sensors::init_sensors(){
 
     // Characterise ADC2
     esp_adc_cal_characterize(adc_unit_t::ADC_UNIT_2, ADC2_ATTEN, ADC2_WIDTH, 0, &adc2_cal);
+    for (uint32_t raw = 0; raw < ATF_TEMP_TABLE_SIZE; raw++) {
+        atf_temp_table[raw] = calc_atf_temp(raw);
+    }
+    // Only the sampler task touches ADC2 from now on
+    if (xTaskCreate(adc2_sampler, "ADC2_SAMPLER", 4096, nullptr, 5, nullptr) != pdPASS) {
+        ESP_LOGE(LOG_TAG, "ADC2 sampler task creation failed!");
+        return false;
+    }
 
+#ifdef RPM_EDGE_CAPTURE
+    // Interrupt on every falling edge (The edge PCNT counted)
+    CHECK_ESP_FUNC(gpio_set_intr_type(PIN_N2, GPIO_INTR_NEGEDGE), "Failed to set interrupt type for N2! %s", esp_err_to_name(res))
+    CHECK_ESP_FUNC(gpio_set_intr_type(PIN_N3, GPIO_INTR_NEGEDGE), "Failed to set interrupt type for N3! %s", esp_err_to_name(res))
+    CHECK_ESP_FUNC(gpio_install_isr_service(ESP_INTR_FLAG_IRAM), "Failed to install ISR service for GPIO! %s", esp_err_to_name(res))
+    CHECK_ESP_FUNC(gpio_isr_handler_add(PIN_N2, &on_n2_edge, nullptr), "Failed to add N2 to ISR handler! %s", esp_err_to_name(res))
+    CHECK_ESP_FUNC(gpio_isr_handler_add(PIN_N3, &on_n3_edge, nullptr), "Failed to add N3 to ISR handler! %s", esp_err_to_name(res))
+#else
     // Now configure PCNT to begin counting!
     CHECK_ESP_FUNC(pcnt_unit_config(&pcnt_cfg_n2), "Failed to configure PCNT for N2 RPM reading! %s", esp_err_to_name(res))
     CHECK_ESP_FUNC(pcnt_unit_config(&pcnt_cfg_n3), "Failed to configure PCNT for N3 RPM reading! %s", esp_err_to_name(res))
@@ -188,85 +381,77 @@ bool Sensors::init_sensors(){
     // Resume counting
     CHECK_ESP_FUNC(pcnt_counter_resume(PCNT_N2_RPM), "Failed to resume PCNT N2 RPM! %s", esp_err_to_name(res))
     CHECK_ESP_FUNC(pcnt_counter_resume(PCNT_N3_RPM), "Failed to resume PCNT N3 RPM! %s", esp_err_to_name(res))
+#endif
 
     ESP_LOGI(LOG_TAG, "Sensors INIT OK!");
     return true;
 }
 
-inline uint32_t read_rpm(portMUX_TYPE* mux, RpmSampleData* sample) {
+#ifndef RPM_EDGE_CAPTURE
+inline uint32_t read_rpm(const Seqlock<RpmSample>* published) {
     uint64_t now = esp_timer_get_time();
-    portENTER_CRITICAL(mux);
-    if (now-sample->last_time > 100000) { // 100ms timeout
-        portEXIT_CRITICAL(mux);
+    RpmSample sample;
+    published->read(&sample);
+    // The ISR can publish a sample between us reading the time and reading the sample
+    if (sample.last_time < now && now-sample.last_time > 100000) { // 100ms timeout
+        return 0;
+    }
+    if (sample.total < AVERAGE_SAMPLES) {
         return 0;
     }
 #define NUMERATOR 1000000 * (PULSES_PER_REV / SAMPLES_PER_REVOLUTION)
-    uint32_t res = NUMERATOR / (sample->total / AVERAGE_SAMPLES); 
-    portEXIT_CRITICAL(mux);
-    return res;
+    return NUMERATOR / (sample.total / AVERAGE_SAMPLES);
 }
 
+#endif
+
 uint32_t Sensors::read_n2_rpm(){
-    return read_rpm(&n2_mux, &n2_samples);
+#ifdef RPM_EDGE_CAPTURE
+    return edge_ring_rpm(&n2_edges, esp_timer_get_time(), PULSES_PER_REV);
+#else
+    return read_rpm(&n2_published);
+#endif
 }
 
 uint32_t Sensors::read_n3_rpm(){
-    return read_rpm(&n3_mux, &n3_samples);
+#ifdef RPM_EDGE_CAPTURE
+    return edge_ring_rpm(&n3_edges, esp_timer_get_time(), PULSES_PER_REV);
+#else
+    return read_rpm(&n3_published);
+#endif
+}
+
+void Sensors::get_rpm_isr_stats(RpmIsrStats* n2, RpmIsrStats* n3) {
+    *n2 = n2_isr_stats;
+    *n3 = n3_isr_stats;
 }
 
 bool Sensors::read_vbatt(uint16_t *dest){
-    uint32_t v;
-    esp_err_t res = esp_adc_cal_get_voltage(adc_channel_t::ADC_CHANNEL_8, &adc2_cal, &v);
-    if (res != ESP_OK) {
-        ESP_LOGW("READ_VBATT", "Failed to query VBATT. %s", esp_err_to_name(res));
+    AdcReadings r;
+    adc_readings.read(&r);
+    if (!adc_reading_fresh(r.vbatt_time)) {
         return false;
-    } else {
-        // Vin = Vout(R1+R2)/R2
-        *dest = v*5.54; // 5.54 = (100+22)/22
-        return true;
     }
+    *dest = r.vbatt_mv;
+    return true;
 }
 
 bool Sensors::read_atf_temp(int* dest){
-    int raw;
-    esp_err_t res = adc2_get_raw(ADC_CHANNEL_ATF, ADC2_WIDTH, &raw);
-    if (res != ESP_OK) {
-        ESP_LOGW("READ_VBATT", "Failed to query ATF temp. %s", esp_err_to_name(res));
-        return false;
-    } else {
-        if (raw >= 3900) {
-            return false; // Parking lock engaged, cannot read.
-        }
-        uint32_t tmp = esp_adc_cal_raw_to_voltage(raw, &adc2_cal);
-        if (tmp < atf_temp_lookup[0].v) {
-            *dest = atf_temp_lookup[0].temp;
-            return true;
-        } else if (tmp > atf_temp_lookup[NUM_TEMP_POINTS-1].v) {
-            *dest = atf_temp_lookup[NUM_TEMP_POINTS-1].temp;
-            return true;
-        } else {
-            for (uint8_t i = 0; i < NUM_TEMP_POINTS-1; i++) {
-                // Found! Interpolate linearly to get a better estimate of ATF Temp
-                if (atf_temp_lookup[i].v <= tmp && atf_temp_lookup[i+1].v >= tmp) {
-                    float dx = tmp - atf_temp_lookup[i].v;
-                    float dy = atf_temp_lookup[i+1].v - atf_temp_lookup[i].v;
-                    *dest = atf_temp_lookup[i].temp + (atf_temp_lookup[i+1].temp-atf_temp_lookup[i].temp) * ((dx)/dy);
-                    return true;
-                }
-            }
-            return true;
-        }
+    AdcReadings r;
+    adc_readings.read(&r);
+    if (!adc_reading_fresh(r.atf_time) || r.parking_lock) {
+        return false; // Parking lock engaged, cannot read.
     }
+    *dest = r.atf_temp;
+    return true;
 }
 
 bool Sensors::parking_lock_engaged(bool* dest){
-    int raw;
-    esp_err_t res = adc2_get_raw(ADC_CHANNEL_ATF, ADC2_WIDTH, &raw);
-    if (res != ESP_OK) {
-        ESP_LOGW("READ_VBATT", "Failed to query parking lock. %s", esp_err_to_name(res));
+    AdcReadings r;
+    adc_readings.read(&r);
+    if (!adc_reading_fresh(r.atf_time)) {
         return false;
-    } else {
-        *dest = raw >= 3900;
-        return true;
     }
-}
\ No newline at end of file
+    *dest = r.parking_lock;
+    return true;
+}
@@ -3,12 +3,27 @@
 
 #include <stdint.h>
 
+// Time spent in the N2 or N3 speed sensor ISR
+typedef struct {
+    // Number of times the ISR has run
+    uint32_t count;
+    // CPU cycles the last run took
+    uint32_t last_cycles;
+    // Most CPU cycles any run has taken
+    uint32_t max_cycles;
+} RpmIsrStats;
+
 namespace Sensors {
     bool init_sensors();
 
     uint32_t read_n3_rpm();
     uint32_t read_n2_rpm();
 
+    // Gets how long the N2 and N3 ISRs take. Counters can be one ISR run apart
+    void get_rpm_isr_stats(RpmIsrStats* n2, RpmIsrStats* n3);
+
+    // These return the latest readings of the ADC2 sampler task, so never block.
+    // They return false if there is no recent reading
     bool read_vbatt(uint16_t* dest);
     bool read_atf_temp(int* dest);
 